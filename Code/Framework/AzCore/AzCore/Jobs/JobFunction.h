@@ -29,8 +29,8 @@ namespace AZ
 
         typedef const typename AZStd::remove_cv<typename AZStd::remove_reference<Function>::type>::type& FunctionCRef;
 
-        JobFunction(FunctionCRef processFunction, bool isAutoDelete, JobContext* context)
-            : Job(isAutoDelete, context)
+        JobFunction(FunctionCRef processFunction, bool isAutoDelete, JobContext* context, AZ::s8 priority = 0)
+            : Job(isAutoDelete, context, false, priority)
             , m_function(processFunction)
         {
         }
@@ -76,9 +76,10 @@ namespace AZ
 
     /// Convenience function to create (aznew JobFunction with any function signature). Delete the function with delete (or isAutoDelete set to true)
     template<class Function>
-    inline JobFunction<Function>* CreateJobFunction(const Function& processFunction, bool isAutoDelete, JobContext* context = nullptr)
+    inline JobFunction<Function>* CreateJobFunction(
+        const Function& processFunction, bool isAutoDelete, JobContext* context = nullptr, AZ::s8 priority = 0)
     {
-        return aznew JobFunction<Function>(processFunction, isAutoDelete, context);
+        return aznew JobFunction<Function>(processFunction, isAutoDelete, context, priority);
     }
 
     /// For delete symmetry
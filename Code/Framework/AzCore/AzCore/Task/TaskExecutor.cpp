@@ -271,6 +271,15 @@ namespace AZ
                     Task* task = m_queue.TryDequeue();
                     while (task)
                     {
+                        if (task->m_graph == nullptr)
+                        {
+                            // Standalone tasks submitted with TaskExecutor::SubmitTask are owned by the executor
+                            task->Invoke();
+                            delete task;
+                            task = m_queue.TryDequeue();
+                            continue;
+                        }
+
                         task->Invoke();
                         // Decrement counts for all task successors
                         for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
@@ -403,6 +412,15 @@ namespace AZ
         azfree(m_workers);
     }
 
+    uint32_t TaskExecutor::GetCurrentWorkerIndex()
+    {
+        if (Internal::TaskWorker* worker = GetTaskWorker(); worker)
+        {
+            return static_cast<uint32_t>(worker - m_workers);
+        }
+        return m_threadCount;
+    }
+
     Internal::TaskWorker* TaskExecutor::GetTaskWorker()
     {
         if (Internal::TaskWorker::t_worker && Internal::TaskWorker::t_worker->m_executor == this)
@@ -136,6 +136,22 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        // Submit a single task that isn't part of a task graph. This avoids compiling a graph for fire-and-forget work
+        // such as tasks handed over by middleware schedulers. The task is allocated from the task pool and deleted by the
+        // worker once it has run. Any synchronization with the work done by the task is up to the caller.
+        template<typename Lambda>
+        void SubmitTask(TaskDescriptor const& descriptor, Lambda&& lambda);
+
+        // Returns the number of worker threads that run submitted tasks
+        uint32_t GetThreadCount() const
+        {
+            return m_threadCount;
+        }
+
+        // Returns the index of the calling worker thread in the range [0, GetThreadCount()). Threads that aren't workers of this
+        // executor get GetThreadCount() instead. This lets tasks index per-thread scratch data without any locking.
+        uint32_t GetCurrentWorkerIndex();
+
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
     private:
@@ -156,4 +172,10 @@ namespace AZ
         // https://github.com/o3de/o3de/issues/12015
         Internal::CompiledTaskGraphTracker m_eventTracker;
     };
+
+    template<typename Lambda>
+    void TaskExecutor::SubmitTask(TaskDescriptor const& descriptor, Lambda&& lambda)
+    {
+        Submit(*aznew Internal::Task(descriptor, AZStd::forward<Lambda>(lambda)));
+    }
 } // namespace AZ
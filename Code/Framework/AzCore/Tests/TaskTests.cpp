@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -415,6 +416,61 @@ namespace UnitTest
         EXPECT_EQ(11, x);
     }
 
+    TEST_F(TaskGraphTestFixture, StandaloneTasks)
+    {
+        constexpr int TaskCount = 100;
+        AZStd::atomic<int> x = 0;
+
+        for (int i = 0; i != TaskCount; ++i)
+        {
+            m_executor->SubmitTask(
+                defaultTD,
+                [&x]
+                {
+                    ++x;
+                });
+        }
+
+        // Standalone tasks don't signal an event, so poll until they've all run. The tasks themselves are freed
+        // by the workers, which the leak detection in TearDown verifies after the executor is destroyed.
+        while (x < TaskCount)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        EXPECT_EQ(TaskCount, x);
+        EXPECT_GT(m_executor->GetThreadCount(), 0u);
+    }
+
+    TEST_F(TaskGraphTestFixture, CurrentWorkerIndex)
+    {
+        constexpr int TaskCount = 16;
+        AZStd::array<uint32_t, TaskCount> workerIndices;
+
+        TaskGraph graph{ "CurrentWorkerIndex" };
+        for (int i = 0; i != TaskCount; ++i)
+        {
+            graph.AddTask(
+                defaultTD,
+                [this, &workerIndices, i]
+                {
+                    workerIndices[i] = m_executor->GetCurrentWorkerIndex();
+                });
+        }
+
+        TaskGraphEvent ev{ "CurrentWorkerIndex Wait" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        for (uint32_t workerIndex : workerIndices)
+        {
+            EXPECT_LT(workerIndex, m_executor->GetThreadCount());
+        }
+
+        // The test thread isn't a worker
+        EXPECT_EQ(m_executor->GetThreadCount(), m_executor->GetCurrentWorkerIndex());
+    }
+
     TEST_F(TaskGraphTestFixture, ForkJoin)
     {
         AZStd::atomic<int> x = 0;
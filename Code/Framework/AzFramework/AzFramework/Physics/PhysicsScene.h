@@ -143,6 +143,8 @@ namespace AzPhysics
         //! @param sceneHandle A handle to the scene to make the scene query with.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
+        //! @note Implementations may split the requests across worker threads (see physx_parallelSceneQueryBatch),
+        //! in which case filter callbacks in the requests can be called concurrently and must be thread safe.
         virtual SceneQueryHitsList QuerySceneBatch(SceneHandle sceneHandle, const SceneQueryRequests& requests) = 0;
 
         //! Make a non-blocking query into the scene.
@@ -360,6 +362,8 @@ namespace AzPhysics
         //! Make many blocking queries into the scene.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
+        //! @note Implementations may split the requests across worker threads (see physx_parallelSceneQueryBatch),
+        //! in which case filter callbacks in the requests can be called concurrently and must be thread safe.
         virtual SceneQueryHitsList QuerySceneBatch(const SceneQueryRequests& requests) = 0;
 
         //! Make a non-blocking query into the scene.
@@ -19,6 +19,11 @@
 #include <AzFramework/Render/GeometryIntersectionStructures.h>
 #include <AzFramework/SurfaceData/SurfaceData.h>
 
+namespace AZ
+{
+    class TaskGraphEvent;
+}
+
 namespace AzFramework
 {
     namespace Terrain
@@ -26,6 +31,9 @@ namespace AzFramework
         typedef AZStd::function<void(size_t xIndex, size_t yIndex, const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)> SurfacePointRegionFillCallback;
         typedef AZStd::function<void(const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)> SurfacePointListFillCallback;
 
+        //! Callback used by QueryListIntoBuffersAsync to report that a range of the output buffers has been filled in.
+        typedef AZStd::function<void(size_t firstIndex, size_t count)> QueryBufferRangeFilledCallback;
+
         struct FloatRange
         {
             AZ_TYPE_INFO(FloatRange, "{7E6319B6-1409-4865-8AD1-6F68272A94E9}");
@@ -75,6 +83,17 @@ namespace AzFramework
             size_t m_numPointsY{ 0 }; //! The total number of points to query in the Y direction
         };
 
+        //! Caller-owned output buffers for the QueryListIntoBuffers / QueryListIntoBuffersAsync APIs.
+        //! The buffer for each requested type of data needs one entry per input position. Buffers for data that isn't requested
+        //! are ignored and can be left empty. m_terrainExists is always optional.
+        struct TerrainQueryBuffers
+        {
+            AZStd::span<float> m_heights; //! The terrain height at each position
+            AZStd::span<AZ::Vector3> m_normals; //! The terrain normal at each position
+            AZStd::span<SurfaceData::SurfaceTagWeightList> m_surfaceWeights; //! The surface weights at each position, in decreasing weight order
+            AZStd::span<bool> m_terrainExists; //! Whether or not terrain exists at each position
+        };
+
         //! A JobContext used to run jobs spawned by calls to the various Query*Async functions.
         class TerrainJobContext : public AZ::JobContext
         {
@@ -157,6 +176,20 @@ namespace AzFramework
             //! The callback function that will be invoked when a call to a Query*Async function completes.
             //! If the job is cancelled, the completion callback will not be invoked.
             QueryAsyncCompleteCallback m_completionCallback = nullptr;
+
+            //! The priority of the async terrain request jobs, from -128 (lowest) to 127 (highest).
+            //! Higher priority requests are started ahead of any lower priority work that hasn't started yet.
+            AZ::s8 m_priority = 0;
+
+            //! Optional event that QueryListIntoBuffersAsync signals once all of its work has finished, including when it was cancelled.
+            //! Requests with an event run on the task graph, so the task graph system needs to be active to use this.
+            //! The event needs to outlive the request.
+            AZ::TaskGraphEvent* m_completionEvent = nullptr;
+
+            //! Optional callback that QueryListIntoBuffersAsync invokes each time a range of the output buffers has been filled in,
+            //! so that callers can start consuming the results before the entire request has completed.
+            //! The callback isn't invoked for ranges that were skipped because the request was cancelled.
+            QueryBufferRangeFilledCallback m_rangeFilledCallback = nullptr;
         };
 
         //! Shared interface for terrain system implementations
@@ -199,6 +232,11 @@ namespace AzFramework
             // Returns true if any terrain area spawner intersects with the provided bounds
             virtual bool TerrainAreaExistsInBounds(const AZ::Aabb& bounds) const = 0;
 
+            //! Returns the range of terrain heights over the XY area of the given region, or a null range if the region isn't valid.
+            //! The range is conservative: it can cover a slightly larger area than the region, and it includes the heights used
+            //! for points with no terrain. Repeated queries of unchanged regions are cheap, even for large regions.
+            virtual FloatRange GetTerrainHeightBoundsInRegion(const AZ::Aabb& region) const = 0;
+
             //! Returns terrains height in meters at location x,y.
             //! @terrainExistsPtr: Can be nullptr. If != nullptr then, if there's no terrain at location x,y or location x,y is inside
             //!  a terrain HOLE then *terrainExistsPtr will become false, otherwise *terrainExistsPtr will become true.
@@ -300,6 +338,14 @@ namespace AzFramework
                 SurfacePointListFillCallback perPositionCallback,
                 Sampler sampleFilter = Sampler::DEFAULT) const = 0;
 
+            //! Given a list of XY coordinates, write the requested terrain data for each coordinate directly into the provided buffers.
+            //! This avoids the overhead of invoking a callback for every position when the caller just wants the data in arrays.
+            virtual void QueryListIntoBuffers(
+                const AZStd::span<const AZ::Vector3>& inPositions,
+                TerrainDataMask requestedData,
+                const TerrainQueryBuffers& outBuffers,
+                Sampler sampleFilter = Sampler::DEFAULT) const = 0;
+
             //! Given a terrain query region, call the provided callback function with terrain data corresponding to the
             //! coordinates in the region.
             virtual void QueryRegion(
@@ -314,6 +360,14 @@ namespace AzFramework
             //! Given a ray, return the closest intersection with terrain.
             virtual RenderGeometry::RayResult GetClosestIntersection(const RenderGeometry::RayRequest& ray) const = 0;
 
+            //! Given a list of rays, find the closest intersection with terrain for each ray.
+            //! The rays are traced together so that the terrain heights they need can be fetched in bulk, which is much faster
+            //! than calling GetClosestIntersection once per ray.
+            //! @param rays The input list of rays.
+            //! @param outResults The output list of results. This list is expected to be the same size as the rays list.
+            virtual void GetClosestIntersections(
+                AZStd::span<const RenderGeometry::RayRequest> rays, AZStd::span<RenderGeometry::RayResult> outResults) const = 0;
+
             //! Asynchronous versions of the various 'Query*' API functions declared above.
             //! It's the responsibility of the caller to ensure all callbacks are thread-safe.
             virtual AZStd::shared_ptr<TerrainJobContext> QueryListAsync(
@@ -334,6 +388,24 @@ namespace AzFramework
                 SurfacePointRegionFillCallback perPositionCallback,
                 Sampler sampleFilter = Sampler::DEFAULT,
                 AZStd::shared_ptr<QueryAsyncParams> params = nullptr) const = 0;
+
+            //! Asynchronous version of QueryListIntoBuffers.
+            //! The input positions and the output buffers need to stay valid until the request completes.
+            //! Returns nullptr if the request couldn't be started, in which case no callbacks or events will be triggered.
+            virtual AZStd::shared_ptr<TerrainJobContext> QueryListIntoBuffersAsync(
+                const AZStd::span<const AZ::Vector3>& inPositions,
+                TerrainDataMask requestedData,
+                const TerrainQueryBuffers& outBuffers,
+                Sampler sampleFilter = Sampler::DEFAULT,
+                AZStd::shared_ptr<QueryAsyncParams> params = nullptr) const = 0;
+
+            //! Asynchronous version of GetClosestIntersections. The rays are split across jobs, with each job tracing its rays together.
+            //! The rays and the output results need to stay valid until the request completes.
+            //! Returns nullptr if the request couldn't be started, in which case no callbacks will be triggered.
+            virtual AZStd::shared_ptr<TerrainJobContext> GetClosestIntersectionsAsync(
+                AZStd::span<const RenderGeometry::RayRequest> rays,
+                AZStd::span<RenderGeometry::RayResult> outResults,
+                AZStd::shared_ptr<QueryAsyncParams> params = nullptr) const = 0;
         };
         using TerrainDataRequestBus = AZ::EBus<TerrainDataRequests>;
 
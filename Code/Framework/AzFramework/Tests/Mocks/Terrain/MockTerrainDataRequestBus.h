@@ -57,6 +57,7 @@ namespace UnitTest
         MOCK_CONST_METHOD0(GetTerrainHeightBounds, AzFramework::Terrain::FloatRange());
         MOCK_METHOD1(SetTerrainHeightBounds, void(const AzFramework::Terrain::FloatRange&));
         MOCK_CONST_METHOD1(TerrainAreaExistsInBounds, bool(const AZ::Aabb&));
+        MOCK_CONST_METHOD1(GetTerrainHeightBoundsInRegion, AzFramework::Terrain::FloatRange(const AZ::Aabb&));
         MOCK_CONST_METHOD3(GetHeight, float(const AZ::Vector3&, Sampler, bool*));
         MOCK_CONST_METHOD3(GetHeightFromVector2, float(const AZ::Vector2&, Sampler, bool*));
         MOCK_CONST_METHOD4(GetHeightFromFloats, float(float, float, Sampler, bool*));
@@ -84,6 +85,9 @@ namespace UnitTest
             QueryList, void(const AZStd::span<const AZ::Vector3>&, TerrainDataMask, AzFramework::Terrain::SurfacePointListFillCallback, Sampler));
         MOCK_CONST_METHOD4(
             QueryListOfVector2, void(const AZStd::span<const AZ::Vector2>&, TerrainDataMask, AzFramework::Terrain::SurfacePointListFillCallback, Sampler));
+        MOCK_CONST_METHOD4(
+            QueryListIntoBuffers,
+            void(const AZStd::span<const AZ::Vector3>&, TerrainDataMask, const AzFramework::Terrain::TerrainQueryBuffers&, Sampler));
         MOCK_CONST_METHOD3(
             GetNumSamplesFromRegion, AZStd::pair<size_t, size_t>(const AZ::Aabb&, const AZ::Vector2&, Sampler));
         MOCK_CONST_METHOD4(
@@ -97,6 +101,9 @@ namespace UnitTest
             GetTerrainRaycastEntityContextId, AzFramework::EntityContextId());
         MOCK_CONST_METHOD1(
             GetClosestIntersection, AzFramework::RenderGeometry::RayResult(const AzFramework::RenderGeometry::RayRequest&));
+        MOCK_CONST_METHOD2(
+            GetClosestIntersections,
+            void(AZStd::span<const AzFramework::RenderGeometry::RayRequest>, AZStd::span<AzFramework::RenderGeometry::RayResult>));
         MOCK_CONST_METHOD5(
             QueryListAsync,
             AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>(
@@ -121,5 +128,19 @@ namespace UnitTest
                 AzFramework::Terrain::SurfacePointRegionFillCallback,
                 Sampler,
                 AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams>));
+        MOCK_CONST_METHOD5(
+            QueryListIntoBuffersAsync,
+            AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>(
+                const AZStd::span<const AZ::Vector3>&,
+                TerrainDataMask,
+                const AzFramework::Terrain::TerrainQueryBuffers&,
+                Sampler,
+                AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams>));
+        MOCK_CONST_METHOD3(
+            GetClosestIntersectionsAsync,
+            AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>(
+                AZStd::span<const AzFramework::RenderGeometry::RayRequest>,
+                AZStd::span<AzFramework::RenderGeometry::RayResult>,
+                AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams>));
     };
 } // namespace UnitTest
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBuffer.h>
+
+namespace AzNetworking
+{
+    PacketBufferPool::PacketBufferPool(uint32_t maxPooledBuffers)
+        : m_maxPooledBuffers(maxPooledBuffers)
+    {
+        m_freeBuffers.reserve(maxPooledBuffers);
+    }
+
+    PacketBufferPool::~PacketBufferPool()
+    {
+        AZ_Assert(m_outstandingCount == 0, "PacketBufferPool destroyed with %u buffers still referenced", static_cast<uint32_t>(m_outstandingCount));
+        for (PacketBuffer* buffer : m_freeBuffers)
+        {
+            delete buffer;
+        }
+    }
+
+    PacketBufferPtr PacketBufferPool::Acquire()
+    {
+        PacketBuffer* buffer = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_freeBuffers.empty())
+            {
+                buffer = m_freeBuffers.back();
+                m_freeBuffers.pop_back();
+            }
+        }
+
+        if (buffer == nullptr)
+        {
+            buffer = new PacketBuffer(*this);
+            ++m_allocationCount;
+        }
+
+        buffer->m_payloadSize = 0;
+        ++m_acquireCount;
+        ++m_outstandingCount;
+        return PacketBufferPtr(buffer);
+    }
+
+    void PacketBufferPool::Release(PacketBuffer* buffer)
+    {
+        --m_outstandingCount;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_freeBuffers.size() < m_maxPooledBuffers)
+            {
+                m_freeBuffers.push_back(buffer);
+                return;
+            }
+        }
+        delete buffer;
+    }
+}
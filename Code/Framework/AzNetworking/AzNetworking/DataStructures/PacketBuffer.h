@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AzNetworking
+{
+    class PacketBufferPool;
+
+    //! @class PacketBuffer
+    //! @brief Reference counted storage for a single serialized packet, recycled through a PacketBufferPool.
+    //!
+    //! The payload is written at a fixed offset, leaving headroom in front of it so that headers which can only be
+    //! serialized once the payload is known can be prepended in place instead of copying the payload behind them.
+    class PacketBuffer
+    {
+    public:
+
+        AZ_CLASS_ALLOCATOR(PacketBuffer, AZ::SystemAllocator);
+
+        //! Number of bytes reserved in front of the payload for prepended headers.
+        static constexpr uint32_t Headroom = 32;
+
+        //! Returns a pointer to the start of the payload.
+        //! @return pointer to the start of the payload
+        uint8_t* GetPayload();
+        const uint8_t* GetPayload() const;
+
+        //! Returns the number of valid payload bytes.
+        //! @return the number of valid payload bytes
+        uint32_t GetPayloadSize() const;
+
+        //! Returns the maximum number of bytes the payload can hold.
+        //! @return the maximum number of bytes the payload can hold
+        uint32_t GetPayloadCapacity() const;
+
+        //! Sets the number of valid payload bytes.
+        //! @param size the number of valid payload bytes, must not exceed the payload capacity
+        void SetPayloadSize(uint32_t size);
+
+        //! Reserves space for a header directly in front of the payload.
+        //! @param headerSize size of the header in bytes, must not exceed Headroom
+        //! @return pointer to write the header to, the header and payload are then contiguous
+        uint8_t* PrependHeader(uint32_t headerSize);
+
+    private:
+
+        explicit PacketBuffer(PacketBufferPool& pool);
+        ~PacketBuffer() = default;
+
+        void add_ref();
+        void release();
+
+        AZ_DISABLE_COPY_MOVE(PacketBuffer);
+
+        PacketBufferPool& m_pool;
+        AZStd::atomic<uint32_t> m_refCount = 0;
+        uint32_t m_payloadSize = 0;
+        uint8_t m_buffer[Headroom + MaxPacketSize];
+
+        template <typename T>
+        friend struct AZStd::IntrusivePtrCountPolicy;
+        friend class PacketBufferPool;
+    };
+
+    using PacketBufferPtr = AZStd::intrusive_ptr<PacketBuffer>;
+
+    //! @class PacketBufferPool
+    //! @brief Thread safe free list of PacketBuffers, avoiding a heap allocation for every packet sent.
+    //!
+    //! Buffers return to their pool when the last PacketBufferPtr referencing them is released, so the pool must
+    //! outlive every buffer acquired from it.
+    class PacketBufferPool
+    {
+    public:
+
+        static constexpr uint32_t DefaultMaxPooledBuffers = 64;
+
+        //! Constructor.
+        //! @param maxPooledBuffers maximum number of released buffers kept for reuse, any extra buffers are freed
+        explicit PacketBufferPool(uint32_t maxPooledBuffers = DefaultMaxPooledBuffers);
+        ~PacketBufferPool();
+
+        //! Returns an empty buffer, reusing a released buffer if one is available.
+        //! @return an empty buffer
+        PacketBufferPtr Acquire();
+
+        //! Returns the total number of buffers acquired from this pool.
+        //! @return the total number of buffers acquired from this pool
+        uint64_t GetAcquireCount() const;
+
+        //! Returns the total number of buffers this pool had to allocate because no released buffer was available.
+        //! @return the total number of buffers this pool had to allocate
+        uint64_t GetAllocationCount() const;
+
+        //! Returns the number of acquired buffers that have not yet been released.
+        //! @return the number of acquired buffers that have not yet been released
+        uint32_t GetOutstandingCount() const;
+
+    private:
+
+        void Release(PacketBuffer* buffer);
+
+        AZ_DISABLE_COPY_MOVE(PacketBufferPool);
+
+        AZStd::mutex m_mutex;
+        AZStd::vector<PacketBuffer*> m_freeBuffers;
+        uint32_t m_maxPooledBuffers;
+        AZStd::atomic<uint64_t> m_acquireCount = 0;
+        AZStd::atomic<uint64_t> m_allocationCount = 0;
+        AZStd::atomic<uint32_t> m_outstandingCount = 0;
+
+        friend class PacketBuffer;
+    };
+}
+
+#include <AzNetworking/DataStructures/PacketBuffer.inl>
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline PacketBuffer::PacketBuffer(PacketBufferPool& pool)
+        : m_pool(pool)
+    {
+        ;
+    }
+
+    inline uint8_t* PacketBuffer::GetPayload()
+    {
+        return m_buffer + Headroom;
+    }
+
+    inline const uint8_t* PacketBuffer::GetPayload() const
+    {
+        return m_buffer + Headroom;
+    }
+
+    inline uint32_t PacketBuffer::GetPayloadSize() const
+    {
+        return m_payloadSize;
+    }
+
+    inline uint32_t PacketBuffer::GetPayloadCapacity() const
+    {
+        return MaxPacketSize;
+    }
+
+    inline void PacketBuffer::SetPayloadSize(uint32_t size)
+    {
+        AZ_Assert(size <= GetPayloadCapacity(), "Payload size %u exceeds buffer capacity %u", size, GetPayloadCapacity());
+        m_payloadSize = size;
+    }
+
+    inline uint8_t* PacketBuffer::PrependHeader(uint32_t headerSize)
+    {
+        AZ_Assert(headerSize <= Headroom, "Header size %u exceeds reserved headroom %u", headerSize, Headroom);
+        return GetPayload() - headerSize;
+    }
+
+    inline void PacketBuffer::add_ref()
+    {
+        ++m_refCount;
+    }
+
+    inline void PacketBuffer::release()
+    {
+        if (--m_refCount == 0)
+        {
+            m_pool.Release(this);
+        }
+    }
+
+    inline uint64_t PacketBufferPool::GetAcquireCount() const
+    {
+        return m_acquireCount;
+    }
+
+    inline uint64_t PacketBufferPool::GetAllocationCount() const
+    {
+        return m_allocationCount;
+    }
+
+    inline uint32_t PacketBufferPool::GetOutstandingCount() const
+    {
+        return m_outstandingCount;
+    }
+}
@@ -53,6 +53,11 @@ namespace AzNetworking
         //! Returns size of compressed buffer needed to uncompress uncompSize of bytes.
         virtual AZStd::size_t GetMaxCompressedBufferSize(AZStd::size_t uncompSize) const = 0;
 
+        //! Returns true if the compressor carries history from one packet to the next (streaming compressors).
+        //! Every output of a stateful compressor must be delivered to the remote Decompress() in order, so transports
+        //! must send the compressed payload even when compression yields no gain, and must not use them over unreliable channels.
+        virtual bool IsStateful() const { return false; }
+
         //! Finalizes the stream, and returns composed packet.
         //! Chunk based compressors should loop internally in Compress() to compress all chunks of uncompData.
         //! @param uncompData   buffer to compress
@@ -34,6 +34,12 @@ namespace AzNetworking
         int64_t m_sendBytesCompressedDelta = 0;
         //! Returns the numbers of bytes added by encryption.
         uint64_t m_sendBytesEncryptionInflation = 0;
+        //! Returns the total number of system calls made to send data on this socket, less than sent packets when sends are batched.
+        uint64_t m_sendCalls = 0;
+        //! Returns the total number of pooled packet buffers acquired to serialize, compress or encrypt outgoing packets.
+        uint64_t m_sendBufferAcquires = 0;
+        //! Returns the total number of packet buffers heap allocated because the pool had none to reuse.
+        uint64_t m_sendBufferAllocations = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
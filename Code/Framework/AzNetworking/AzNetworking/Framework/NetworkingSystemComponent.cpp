@@ -197,6 +197,10 @@ namespace AzNetworking
             AZLOG_INFO(" - Total sent bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBytesUncompressed));
             AZLOG_INFO(" - Total sent compressed packets without benefit: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendCompressedPacketsNoGain));
             AZLOG_INFO(" - Total gain from packet compression: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
+            AZLOG_INFO(" - Total send system calls: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendCalls));
+            AZLOG_INFO(" - Total send buffers acquired: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBufferAcquires));
+            AZLOG_INFO(" - Total send buffer allocations: %llu (%.3f per sent packet)", aznumeric_cast<AZ::u64>(metrics.m_sendBufferAllocations),
+                (metrics.m_sendPackets > 0) ? aznumeric_cast<double>(metrics.m_sendBufferAllocations) / aznumeric_cast<double>(metrics.m_sendPackets) : 0.0);
             AZLOG_INFO(" - Total packets resent: %llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
             AZLOG_INFO(" - Total receive time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
             AZLOG_INFO(" - Total received packets: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvPackets));
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/TypeValidatingSerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    NetworkBitInputSerializer::NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    bool NetworkBitInputSerializer::SerializeBits(uint64_t value, uint32_t bitCount)
+    {
+        AZ_Assert(bitCount <= 64, "Cannot serialize more than 64 bits at a time, requested %u", bitCount);
+        const uint64_t nextBitPosition = static_cast<uint64_t>(m_bitPosition) + bitCount;
+        if (!m_serializerValid || (nextBitPosition > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        // Bits are packed least significant first, a partially filled byte is always written through to the buffer so GetSize() is exact
+        while (bitCount > 0)
+        {
+            const uint32_t byteIndex = m_bitPosition >> 3;
+            const uint32_t bitOffset = m_bitPosition & 7;
+            const uint32_t bitsInByte = AZStd::min<uint32_t>(8 - bitOffset, bitCount);
+            const uint8_t bits = static_cast<uint8_t>((value & ((1u << bitsInByte) - 1)) << bitOffset);
+            m_buffer[byteIndex] = (bitOffset == 0) ? bits : static_cast<uint8_t>(m_buffer[byteIndex] | bits);
+            value >>= bitsInByte;
+            bitCount -= bitsInByte;
+            m_bitPosition += bitsInByte;
+        }
+        return true;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetBitSize() const
+    {
+        return m_bitPosition;
+    }
+
+    SerializerMode NetworkBitInputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool NetworkBitInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return SerializeBits(value ? 1 : 0, 1);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        // Floats are written at full precision, bandwidth sensitive values should be quantized before serialization
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(float));
+        return SerializeBits(bits, 32);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(double));
+        return SerializeBits(bits, 64);
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+
+        if ((m_bitPosition & 7) == 0)
+        {
+            // Byte aligned, so the bytes can be copied directly
+            const uint32_t byteIndex = m_bitPosition >> 3;
+            if (outSize > m_bufferCapacity - byteIndex)
+            {
+                m_serializerValid = false;
+                return false;
+            }
+            memcpy(m_buffer + byteIndex, buffer, outSize);
+            m_bitPosition += outSize * 8;
+            return true;
+        }
+
+        for (uint32_t i = 0; i < outSize; ++i)
+        {
+            if (!SerializeBits(buffer[i], 8))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::BeginObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::EndObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitInputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSize() const
+    {
+        return (m_bitPosition + 7) >> 3;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitInputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue)
+    {
+        m_serializerValid &= (inputValue >= minValue);
+        m_serializerValid &= (inputValue <= maxValue);
+        // Widen before subtracting so that signed ranges spanning more than half the type don't overflow
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        const uint64_t offsetValue = static_cast<uint64_t>(inputValue) - static_cast<uint64_t>(minValue);
+        return SerializeBits(offsetValue, GetBitCountForRange(valueRange));
+    }
+
+    template class TypeValidatingSerializer<NetworkBitInputSerializer>;
+}
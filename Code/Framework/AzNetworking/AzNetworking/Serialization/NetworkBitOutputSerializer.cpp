@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Serialization/TypeValidatingSerializer.h>
+#include <AzNetworking/Serialization/TrackChangedSerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    NetworkBitOutputSerializer::NetworkBitOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBits(uint64_t& outValue, uint32_t bitCount)
+    {
+        AZ_Assert(bitCount <= 64, "Cannot serialize more than 64 bits at a time, requested %u", bitCount);
+        const uint64_t nextBitPosition = static_cast<uint64_t>(m_bitPosition) + bitCount;
+        if (!m_serializerValid || (nextBitPosition > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        uint64_t result = 0;
+        uint32_t bitsRead = 0;
+        while (bitsRead < bitCount)
+        {
+            const uint32_t byteIndex = m_bitPosition >> 3;
+            const uint32_t bitOffset = m_bitPosition & 7;
+            const uint32_t bitsInByte = AZStd::min<uint32_t>(8 - bitOffset, bitCount - bitsRead);
+            const uint64_t bits = (m_buffer[byteIndex] >> bitOffset) & ((1u << bitsInByte) - 1);
+            result |= bits << bitsRead;
+            bitsRead += bitsInByte;
+            m_bitPosition += bitsInByte;
+        }
+        outValue = result;
+        return true;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetReadBitSize() const
+    {
+        return m_bitPosition;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetReadSize() const
+    {
+        return (m_bitPosition + 7) >> 3;
+    }
+
+    SerializerMode NetworkBitOutputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        uint64_t bit = 0;
+        if (SerializeBits(bit, 1))
+        {
+            value = (bit > 0);
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint64_t bits = 0;
+        if (SerializeBits(bits, 32))
+        {
+            const uint32_t floatBits = static_cast<uint32_t>(bits);
+            memcpy(&value, &floatBits, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        if (SerializeBits(bits, 64))
+        {
+            memcpy(&value, &bits, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+
+        if ((m_bitPosition & 7) == 0)
+        {
+            // Byte aligned, so the bytes can be copied directly
+            const uint32_t byteIndex = m_bitPosition >> 3;
+            if (outSize > m_bufferCapacity - byteIndex)
+            {
+                m_serializerValid = false;
+                return false;
+            }
+            memcpy(buffer, m_buffer + byteIndex, outSize);
+            m_bitPosition += outSize * 8;
+            return true;
+        }
+
+        for (uint32_t i = 0; i < outSize; ++i)
+        {
+            uint64_t byteValue = 0;
+            if (!SerializeBits(byteValue, 8))
+            {
+                return false;
+            }
+            buffer[i] = static_cast<uint8_t>(byteValue);
+        }
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::BeginObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::EndObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitOutputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetSize() const
+    {
+        return GetReadSize();
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
+    {
+        // Widen before subtracting so that signed ranges spanning more than half the type don't overflow
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        uint64_t offsetValue = 0;
+        if (SerializeBits(offsetValue, GetBitCountForRange(valueRange)))
+        {
+            m_serializerValid &= (offsetValue <= valueRange);
+            outValue = m_serializerValid ? static_cast<ORIGINAL_TYPE>(static_cast<uint64_t>(minValue) + offsetValue) : outValue;
+        }
+        return m_serializerValid;
+    }
+
+    template class TypeValidatingSerializer<NetworkBitOutputSerializer>;
+    template class TypeValidatingSerializer<TrackChangedSerializer<NetworkBitOutputSerializer>>;
+}
@@ -301,11 +301,14 @@ namespace AzNetworking
                 m_networkInterface.GetMetrics().m_sendCompressedPacketsNoGain++;
             }
 
-            // Only use compression if there's actual gain
-            if (compressionMemBytesUsed < payloadSize)
+            // Only use compression if there's actual gain, unless the compressor is stateful and the remote must see every packet
+            if (compressionMemBytesUsed < payloadSize || m_compressor->IsStateful())
             {
                 // Track byte delta caused by compression
-                m_networkInterface.GetMetrics().m_sendBytesCompressedDelta += (payloadSize - compressionMemBytesUsed);
+                if (compressionMemBytesUsed < payloadSize)
+                {
+                    m_networkInterface.GetMetrics().m_sendBytesCompressedDelta += (payloadSize - compressionMemBytesUsed);
+                }
 
                 writeBuffer.Resize(aznumeric_cast<int32_t>(compressionMemBytesUsed));
                 payloadSize = static_cast<uint32_t>(writeBuffer.GetSize());
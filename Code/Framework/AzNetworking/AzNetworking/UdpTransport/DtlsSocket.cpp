@@ -19,7 +19,8 @@ namespace AzNetworking
 {
     DtlsSocket::~DtlsSocket()
     {
-        FreeSslContext(m_sslContext);
+        // Close here rather than in the base destructor so any batched encrypted buffers are released before their pool
+        Close();
     }
 
     bool DtlsSocket::IsEncrypted() const
@@ -69,12 +70,12 @@ namespace AzNetworking
         UdpSocket::Close();
     }
 
-    int32_t DtlsSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const
+    int32_t DtlsSocket::SendInternal(const IpAddress& address, const PacketBufferPtr& buffer, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const
     {
         if (!encrypt)
         {
             // If the packet has requested to remain unencrypted then just send directly
-            return UdpSocket::SendInternal(address, data, size, encrypt, dtlsEndpoint);
+            return UdpSocket::SendInternal(address, buffer, data, size, encrypt, dtlsEndpoint);
         }
 
         if (dtlsEndpoint.m_sslSocket == nullptr)
@@ -84,16 +85,21 @@ namespace AzNetworking
         }
 
 #if AZ_TRAIT_USE_OPENSSL
-        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
+        PacketBufferPtr encryptedBuffer = m_encryptedBufferPool.Acquire();
         // Write out the packet we were requested to send
         SSL_write(dtlsEndpoint.m_sslSocket, data, size);
-        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
+        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encryptedBuffer->GetPayload(), MaxUdpTransmissionUnit);
+        if (sentBytesEnc <= 0)
+        {
+            return SocketOpResultError;
+        }
+        encryptedBuffer->SetPayloadSize(aznumeric_cast<uint32_t>(sentBytesEnc));
 
         // Track encryption metrics
         m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
         m_sentPacketsEncrypted++;
 
-        return UdpSocket::SendInternal(address, encrpytedSendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
+        return SendRaw(address, encryptedBuffer, encryptedBuffer->GetPayload(), aznumeric_cast<uint32_t>(sentBytesEnc));
 #else
         return 0;
 #endif
@@ -57,8 +57,11 @@ namespace AzNetworking
 
     private:
 
-        int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
+        int32_t SendInternal(const IpAddress& address, const PacketBufferPtr& buffer, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
 
         SSL_CTX* m_sslContext = nullptr;
+
+        //! Encrypted payloads are written to pooled buffers so they can be retained by a send batch
+        mutable PacketBufferPool m_encryptedBufferPool;
     };
 }
@@ -38,6 +38,7 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+    AZ_CVAR(uint32_t, net_UdpMaxPooledPacketBuffers, 64, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The maximum number of released packet buffers each UDP network interface keeps for reuse");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -60,12 +61,19 @@ namespace AzNetworking
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
+        , m_packetBufferPool(net_UdpMaxPooledPacketBuffers)
         , m_socket(net_UdpUseEncryption ? new DtlsSocket() : new UdpSocket())
         , m_readerThread(readerThread)
         , m_timeoutMs(net_UdpDefaultTimeoutMs)
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor);
+        if (m_compressor && m_compressor->IsStateful())
+        {
+            // Stateful compressors require in-order delivery of every packet, which UDP can't guarantee
+            AZLOG_ERROR("Compressor %s is stateful and cannot be used for UDP, packets will be sent uncompressed", compressor.c_str());
+            m_compressor.reset();
+        }
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
@@ -183,6 +191,9 @@ namespace AzNetworking
             return;
         }
 
+        // Coalesce everything sent while processing received packets and timeouts (acks, heartbeats, resends) into as few socket writes as possible
+        m_socket->BeginSendBatch();
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -333,6 +344,11 @@ namespace AzNetworking
         // Time out any packets that haven't been acked within our timeout window
         m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
 
+        if (m_socket->EndSendBatch() < 0)
+        {
+            AZLOG_ERROR("One or more batched packets failed to send on the socket");
+        }
+
         // Delete any connections we've disconnected
         for (RemovedConnection& removedConnection : m_removedConnections)
         {
@@ -346,6 +362,9 @@ namespace AzNetworking
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
         GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
         GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
+        GetMetrics().m_sendCalls = m_socket->GetSendCalls();
+        GetMetrics().m_sendBufferAcquires = m_packetBufferPool.GetAcquireCount();
+        GetMetrics().m_sendBufferAllocations = m_packetBufferPool.GetAllocationCount();
         GetMetrics().m_recvTimeMs += receiveTimeMs;
         GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
         GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
@@ -467,12 +486,33 @@ namespace AzNetworking
 
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
-        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
+        // Serialize the payload once, straight into a pooled buffer
+        // The header is prepended in the buffer's headroom, and reliable packets retain the buffer for retransmission
+        PacketBufferPtr payloadBuffer = m_packetBufferPool.Acquire();
+        {
+            NetworkInputSerializer networkSerializer(payloadBuffer->GetPayload(), payloadBuffer->GetPayloadCapacity());
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+
+            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            {
+                AZLOG_ERROR("Packet type %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(packet.GetPacketType()));
+                return InvalidPacketId;
+            }
+
+            payloadBuffer->SetPayloadSize(networkSerializer.GetSize());
+        }
+
+        return SendPacket(connection, packet.GetPacketType(), payloadBuffer, reliableSequence);
+    }
+
+    PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, PacketType packetType, const PacketBufferPtr& payloadBuffer, SequenceId reliableSequence)
+    {
+        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packetType), connection.GetRemoteAddress().GetString().c_str());
 
         // The ordering inside this function is incredibly important and fragile
         const IpAddress& address = connection.GetRemoteAddress();
         // We don't want to compress the initial InitiateConnectionPacket, ConnectionHandshakePackets or FragmentedPackets of those two
-        const bool shouldCompress = packet.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
+        const bool shouldCompress = packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
 
         if (address.GetAddress(ByteOrder::Host) == 0)
         {
@@ -484,14 +524,14 @@ namespace AzNetworking
         // Check if we need to fragment this packet first
         // We don't ack aggregate packets that get fragmented, so we want to get this chunk out of the way before
         // we start throwing PacketId's and SequenceId's into our other tracking data structures below
-        UdpPacketHeader header(connection.GetPacketTracker(), packet.GetPacketType(), reliableSequence);
+        UdpPacketHeader header(connection.GetPacketTracker(), packetType, reliableSequence);
         const PacketId localPacketId = header.GetPacketId();
 
         // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
         // not set up
         if (reliabilityType == ReliabilityType::Reliable)
         {
-            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packet))
+            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packetType, payloadBuffer))
             {
                 connection.Disconnect(DisconnectReason::ReliableQueueFull, TerminationEndpoint::Local);
             }
@@ -500,21 +540,22 @@ namespace AzNetworking
         // If we're still connecting, only transmit packets related to establishing connection and queue the rest for later
         // This implicitly enforces that the only FragmentedPackets sent here are of ConnectionHandshakePacket
         // Other large packets are simply queued before they are fragmented
-        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType()))
+        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType))
         {
             // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
             AZLOG(
                 NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
-                (int)packet.GetPacketType());
+                (int)packetType);
             return localPacketId;
         }
 
-        UdpPacketEncodingBuffer buffer;
+        // Serialize the flags and header, then prepend them to the payload in place
+        // A buffer is only ever resent after the previous send timed out, so rewriting its headroom can't race a batched send
+        uint32_t headerSize = 0;
         {
-            buffer.Resize(buffer.GetCapacity());
-
-            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            uint8_t headerData[PacketBuffer::Headroom];
+            NetworkInputSerializer networkSerializer(headerData, static_cast<uint32_t>(sizeof(headerData)));
             ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
 
             if (!header.SerializePacketFlags(serializer))
@@ -529,16 +570,13 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
-            {
-                AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
-                return InvalidPacketId;
-            }
-
-            buffer.Resize(serializer.GetSize());
+            headerSize = networkSerializer.GetSize();
+            memcpy(payloadBuffer->PrependHeader(headerSize), headerData, headerSize);
         }
-        uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
-        uint8_t* packetData = buffer.GetBuffer();
+        const uint32_t uncompressedSize = headerSize + payloadBuffer->GetPayloadSize();
+        uint32_t packetSize = uncompressedSize;
+        uint8_t* packetData = payloadBuffer->PrependHeader(headerSize);
+        PacketBufferPtr sendBuffer = payloadBuffer;
 
         // If the packet doesn't fit within our MTU (minus potential SSL encryption overhead), break it up
         if (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead)
@@ -551,6 +589,9 @@ namespace AzNetworking
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
             ChunkBuffer chunkBuffer;
+
+            // Coalesce all the fragments into as few socket writes as possible
+            m_socket->BeginSendBatch();
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
@@ -563,15 +604,19 @@ namespace AzNetworking
                 bytesRemaining -= nextChunkSize;
                 chunkStart += nextChunkSize;
             }
+            if (m_socket->EndSendBatch() < 0)
+            {
+                AZLOG_ERROR("PacketId %u failed to send one or more fragments on the socket", aznumeric_cast<uint32_t>(localPacketId));
+            }
             AZ_Assert(bytesRemaining == 0, "Non-zero bytes remaining (%u) after chunking a packet into fragments", bytesRemaining);
 
             return localPacketId;
         }
 
-        UdpPacketEncodingBuffer writeBuffer;
         if (m_compressor && shouldCompress)
         {
-            NetworkInputSerializer flagSerializer(writeBuffer.GetBuffer(), static_cast<uint32_t>(writeBuffer.GetCapacity()));
+            PacketBufferPtr compressedBuffer = m_packetBufferPool.Acquire();
+            NetworkInputSerializer flagSerializer(compressedBuffer->GetPayload(), compressedBuffer->GetPayloadCapacity());
             ISerializer& serializer = flagSerializer; // To get the default typeinfo parameters in ISerializer
 
             header.SetPacketFlag(PacketFlag::Compressed, true);
@@ -584,11 +629,11 @@ namespace AzNetworking
             AZ_Assert(flagSize == 1, "Flag bitfield should serialize to one byte");
 
             // Compress the packet, make sure to offset by the size of the flag which is now serialized
-            const uint32_t payloadSize = static_cast<uint32_t>(buffer.GetSize() - flagSize);
-            uint8_t* payload = buffer.GetBuffer() + flagSize;
-            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
+            const uint32_t payloadSize = packetSize - flagSize;
+            const uint8_t* payload = packetData + flagSize;
+            const AZStd::size_t maxSizeNeeded = AZStd::min<AZStd::size_t>(m_compressor->GetMaxCompressedBufferSize(payloadSize), compressedBuffer->GetPayloadCapacity() - flagSize);
             AZStd::size_t compressionMemBytesUsed = 0;
-            CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+            CompressorError compErr = m_compressor->Compress(payload, payloadSize, compressedBuffer->GetPayload() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
 
             if (compErr != CompressorError::Ok)
             {
@@ -599,12 +644,17 @@ namespace AzNetworking
             // Only use compression if there's actual gain
             if (compressionMemBytesUsed < payloadSize)
             {
-                writeBuffer.Resize(aznumeric_cast<int32_t>(flagSize + compressionMemBytesUsed));
-                packetSize = static_cast<uint32_t>(writeBuffer.GetSize());
-                packetData = writeBuffer.GetBuffer();
+                compressedBuffer->SetPayloadSize(aznumeric_cast<uint32_t>(flagSize + compressionMemBytesUsed));
+                packetSize = compressedBuffer->GetPayloadSize();
+                packetData = compressedBuffer->GetPayload();
+                sendBuffer = AZStd::move(compressedBuffer);
                 // Track byte delta caused by compression
-                GetMetrics().m_sendBytesCompressedDelta += (packetSize - compressionMemBytesUsed);
-            }        
+                GetMetrics().m_sendBytesCompressedDelta += aznumeric_cast<int64_t>(payloadSize) - aznumeric_cast<int64_t>(compressionMemBytesUsed);
+            }
+            else
+            {
+                GetMetrics().m_sendCompressedPacketsNoGain++;
+            }
         }
 
         AZLOG(NET_Debug, "Sending local sequence id %d, remote sequence id %d, %s, reliable id: %d, ack vector %x",
@@ -615,14 +665,14 @@ namespace AzNetworking
             aznumeric_cast<uint32_t>(header.GetSequenceWindow())
         );
 
-        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
+        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packetType));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
-        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
-        if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
+        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType);
+        if (m_socket->Send(address, sendBuffer, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
-            GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
+            connection.ProcessSent(localPacketId, packetType, packetSize + UdpPacketHeaderSize, reliabilityType);
+            GetMetrics().m_sendBytesUncompressed += uncompressedSize + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
             return localPacketId;
         }
         else
@@ -14,6 +14,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/DataStructures/PacketBuffer.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
@@ -142,6 +143,14 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Sends an already serialized packet payload to the remote connection, used directly when retransmitting reliable packets.
+        //! @param connection       the UdpConnection instance to send the packet on
+        //! @param packetType       type of the serialized packet
+        //! @param payloadBuffer    pooled buffer holding the serialized payload, the packet header is prepended in its headroom
+        //! @param reliableSequence the reliable sequence number to use for this packet, providing InvalidSequenceId will cause the packet to be sent unreliably
+        //! @return packet id for the transmitted packet
+        PacketId SendPacket(UdpConnection& connection, PacketType packetType, const PacketBufferPtr& payloadBuffer, SequenceId reliableSequence);
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
         void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
@@ -176,6 +185,7 @@ namespace AzNetworking
         bool m_allowIncomingConnections = false;
         AZ::TimeMs m_timeoutMs = AZ::Time::ZeroTimeMs;
         IConnectionListener& m_connectionListener;
+        PacketBufferPool m_packetBufferPool; // Declared before the connection set, batched sends may hold buffers until the socket is destroyed
         UdpConnectionSet m_connectionSet;
         TimeoutQueue m_connectionTimeoutQueue;
         TimeoutQueue m_packetTimeoutQueue;
@@ -34,7 +34,7 @@ namespace AzNetworking
         return static_cast<uint32_t>(m_packetWindow.size());
     }
 
-    bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
+    bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const PacketBufferPtr& payloadBuffer)
     {
         AZLOG(NET_ReliableQueueDebug, "Inserting packetId %u with reliable sequenceId %u", static_cast<uint32_t>(packetId), static_cast<uint32_t>(reliableSequenceId));
         if (m_packetWindow.size() > net_MaxReliablePacketsInWindow)
@@ -48,7 +48,8 @@ namespace AzNetworking
             AZ_Assert(false, "Attempted to reinsert an existing packetId into the reliable queue");
             return false;
         }
-        m_packetWindow[packetId] = { reliableSequenceId, packet.Clone() };
+        // Retain the buffer itself, a lost packet is resent straight from it without copying or reserializing the payload
+        m_packetWindow[packetId] = { reliableSequenceId, packetType, payloadBuffer };
         return true;
     }
 
@@ -104,14 +105,15 @@ namespace AzNetworking
         AZLOG(NET_ReliableQueueDebug, "Lost packetId %u", static_cast<uint32_t>(packetId));
 
         bool result = false;
-        AZStd::unique_ptr<IPacket> lostPacket;
+        PacketBufferPtr lostPayload;
+        PacketType lostPacketType = PacketType{ 0 };
         SequenceId lostReliableSequenceId = InvalidSequenceId;
 
         PendingPacketMap::iterator iter = m_packetWindow.find(packetId);
         if (iter != m_packetWindow.end())
         {
-            AZ_Assert(iter->second.m_packet != nullptr, "Timed out reliable packet was nullptr");
-            lostPacket = AZStd::move(iter->second.m_packet); // This transfers ownership out of the pending packet to this local scoped alloc
+            lostPayload = AZStd::move(iter->second.m_payloadBuffer);
+            lostPacketType = iter->second.m_packetType;
             lostReliableSequenceId = iter->second.m_reliableSequenceId;
             m_packetWindow.erase(iter);
         }
@@ -126,7 +128,7 @@ namespace AzNetworking
 
             // This punches down an abstraction layer purposefully to resend using the existing reliable SequenceId
             // NOTE: This will call back into UdpReliableQueue::PrepareForSend!!
-            if (networkInterface.SendPacket(connection, *lostPacket, lostReliableSequenceId) == InvalidPacketId)
+            if (networkInterface.SendPacket(connection, lostPacketType, lostPayload, lostReliableSequenceId) == InvalidPacketId)
             {
                 // Packet failed to retransmit, meaning no retry attempt was made
                 // Since we've lost a reliable packet, the appropriate response is to terminate the connection
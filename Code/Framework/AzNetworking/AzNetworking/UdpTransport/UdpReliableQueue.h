@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzNetworking/PacketLayer/IPacket.h>
+#include <AzNetworking/DataStructures/PacketBuffer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
@@ -24,7 +25,8 @@ namespace AzNetworking
     struct PendingPacket
     {
         SequenceId m_reliableSequenceId;
-        AZStd::unique_ptr<IPacket> m_packet;
+        PacketType m_packetType;
+        PacketBufferPtr m_payloadBuffer; //!< The serialized payload, retransmitted without reserializing the packet
     };
 
     //! @class UdpReliableQueue
@@ -47,9 +49,10 @@ namespace AzNetworking
         //! Called when we're going to transmit a packet that we want to be reliable.
         //! @param packetId           packet id of the packet we're sending
         //! @param reliableSequenceId the reliable sequence identifier of the packet we're sending
-        //! @param packet             reference to the packet being transmitted
+        //! @param packetType         type of the packet being transmitted
+        //! @param payloadBuffer      buffer holding the serialized payload, retained until the packet is acked or resent
         //! @return boolean true on success, false on failure
-        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const PacketBufferPtr& payloadBuffer);
 
         //! Called when a reliable packet has been received.
         //! @param header the header for the received reliable packet
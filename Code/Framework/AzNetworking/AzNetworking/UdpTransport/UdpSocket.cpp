@@ -96,6 +96,8 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        m_sendBatch.clear();
+        m_sendBatchDepth = 0;
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -107,6 +109,21 @@ namespace AzNetworking
         uint32_t size,
         bool encrypt,
         DtlsEndpoint& dtlsEndpoint,
+        const ConnectionQuality& connectionQuality
+    ) const
+    {
+        // Without an owning buffer the payload can't be retained, so it is always transmitted immediately
+        return Send(address, PacketBufferPtr(), data, size, encrypt, dtlsEndpoint, connectionQuality);
+    }
+
+    int32_t UdpSocket::Send
+    (
+        const IpAddress& address,
+        const PacketBufferPtr& buffer,
+        const uint8_t* data,
+        uint32_t size,
+        bool encrypt,
+        DtlsEndpoint& dtlsEndpoint,
         [[maybe_unused]] const ConnectionQuality& connectionQuality
     ) const
     {
@@ -138,7 +155,7 @@ namespace AzNetworking
         if (connectionQuality.m_latencyMs <= AZ::Time::ZeroTimeMs)
 #endif
         {
-            sentBytes = SendInternal(address, data, size, encrypt, dtlsEndpoint);
+            sentBytes = SendInternal(address, buffer, data, size, encrypt, dtlsEndpoint);
 
             if (sentBytes < 0)
             {
@@ -172,6 +189,21 @@ namespace AzNetworking
         return sentBytes;
     }
 
+    void UdpSocket::BeginSendBatch()
+    {
+        ++m_sendBatchDepth;
+    }
+
+    int32_t UdpSocket::EndSendBatch()
+    {
+        AZ_Assert(m_sendBatchDepth > 0, "EndSendBatch called without a matching BeginSendBatch");
+        if ((m_sendBatchDepth > 0) && (--m_sendBatchDepth == 0))
+        {
+            return FlushSendBatch();
+        }
+        return SocketOpResultSuccess;
+    }
+
     int32_t UdpSocket::Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const
     {
         AZ_Assert(size > 0, "Invalid data size for send");
@@ -224,21 +256,120 @@ namespace AzNetworking
         return receivedBytes;
     }
 
-    int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
+    int32_t UdpSocket::SendInternal(const IpAddress& address, const PacketBufferPtr& buffer, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
+    {
+        return SendRaw(address, buffer, data, size);
+    }
+
+    int32_t UdpSocket::SendRaw(const IpAddress& address, const PacketBufferPtr& buffer, const uint8_t* data, uint32_t size) const
+    {
+        if ((m_sendBatchDepth == 0) || (buffer == nullptr))
+        {
+            return SendTo(address, data, size);
+        }
+
+        if (m_sendBatch.size() >= MaxSendBatchSize)
+        {
+            m_sendBatchResult = AZStd::min(m_sendBatchResult, FlushSendBatch());
+        }
+        m_sendBatch.push_back({ address, buffer, data, size });
+        return static_cast<int32_t>(size);
+    }
+
+    int32_t UdpSocket::SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const
     {
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
         destAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
         destAddr.sin_port = address.GetPort(ByteOrder::Network);
+        m_sendCalls++;
         return static_cast<int32_t>(sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr)));
     }
 
+    int32_t UdpSocket::OnBatchedSendFailed(const QueuedSend& queued) const
+    {
+        // The payload was counted as sent when it was queued, so take it back out just like a failed immediate send
+        m_sentBytes -= queued.m_size;
+
+        const int32_t error = GetLastNetworkError();
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
+        {
+            return SocketOpResultSuccess;
+        }
+
+        AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return SocketOpResultError;
+    }
+
+    int32_t UdpSocket::FlushSendBatch() const
+    {
+        // Include any failures from flushes forced by the batch filling up
+        int32_t result = m_sendBatchResult;
+        m_sendBatchResult = SocketOpResultSuccess;
+
+        if (m_sendBatch.empty() || !IsOpen())
+        {
+            m_sendBatch.clear();
+            return result;
+        }
+
+#if AZ_TRAIT_USE_SENDMMSG
+        sockaddr_in destAddrs[MaxSendBatchSize];
+        iovec payloads[MaxSendBatchSize];
+        mmsghdr messages[MaxSendBatchSize];
+        memset(messages, 0, sizeof(messages));
+
+        const uint32_t messageCount = static_cast<uint32_t>(m_sendBatch.size());
+        for (uint32_t i = 0; i < messageCount; ++i)
+        {
+            const QueuedSend& queued = m_sendBatch[i];
+            memset(&destAddrs[i], 0, sizeof(destAddrs[i]));
+            destAddrs[i].sin_family = AF_INET;
+            destAddrs[i].sin_addr.s_addr = queued.m_address.GetAddress(ByteOrder::Network);
+            destAddrs[i].sin_port = queued.m_address.GetPort(ByteOrder::Network);
+            payloads[i].iov_base = const_cast<uint8_t*>(queued.m_data);
+            payloads[i].iov_len = queued.m_size;
+            messages[i].msg_hdr.msg_name = &destAddrs[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(destAddrs[i]);
+            messages[i].msg_hdr.msg_iov = &payloads[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        uint32_t sentCount = 0;
+        while (sentCount < messageCount)
+        {
+            const int32_t sentMessages = static_cast<int32_t>(sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, messageCount - sentCount, 0));
+            m_sendCalls++;
+            if (sentMessages > 0)
+            {
+                sentCount += static_cast<uint32_t>(sentMessages);
+                continue;
+            }
+
+            // The first remaining message failed, skip it and keep going like individual sends would
+            result = AZStd::min(result, OnBatchedSendFailed(m_sendBatch[sentCount]));
+            ++sentCount;
+        }
+#else
+        for (const QueuedSend& queued : m_sendBatch)
+        {
+            if (SendTo(queued.m_address, queued.m_data, queued.m_size) < 0)
+            {
+                result = AZStd::min(result, OnBatchedSendFailed(queued));
+            }
+        }
+#endif
+
+        m_sendBatch.clear();
+        return result;
+    }
+
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
-        return SendInternal(data.m_address, data.m_dataBuffer.GetBuffer(), static_cast<uint32_t>(data.m_dataBuffer.GetSize()), data.m_encrypt, *data.m_dtlsEndpoint);
+        return SendInternal(data.m_address, PacketBufferPtr(), data.m_dataBuffer.GetBuffer(), static_cast<uint32_t>(data.m_dataBuffer.GetSize()), data.m_encrypt, *data.m_dtlsEndpoint);
     }
 #endif
 }
@@ -12,6 +12,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/DataStructures/PacketBuffer.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
 
@@ -86,6 +87,27 @@ namespace AzNetworking
         //! @return number of bytes sent, <= 0 on error
         int32_t Send(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
 
+        //! Sends a single payload owned by a pooled buffer over the UDP socket to the connected endpoint.
+        //! While a send batch is active the buffer is retained and the payload is transmitted when the batch ends, without being copied.
+        //! @param address           the address to send the payload to
+        //! @param buffer            the pooled buffer owning the payload
+        //! @param data              pointer to the data to send, must point into the provided buffer
+        //! @param size              size of the payload in bytes
+        //! @param encrypt           signals that the payload should be encrypted before transmitting if encryption is supported
+        //! @param dtlsEndpoint      data required for DTLS encryption
+        //! @param connectionQuality debug connection quality parameters
+        //! @return number of bytes sent, <= 0 on error
+        int32_t Send(const IpAddress& address, const PacketBufferPtr& buffer, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
+
+        //! Begins a send batch, payloads sent from pooled buffers are queued until the matching EndSendBatch.
+        //! Queued payloads are transmitted with as few system calls as the platform allows. Batches may be nested.
+        void BeginSendBatch();
+
+        //! Ends a send batch, transmitting all queued payloads once the outermost batch ends.
+        //! Payloads that fail to transmit are removed from the sent byte count, as a failed immediate send would be.
+        //! @return SocketOpResultSuccess if every queued payload was sent or would have blocked, SocketOpResultError otherwise
+        int32_t EndSendBatch();
+
         //! Receives a payload from the UDP socket.
         //! @param outAddress on success, the address of the endpoint that sent the data
         //! @param outData    on success, address to write the received data to
@@ -113,6 +135,10 @@ namespace AzNetworking
         //! @return the total number of additional bytes sent on this socket due to SSL encryption
         uint32_t GetSentBytesEncryptionInflation() const;
 
+        //! Returns the total number of system calls made to transmit data on this socket.
+        //! @return the total number of system calls made to transmit data on this socket
+        uint32_t GetSendCalls() const;
+
         //! Returns the total number of packets received on this socket.
         //! @return the total number of packets received on this socket
         uint32_t GetRecvPackets() const;
@@ -126,11 +152,38 @@ namespace AzNetworking
         mutable uint32_t m_sentPacketsEncrypted = 0;
         mutable uint32_t m_sentBytesEncryptionInflation = 0;
 
-        virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
+        virtual int32_t SendInternal(const IpAddress& address, const PacketBufferPtr& buffer, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
+
+        //! Transmits a payload, or queues it on the active send batch if it is owned by a pooled buffer.
+        //! @param address the address to send the payload to
+        //! @param buffer  the pooled buffer owning the payload, may be nullptr in which case the payload is transmitted immediately
+        //! @param data    pointer to the data to send
+        //! @param size    size of the payload in bytes
+        //! @return number of bytes sent or queued, < 0 on error
+        int32_t SendRaw(const IpAddress& address, const PacketBufferPtr& buffer, const uint8_t* data, uint32_t size) const;
 
     private:
 
+        int32_t SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        static constexpr uint32_t MaxSendBatchSize = 64;
+
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            PacketBufferPtr m_buffer;
+            const uint8_t* m_data = nullptr;
+            uint32_t m_size = 0;
+        };
+
+        int32_t FlushSendBatch() const;
+        int32_t OnBatchedSendFailed(const QueuedSend& queued) const;
+
         SocketFd m_socketFd = InvalidSocketFd;
+        uint32_t m_sendBatchDepth = 0;
+        mutable AZStd::fixed_vector<QueuedSend, MaxSendBatchSize> m_sendBatch;
+        mutable int32_t m_sendBatchResult = SocketOpResultSuccess;
+        mutable uint32_t m_sendCalls = 0;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
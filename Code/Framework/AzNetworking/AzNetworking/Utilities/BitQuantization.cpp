@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/BitQuantization.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    // The three smallest components of a unit quaternion are bounded by 1/sqrt(2)
+    static constexpr float SmallestThreeRange = 0.70710678f;
+
+    // Number of elements quantized per batch when serializing arrays, sized to keep the scratch buffers on the stack
+    static constexpr uint32_t SerializeBatchSize = 32;
+
+    uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t bitCount)
+    {
+        AZ_Assert((bitCount > 0) && (bitCount <= MaxQuantizedFloatBits), "Invalid quantization bit count %u", bitCount);
+        // Uses the same rounding as the batch quantizers, so scalar and batch encoded values are interchangeable
+        using Vec1 = AZ::Simd::Vec1;
+        const float maxQuantized = static_cast<float>(GetMaxQuantizedValue(bitCount));
+        const Vec1::FloatType scaled = Vec1::Splat((value - minValue) * (maxQuantized / (maxValue - minValue)));
+        const Vec1::FloatType clamped = Vec1::Clamp(scaled, Vec1::ZeroFloat(), Vec1::Splat(maxQuantized));
+        return static_cast<uint32_t>(Vec1::SelectFirst(Vec1::ConvertToFloat(Vec1::ConvertToIntNearest(clamped))));
+    }
+
+    float DequantizeFloat(uint32_t quantizedValue, float minValue, float maxValue, uint32_t bitCount)
+    {
+        AZ_Assert((bitCount > 0) && (bitCount <= MaxQuantizedFloatBits), "Invalid quantization bit count %u", bitCount);
+        const float maxQuantized = static_cast<float>(GetMaxQuantizedValue(bitCount));
+        return minValue + static_cast<float>(quantizedValue) * ((maxValue - minValue) / maxQuantized);
+    }
+
+    void QuantizeFloatArray(const float* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount, uint32_t* outQuantized)
+    {
+        AZ_Assert((bitCount > 0) && (bitCount <= MaxQuantizedFloatBits), "Invalid quantization bit count %u", bitCount);
+        using Vec4 = AZ::Simd::Vec4;
+        const float maxQuantized = static_cast<float>(GetMaxQuantizedValue(bitCount));
+        const Vec4::FloatType minimum = Vec4::Splat(minValue);
+        const Vec4::FloatType maximum = Vec4::Splat(maxQuantized);
+        const Vec4::FloatType toQuantized = Vec4::Splat(maxQuantized / (maxValue - minValue));
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        // Four values per iteration, loaded from and stored to the packed arrays directly
+        uint32_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const Vec4::FloatType scaled = Vec4::Mul(Vec4::Sub(Vec4::LoadUnaligned(values + i), minimum), toQuantized);
+            Vec4::StoreUnaligned(reinterpret_cast<int32_t*>(outQuantized + i), Vec4::ConvertToIntNearest(Vec4::Clamp(scaled, zero, maximum)));
+        }
+
+        for (; i < count; ++i)
+        {
+            outQuantized[i] = QuantizeFloat(values[i], minValue, maxValue, bitCount);
+        }
+    }
+
+    void DequantizeFloatArray(const uint32_t* quantized, uint32_t count, float minValue, float maxValue, uint32_t bitCount, float* outValues)
+    {
+        AZ_Assert((bitCount > 0) && (bitCount <= MaxQuantizedFloatBits), "Invalid quantization bit count %u", bitCount);
+        using Vec4 = AZ::Simd::Vec4;
+        const float maxQuantized = static_cast<float>(GetMaxQuantizedValue(bitCount));
+        const Vec4::FloatType minimum = Vec4::Splat(minValue);
+        const Vec4::FloatType toFloat = Vec4::Splat((maxValue - minValue) / maxQuantized);
+
+        uint32_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const Vec4::Int32Type integral = Vec4::LoadUnaligned(reinterpret_cast<const int32_t*>(quantized + i));
+            Vec4::StoreUnaligned(outValues + i, Vec4::Madd(Vec4::ConvertToFloat(integral), toFloat, minimum));
+        }
+
+        for (; i < count; ++i)
+        {
+            outValues[i] = DequantizeFloat(quantized[i], minValue, maxValue, bitCount);
+        }
+    }
+
+    void QuantizeVector3Array(const AZ::Vector3* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount, uint32_t* outQuantized)
+    {
+        // Every component shares the same range, so pack the components into a contiguous stream and quantize it four lanes at a time
+        // rather than one padded vector per instruction
+        float components[SerializeBatchSize * 3];
+        for (uint32_t batchStart = 0; batchStart < count; batchStart += SerializeBatchSize)
+        {
+            const uint32_t batchCount = AZStd::min(SerializeBatchSize, count - batchStart);
+            for (uint32_t i = 0; i < batchCount; ++i)
+            {
+                values[batchStart + i].StoreToFloat3(components + i * 3);
+            }
+            QuantizeFloatArray(components, batchCount * 3, minValue, maxValue, bitCount, outQuantized + batchStart * 3);
+        }
+    }
+
+    void DequantizeVector3Array(const uint32_t* quantized, uint32_t count, float minValue, float maxValue, uint32_t bitCount, AZ::Vector3* outValues)
+    {
+        float components[SerializeBatchSize * 3];
+        for (uint32_t batchStart = 0; batchStart < count; batchStart += SerializeBatchSize)
+        {
+            const uint32_t batchCount = AZStd::min(SerializeBatchSize, count - batchStart);
+            DequantizeFloatArray(quantized + batchStart * 3, batchCount * 3, minValue, maxValue, bitCount, components);
+            for (uint32_t i = 0; i < batchCount; ++i)
+            {
+                outValues[batchStart + i] = AZ::Vector3::CreateFromFloat3(components + i * 3);
+            }
+        }
+    }
+
+    void QuantizeQuaternionArray(const AZ::Quaternion* values, uint32_t count, uint32_t bitCount, uint32_t* outQuantized)
+    {
+        AZ_Assert((bitCount > 0) && (bitCount <= MaxQuantizedFloatBits), "Invalid quantization bit count %u", bitCount);
+        using Vec4 = AZ::Simd::Vec4;
+        const float maxQuantized = static_cast<float>(GetMaxQuantizedValue(bitCount));
+        const Vec4::FloatType minimum = Vec4::Splat(-SmallestThreeRange);
+        const Vec4::FloatType maximum = Vec4::Splat(maxQuantized);
+        const Vec4::FloatType toQuantized = Vec4::Splat(maxQuantized / (2.0f * SmallestThreeRange));
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const Vec4::FloatType value = values[i].GetSimdValue();
+            alignas(16) float magnitudes[4];
+            Vec4::StoreAligned(magnitudes, Vec4::Abs(value));
+
+            uint32_t largestIndex = 0;
+            for (uint32_t element = 1; element < 4; ++element)
+            {
+                largestIndex = (magnitudes[element] > magnitudes[largestIndex]) ? element : largestIndex;
+            }
+
+            // q and -q represent the same rotation, flip so the dropped component is positive and can be reconstructed without a sign bit
+            const Vec4::FloatType positive = (values[i].GetElement(largestIndex) < 0.0f) ? Vec4::Sub(zero, value) : value;
+
+            // Quantize all four lanes at once, the lane holding the dropped component is clamped and then discarded
+            const Vec4::FloatType scaled = Vec4::Mul(Vec4::Sub(positive, minimum), toQuantized);
+            alignas(16) int32_t quantized[4];
+            Vec4::StoreAligned(quantized, Vec4::ConvertToIntNearest(Vec4::Clamp(scaled, zero, maximum)));
+
+            uint32_t* output = outQuantized + i * QuantizedQuaternionElementCount;
+            output[0] = largestIndex;
+            for (uint32_t element = 0, outputIndex = 1; element < 4; ++element)
+            {
+                if (element != largestIndex)
+                {
+                    output[outputIndex++] = static_cast<uint32_t>(quantized[element]);
+                }
+            }
+        }
+    }
+
+    void DequantizeQuaternionArray(const uint32_t* quantized, uint32_t count, uint32_t bitCount, AZ::Quaternion* outValues)
+    {
+        AZ_Assert((bitCount > 0) && (bitCount <= MaxQuantizedFloatBits), "Invalid quantization bit count %u", bitCount);
+        using Vec4 = AZ::Simd::Vec4;
+        const float maxQuantized = static_cast<float>(GetMaxQuantizedValue(bitCount));
+        const Vec4::FloatType minimum = Vec4::Splat(-SmallestThreeRange);
+        const Vec4::FloatType toFloat = Vec4::Splat((2.0f * SmallestThreeRange) / maxQuantized);
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint32_t* input = quantized + i * QuantizedQuaternionElementCount;
+            const uint32_t largestIndex = AZStd::min<uint32_t>(input[0], 3);
+
+            alignas(16) int32_t integral[4];
+            for (uint32_t element = 0, inputIndex = 1; element < 4; ++element)
+            {
+                integral[element] = (element != largestIndex) ? static_cast<int32_t>(input[inputIndex++]) : 0;
+            }
+
+            alignas(16) float components[4];
+            Vec4::StoreAligned(components, Vec4::Madd(Vec4::ConvertToFloat(Vec4::LoadAligned(integral)), toFloat, minimum));
+
+            float sumOfSquares = 0.0f;
+            for (uint32_t element = 0; element < 4; ++element)
+            {
+                sumOfSquares += (element != largestIndex) ? components[element] * components[element] : 0.0f;
+            }
+            components[largestIndex] = AZ::Sqrt(AZStd::max(0.0f, 1.0f - sumOfSquares));
+
+            outValues[i] = AZ::Quaternion(Vec4::LoadAligned(components)).GetNormalized();
+        }
+    }
+
+    bool SerializeQuantizedVector3Array(ISerializer& serializer, AZ::Vector3* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount, const char* name)
+    {
+        const bool writeToObject = (serializer.GetSerializerMode() == SerializerMode::WriteToObject);
+        const uint32_t maxQuantized = GetMaxQuantizedValue(bitCount);
+        uint32_t quantized[SerializeBatchSize * 3];
+
+        serializer.BeginObject(name);
+        for (uint32_t batchStart = 0; (batchStart < count) && serializer.IsValid(); batchStart += SerializeBatchSize)
+        {
+            const uint32_t batchCount = AZStd::min(SerializeBatchSize, count - batchStart);
+            if (!writeToObject)
+            {
+                QuantizeVector3Array(values + batchStart, batchCount, minValue, maxValue, bitCount, quantized);
+            }
+
+            for (uint32_t i = 0; i < batchCount * 3; ++i)
+            {
+                serializer.Serialize(quantized[i], name, 0u, maxQuantized);
+            }
+
+            if (writeToObject && serializer.IsValid())
+            {
+                DequantizeVector3Array(quantized, batchCount, minValue, maxValue, bitCount, values + batchStart);
+            }
+        }
+        serializer.EndObject(name);
+        return serializer.IsValid();
+    }
+
+    bool SerializeQuantizedQuaternionArray(ISerializer& serializer, AZ::Quaternion* values, uint32_t count, uint32_t bitCount, const char* name)
+    {
+        const bool writeToObject = (serializer.GetSerializerMode() == SerializerMode::WriteToObject);
+        const uint32_t maxQuantized = GetMaxQuantizedValue(bitCount);
+        uint32_t quantized[SerializeBatchSize * QuantizedQuaternionElementCount];
+
+        serializer.BeginObject(name);
+        for (uint32_t batchStart = 0; (batchStart < count) && serializer.IsValid(); batchStart += SerializeBatchSize)
+        {
+            const uint32_t batchCount = AZStd::min(SerializeBatchSize, count - batchStart);
+            if (!writeToObject)
+            {
+                QuantizeQuaternionArray(values + batchStart, batchCount, bitCount, quantized);
+            }
+
+            for (uint32_t i = 0; i < batchCount; ++i)
+            {
+                uint32_t* element = quantized + i * QuantizedQuaternionElementCount;
+                serializer.Serialize(element[0], name, 0u, 3u);
+                serializer.Serialize(element[1], name, 0u, maxQuantized);
+                serializer.Serialize(element[2], name, 0u, maxQuantized);
+                serializer.Serialize(element[3], name, 0u, maxQuantized);
+            }
+
+            if (writeToObject && serializer.IsValid())
+            {
+                DequantizeQuaternionArray(quantized, batchCount, bitCount, values + batchStart);
+            }
+        }
+        serializer.EndObject(name);
+        return serializer.IsValid();
+    }
+
+    bool SerializeQuantizedTransformArray
+    (
+        ISerializer& serializer,
+        AZ::Transform* values,
+        uint32_t count,
+        float minTranslation,
+        float maxTranslation,
+        uint32_t translationBitCount,
+        uint32_t rotationBitCount,
+        const char* name
+    )
+    {
+        const bool writeToObject = (serializer.GetSerializerMode() == SerializerMode::WriteToObject);
+        AZ::Vector3 translations[SerializeBatchSize];
+        AZ::Quaternion rotations[SerializeBatchSize];
+        float scales[SerializeBatchSize];
+
+        serializer.BeginObject(name);
+        for (uint32_t batchStart = 0; (batchStart < count) && serializer.IsValid(); batchStart += SerializeBatchSize)
+        {
+            const uint32_t batchCount = AZStd::min(SerializeBatchSize, count - batchStart);
+            if (!writeToObject)
+            {
+                for (uint32_t i = 0; i < batchCount; ++i)
+                {
+                    translations[i] = values[batchStart + i].GetTranslation();
+                    rotations[i] = values[batchStart + i].GetRotation();
+                    scales[i] = values[batchStart + i].GetUniformScale();
+                }
+            }
+
+            SerializeQuantizedVector3Array(serializer, translations, batchCount, minTranslation, maxTranslation, translationBitCount, "Translation");
+            SerializeQuantizedQuaternionArray(serializer, rotations, batchCount, rotationBitCount, "Rotation");
+            for (uint32_t i = 0; i < batchCount; ++i)
+            {
+                serializer.Serialize(scales[i], "Scale");
+            }
+
+            if (writeToObject && serializer.IsValid())
+            {
+                for (uint32_t i = 0; i < batchCount; ++i)
+                {
+                    values[batchStart + i] = AZ::Transform(translations[i], rotations[i], scales[i]);
+                }
+            }
+        }
+        serializer.EndObject(name);
+        return serializer.IsValid();
+    }
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+
+namespace AzNetworking
+{
+    //! Maximum number of bits a float may be range coded into, wider values would exceed single precision float mantissa.
+    static constexpr uint32_t MaxQuantizedFloatBits = 24;
+
+    //! Number of quantized integers produced for each quaternion by the smallest-three encoding.
+    //! The first holds the index of the dropped largest component, the remaining three hold the other components.
+    static constexpr uint32_t QuantizedQuaternionElementCount = 4;
+
+    //! Returns the largest quantized integer representable in the provided number of bits.
+    //! @param bitCount number of bits used to encode the quantized value, in the range [1, MaxQuantizedFloatBits]
+    //! @return largest quantized integer representable in bitCount bits
+    constexpr uint32_t GetMaxQuantizedValue(uint32_t bitCount);
+
+    //! Range codes a float into an integer in [0, GetMaxQuantizedValue(bitCount)], clamping values outside [minValue, maxValue].
+    //! @param value    the value to quantize
+    //! @param minValue minimum value of the encoded range
+    //! @param maxValue maximum value of the encoded range
+    //! @param bitCount number of bits used to encode the quantized value
+    //! @return the quantized integer
+    uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t bitCount);
+
+    //! Decodes a float that was range coded using QuantizeFloat.
+    //! @param quantizedValue the quantized integer
+    //! @param minValue       minimum value of the encoded range
+    //! @param maxValue       maximum value of the encoded range
+    //! @param bitCount       number of bits used to encode the quantized value
+    //! @return the decoded value
+    float DequantizeFloat(uint32_t quantizedValue, float minValue, float maxValue, uint32_t bitCount);
+
+    //! Range codes an array of floats, four values at a time, using the same rounding as QuantizeFloat.
+    //! @param values       the values to quantize
+    //! @param count        number of values to quantize
+    //! @param minValue     minimum value of the encoded range
+    //! @param maxValue     maximum value of the encoded range
+    //! @param bitCount     number of bits used to encode each value
+    //! @param outQuantized receives count quantized integers
+    void QuantizeFloatArray(const float* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount, uint32_t* outQuantized);
+
+    //! Decodes an array of floats that was range coded using QuantizeFloatArray or QuantizeFloat.
+    //! @param quantized the count quantized integers
+    //! @param count     number of values to decode
+    //! @param minValue  minimum value of the encoded range
+    //! @param maxValue  maximum value of the encoded range
+    //! @param bitCount  number of bits used to encode each value
+    //! @param outValues receives the decoded values
+    void DequantizeFloatArray(const uint32_t* quantized, uint32_t count, float minValue, float maxValue, uint32_t bitCount, float* outValues);
+
+    //! Range codes every component of an array of vectors as one packed stream of floats.
+    //! @param values       the vectors to quantize
+    //! @param count        number of vectors to quantize
+    //! @param minValue     minimum component value of the encoded range
+    //! @param maxValue     maximum component value of the encoded range
+    //! @param bitCount     number of bits used to encode each component
+    //! @param outQuantized receives count * 3 quantized integers
+    void QuantizeVector3Array(const AZ::Vector3* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount, uint32_t* outQuantized);
+
+    //! Decodes an array of vectors that was range coded using QuantizeVector3Array.
+    //! @param quantized the count * 3 quantized integers
+    //! @param count     number of vectors to decode
+    //! @param minValue  minimum component value of the encoded range
+    //! @param maxValue  maximum component value of the encoded range
+    //! @param bitCount  number of bits used to encode each component
+    //! @param outValues receives the decoded vectors
+    void DequantizeVector3Array(const uint32_t* quantized, uint32_t count, float minValue, float maxValue, uint32_t bitCount, AZ::Vector3* outValues);
+
+    //! Quantizes an array of unit quaternions using the smallest-three encoding.
+    //! The largest magnitude component is dropped and reconstructed on decode, the remaining three lie in [-1/sqrt(2), 1/sqrt(2)]
+    //! which allows them to be encoded with more precision than a naive [-1, 1] range.
+    //! @param values       the normalized quaternions to quantize
+    //! @param count        number of quaternions to quantize
+    //! @param bitCount     number of bits used to encode each of the three retained components
+    //! @param outQuantized receives count * QuantizedQuaternionElementCount quantized integers
+    void QuantizeQuaternionArray(const AZ::Quaternion* values, uint32_t count, uint32_t bitCount, uint32_t* outQuantized);
+
+    //! Decodes an array of quaternions that was quantized using QuantizeQuaternionArray.
+    //! @param quantized the count * QuantizedQuaternionElementCount quantized integers
+    //! @param count     number of quaternions to decode
+    //! @param bitCount  number of bits used to encode each of the three retained components
+    //! @param outValues receives the decoded normalized quaternions
+    void DequantizeQuaternionArray(const uint32_t* quantized, uint32_t count, uint32_t bitCount, AZ::Quaternion* outValues);
+
+    //! Quantizes and serializes an array of vectors.
+    //! On a bit-packing serializer each component occupies exactly bitCount bits.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param values     the vectors to serialize, overwritten with the decoded values when writing to objects
+    //! @param count      number of vectors to serialize
+    //! @param minValue   minimum component value of the encoded range
+    //! @param maxValue   maximum component value of the encoded range
+    //! @param bitCount   number of bits used to encode each component
+    //! @param name       string name of the array being serialized
+    //! @return boolean true for success, false for serialization failure
+    bool SerializeQuantizedVector3Array(ISerializer& serializer, AZ::Vector3* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount, const char* name);
+
+    //! Quantizes and serializes an array of unit quaternions using the smallest-three encoding.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param values     the normalized quaternions to serialize, overwritten with the decoded values when writing to objects
+    //! @param count      number of quaternions to serialize
+    //! @param bitCount   number of bits used to encode each of the three retained components
+    //! @param name       string name of the array being serialized
+    //! @return boolean true for success, false for serialization failure
+    bool SerializeQuantizedQuaternionArray(ISerializer& serializer, AZ::Quaternion* values, uint32_t count, uint32_t bitCount, const char* name);
+
+    //! Quantizes and serializes an array of transforms.
+    //! Translations are range coded, rotations use the smallest-three encoding and uniform scale is sent at full precision.
+    //! @param serializer         ISerializer instance to use for serialization
+    //! @param values             the transforms to serialize, overwritten with the decoded values when writing to objects
+    //! @param count              number of transforms to serialize
+    //! @param minTranslation     minimum translation component value of the encoded range
+    //! @param maxTranslation     maximum translation component value of the encoded range
+    //! @param translationBitCount number of bits used to encode each translation component
+    //! @param rotationBitCount    number of bits used to encode each of the three retained rotation components
+    //! @param name               string name of the array being serialized
+    //! @return boolean true for success, false for serialization failure
+    bool SerializeQuantizedTransformArray
+    (
+        ISerializer& serializer,
+        AZ::Transform* values,
+        uint32_t count,
+        float minTranslation,
+        float maxTranslation,
+        uint32_t translationBitCount,
+        uint32_t rotationBitCount,
+        const char* name
+    );
+
+    //! @class QuantizedFloat
+    //! @brief A float that is range coded into NUM_BITS bits when serialized.
+    //!
+    //! Unlike QuantizedValues, which always serializes a whole number of bytes, the encoded width is an arbitrary number of
+    //! bits, so when visited by a bit-packing serializer only NUM_BITS bits are written. Suitable for use as a network property type.
+    template <uint32_t NUM_BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    class QuantizedFloat
+    {
+    public:
+
+        static_assert((NUM_BITS > 0) && (NUM_BITS <= MaxQuantizedFloatBits), "NUM_BITS must be in the range [1, MaxQuantizedFloatBits]");
+        static_assert(MIN_VALUE < MAX_VALUE, "MIN_VALUE must be less than MAX_VALUE");
+
+        using SelfType = QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>;
+
+        QuantizedFloat() = default;
+
+        //! Construct from float.
+        //! @param value value to construct from
+        explicit QuantizedFloat(float value);
+
+        //! Assignment from float.
+        //! @param rhs value to assign from
+        SelfType& operator =(float rhs);
+
+        //! Const underlying type operator.
+        //! @return the quantized value
+        operator float() const;
+
+        bool operator ==(const SelfType& rhs) const;
+        bool operator !=(const SelfType& rhs) const;
+
+        //! Retrieves the quantized integral value used during serialization.
+        //! @return the quantized integral value used during serialization
+        uint32_t GetQuantizedIntegralValue() const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+
+        float m_value = 0.0f;
+        uint32_t m_serializeValue = 0;
+    };
+
+    //! @class QuantizedQuaternion
+    //! @brief A unit quaternion that is serialized using the smallest-three encoding with NUM_BITS bits per retained component.
+    //!
+    //! On a bit-packing serializer a QuantizedQuaternion<10> occupies 32 bits, compared to 128 bits for a raw quaternion or
+    //! 64 bits for a 2 byte per element QuantizedValues. Suitable for use as a network property type.
+    template <uint32_t NUM_BITS>
+    class QuantizedQuaternion
+    {
+    public:
+
+        static_assert((NUM_BITS > 0) && (NUM_BITS <= MaxQuantizedFloatBits), "NUM_BITS must be in the range [1, MaxQuantizedFloatBits]");
+
+        using SelfType = QuantizedQuaternion<NUM_BITS>;
+
+        //! Default constructor, initializes to the identity rotation.
+        QuantizedQuaternion();
+
+        //! Construct from quaternion.
+        //! @param value normalized quaternion to construct from
+        explicit QuantizedQuaternion(const AZ::Quaternion& value);
+
+        //! Assignment from quaternion.
+        //! @param rhs normalized quaternion to assign from
+        SelfType& operator =(const AZ::Quaternion& rhs);
+
+        //! Const underlying type operator.
+        //! @return the quantized value
+        operator AZ::Quaternion() const;
+
+        bool operator ==(const SelfType& rhs) const;
+        bool operator !=(const SelfType& rhs) const;
+
+        //! Retrieves the quantized integral values used during serialization.
+        //! @return the QuantizedQuaternionElementCount quantized integral values used during serialization
+        const uint32_t* GetQuantizedIntegralValues() const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+
+        AZ::Quaternion m_value;
+        uint32_t m_serializeValues[QuantizedQuaternionElementCount];
+    };
+}
+
+#include <AzNetworking/Utilities/BitQuantization.inl>
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline constexpr uint32_t GetMaxQuantizedValue(uint32_t bitCount)
+    {
+        return (1u << bitCount) - 1;
+    }
+
+    template <uint32_t NUM_BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>::QuantizedFloat(float value)
+    {
+        *this = value;
+    }
+
+    template <uint32_t NUM_BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>& QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>::operator =(float rhs)
+    {
+        m_serializeValue = QuantizeFloat(rhs, static_cast<float>(MIN_VALUE), static_cast<float>(MAX_VALUE), NUM_BITS);
+        m_value = DequantizeFloat(m_serializeValue, static_cast<float>(MIN_VALUE), static_cast<float>(MAX_VALUE), NUM_BITS);
+        return *this;
+    }
+
+    template <uint32_t NUM_BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>::operator float() const
+    {
+        return m_value;
+    }
+
+    template <uint32_t NUM_BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline bool QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>::operator ==(const SelfType& rhs) const
+    {
+        return m_serializeValue == rhs.m_serializeValue;
+    }
+
+    template <uint32_t NUM_BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline bool QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>::operator !=(const SelfType& rhs) const
+    {
+        return m_serializeValue != rhs.m_serializeValue;
+    }
+
+    template <uint32_t NUM_BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline uint32_t QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>::GetQuantizedIntegralValue() const
+    {
+        return m_serializeValue;
+    }
+
+    template <uint32_t NUM_BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline bool QuantizedFloat<NUM_BITS, MIN_VALUE, MAX_VALUE>::Serialize(ISerializer& serializer)
+    {
+        if (serializer.Serialize(m_serializeValue, "Value", 0u, GetMaxQuantizedValue(NUM_BITS))
+         && (serializer.GetSerializerMode() == SerializerMode::WriteToObject))
+        {
+            m_value = DequantizeFloat(m_serializeValue, static_cast<float>(MIN_VALUE), static_cast<float>(MAX_VALUE), NUM_BITS);
+        }
+        return serializer.IsValid();
+    }
+
+    template <uint32_t NUM_BITS>
+    inline QuantizedQuaternion<NUM_BITS>::QuantizedQuaternion()
+    {
+        *this = AZ::Quaternion::CreateIdentity();
+    }
+
+    template <uint32_t NUM_BITS>
+    inline QuantizedQuaternion<NUM_BITS>::QuantizedQuaternion(const AZ::Quaternion& value)
+    {
+        *this = value;
+    }
+
+    template <uint32_t NUM_BITS>
+    inline QuantizedQuaternion<NUM_BITS>& QuantizedQuaternion<NUM_BITS>::operator =(const AZ::Quaternion& rhs)
+    {
+        QuantizeQuaternionArray(&rhs, 1, NUM_BITS, m_serializeValues);
+        DequantizeQuaternionArray(m_serializeValues, 1, NUM_BITS, &m_value);
+        return *this;
+    }
+
+    template <uint32_t NUM_BITS>
+    inline QuantizedQuaternion<NUM_BITS>::operator AZ::Quaternion() const
+    {
+        return m_value;
+    }
+
+    template <uint32_t NUM_BITS>
+    inline bool QuantizedQuaternion<NUM_BITS>::operator ==(const SelfType& rhs) const
+    {
+        for (uint32_t i = 0; i < QuantizedQuaternionElementCount; ++i)
+        {
+            if (m_serializeValues[i] != rhs.m_serializeValues[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <uint32_t NUM_BITS>
+    inline bool QuantizedQuaternion<NUM_BITS>::operator !=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    template <uint32_t NUM_BITS>
+    inline const uint32_t* QuantizedQuaternion<NUM_BITS>::GetQuantizedIntegralValues() const
+    {
+        return m_serializeValues;
+    }
+
+    template <uint32_t NUM_BITS>
+    inline bool QuantizedQuaternion<NUM_BITS>::Serialize(ISerializer& serializer)
+    {
+        serializer.Serialize(m_serializeValues[0], "LargestIndex", 0u, 3u);
+        serializer.Serialize(m_serializeValues[1], "A", 0u, GetMaxQuantizedValue(NUM_BITS));
+        serializer.Serialize(m_serializeValues[2], "B", 0u, GetMaxQuantizedValue(NUM_BITS));
+        serializer.Serialize(m_serializeValues[3], "C", 0u, GetMaxQuantizedValue(NUM_BITS));
+
+        if (serializer.IsValid() && (serializer.GetSerializerMode() == SerializerMode::WriteToObject))
+        {
+            DequantizeQuaternionArray(m_serializeValues, 1, NUM_BITS, &m_value);
+        }
+        return serializer.IsValid();
+    }
+}
@@ -109,6 +109,11 @@ namespace AzNetworking
     //! @return string label for the provided index
     template <AZStd::size_t MAX_VALUE>
     constexpr auto GenerateIndexLabel(AZStd::size_t value);
+
+    //! Returns the minimum number of bits required to represent every value in [0, range].
+    //! @param range the largest value that must be representable
+    //! @return number of bits required, 0 if range is 0
+    constexpr uint32_t GetBitCountForRange(uint64_t range);
 }
 
 AZ_TYPE_SAFE_INTEGRAL_SERIALIZEBINDING(AzNetworking::SequenceRolloverCount);
@@ -41,4 +41,15 @@ namespace AzNetworking
         result[NumHexDigits] = '\0'; // Guarantee null termination
         return result;
     }
+
+    inline constexpr uint32_t GetBitCountForRange(uint64_t range)
+    {
+        uint32_t bitCount = 0;
+        while (range > 0)
+        {
+            range >>= 1;
+            ++bitCount;
+        }
+        return bitCount;
+    }
 }
@@ -34,6 +34,9 @@ set(FILES
     DataStructures/FixedSizeVectorBitset.h
     DataStructures/FixedSizeVectorBitset.inl
     DataStructures/IBitset.h
+    DataStructures/PacketBuffer.cpp
+    DataStructures/PacketBuffer.h
+    DataStructures/PacketBuffer.inl
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
     DataStructures/TimeoutQueue.cpp
@@ -56,6 +59,10 @@ set(FILES
     Serialization/HashSerializer.h
     Serialization/ISerializer.h
     Serialization/ISerializer.inl
+    Serialization/NetworkBitInputSerializer.cpp
+    Serialization/NetworkBitInputSerializer.h
+    Serialization/NetworkBitOutputSerializer.cpp
+    Serialization/NetworkBitOutputSerializer.h
     Serialization/NetworkInputSerializer.cpp
     Serialization/NetworkInputSerializer.h
     Serialization/NetworkOutputSerializer.cpp
@@ -122,6 +129,9 @@ set(FILES
     UdpTransport/UdpSocket.cpp
     UdpTransport/UdpSocket.h
     UdpTransport/UdpSocket.inl
+    Utilities/BitQuantization.cpp
+    Utilities/BitQuantization.h
+    Utilities/BitQuantization.inl
     Utilities/CidrAddress.cpp
     Utilities/CidrAddress.h
     Utilities/EncryptionCommon.cpp
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBuffer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using PacketBufferTests = LeakDetectionFixture;
+
+    TEST_F(PacketBufferTests, AcquireReusesReleasedBuffers)
+    {
+        AzNetworking::PacketBufferPool pool;
+        const uint8_t* firstPayload = nullptr;
+        {
+            AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+            firstPayload = buffer->GetPayload();
+            EXPECT_EQ(pool.GetOutstandingCount(), 1u);
+        }
+        EXPECT_EQ(pool.GetOutstandingCount(), 0u);
+
+        AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+        EXPECT_EQ(buffer->GetPayload(), firstPayload);
+        EXPECT_EQ(buffer->GetPayloadSize(), 0u);
+        EXPECT_EQ(pool.GetAcquireCount(), 2u);
+        EXPECT_EQ(pool.GetAllocationCount(), 1u);
+    }
+
+    TEST_F(PacketBufferTests, SharedReferencesKeepBufferAlive)
+    {
+        AzNetworking::PacketBufferPool pool;
+        AzNetworking::PacketBufferPtr retained;
+        {
+            AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+            retained = buffer;
+        }
+        EXPECT_EQ(pool.GetOutstandingCount(), 1u);
+
+        AzNetworking::PacketBufferPtr other = pool.Acquire();
+        EXPECT_NE(other.get(), retained.get());
+        EXPECT_EQ(pool.GetAllocationCount(), 2u);
+    }
+
+    TEST_F(PacketBufferTests, MaxPooledBuffersIsRespected)
+    {
+        AzNetworking::PacketBufferPool pool(1);
+        {
+            AzNetworking::PacketBufferPtr first = pool.Acquire();
+            AzNetworking::PacketBufferPtr second = pool.Acquire();
+        }
+        {
+            AzNetworking::PacketBufferPtr first = pool.Acquire();
+            AzNetworking::PacketBufferPtr second = pool.Acquire();
+        }
+        // Only one of the two released buffers was kept, so the second pair needed one new allocation
+        EXPECT_EQ(pool.GetAllocationCount(), 3u);
+    }
+
+    TEST_F(PacketBufferTests, PrependHeaderIsContiguousWithPayload)
+    {
+        AzNetworking::PacketBufferPool pool;
+        AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+
+        const uint8_t payload[] = { 4, 5, 6 };
+        memcpy(buffer->GetPayload(), payload, sizeof(payload));
+        buffer->SetPayloadSize(sizeof(payload));
+
+        const uint8_t header[] = { 1, 2, 3 };
+        uint8_t* headerStart = buffer->PrependHeader(sizeof(header));
+        memcpy(headerStart, header, sizeof(header));
+
+        const uint8_t expected[] = { 1, 2, 3, 4, 5, 6 };
+        EXPECT_EQ(memcmp(headerStart, expected, sizeof(expected)), 0);
+        EXPECT_EQ(buffer->GetPayloadSize(), sizeof(payload));
+    }
+}
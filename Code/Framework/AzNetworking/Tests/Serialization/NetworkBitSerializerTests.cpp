@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    struct BitPackedDataElement
+    {
+        bool testBool = false;
+        char testChar = 'a';
+        int8_t testInt8 = 0;
+        int16_t testInt16 = 1;
+        int32_t testInt32 = 2;
+        int64_t testInt64 = 3;
+        uint8_t testUint8 = 0;
+        uint16_t testUint16 = 1;
+        uint32_t testUint32 = 2;
+        uint64_t testUint64 = 3;
+        uint32_t testRanged = 0;
+        int32_t testSignedRanged = 0;
+        double testDouble = 1.0;
+        float testFloat = 1.f;
+        AZStd::fixed_string<32> testFixedString = "FixedString";
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            return serializer.Serialize(testBool, "TestBool") && serializer.Serialize(testChar, "TestChar")
+                && serializer.Serialize(testInt8, "TestInt8") && serializer.Serialize(testInt16, "TestInt16")
+                && serializer.Serialize(testInt32, "TestInt32") && serializer.Serialize(testInt64, "TestInt64")
+                && serializer.Serialize(testUint8, "TestUint8") && serializer.Serialize(testUint16, "TestUint16")
+                && serializer.Serialize(testUint32, "TestUint32") && serializer.Serialize(testUint64, "TestUint64")
+                && serializer.Serialize(testRanged, "TestRanged", 0u, 1000u)
+                && serializer.Serialize(testSignedRanged, "TestSignedRanged", -3, 4)
+                && serializer.Serialize(testDouble, "TestDouble") && serializer.Serialize(testFloat, "TestFloat")
+                && serializer.Serialize(testFixedString, "TestFixedString");
+        }
+    };
+
+    using NetworkBitSerializerTests = LeakDetectionFixture;
+
+    TEST_F(NetworkBitSerializerTests, RoundTripAllTypes)
+    {
+        AZStd::array<uint8_t, 256> buffer;
+
+        BitPackedDataElement inElement;
+        inElement.testBool = true;
+        inElement.testChar = 'z';
+        inElement.testInt8 = -100;
+        inElement.testInt16 = -30000;
+        inElement.testInt32 = AZStd::numeric_limits<int32_t>::min();
+        inElement.testInt64 = AZStd::numeric_limits<int64_t>::min() + 5;
+        inElement.testUint8 = 200;
+        inElement.testUint16 = 60000;
+        inElement.testUint32 = 4000000000u;
+        inElement.testUint64 = AZStd::numeric_limits<uint64_t>::max();
+        inElement.testRanged = 999;
+        inElement.testSignedRanged = -3;
+        inElement.testDouble = -2.25;
+        inElement.testFloat = 3.5f;
+        inElement.testFixedString = "BitPacked";
+
+        AzNetworking::NetworkBitInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inElement.Serialize(inSerializer));
+
+        BitPackedDataElement outElement;
+        AzNetworking::NetworkBitOutputSerializer outSerializer(buffer.data(), inSerializer.GetSize());
+        EXPECT_TRUE(outElement.Serialize(outSerializer));
+        EXPECT_EQ(outSerializer.GetReadBitSize(), inSerializer.GetBitSize());
+
+        EXPECT_EQ(inElement.testBool, outElement.testBool);
+        EXPECT_EQ(inElement.testChar, outElement.testChar);
+        EXPECT_EQ(inElement.testInt8, outElement.testInt8);
+        EXPECT_EQ(inElement.testInt16, outElement.testInt16);
+        EXPECT_EQ(inElement.testInt32, outElement.testInt32);
+        EXPECT_EQ(inElement.testInt64, outElement.testInt64);
+        EXPECT_EQ(inElement.testUint8, outElement.testUint8);
+        EXPECT_EQ(inElement.testUint16, outElement.testUint16);
+        EXPECT_EQ(inElement.testUint32, outElement.testUint32);
+        EXPECT_EQ(inElement.testUint64, outElement.testUint64);
+        EXPECT_EQ(inElement.testRanged, outElement.testRanged);
+        EXPECT_EQ(inElement.testSignedRanged, outElement.testSignedRanged);
+        EXPECT_EQ(inElement.testDouble, outElement.testDouble);
+        EXPECT_EQ(inElement.testFloat, outElement.testFloat);
+        EXPECT_EQ(inElement.testFixedString, outElement.testFixedString);
+    }
+
+    TEST_F(NetworkBitSerializerTests, BoundedValuesUseMinimalBits)
+    {
+        AZStd::array<uint8_t, 16> buffer;
+        AzNetworking::NetworkBitInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::ISerializer& serializer = inSerializer;
+
+        bool flag = true;
+        uint32_t tenBits = 1023;
+        int8_t threeBits = -2;
+        serializer.Serialize(flag, "Flag");
+        serializer.Serialize(tenBits, "TenBits", 0u, 1023u);
+        serializer.Serialize(threeBits, "ThreeBits", int8_t(-4), int8_t(3));
+
+        EXPECT_TRUE(inSerializer.IsValid());
+        EXPECT_EQ(inSerializer.GetBitSize(), 14u);
+        EXPECT_EQ(inSerializer.GetSize(), 2u);
+    }
+
+    TEST_F(NetworkBitSerializerTests, SerializeBitsAcrossByteBoundaries)
+    {
+        AZStd::array<uint8_t, 32> buffer;
+        AzNetworking::NetworkBitInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inSerializer.SerializeBits(0x5, 3));
+        EXPECT_TRUE(inSerializer.SerializeBits(0x123456789ABCDEF0ull, 64));
+        EXPECT_TRUE(inSerializer.SerializeBits(0x1FFFF, 17));
+
+        AzNetworking::NetworkBitOutputSerializer outSerializer(buffer.data(), inSerializer.GetSize());
+        uint64_t value = 0;
+        EXPECT_TRUE(outSerializer.SerializeBits(value, 3));
+        EXPECT_EQ(value, 0x5u);
+        EXPECT_TRUE(outSerializer.SerializeBits(value, 64));
+        EXPECT_EQ(value, 0x123456789ABCDEF0ull);
+        EXPECT_TRUE(outSerializer.SerializeBits(value, 17));
+        EXPECT_EQ(value, 0x1FFFFu);
+    }
+
+    TEST_F(NetworkBitSerializerTests, OverflowInvalidatesSerializer)
+    {
+        AZStd::array<uint8_t, 1> buffer;
+        AzNetworking::NetworkBitInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inSerializer.SerializeBits(0x7, 7));
+        EXPECT_FALSE(inSerializer.SerializeBits(0x3, 2));
+        EXPECT_FALSE(inSerializer.IsValid());
+
+        AzNetworking::NetworkBitOutputSerializer outSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::ISerializer& serializer = outSerializer;
+        uint16_t value = 0;
+        EXPECT_FALSE(serializer.Serialize(value, "Value", uint16_t(0), uint16_t(1000)));
+        EXPECT_FALSE(outSerializer.IsValid());
+    }
+
+    TEST_F(NetworkBitSerializerTests, OutOfRangeValueInvalidatesSerializer)
+    {
+        AZStd::array<uint8_t, 4> buffer;
+        AzNetworking::NetworkBitInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::ISerializer& serializer = inSerializer;
+        uint32_t value = 8;
+        EXPECT_FALSE(serializer.Serialize(value, "Value", 0u, 7u));
+    }
+}
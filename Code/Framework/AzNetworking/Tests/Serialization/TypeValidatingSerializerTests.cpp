@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/Console/Console.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Serialization/TypeValidatingSerializer.h>
@@ -101,6 +103,25 @@ namespace UnitTest
         EXPECT_EQ(inElement.testFixedString, outElement.testFixedString);
     }
 
+    TEST_F(TypeValidatingSerializerTests, TestTypeValidatingBitPackedSerializer)
+    {
+        AZStd::array<uint8_t, 2048> buffer;
+
+        TypeValidatingDataElement inElement;
+        inElement.testInt64 = -12345;
+        inElement.testFixedString = "BitPacked";
+        AzNetworking::TypeValidatingSerializer<AzNetworking::NetworkBitInputSerializer> inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inElement.Serialize(inSerializer));
+
+        TypeValidatingDataElement outElement;
+        AzNetworking::TypeValidatingSerializer<AzNetworking::NetworkBitOutputSerializer> outSerializer(
+            static_cast<const uint8_t*>(buffer.data()), inSerializer.GetSize());
+        EXPECT_TRUE(outElement.Serialize(outSerializer));
+
+        EXPECT_EQ(inElement.testInt64, outElement.testInt64);
+        EXPECT_EQ(inElement.testFixedString, outElement.testFixedString);
+    }
+
     TEST_F(TypeValidatingSerializerTests, TestTypeValidatingNameMismatch)
     {
         TypeValidatingDataElement inElement;
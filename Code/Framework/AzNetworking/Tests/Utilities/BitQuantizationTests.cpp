@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/BitQuantization.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using BitQuantizationTests = LeakDetectionFixture;
+
+    // q and -q represent the same rotation, and smallest-three encoding is free to return either
+    static bool IsSameRotation(const AZ::Quaternion& lhs, const AZ::Quaternion& rhs, float tolerance)
+    {
+        return lhs.IsClose(rhs, tolerance) || lhs.IsClose(-rhs, tolerance);
+    }
+
+    TEST_F(BitQuantizationTests, QuantizeFloatRoundTrip)
+    {
+        EXPECT_EQ(AzNetworking::QuantizeFloat(-10.0f, -10.0f, 10.0f, 8), 0u);
+        EXPECT_EQ(AzNetworking::QuantizeFloat(10.0f, -10.0f, 10.0f, 8), 255u);
+        EXPECT_EQ(AzNetworking::QuantizeFloat(100.0f, -10.0f, 10.0f, 8), 255u);
+        EXPECT_EQ(AzNetworking::QuantizeFloat(-100.0f, -10.0f, 10.0f, 8), 0u);
+
+        const float value = 1.2345f;
+        const uint32_t quantized = AzNetworking::QuantizeFloat(value, -10.0f, 10.0f, 16);
+        EXPECT_NEAR(AzNetworking::DequantizeFloat(quantized, -10.0f, 10.0f, 16), value, 20.0f / 65535.0f);
+    }
+
+    TEST_F(BitQuantizationTests, QuantizeFloatArrayMatchesScalar)
+    {
+        constexpr uint32_t Count = 7; // Covers both the four wide loop and the remainder
+        const float values[Count] = { -20.0f, -10.0f, -3.75f, 0.0f, 1.2345f, 9.99f, 20.0f };
+
+        uint32_t quantized[Count];
+        AzNetworking::QuantizeFloatArray(values, Count, -10.0f, 10.0f, 10, quantized);
+        for (uint32_t i = 0; i < Count; ++i)
+        {
+            EXPECT_EQ(quantized[i], AzNetworking::QuantizeFloat(values[i], -10.0f, 10.0f, 10));
+        }
+
+        float decoded[Count];
+        AzNetworking::DequantizeFloatArray(quantized, Count, -10.0f, 10.0f, 10, decoded);
+        for (uint32_t i = 0; i < Count; ++i)
+        {
+            EXPECT_NEAR(decoded[i], AzNetworking::DequantizeFloat(quantized[i], -10.0f, 10.0f, 10), 0.0001f);
+        }
+    }
+
+    TEST_F(BitQuantizationTests, QuantizeVector3ArrayMatchesScalar)
+    {
+        constexpr uint32_t Count = 5;
+        const AZ::Vector3 values[Count] = {
+            AZ::Vector3(-50.0f, 0.0f, 50.0f), AZ::Vector3(1.0f, 2.0f, 3.0f), AZ::Vector3(-0.5f, 0.25f, 12.75f),
+            AZ::Vector3(100.0f, -100.0f, 0.0f), AZ::Vector3(33.3f, -33.3f, 7.0f) };
+
+        uint32_t quantized[Count * 3];
+        AzNetworking::QuantizeVector3Array(values, Count, -50.0f, 50.0f, 12, quantized);
+        for (uint32_t i = 0; i < Count; ++i)
+        {
+            for (uint32_t element = 0; element < 3; ++element)
+            {
+                const float component = values[i].GetElement(element);
+                EXPECT_EQ(quantized[i * 3 + element], AzNetworking::QuantizeFloat(component, -50.0f, 50.0f, 12));
+            }
+        }
+
+        AZ::Vector3 decoded[Count];
+        AzNetworking::DequantizeVector3Array(quantized, Count, -50.0f, 50.0f, 12, decoded);
+        EXPECT_TRUE(decoded[1].IsClose(values[1], 0.05f));
+        EXPECT_TRUE(decoded[3].IsClose(AZ::Vector3(50.0f, -50.0f, 0.0f), 0.05f));
+    }
+
+    TEST_F(BitQuantizationTests, QuantizeQuaternionArrayRoundTrip)
+    {
+        constexpr uint32_t Count = 4;
+        const AZ::Quaternion values[Count] = {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationZ(1.2f) * AZ::Quaternion::CreateRotationX(-2.3f),
+            AZ::Quaternion::CreateRotationY(3.1f),
+            AZ::Quaternion(-0.5f, 0.5f, -0.5f, 0.5f) };
+
+        uint32_t quantized[Count * AzNetworking::QuantizedQuaternionElementCount];
+        AzNetworking::QuantizeQuaternionArray(values, Count, 10, quantized);
+
+        AZ::Quaternion decoded[Count];
+        AzNetworking::DequantizeQuaternionArray(quantized, Count, 10, decoded);
+        for (uint32_t i = 0; i < Count; ++i)
+        {
+            EXPECT_NEAR(decoded[i].GetLength(), 1.0f, 0.001f);
+            EXPECT_TRUE(IsSameRotation(decoded[i], values[i], 0.005f));
+        }
+    }
+
+    TEST_F(BitQuantizationTests, SerializeQuantizedTransformArray)
+    {
+        constexpr uint32_t Count = 40;
+        AZ::Transform values[Count];
+        for (uint32_t i = 0; i < Count; ++i)
+        {
+            const float offset = static_cast<float>(i);
+            values[i] = AZ::Transform(
+                AZ::Vector3(offset - 20.0f, offset * 0.5f, -offset), AZ::Quaternion::CreateRotationZ(offset * 0.1f), 1.0f + offset * 0.01f);
+        }
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkBitInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(AzNetworking::SerializeQuantizedTransformArray(inSerializer, values, Count, -64.0f, 64.0f, 16, 12, "Transforms"));
+
+        // 3 * 16 bits translation, 2 + 3 * 12 bits rotation and 32 bits scale per transform
+        EXPECT_EQ(inSerializer.GetBitSize(), Count * (48u + 38u + 32u));
+
+        AZ::Transform decoded[Count];
+        AzNetworking::NetworkBitOutputSerializer outSerializer(buffer.data(), inSerializer.GetSize());
+        EXPECT_TRUE(AzNetworking::SerializeQuantizedTransformArray(outSerializer, decoded, Count, -64.0f, 64.0f, 16, 12, "Transforms"));
+        for (uint32_t i = 0; i < Count; ++i)
+        {
+            EXPECT_TRUE(decoded[i].GetTranslation().IsClose(values[i].GetTranslation(), 0.01f));
+            EXPECT_TRUE(IsSameRotation(decoded[i].GetRotation(), values[i].GetRotation(), 0.005f));
+            EXPECT_FLOAT_EQ(decoded[i].GetUniformScale(), values[i].GetUniformScale());
+        }
+    }
+
+    TEST_F(BitQuantizationTests, QuantizedTypesSerialize)
+    {
+        AZStd::array<uint8_t, 16> buffer;
+        AzNetworking::QuantizedFloat<9, -5, 5> inFloat(1.234f);
+        AzNetworking::QuantizedQuaternion<10> inQuaternion(AZ::Quaternion::CreateRotationY(0.75f));
+
+        AzNetworking::NetworkBitInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inFloat.Serialize(inSerializer));
+        EXPECT_TRUE(inQuaternion.Serialize(inSerializer));
+        EXPECT_EQ(inSerializer.GetBitSize(), 9u + 32u);
+
+        AzNetworking::QuantizedFloat<9, -5, 5> outFloat;
+        AzNetworking::QuantizedQuaternion<10> outQuaternion;
+        AzNetworking::NetworkBitOutputSerializer outSerializer(buffer.data(), inSerializer.GetSize());
+        EXPECT_TRUE(outFloat.Serialize(outSerializer));
+        EXPECT_TRUE(outQuaternion.Serialize(outSerializer));
+
+        EXPECT_EQ(inFloat, outFloat);
+        EXPECT_EQ(inQuaternion, outQuaternion);
+        EXPECT_NEAR(static_cast<float>(outFloat), 1.234f, 10.0f / 511.0f);
+        EXPECT_TRUE(IsSameRotation(outQuaternion, AZ::Quaternion::CreateRotationY(0.75f), 0.005f));
+    }
+}
@@ -31,4 +31,14 @@ namespace UnitTest
     {
         EXPECT_STREQ(AzNetworking::GenerateIndexLabel<UINT_MAX>(UINT_MAX).c_str(), "FFFFFFFF");
     }
+
+    TEST(NetworkCommon, GetBitCountForRange)
+    {
+        EXPECT_EQ(AzNetworking::GetBitCountForRange(0), 0u);
+        EXPECT_EQ(AzNetworking::GetBitCountForRange(1), 1u);
+        EXPECT_EQ(AzNetworking::GetBitCountForRange(7), 3u);
+        EXPECT_EQ(AzNetworking::GetBitCountForRange(8), 4u);
+        EXPECT_EQ(AzNetworking::GetBitCountForRange(1023), 10u);
+        EXPECT_EQ(AzNetworking::GetBitCountForRange(UINT64_MAX), 64u);
+    }
 }
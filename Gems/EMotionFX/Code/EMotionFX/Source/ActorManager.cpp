@@ -11,11 +11,14 @@
 #include "ActorManager.h"
 #include "ActorInstance.h"
 #include "MultiThreadScheduler.h"
+#include "TaskGraphScheduler.h"
 #include <MCore/Source/LogManager.h>
 #include <MCore/Source/StringConversions.h>
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace EMotionFX
 {
@@ -27,8 +30,17 @@ namespace EMotionFX
     {
         m_scheduler  = nullptr;
 
-        // setup the default scheduler
-        SetScheduler(MultiThreadScheduler::Create());
+        // setup the default scheduler, which runs on the task graph when the task graph is active
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        if (useTaskGraph)
+        {
+            SetScheduler(TaskGraphScheduler::Create());
+        }
+        else
+        {
+            SetScheduler(MultiThreadScheduler::Create());
+        }
 
         // reserve memory
         m_actorInstances.reserve(1024);
@@ -56,6 +56,8 @@ namespace EMotionFX
 
         // copy the bone info (for precalc/optimization reasons)
         result->m_bones = m_bones;
+        result->m_boneDualQuats = m_boneDualQuats;
+        result->m_influences = m_influences;
 
         // return the result
         return result;
@@ -68,11 +70,12 @@ namespace EMotionFX
         const Pose* pose = actorInstance->GetTransformData()->GetCurrentPose();
 
         // Calculate the skinning matrices based on the current pose.
-        for (BoneInfo& boneInfo : m_bones)
+        const size_t numBones = m_bones.size();
+        for (size_t i = 0; i < numBones; ++i)
         {
-            const size_t nodeIndex = boneInfo.m_nodeNr;
+            const size_t nodeIndex = m_bones[i].m_nodeNr;
             const Transform skinTransform = actor->GetInverseBindPoseTransform(nodeIndex) * pose->GetModelSpaceTransform(nodeIndex);
-            boneInfo.m_dualQuat.FromRotationTranslation(skinTransform.m_rotation, skinTransform.m_position);
+            m_boneDualQuats[i].FromRotationTranslation(skinTransform.m_rotation, skinTransform.m_position);
         }
 
         if (m_useTaskGraph)
@@ -87,7 +90,7 @@ namespace EMotionFX
             AZ::JobCompletion jobCompletion;
 
             // Split up the skinned vertices into batches.
-            const uint32 numVertices = m_mesh->GetNumVertices();
+            const AZ::u32 numVertices = aznumeric_cast<AZ::u32>(m_influences.GetNumVertices());
             const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
             for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
             {
@@ -98,7 +101,7 @@ namespace EMotionFX
                 AZ::JobContext* jobContext = nullptr;
                 AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinRange(startVertex, endVertex);
                     }, /*isAutoDelete=*/true, jobContext);
 
                 job->SetDependent(&jobCompletion);
@@ -109,185 +112,9 @@ namespace EMotionFX
         }
     }
 
-    void DualQuatSkinDeformer::SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos)
+    void DualQuatSkinDeformer::SkinRange(AZ::u32 startIndex, AZ::u32 endIndex) const
     {
-        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
-        AZ_Assert(layer, "Cannot find skinning layer.");
-
-        AZ::Vector3 newTangent;
-        AZ::Vector3 vtxPos, normal, tangent, bitangent;
-        AZ::u32 orgVertex;
-        float weight;
-
-        AZ::Vector3* positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
-        AZ::Vector3* normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
-        AZ::Vector4* tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
-        AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
-        AZ::u32* orgVerts = static_cast<AZ::u32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
-            {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-                bitangent = bitangents[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = skinQuat.TransformVector(bitangent);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = bitangent;
-                }
-            }
-        }
-        else if (tangents && !bitangents) // tangents but no bitangents
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
-            {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
-            }
-        }
-        else // there are no tangents and bitangents to skin
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
-            {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                }
-            }
-        }
+        SkinningKernels::DualQuaternion(m_influences, startIndex, endIndex, m_boneDualQuats.data(), SkinningKernels::VertexStreams::Create(m_mesh));
     }
 
     // initialize the mesh deformer
@@ -299,6 +126,8 @@ namespace EMotionFX
 
         // clear the bone information array, but don't free the currently allocated/reserved memory
         m_bones.clear();
+        m_boneDualQuats.clear();
+        m_influences.Clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -333,8 +162,8 @@ namespace EMotionFX
                     // add the bone to the array of bones in this deformer
                     BoneInfo lastBone;
                     lastBone.m_nodeNr = nodeIndex;
-                    lastBone.m_dualQuat.Identity();
                     m_bones.emplace_back(lastBone);
+                    m_boneDualQuats.emplace_back(MCore::DualQuaternion());
                     boneIndex = static_cast<AZ::u16>(m_bones.size() - 1);
                     localBoneMap[nodeIndex] = boneIndex;
                 }
@@ -344,12 +173,15 @@ namespace EMotionFX
             }
         }
 
+        // Sort the influences by their number per vertex, now that their bone numbers are set.
+        m_influences.Init(m_mesh);
+
         if (m_useTaskGraph)
         {
             // Prepare the task graph
             // Split up the to be skinned vertices into batches. As the mesh does not change at runtime, the task graph can
             // be prepared at init time and be reused at runtime.
-            const uint32 numVertices = m_mesh->GetNumVertices();
+            const AZ::u32 numVertices = aznumeric_cast<AZ::u32>(m_influences.GetNumVertices());
             const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
             for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
             {
@@ -362,7 +194,7 @@ namespace EMotionFX
                     taskDescriptor,
                     [this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinRange(startVertex, endVertex);
                     });
             }
         }
@@ -15,6 +15,7 @@
 #include <MCore/Source/DualQuaternion.h>
 #include "Mesh.h"
 #include "MeshDeformer.h"
+#include "SkinningKernels.h"
 
 namespace EMotionFX
 {
@@ -112,7 +113,7 @@ namespace EMotionFX
          * This does not alter the value returned by GetNumLocalBones().
          * @param numBones The number of bones to pre-allocate space for.
          */
-        MCORE_INLINE void ReserveLocalBones(size_t numBones)                { m_bones.reserve(numBones); }
+        MCORE_INLINE void ReserveLocalBones(size_t numBones)                { m_bones.reserve(numBones); m_boneDualQuats.reserve(numBones); }
 
     protected:
         /**
@@ -121,21 +122,20 @@ namespace EMotionFX
         struct EMFX_API BoneInfo
         {
             size_t                  m_nodeNr;        /**< The node number. */
-            MCore::DualQuaternion   m_dualQuat;      /**< The dual quat of the pre-calculated matrix that contains the "globalMatrix * inverse(bindPoseMatrix)". */
 
             MCORE_INLINE BoneInfo()
                 : m_nodeNr(InvalidIndex) {}
         };
         AZStd::vector<BoneInfo> m_bones; /**< The array of bone information used for pre-calculation. */
+        AZStd::vector<MCore::DualQuaternion> m_boneDualQuats; /**< The dual quats of the pre-calculated matrices that contain the "globalMatrix * inverse(bindPoseMatrix)", one for every bone. */
+        SkinningInfluences m_influences; /**< The skinning influences of the mesh, sorted by the number of influences per vertex. */
 
         /**
          * Skin a part of the mesh.
-         * @param mesh The mesh to be skinned.
-         * @param startVertex The start vertex index to start skinning.
-         * @param endVertex The end vertex index for the range to be skinned.
-         * @param boneInfos The pre-calculated skinning matrices shared across the skinning process.
+         * @param startIndex The first vertex to skin, as index in the sorted order of the skinning influences.
+         * @param endIndex The vertex after the last vertex to skin, as index in the sorted order of the skinning influences.
          */
-        static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
+        void SkinRange(AZ::u32 startIndex, AZ::u32 endIndex) const;
 
         //! Number of vertices per batch/job used for multi-threaded software skinning.
         static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
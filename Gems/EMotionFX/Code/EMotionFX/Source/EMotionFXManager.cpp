@@ -22,8 +22,11 @@
 #include <MCore/Source/MemoryTracker.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/DebugDraw.h>
@@ -77,7 +80,13 @@ namespace EMotionFX
         gEMFX.Get()->SetGlobalSimulationSpeed (1.0f);
 
         // set the number of threads
-        const AZ::u32 numThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        // The TaskGraphScheduler updates the actor instances on the task graph workers, which use their worker index as thread index,
+        // so when the task graph system is available there has to be thread data for each of its workers as well.
+        AZ::u32 numThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        if (AZ::Interface<AZ::TaskGraphActiveInterface>::Get())
+        {
+            numThreads = AZStd::max(numThreads, AZ::TaskExecutor::Instance().GetThreadCount());
+        }
         AZ_Assert(numThreads > 0, "The number of threads is expected to be bigger than 0.");
         gEMFX.Get()->SetNumThreads(numThreads);
 
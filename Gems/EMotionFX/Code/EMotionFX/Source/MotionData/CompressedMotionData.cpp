@@ -0,0 +1,1259 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        constexpr float s_maxQuantizedValue = 65535.0f;
+
+        // Calculate the range of a track, where the step is the value difference between two successive quantized values.
+        void CalcQuantizationRange(const AZ::Vector3& minValue, const AZ::Vector3& maxValue, AZ::Vector3& outRangeMin, AZ::Vector3& outRangeStep)
+        {
+            outRangeMin = minValue;
+            outRangeStep = (maxValue - minValue) / s_maxQuantizedValue;
+        }
+
+        AZ::u16 QuantizeValue(float value, float rangeMin, float rangeStep)
+        {
+            if (rangeStep <= 0.0f)
+            {
+                return 0;
+            }
+
+            return static_cast<AZ::u16>(AZ::GetClamp((value - rangeMin) / rangeStep + 0.5f, 0.0f, s_maxQuantizedValue));
+        }
+
+        void QuantizeVector3(const AZ::Vector3& value, const AZ::Vector3& rangeMin, const AZ::Vector3& rangeStep, AZ::u16* outValues)
+        {
+            outValues[0] = QuantizeValue(value.GetX(), rangeMin.GetX(), rangeStep.GetX());
+            outValues[1] = QuantizeValue(value.GetY(), rangeMin.GetY(), rangeStep.GetY());
+            outValues[2] = QuantizeValue(value.GetZ(), rangeMin.GetZ(), rangeStep.GetZ());
+        }
+
+        AZ::Vector3 DequantizeVector3(const AZ::u16* values, const AZ::Vector3& rangeMin, const AZ::Vector3& rangeStep)
+        {
+            return rangeMin + AZ::Vector3(static_cast<float>(values[0]), static_cast<float>(values[1]), static_cast<float>(values[2])) * rangeStep;
+        }
+
+        // Interpolate in quantized space, which is the same as interpolating the dequantized values, as the mapping is linear.
+        AZ::Vector3 DequantizeVector3(const AZ::u16* valuesA, const AZ::u16* valuesB, float t, const AZ::Vector3& rangeMin, const AZ::Vector3& rangeStep)
+        {
+            const AZ::Vector3 a(static_cast<float>(valuesA[0]), static_cast<float>(valuesA[1]), static_cast<float>(valuesA[2]));
+            const AZ::Vector3 b(static_cast<float>(valuesB[0]), static_cast<float>(valuesB[1]), static_cast<float>(valuesB[2]));
+            return rangeMin + a.Lerp(b, t) * rangeStep;
+        }
+
+        // Only the imaginary part of the rotation gets stored, so make sure w is positive so it can be reconstructed.
+        AZ::Vector3 GetRotationImaginary(const AZ::Quaternion& rotation)
+        {
+            const AZ::Quaternion normalized = rotation.GetNormalized();
+            return (normalized.GetW() < 0.0f) ? -normalized.GetImaginary() : normalized.GetImaginary();
+        }
+
+        AZ::Quaternion DequantizeRotation(const AZ::u16* values, const AZ::Vector3& rangeMin, const AZ::Vector3& rangeStep)
+        {
+            const AZ::Vector3 imaginary = DequantizeVector3(values, rangeMin, rangeStep);
+            const float w = AZ::Sqrt(AZ::GetMax(0.0f, 1.0f - imaginary.GetLengthSq()));
+            return AZ::Quaternion::CreateFromVector3AndValue(imaginary, w);
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Evenly Spaced Keyframes (smaller, slightly lossy)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        Clear();
+        CopyBaseMotionData(motionData);
+        m_numSamples = numSamples;
+        SetSampleRate(sampleRate);
+        UpdateDuration();
+
+        AZ_Warning("EMotionFX", AZ::IsClose(m_sampleSpacing, sampleSpacing, AZ::Constants::FloatEpsilon),
+            "Corrected sample spacing should match the set inverse sample rate. Floating point accuracy error.");
+
+        if (m_numSamples == 0)
+        {
+            return;
+        }
+
+        // First find the value range of every animated track, and assign the location of its values inside the frames.
+        AZ::u32 frameSize = 0;
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            AZ::Vector3 minPosition(FLT_MAX);
+            AZ::Vector3 maxPosition(-FLT_MAX);
+            AZ::Vector3 minRotation(FLT_MAX);
+            AZ::Vector3 maxRotation(-FLT_MAX);
+            AZ::Vector3 minScale(FLT_MAX);
+            AZ::Vector3 maxScale(-FLT_MAX);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const Transform transform = motionData->SampleJointTransform(s * sampleSpacing, i);
+                const AZ::Vector3 imaginary = GetRotationImaginary(transform.m_rotation);
+                minPosition = minPosition.GetMin(transform.m_position);
+                maxPosition = maxPosition.GetMax(transform.m_position);
+                minRotation = minRotation.GetMin(imaginary);
+                maxRotation = maxRotation.GetMax(imaginary);
+                EMFX_SCALECODE
+                (
+                    minScale = minScale.GetMin(transform.m_scale);
+                    maxScale = maxScale.GetMax(transform.m_scale);
+                )
+            }
+
+            JointData& jointData = m_jointData[i];
+            if (motionData->IsJointPositionAnimated(i))
+            {
+                CalcQuantizationRange(minPosition, maxPosition, jointData.m_position.m_rangeMin, jointData.m_position.m_rangeStep);
+                jointData.m_position.m_offset = frameSize;
+                frameSize += 3;
+            }
+
+            if (motionData->IsJointRotationAnimated(i))
+            {
+                CalcQuantizationRange(minRotation, maxRotation, jointData.m_rotation.m_rangeMin, jointData.m_rotation.m_rangeStep);
+                jointData.m_rotation.m_offset = frameSize;
+                frameSize += 3;
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            if (motionData->IsJointScaleAnimated(i))
+            {
+                CalcQuantizationRange(minScale, maxScale, jointData.m_scale.m_rangeMin, jointData.m_scale.m_rangeStep);
+                jointData.m_scale.m_offset = frameSize;
+                frameSize += 3;
+            }
+#endif
+        }
+
+        const auto initFloatTrack = [this, sampleSpacing, &frameSize](FloatData& floatData, const auto& sampleFunction)
+        {
+            float minValue = FLT_MAX;
+            float maxValue = -FLT_MAX;
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float value = sampleFunction(s * sampleSpacing);
+                minValue = AZ::GetMin(minValue, value);
+                maxValue = AZ::GetMax(maxValue, value);
+            }
+
+            floatData.m_rangeMin = minValue;
+            floatData.m_rangeStep = (maxValue - minValue) / s_maxQuantizedValue;
+            floatData.m_offset = frameSize;
+            frameSize++;
+        };
+
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                initFloatTrack(m_morphData[i], [motionData, i](float keyTime) { return motionData->SampleMorph(keyTime, i); });
+            }
+        }
+
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                initFloatTrack(m_floatData[i], [motionData, i](float keyTime) { return motionData->SampleFloat(keyTime, i); });
+            }
+        }
+
+        // Now that the ranges are known, quantize the samples into their frames.
+        m_frameSize = frameSize;
+        m_samples.resize(m_numSamples * m_frameSize);
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const JointData& jointData = m_jointData[i];
+            if (!IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const Transform transform = motionData->SampleJointTransform(s * sampleSpacing, i);
+                AZ::u16* frame = m_samples.data() + s * m_frameSize;
+                if (jointData.m_position.m_offset != InvalidIndex32)
+                {
+                    QuantizeVector3(transform.m_position, jointData.m_position.m_rangeMin, jointData.m_position.m_rangeStep, frame + jointData.m_position.m_offset);
+                }
+
+                if (jointData.m_rotation.m_offset != InvalidIndex32)
+                {
+                    QuantizeVector3(GetRotationImaginary(transform.m_rotation), jointData.m_rotation.m_rangeMin, jointData.m_rotation.m_rangeStep, frame + jointData.m_rotation.m_offset);
+                }
+
+#ifndef EMFX_SCALE_DISABLED
+                if (jointData.m_scale.m_offset != InvalidIndex32)
+                {
+                    QuantizeVector3(transform.m_scale, jointData.m_scale.m_rangeMin, jointData.m_scale.m_rangeStep, frame + jointData.m_scale.m_offset);
+                }
+#endif
+            }
+        }
+
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            const FloatData& morphData = m_morphData[i];
+            if (morphData.m_offset != InvalidIndex32)
+            {
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    m_samples[s * m_frameSize + morphData.m_offset] = QuantizeValue(motionData->SampleMorph(s * sampleSpacing, i), morphData.m_rangeMin, morphData.m_rangeStep);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            const FloatData& floatData = m_floatData[i];
+            if (floatData.m_offset != InvalidIndex32)
+            {
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    m_samples[s * m_frameSize + floatData.m_offset] = QuantizeValue(motionData->SampleFloat(s * sampleSpacing, i), floatData.m_rangeMin, floatData.m_rangeStep);
+                }
+            }
+        }
+    }
+
+    const AZ::u16* CompressedMotionData::GetFrame(size_t sampleIndex) const
+    {
+        return m_samples.data() + sampleIndex * m_frameSize;
+    }
+
+    Transform CompressedMotionData::DecodeJointTransform(const AZ::u16* frameA, const AZ::u16* frameB, float t, size_t jointDataIndex) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+
+        Transform result;
+        const Vector3Track& positionTrack = jointData.m_position;
+        result.m_position = (positionTrack.m_offset != InvalidIndex32)
+            ? DequantizeVector3(frameA + positionTrack.m_offset, frameB + positionTrack.m_offset, t, positionTrack.m_rangeMin, positionTrack.m_rangeStep)
+            : staticTransform.m_position;
+
+        const Vector3Track& rotationTrack = jointData.m_rotation;
+        if (rotationTrack.m_offset != InvalidIndex32)
+        {
+            const AZ::Quaternion rotationA = DequantizeRotation(frameA + rotationTrack.m_offset, rotationTrack.m_rangeMin, rotationTrack.m_rangeStep);
+            const AZ::Quaternion rotationB = DequantizeRotation(frameB + rotationTrack.m_offset, rotationTrack.m_rangeMin, rotationTrack.m_rangeStep);
+            result.m_rotation = rotationA.NLerp(rotationB, t);
+        }
+        else
+        {
+            result.m_rotation = staticTransform.m_rotation;
+        }
+
+#ifndef EMFX_SCALE_DISABLED
+        const Vector3Track& scaleTrack = jointData.m_scale;
+        result.m_scale = (scaleTrack.m_offset != InvalidIndex32)
+            ? DequantizeVector3(frameA + scaleTrack.m_offset, frameB + scaleTrack.m_offset, t, scaleTrack.m_rangeMin, scaleTrack.m_rangeStep)
+            : staticTransform.m_scale;
+#endif
+
+        return result;
+    }
+
+    float CompressedMotionData::DecodeFloat(const AZ::u16* frameA, const AZ::u16* frameB, float t, const FloatData& track) const
+    {
+        const float quantized = AZ::Lerp(static_cast<float>(frameA[track.m_offset]), static_cast<float>(frameB[track.m_offset]), t);
+        return track.m_rangeMin + quantized * track.m_rangeStep;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t transformDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && transformDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (transformDataIndex != InvalidIndex && !inPlace)
+        {
+            result = DecodeJointTransform(GetFrame(indexA), GetFrame(indexB), t, transformDataIndex);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        // All joints decode from the same two frames.
+        const AZ::u16* frameA = GetFrame(indexA);
+        const AZ::u16* frameB = GetFrame(indexB);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = DecodeJointTransform(frameA, frameB, t, jointDataIndex);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const FloatData& data = m_morphData[realIndex];
+                if (data.m_offset != InvalidIndex32)
+                {
+                    outputPose->SetMorphWeight(i, DecodeFloat(frameA, frameB, t, data));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const FloatData& morphData = m_morphData[morphDataIndex];
+        if (morphData.m_offset == InvalidIndex32)
+        {
+            return m_staticMorphData[morphDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeFloat(GetFrame(indexA), GetFrame(indexB), t, morphData);
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const FloatData& floatData = m_floatData[floatDataIndex];
+        if (floatData.m_offset == InvalidIndex32)
+        {
+            return m_staticFloatData[floatDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeFloat(GetFrame(indexA), GetFrame(indexB), t, floatData);
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeJointTransform(GetFrame(indexA), GetFrame(indexB), t, jointDataIndex);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const Vector3Track& track = m_jointData[jointDataIndex].m_position;
+        if (track.m_offset == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DequantizeVector3(GetFrame(indexA) + track.m_offset, GetFrame(indexB) + track.m_offset, t, track.m_rangeMin, track.m_rangeStep);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const Vector3Track& track = m_jointData[jointDataIndex].m_rotation;
+        if (track.m_offset == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        const AZ::Quaternion rotationA = DequantizeRotation(GetFrame(indexA) + track.m_offset, track.m_rangeMin, track.m_rangeStep);
+        const AZ::Quaternion rotationB = DequantizeRotation(GetFrame(indexB) + track.m_offset, track.m_rangeMin, track.m_rangeStep);
+        return rotationA.NLerp(rotationB, t);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const Vector3Track& track = m_jointData[jointDataIndex].m_scale;
+        if (track.m_offset == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DequantizeVector3(GetFrame(indexA) + track.m_offset, GetFrame(indexB) + track.m_offset, t, track.m_rangeMin, track.m_rangeStep);
+    }
+#endif
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        // Remove the values of the tracks that get cut off from the frames.
+        for (size_t i = numJoints; i < m_jointData.size(); ++i)
+        {
+            ClearJointTransformSamples(i);
+        }
+        for (size_t i = numMorphs; i < m_morphData.size(); ++i)
+        {
+            ClearMorphSamples(i);
+        }
+        for (size_t i = numFloats; i < m_floatData.size(); ++i)
+        {
+            ClearFloatSamples(i);
+        }
+
+        m_jointData.resize(numJoints);
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        ClearJointTransformSamples(jointDataIndex);
+        m_jointData.erase(m_jointData.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        ClearMorphSamples(morphDataIndex);
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        ClearFloatSamples(floatDataIndex);
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+        m_samples.clear();
+        m_samples.shrink_to_fit();
+
+        m_frameSize = 0;
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Positions are stored relative to their range, so scaling the range scales all samples.
+        for (JointData& jointData : m_jointData)
+        {
+            jointData.m_position.m_rangeMin *= scaleFactor;
+            jointData.m_position.m_rangeStep *= scaleFactor;
+        }
+    }
+
+    void CompressedMotionData::RemoveTrackValues(AZ::u32& offset, AZ::u32 numValues)
+    {
+        if (offset == InvalidIndex32)
+        {
+            return;
+        }
+
+        const AZ::u32 removedOffset = offset;
+        offset = InvalidIndex32;
+
+        // Rebuild all frames without the values of the track.
+        const size_t newFrameSize = m_frameSize - numValues;
+        AZStd::vector<AZ::u16> newSamples(m_numSamples * newFrameSize);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const AZ::u16* frame = GetFrame(s);
+            AZ::u16* newFrame = newSamples.data() + s * newFrameSize;
+            AZStd::copy(frame, frame + removedOffset, newFrame);
+            AZStd::copy(frame + removedOffset + numValues, frame + m_frameSize, newFrame + removedOffset);
+        }
+        m_samples = AZStd::move(newSamples);
+        m_frameSize = newFrameSize;
+
+        // The values of all tracks stored after the removed track moved to the front.
+        const auto updateOffset = [removedOffset, numValues](AZ::u32& trackOffset)
+        {
+            if (trackOffset != InvalidIndex32 && trackOffset > removedOffset)
+            {
+                trackOffset -= numValues;
+            }
+        };
+
+        for (JointData& jointData : m_jointData)
+        {
+            updateOffset(jointData.m_position.m_offset);
+            updateOffset(jointData.m_rotation.m_offset);
+#ifndef EMFX_SCALE_DISABLED
+            updateOffset(jointData.m_scale.m_offset);
+#endif
+        }
+        for (FloatData& morphData : m_morphData)
+        {
+            updateOffset(morphData.m_offset);
+        }
+        for (FloatData& floatData : m_floatData)
+        {
+            updateOffset(floatData.m_offset);
+        }
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            ClearJointTransformSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            ClearMorphSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            ClearFloatSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        RemoveTrackValues(m_jointData[jointDataIndex].m_position.m_offset, 3);
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        RemoveTrackValues(m_jointData[jointDataIndex].m_rotation.m_offset, 3);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        RemoveTrackValues(m_jointData[jointDataIndex].m_scale.m_offset, 3);
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        ClearJointPositionSamples(jointDataIndex);
+        ClearJointRotationSamples(jointDataIndex);
+#ifndef EMFX_SCALE_DISABLED
+        ClearJointScaleSamples(jointDataIndex);
+#endif
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        RemoveTrackValues(m_morphData[morphDataIndex].m_offset, 1);
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        RemoveTrackValues(m_floatData[floatDataIndex].m_offset, 1);
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_position.m_offset != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotation.m_offset != InvalidIndex32;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scale.m_offset != InvalidIndex32;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+#ifndef EMFX_SCALE_DISABLED
+        return (IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex) || IsJointScaleAnimated(jointDataIndex));
+#else
+        return (IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex));
+#endif
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].m_offset != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].m_offset != InvalidIndex32;
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    size_t CompressedMotionData::GetFrameSize() const
+    {
+        return m_frameSize;
+    }
+
+    size_t CompressedMotionData::CalcSampleDataSizeInBytes() const
+    {
+        return m_samples.size() * sizeof(AZ::u16) +
+            m_jointData.size() * sizeof(JointData) +
+            (m_morphData.size() + m_floatData.size()) * sizeof(FloatData);
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        AZ::u32 m_frameSize = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+        // AZ::u16[m_numSamples * m_frameSize]
+    };
+
+    struct File_CompressedMotionData_Track
+    {
+        FileFormat::FileVector3 m_rangeMin { 0.0f, 0.0f, 0.0f };
+        FileFormat::FileVector3 m_rangeStep { 0.0f, 0.0f, 0.0f };
+        AZ::u32                 m_offset = InvalidIndex32;           // The offset inside the frame, or InvalidIndex32 when not animated.
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        File_CompressedMotionData_Track m_position;
+        File_CompressedMotionData_Track m_rotation;
+        File_CompressedMotionData_Track m_scale;
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float   m_staticValue = 0.0f;       // The static (first frame) value.
+        float   m_rangeMin = 0.0f;
+        float   m_rangeStep = 0.0f;
+        AZ::u32 m_offset = InvalidIndex32;  // The offset inside the frame, or InvalidIndex32 when not animated.
+
+        // Followed by:
+        // String: The name of the channel.
+    };
+    //---------------------------------------------------------------------------------------
+
+    namespace
+    {
+        void SaveTrack(const AZ::Vector3& rangeMin, const AZ::Vector3& rangeStep, AZ::u32 offset, File_CompressedMotionData_Track& outTrack, MCore::Endian::EEndianType targetEndianType)
+        {
+            ExporterLib::CopyVector(outTrack.m_rangeMin, AZ::PackedVector3f(rangeMin));
+            ExporterLib::CopyVector(outTrack.m_rangeStep, AZ::PackedVector3f(rangeStep));
+            outTrack.m_offset = offset;
+            ExporterLib::ConvertFileVector3(&outTrack.m_rangeMin, targetEndianType);
+            ExporterLib::ConvertFileVector3(&outTrack.m_rangeStep, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&outTrack.m_offset, targetEndianType);
+        }
+
+        bool ReadTrack(File_CompressedMotionData_Track& track, AZ::u32 frameSize, AZ::Vector3& outRangeMin, AZ::Vector3& outRangeStep, AZ::u32& outOffset, MCore::Endian::EEndianType sourceEndianType)
+        {
+            MCore::Endian::ConvertFloat(&track.m_rangeMin.m_x, sourceEndianType, /*numFloats=*/3);
+            MCore::Endian::ConvertFloat(&track.m_rangeStep.m_x, sourceEndianType, /*numFloats=*/3);
+            MCore::Endian::ConvertUnsignedInt32(&track.m_offset, sourceEndianType);
+            outRangeMin.Set(track.m_rangeMin.m_x, track.m_rangeMin.m_y, track.m_rangeMin.m_z);
+            outRangeStep.Set(track.m_rangeStep.m_x, track.m_rangeStep.m_y, track.m_rangeStep.m_z);
+            outOffset = track.m_offset;
+            return (outOffset == InvalidIndex32 || outOffset + 3 <= frameSize);
+        }
+    } // namespace
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        numBytes += m_samples.size() * sizeof(AZ::u16);
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_frameSize = static_cast<AZ::u32>(GetFrameSize());
+        info.m_sampleRate = GetSampleRate();
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_frameSize, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, GetJointStaticRotation(i));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, GetJointBindPoseRotation(i));
+            EMFX_SCALECODE
+            (
+                ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+                ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+            )
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                MCore::LogDetailedInfo("   + Position Animated:     %s", IsJointPositionAnimated(i) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Rotation Animated:     %s", IsJointRotationAnimated(i) ? "Yes" : "No");
+#ifndef EMFX_SCALE_DISABLED
+                MCore::LogDetailedInfo("   + Scale Animated:        %s", IsJointScaleAnimated(i) ? "Yes" : "No");
+#endif
+            }
+
+            // Convert endian.
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+
+            const JointData& jointData = m_jointData[i];
+            SaveTrack(jointData.m_position.m_rangeMin, jointData.m_position.m_rangeStep, jointData.m_position.m_offset, jointChunk.m_position, targetEndianType);
+            SaveTrack(jointData.m_rotation.m_rangeMin, jointData.m_rotation.m_rangeStep, jointData.m_rotation.m_offset, jointChunk.m_rotation, targetEndianType);
+#ifndef EMFX_SCALE_DISABLED
+            SaveTrack(jointData.m_scale.m_rangeMin, jointData.m_scale.m_rangeStep, jointData.m_scale.m_offset, jointChunk.m_scale, targetEndianType);
+#else
+            SaveTrack(AZ::Vector3::CreateZero(), AZ::Vector3::CreateZero(), InvalidIndex32, jointChunk.m_scale, targetEndianType);
+#endif
+
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+        }
+
+        // Write the morph and float channels.
+        const auto saveFloatData = [stream, targetEndianType](const FloatData& floatData, float staticValue, const AZStd::string& name)
+        {
+            if (name.empty())
+            {
+                MCore::LogError("Cannot save morph or float channel with empty name.");
+                return false;
+            }
+
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = staticValue;
+            floatChunk.m_rangeMin = floatData.m_rangeMin;
+            floatChunk.m_rangeStep = floatData.m_rangeStep;
+            floatChunk.m_offset = floatData.m_offset;
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            ExporterLib::ConvertFloat(&floatChunk.m_rangeMin, targetEndianType);
+            ExporterLib::ConvertFloat(&floatChunk.m_rangeStep, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&floatChunk.m_offset, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(name, stream, targetEndianType);
+            return true;
+        };
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!saveFloatData(m_morphData[i], GetMorphStaticValue(i), GetMorphName(i)))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!saveFloatData(m_floatData[i], GetFloatStaticValue(i), GetFloatName(i)))
+            {
+                return false;
+            }
+        }
+
+        // Write all frames at once.
+        if (!m_samples.empty())
+        {
+            AZStd::vector<AZ::u16> samples = m_samples;
+            for (AZ::u16& value : samples)
+            {
+                ExporterLib::ConvertUnsignedShort(&value, targetEndianType);
+            }
+
+            if (stream->Write(samples.data(), samples.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_frameSize, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + FrameSize  = %d", info.m_frameSize);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        // Initialize the motion data.
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        m_numSamples = info.m_numSamples;
+        m_frameSize = info.m_frameSize;
+        SetSampleRate(info.m_sampleRate);
+        UpdateDuration();
+
+        // Read all joints.
+        AZStd::string name;
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            // Read the tracks, and make sure their values are inside the frames.
+            JointData& jointData = m_jointData[i];
+            bool validTracks = ReadTrack(jointInfo.m_position, info.m_frameSize, jointData.m_position.m_rangeMin, jointData.m_position.m_rangeStep, jointData.m_position.m_offset, sourceEndianType);
+            validTracks &= ReadTrack(jointInfo.m_rotation, info.m_frameSize, jointData.m_rotation.m_rangeMin, jointData.m_rotation.m_rangeStep, jointData.m_rotation.m_offset, sourceEndianType);
+#ifndef EMFX_SCALE_DISABLED
+            validTracks &= ReadTrack(jointInfo.m_scale, info.m_frameSize, jointData.m_scale.m_rangeMin, jointData.m_scale.m_rangeStep, jointData.m_scale.m_offset, sourceEndianType);
+#endif
+            if (!validTracks)
+            {
+                AZ_Error("EMotionFX", false, "The samples of joint %zu are outside of the frame (frame size=%d), cannot load motion data.", i, info.m_frameSize);
+                return false;
+            }
+
+            // Read the name.
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - IsAnimated      = %s", IsJointAnimated(i) ? "Yes" : "No");
+            }
+        }
+
+        // Read the morph and float channels.
+        const auto readFloatData = [stream, sourceEndianType, &info](FloatData& outFloatData, float& outStaticValue, AZStd::string& outName)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            MCore::Endian::ConvertFloat(&floatInfo.m_rangeMin, sourceEndianType);
+            MCore::Endian::ConvertFloat(&floatInfo.m_rangeStep, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&floatInfo.m_offset, sourceEndianType);
+            if (floatInfo.m_offset != InvalidIndex32 && floatInfo.m_offset >= info.m_frameSize)
+            {
+                AZ_Error("EMotionFX", false, "The samples of a morph or float channel are outside of the frame (frame size=%d), cannot load motion data.", info.m_frameSize);
+                return false;
+            }
+
+            outStaticValue = floatInfo.m_staticValue;
+            outFloatData.m_rangeMin = floatInfo.m_rangeMin;
+            outFloatData.m_rangeStep = floatInfo.m_rangeStep;
+            outFloatData.m_offset = floatInfo.m_offset;
+            outName = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            return true;
+        };
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            float staticValue = 0.0f;
+            if (!readFloatData(m_morphData[i], staticValue, name))
+            {
+                return false;
+            }
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, staticValue);
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            float staticValue = 0.0f;
+            if (!readFloatData(m_floatData[i], staticValue, name))
+            {
+                return false;
+            }
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, staticValue);
+        }
+
+        // Read all frames in a single call.
+        m_samples.resize(m_numSamples * m_frameSize);
+        if (!m_samples.empty())
+        {
+            if (stream->Read(m_samples.data(), m_samples.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt16(m_samples.data(), sourceEndianType, static_cast<uint32>(m_samples.size()));
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
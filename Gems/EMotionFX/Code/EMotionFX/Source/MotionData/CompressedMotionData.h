@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    //! Uniformly sampled motion data that stores all animated tracks quantized to 16 bits per component.
+    //! Every track gets its own value range, so the quantization steps are as small as the track allows.
+    //! The samples are stored frame interleaved: all animated tracks of a given frame are stored next to each other in one contiguous block.
+    //! Sampling a full pose therefore only reads the two blocks of the frames to interpolate between, instead of one array per joint.
+    //! Rotations are stored as the x, y and z components of the quaternion on the positive w hemisphere, w is reconstructed when decoding.
+    //! This motion data can only be initialized from other motion data and is not meant to be edited sample by sample.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator)
+        AZ_RTTI(CompressedMotionData, "{87CEDEDA-20D4-4D61-8A8A-5ADF2F4D3845}", MotionData)
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        bool GetSupportsOptimizeSettings() const override { return false; }
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+        //! The number of quantized values stored per frame, which is three for every animated joint track and one for every animated morph and float track.
+        size_t GetFrameSize() const;
+
+        //! The number of bytes used by the quantized samples and the track ranges, not including the static data shared by all motion data types.
+        size_t CalcSampleDataSizeInBytes() const;
+
+    private:
+        // The value range of a quantized track, and the location of its values inside every frame.
+        struct EMFX_API Vector3Track
+        {
+            AZ::Vector3 m_rangeMin = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_rangeStep = AZ::Vector3::CreateZero(); // The value difference of one quantization step.
+            AZ::u32 m_offset = InvalidIndex32; // The offset of the first value within a frame, InvalidIndex32 when not animated.
+        };
+
+        struct EMFX_API JointData
+        {
+            Vector3Track m_position;
+            Vector3Track m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+            Vector3Track m_scale;
+#endif
+        };
+
+        struct EMFX_API FloatData
+        {
+            float m_rangeMin = 0.0f;
+            float m_rangeStep = 0.0f;
+            AZ::u32 m_offset = InvalidIndex32;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+        const AZ::u16* GetFrame(size_t sampleIndex) const;
+        Transform DecodeJointTransform(const AZ::u16* frameA, const AZ::u16* frameB, float t, size_t jointDataIndex) const;
+        float DecodeFloat(const AZ::u16* frameA, const AZ::u16* frameB, float t, const FloatData& track) const;
+        void RemoveTrackValues(AZ::u32& offset, AZ::u32 numValues);
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<FloatData> m_morphData;
+        AZStd::vector<FloatData> m_floatData;
+        AZStd::vector<AZ::u16> m_samples; // All frames, each holding GetFrameSize() values.
+        size_t m_frameSize = 0;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -14,10 +14,26 @@
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Pose.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
+#include <EMotionFX/Source/PoseKernels.h>
 #include <EMotionFX/Source/TransformData.h>
 
 namespace EMotionFX
 {
+    namespace
+    {
+        // The pose kernels process the local space transforms directly, so make sure they are up to date in both poses.
+        void UpdateLocalSpaceTransforms(const Pose& pose, const Pose& otherPose, const uint16* nodeIndices, size_t numNodes)
+        {
+            for (size_t i = 0; i < numNodes; ++i)
+            {
+                const size_t nodeIndex = nodeIndices ? nodeIndices[i] : i;
+                pose.UpdateLocalSpaceTransform(nodeIndex);
+                otherPose.UpdateLocalSpaceTransform(nodeIndex);
+            }
+        }
+    } // namespace
+
+
     // default constructor
     Pose::Pose()
     {
@@ -199,21 +215,13 @@ namespace EMotionFX
     // update the full model space pose
     void Pose::ForceUpdateFullModelSpacePose()
     {
-        // iterate from root towards child nodes recursively, updating all model space transforms on the way
-        Skeleton* skeleton = m_actor->GetSkeleton();
+        // iterate from root towards child nodes, updating all model space transforms on the way
+        const Skeleton* skeleton = m_actor->GetSkeleton();
+        PoseKernels::LocalToModel(*skeleton, m_localSpaceTransforms.data(), m_modelSpaceTransforms.data());
+
         const size_t numNodes = skeleton->GetNumNodes();
         for (size_t i = 0; i < numNodes; ++i)
         {
-            const size_t parentIndex = skeleton->GetNode(i)->GetParentIndex();
-            if (parentIndex != InvalidIndex)
-            {
-                m_modelSpaceTransforms[parentIndex].PreMultiply(m_localSpaceTransforms[i], &m_modelSpaceTransforms[i]);
-            }
-            else
-            {
-                m_modelSpaceTransforms[i] = m_localSpaceTransforms[i];
-            }
-
             m_flags[i] |= FLAG_MODELTRANSFORMREADY;
         }
     }
@@ -833,13 +841,9 @@ namespace EMotionFX
     {
         if (m_actorInstance)
         {
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            UpdateLocalSpaceTransforms(*this, *destPose, enabledNodes.data(), enabledNodes.size());
+            PoseKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), enabledNodes.data(), enabledNodes.size(), weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -859,11 +863,8 @@ namespace EMotionFX
         else
         {
             const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
-            }
+            UpdateLocalSpaceTransforms(*this, *destPose, nullptr, numNodes);
+            PoseKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), nullptr, numNodes, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -943,36 +944,15 @@ namespace EMotionFX
             AZ_Assert(m_localSpaceTransforms.size() == additivePose.m_localSpaceTransforms.size(), "Poses must be of the same size");
             if (m_actorInstance)
             {
-                const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-                for (size_t i = 0; i < numNodes; ++i)
-                {
-                    uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(nodeNr);
-                    transform.m_position += additiveTransform.m_position * weight;
-                    transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
-                    )
-                    transform.m_rotation.Normalize();
-                }
+                const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+                UpdateLocalSpaceTransforms(*this, additivePose, enabledNodes.data(), enabledNodes.size());
+                PoseKernels::ApplyAdditive(m_localSpaceTransforms.data(), additivePose.m_localSpaceTransforms.data(), enabledNodes.data(), enabledNodes.size(), weight);
             }
             else
             {
                 const size_t numNodes = m_localSpaceTransforms.size();
-                for (size_t i = 0; i < numNodes; ++i)
-                {
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(i);
-                    transform.m_position += additiveTransform.m_position * weight;
-                    transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
-                    )
-                    transform.m_rotation.Normalize();
-                }
+                UpdateLocalSpaceTransforms(*this, additivePose, nullptr, numNodes);
+                PoseKernels::ApplyAdditive(m_localSpaceTransforms.data(), additivePose.m_localSpaceTransforms.data(), nullptr, numNodes, weight);
             }
 
             const size_t numMorphs = m_morphWeights.size();
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/PoseKernels.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/Transform.h>
+
+namespace EMotionFX::PoseKernels
+{
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using FloatType = Vec4::FloatType;
+
+        constexpr size_t GroupSize = 4;
+
+        // The transforms of four joints, with one register per component, so that every lane holds another joint.
+        struct TransformGroup
+        {
+            FloatType m_rotation[4]; // x, y, z, w
+            FloatType m_position[3]; // x, y, z
+        #ifndef EMFX_SCALE_DISABLED
+            FloatType m_scale[3];    // x, y, z
+        #endif
+        };
+
+        AZ_FORCE_INLINE size_t GetNodeIndex(const uint16* nodeIndices, size_t i)
+        {
+            return nodeIndices ? nodeIndices[i] : i;
+        }
+
+        // Load four transforms and transpose them from one transform per register into one component per register.
+        AZ_FORCE_INLINE void LoadGroup(const Transform* const* transforms, TransformGroup& outGroup)
+        {
+            FloatType rows[4];
+            FloatType columns[4];
+
+            for (size_t i = 0; i < GroupSize; ++i)
+            {
+                rows[i] = transforms[i]->m_rotation.GetSimdValue();
+            }
+            Vec4::Mat4x4Transpose(rows, outGroup.m_rotation);
+
+            for (size_t i = 0; i < GroupSize; ++i)
+            {
+                rows[i] = Vec4::FromVec3(transforms[i]->m_position.GetSimdValue());
+            }
+            Vec4::Mat4x4Transpose(rows, columns);
+            outGroup.m_position[0] = columns[0];
+            outGroup.m_position[1] = columns[1];
+            outGroup.m_position[2] = columns[2];
+
+        #ifndef EMFX_SCALE_DISABLED
+            for (size_t i = 0; i < GroupSize; ++i)
+            {
+                rows[i] = Vec4::FromVec3(transforms[i]->m_scale.GetSimdValue());
+            }
+            Vec4::Mat4x4Transpose(rows, columns);
+            outGroup.m_scale[0] = columns[0];
+            outGroup.m_scale[1] = columns[1];
+            outGroup.m_scale[2] = columns[2];
+        #endif
+        }
+
+        // Transpose the components back into one transform per register and store the four transforms.
+        AZ_FORCE_INLINE void StoreGroup(const TransformGroup& group, Transform* const* outTransforms)
+        {
+            FloatType rows[4];
+            FloatType columns[4];
+
+            Vec4::Mat4x4Transpose(group.m_rotation, rows);
+            for (size_t i = 0; i < GroupSize; ++i)
+            {
+                outTransforms[i]->m_rotation = AZ::Quaternion(rows[i]);
+            }
+
+            columns[0] = group.m_position[0];
+            columns[1] = group.m_position[1];
+            columns[2] = group.m_position[2];
+            columns[3] = Vec4::ZeroFloat();
+            Vec4::Mat4x4Transpose(columns, rows);
+            for (size_t i = 0; i < GroupSize; ++i)
+            {
+                outTransforms[i]->m_position = AZ::Vector3(Vec4::ToVec3(rows[i]));
+            }
+
+        #ifndef EMFX_SCALE_DISABLED
+            columns[0] = group.m_scale[0];
+            columns[1] = group.m_scale[1];
+            columns[2] = group.m_scale[2];
+            Vec4::Mat4x4Transpose(columns, rows);
+            for (size_t i = 0; i < GroupSize; ++i)
+            {
+                outTransforms[i]->m_scale = AZ::Vector3(Vec4::ToVec3(rows[i]));
+            }
+        #endif
+        }
+
+        AZ_FORCE_INLINE void NormalizeQuaternions(FloatType* quaternions)
+        {
+            const FloatType lengthSq = Vec4::Madd(quaternions[0], quaternions[0],
+                Vec4::Madd(quaternions[1], quaternions[1], Vec4::Madd(quaternions[2], quaternions[2], Vec4::Mul(quaternions[3], quaternions[3]))));
+            const FloatType invLength = Vec4::SqrtInv(lengthSq);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                quaternions[i] = Vec4::Mul(quaternions[i], invLength);
+            }
+        }
+
+        // The same as MCore::NLerp, so including the flip to the shortest path.
+        AZ_FORCE_INLINE void NLerpQuaternions(const FloatType* from, const FloatType* to, FloatType weight, FloatType* outResult)
+        {
+            const FloatType dot = Vec4::Madd(from[0], to[0], Vec4::Madd(from[1], to[1], Vec4::Madd(from[2], to[2], Vec4::Mul(from[3], to[3]))));
+            const FloatType zero = Vec4::ZeroFloat();
+            const FloatType toWeight = Vec4::Select(Vec4::Sub(zero, weight), weight, Vec4::CmpLt(dot, zero));
+            const FloatType fromWeight = Vec4::Sub(Vec4::Splat(1.0f), weight);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                outResult[i] = Vec4::Madd(to[i], toWeight, Vec4::Mul(from[i], fromWeight));
+            }
+            NormalizeQuaternions(outResult);
+        }
+
+        AZ_FORCE_INLINE void MultiplyQuaternions(const FloatType* lhs, const FloatType* rhs, FloatType* outResult)
+        {
+            const FloatType x = Vec4::Add(Vec4::Madd(lhs[3], rhs[0], Vec4::Mul(lhs[0], rhs[3])), Vec4::Sub(Vec4::Mul(lhs[1], rhs[2]), Vec4::Mul(lhs[2], rhs[1])));
+            const FloatType y = Vec4::Add(Vec4::Madd(lhs[3], rhs[1], Vec4::Mul(lhs[1], rhs[3])), Vec4::Sub(Vec4::Mul(lhs[2], rhs[0]), Vec4::Mul(lhs[0], rhs[2])));
+            const FloatType z = Vec4::Add(Vec4::Madd(lhs[3], rhs[2], Vec4::Mul(lhs[2], rhs[3])), Vec4::Sub(Vec4::Mul(lhs[0], rhs[1]), Vec4::Mul(lhs[1], rhs[0])));
+            const FloatType w = Vec4::Sub(Vec4::Mul(lhs[3], rhs[3]), Vec4::Madd(lhs[0], rhs[0], Vec4::Madd(lhs[1], rhs[1], Vec4::Mul(lhs[2], rhs[2]))));
+            outResult[0] = x;
+            outResult[1] = y;
+            outResult[2] = z;
+            outResult[3] = w;
+        }
+
+        AZ_FORCE_INLINE void CrossVectors(const FloatType* lhs, const FloatType* rhs, FloatType* outResult)
+        {
+            outResult[0] = Vec4::Sub(Vec4::Mul(lhs[1], rhs[2]), Vec4::Mul(lhs[2], rhs[1]));
+            outResult[1] = Vec4::Sub(Vec4::Mul(lhs[2], rhs[0]), Vec4::Mul(lhs[0], rhs[2]));
+            outResult[2] = Vec4::Sub(Vec4::Mul(lhs[0], rhs[1]), Vec4::Mul(lhs[1], rhs[0]));
+        }
+
+        // Rotate the vectors by the unit quaternions, using v' = v + w * t + cross(q.xyz, t), where t = 2 * cross(q.xyz, v).
+        AZ_FORCE_INLINE void RotateVectors(const FloatType* quaternions, const FloatType* vectors, FloatType* outResult)
+        {
+            const FloatType two = Vec4::Splat(2.0f);
+            FloatType t[3];
+            CrossVectors(quaternions, vectors, t);
+            t[0] = Vec4::Mul(t[0], two);
+            t[1] = Vec4::Mul(t[1], two);
+            t[2] = Vec4::Mul(t[2], two);
+
+            FloatType qCrossT[3];
+            CrossVectors(quaternions, t, qCrossT);
+            for (size_t i = 0; i < 3; ++i)
+            {
+                outResult[i] = Vec4::Add(Vec4::Madd(quaternions[3], t[i], vectors[i]), qCrossT[i]);
+            }
+        }
+
+        AZ_FORCE_INLINE void ApplyAdditiveToTransform(Transform& transform, const Transform& additiveTransform, float weight)
+        {
+            transform.m_position += additiveTransform.m_position * weight;
+            transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
+            EMFX_SCALECODE
+            (
+                transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
+            )
+            transform.m_rotation.Normalize();
+        }
+    } // namespace
+
+
+    void Blend(Transform* transforms, const Transform* destTransforms, const uint16* nodeIndices, size_t numNodes, float weight)
+    {
+        const FloatType weights = Vec4::Splat(weight);
+
+        size_t i = 0;
+        for (; i + GroupSize <= numNodes; i += GroupSize)
+        {
+            Transform* current[GroupSize];
+            const Transform* dest[GroupSize];
+            for (size_t j = 0; j < GroupSize; ++j)
+            {
+                const size_t nodeIndex = GetNodeIndex(nodeIndices, i + j);
+                current[j] = &transforms[nodeIndex];
+                dest[j] = &destTransforms[nodeIndex];
+            }
+
+            TransformGroup currentGroup;
+            TransformGroup destGroup;
+            LoadGroup(current, currentGroup);
+            LoadGroup(dest, destGroup);
+
+            for (size_t c = 0; c < 3; ++c)
+            {
+                currentGroup.m_position[c] = Vec4::Madd(Vec4::Sub(destGroup.m_position[c], currentGroup.m_position[c]), weights, currentGroup.m_position[c]);
+            #ifndef EMFX_SCALE_DISABLED
+                currentGroup.m_scale[c] = Vec4::Madd(Vec4::Sub(destGroup.m_scale[c], currentGroup.m_scale[c]), weights, currentGroup.m_scale[c]);
+            #endif
+            }
+            NLerpQuaternions(currentGroup.m_rotation, destGroup.m_rotation, weights, currentGroup.m_rotation);
+
+            StoreGroup(currentGroup, current);
+        }
+
+        // blend the remaining transforms one by one
+        for (; i < numNodes; ++i)
+        {
+            const size_t nodeIndex = GetNodeIndex(nodeIndices, i);
+            transforms[nodeIndex].Blend(destTransforms[nodeIndex], weight);
+        }
+    }
+
+
+    void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, const uint16* nodeIndices, size_t numNodes, float weight)
+    {
+        const FloatType weights = Vec4::Splat(weight);
+        [[maybe_unused]] const FloatType one = Vec4::Splat(1.0f);
+
+        size_t i = 0;
+        for (; i + GroupSize <= numNodes; i += GroupSize)
+        {
+            Transform* current[GroupSize];
+            const Transform* additive[GroupSize];
+            for (size_t j = 0; j < GroupSize; ++j)
+            {
+                const size_t nodeIndex = GetNodeIndex(nodeIndices, i + j);
+                current[j] = &transforms[nodeIndex];
+                additive[j] = &additiveTransforms[nodeIndex];
+            }
+
+            TransformGroup currentGroup;
+            TransformGroup additiveGroup;
+            LoadGroup(current, currentGroup);
+            LoadGroup(additive, additiveGroup);
+
+            for (size_t c = 0; c < 3; ++c)
+            {
+                currentGroup.m_position[c] = Vec4::Madd(additiveGroup.m_position[c], weights, currentGroup.m_position[c]);
+            #ifndef EMFX_SCALE_DISABLED
+                currentGroup.m_scale[c] = Vec4::Mul(currentGroup.m_scale[c], Vec4::Madd(Vec4::Sub(additiveGroup.m_scale[c], one), weights, one));
+            #endif
+            }
+
+            FloatType targetRotation[4];
+            MultiplyQuaternions(additiveGroup.m_rotation, currentGroup.m_rotation, targetRotation);
+            NLerpQuaternions(currentGroup.m_rotation, targetRotation, weights, currentGroup.m_rotation);
+
+            StoreGroup(currentGroup, current);
+        }
+
+        // process the remaining transforms one by one
+        for (; i < numNodes; ++i)
+        {
+            const size_t nodeIndex = GetNodeIndex(nodeIndices, i);
+            ApplyAdditiveToTransform(transforms[nodeIndex], additiveTransforms[nodeIndex], weight);
+        }
+    }
+
+
+    void LocalToModel(const Skeleton& skeleton, const Transform* localTransforms, Transform* outModelTransforms)
+    {
+        const Transform identity = Transform::CreateIdentity();
+        const size_t numNodes = skeleton.GetNumNodes();
+
+        size_t i = 0;
+        while (i < numNodes)
+        {
+            // a group can only be processed at once when none of the joints in it is the parent of another one in the same group
+            size_t parentIndices[GroupSize];
+            bool isIndependentGroup = (i + GroupSize <= numNodes);
+            for (size_t j = 0; isIndependentGroup && j < GroupSize; ++j)
+            {
+                parentIndices[j] = skeleton.GetNode(i + j)->GetParentIndex();
+                isIndependentGroup = (parentIndices[j] == InvalidIndex || parentIndices[j] < i);
+            }
+
+            if (!isIndependentGroup)
+            {
+                const size_t parentIndex = skeleton.GetNode(i)->GetParentIndex();
+                if (parentIndex != InvalidIndex)
+                {
+                    outModelTransforms[parentIndex].PreMultiply(localTransforms[i], &outModelTransforms[i]);
+                }
+                else
+                {
+                    outModelTransforms[i] = localTransforms[i];
+                }
+                ++i;
+                continue;
+            }
+
+            const Transform* local[GroupSize];
+            const Transform* parent[GroupSize];
+            Transform* model[GroupSize];
+            for (size_t j = 0; j < GroupSize; ++j)
+            {
+                local[j] = &localTransforms[i + j];
+                parent[j] = (parentIndices[j] != InvalidIndex) ? &outModelTransforms[parentIndices[j]] : &identity;
+                model[j] = &outModelTransforms[i + j];
+            }
+
+            TransformGroup localGroup;
+            TransformGroup parentGroup;
+            LoadGroup(local, localGroup);
+            LoadGroup(parent, parentGroup);
+
+            // the same as Transform::PreMultiply, with the parent model space transform on the left hand side
+            TransformGroup modelGroup;
+            FloatType rotatedPosition[3];
+            RotateVectors(parentGroup.m_rotation, localGroup.m_position, rotatedPosition);
+            for (size_t c = 0; c < 3; ++c)
+            {
+            #ifdef EMFX_SCALE_DISABLED
+                modelGroup.m_position[c] = Vec4::Add(parentGroup.m_position[c], rotatedPosition[c]);
+            #else
+                modelGroup.m_position[c] = Vec4::Madd(rotatedPosition[c], parentGroup.m_scale[c], parentGroup.m_position[c]);
+                modelGroup.m_scale[c] = Vec4::Mul(parentGroup.m_scale[c], localGroup.m_scale[c]);
+            #endif
+            }
+            MultiplyQuaternions(parentGroup.m_rotation, localGroup.m_rotation, modelGroup.m_rotation);
+            NormalizeQuaternions(modelGroup.m_rotation);
+
+            StoreGroup(modelGroup, model);
+
+            // root joints take over their local space transform as is
+            for (size_t j = 0; j < GroupSize; ++j)
+            {
+                if (parentIndices[j] == InvalidIndex)
+                {
+                    *model[j] = *local[j];
+                }
+            }
+
+            i += GroupSize;
+        }
+    }
+} // namespace EMotionFX::PoseKernels
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+namespace EMotionFX
+{
+    class Skeleton;
+    class Transform;
+
+    /**
+     * SIMD kernels that operate on whole arrays of transforms, as used by the pose blending hot paths.
+     * The kernels process four joints at a time. The transforms of four joints are loaded and transposed into separate x, y, z and w
+     * registers for the position, rotation and scale streams, so that every SIMD lane works on its own joint. The results are transposed
+     * back and stored, and the remaining joints are processed one by one.
+     * The node indices are optional. When they are nullptr, the first numNodes transforms are processed, otherwise only the transforms
+     * at the given node indices.
+     */
+    namespace PoseKernels
+    {
+        /**
+         * Blend the transforms towards the destination transforms, which gives the same result as Transform::Blend.
+         * @param transforms The transforms to blend, which also receive the result.
+         * @param destTransforms The transforms to blend towards.
+         * @param nodeIndices The indices of the transforms to blend, or nullptr to blend the first numNodes transforms.
+         * @param numNodes The number of transforms to blend.
+         * @param weight The blend weight, where 0 keeps the transforms and 1 results in the destination transforms.
+         */
+        void Blend(Transform* transforms, const Transform* destTransforms, const uint16* nodeIndices, size_t numNodes, float weight);
+
+        /**
+         * Apply the additive transforms with a given weight, which gives the same result as the weighted Pose::ApplyAdditive.
+         * @param transforms The transforms to apply the additive transforms on, which also receive the result.
+         * @param additiveTransforms The additive transforms.
+         * @param nodeIndices The indices of the transforms to process, or nullptr to process the first numNodes transforms.
+         * @param numNodes The number of transforms to process.
+         * @param weight The weight of the additive transforms, in range of [0..1].
+         */
+        void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, const uint16* nodeIndices, size_t numNodes, float weight);
+
+        /**
+         * Calculate the model space transforms of all joints in the skeleton from their local space transforms.
+         * This requires the parents to be stored before their children in the skeleton. Groups of four joints of which all parents are
+         * stored before the group are processed at once, other joints are processed one by one.
+         * @param skeleton The skeleton to get the parent of every joint from.
+         * @param localTransforms The local space transforms of all joints.
+         * @param outModelTransforms The model space transforms of all joints that receive the result.
+         */
+        void LocalToModel(const Skeleton& skeleton, const Transform* localTransforms, Transform* outModelTransforms);
+    } // namespace PoseKernels
+} // namespace EMotionFX
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SkinningKernels.h>
+#include <MCore/Source/DualQuaternion.h>
+
+namespace EMotionFX
+{
+    void SkinningInfluences::Init(Mesh* mesh)
+    {
+        Clear();
+
+        if (!mesh)
+        {
+            return;
+        }
+
+        SkinningInfoVertexAttributeLayer* layer = static_cast<SkinningInfoVertexAttributeLayer*>(mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        const uint32* orgVerts = static_cast<const uint32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        if (!layer || !orgVerts)
+        {
+            return;
+        }
+
+        // Count the vertices for every number of influences.
+        const uint32 numVertices = mesh->GetNumVertices();
+        AZStd::vector<uint32> numVerticesPerInfluenceCount;
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            const size_t numInfluences = layer->GetNumInfluences(orgVerts[v]);
+            if (numInfluences >= numVerticesPerInfluenceCount.size())
+            {
+                numVerticesPerInfluenceCount.resize(numInfluences + 1, 0);
+            }
+            numVerticesPerInfluenceCount[numInfluences]++;
+        }
+
+        // Create a group for every number of influences that is used.
+        AZStd::vector<uint32> groupIndexPerInfluenceCount(numVerticesPerInfluenceCount.size(), InvalidIndex32);
+        uint32 firstVertex = 0;
+        uint32 firstInfluence = 0;
+        for (uint32 numInfluences = 0; numInfluences < numVerticesPerInfluenceCount.size(); ++numInfluences)
+        {
+            const uint32 groupNumVertices = numVerticesPerInfluenceCount[numInfluences];
+            if (groupNumVertices == 0)
+            {
+                continue;
+            }
+
+            groupIndexPerInfluenceCount[numInfluences] = aznumeric_cast<uint32>(m_groups.size());
+            m_groups.push_back({ numInfluences, firstVertex, groupNumVertices, firstInfluence });
+            firstVertex += groupNumVertices;
+            firstInfluence += groupNumVertices * numInfluences;
+        }
+
+        // Sort the vertices into their groups and store their influences.
+        m_vertices.resize(numVertices);
+        m_boneIndices.resize(firstInfluence);
+        m_weights.resize(firstInfluence);
+        AZStd::vector<uint32> numGroupVertices(m_groups.size(), 0);
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            const uint32 orgVertex = orgVerts[v];
+            const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+            const uint32 groupIndex = groupIndexPerInfluenceCount[numInfluences];
+            const Group& group = m_groups[groupIndex];
+
+            const uint32 indexInGroup = numGroupVertices[groupIndex]++;
+            m_vertices[group.m_firstVertex + indexInGroup] = v;
+
+            const size_t influenceOffset = group.m_firstInfluence + indexInGroup * numInfluences;
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+                m_boneIndices[influenceOffset + i] = influence->GetBoneNr();
+                m_weights[influenceOffset + i] = influence->GetWeight();
+            }
+        }
+    }
+
+    void SkinningInfluences::Clear()
+    {
+        m_groups.clear();
+        m_vertices.clear();
+        m_boneIndices.clear();
+        m_weights.clear();
+    }
+} // namespace EMotionFX
+
+namespace EMotionFX::SkinningKernels
+{
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using FloatType = Vec4::FloatType;
+
+        // Used as number of influences for the kernels that loop over a number of influences only known at runtime.
+        // Vertices without any influences are handled separately, so zero isn't a valid number of influences for the kernels.
+        constexpr size_t AnyNumInfluences = 0;
+
+        // A part of a group of the sorted influences.
+        struct VertexRange
+        {
+            const uint32* m_vertices;
+            const uint16* m_boneIndices;
+            const float* m_weights;
+            size_t m_numVertices;
+            size_t m_numInfluences;
+        };
+
+        struct LinearBlendKernel
+        {
+            using BoneType = AZ::Matrix3x4;
+
+            template<size_t NumInfluences, bool HasTangents, bool HasBitangents>
+            static void Skin(const VertexRange& range, const AZ::Matrix3x4* boneMatrices, const VertexStreams& streams)
+            {
+                const size_t numInfluences = (NumInfluences != AnyNumInfluences) ? NumInfluences : range.m_numInfluences;
+                const uint16* boneIndices = range.m_boneIndices;
+                const float* weights = range.m_weights;
+
+                for (size_t i = 0; i < range.m_numVertices; ++i)
+                {
+                    // Blend the rows of the bone matrices, so that every vertex attribute only gets transformed once rather than once per influence.
+                    const FloatType* rows = boneMatrices[boneIndices[0]].GetSimdValues();
+                    FloatType weight = Vec4::Splat(weights[0]);
+                    FloatType row0 = Vec4::Mul(rows[0], weight);
+                    FloatType row1 = Vec4::Mul(rows[1], weight);
+                    FloatType row2 = Vec4::Mul(rows[2], weight);
+                    for (size_t j = 1; j < numInfluences; ++j)
+                    {
+                        rows = boneMatrices[boneIndices[j]].GetSimdValues();
+                        weight = Vec4::Splat(weights[j]);
+                        row0 = Vec4::Madd(rows[0], weight, row0);
+                        row1 = Vec4::Madd(rows[1], weight, row1);
+                        row2 = Vec4::Madd(rows[2], weight, row2);
+                    }
+                    boneIndices += numInfluences;
+                    weights += numInfluences;
+
+                    const AZ::Matrix3x4 skinMatrix(row0, row1, row2);
+                    const uint32 v = range.m_vertices[i];
+                    streams.m_positions[v] = skinMatrix.TransformPoint(streams.m_positions[v]);
+                    streams.m_normals[v] = skinMatrix.TransformVector(streams.m_normals[v]);
+                    if constexpr (HasTangents)
+                    {
+                        AZ::Vector4& tangent = streams.m_tangents[v];
+                        tangent = AZ::Vector4::CreateFromVector3AndFloat(skinMatrix.TransformVector(tangent.GetAsVector3()), tangent.GetW());
+                    }
+                    if constexpr (HasBitangents)
+                    {
+                        streams.m_bitangents[v] = skinMatrix.TransformVector(streams.m_bitangents[v]);
+                    }
+                }
+            }
+
+            // The weighted sum over zero influences, which moves the vertices to the origin.
+            static void SkinWithoutInfluences(const VertexRange& range, const VertexStreams& streams)
+            {
+                for (size_t i = 0; i < range.m_numVertices; ++i)
+                {
+                    const uint32 v = range.m_vertices[i];
+                    streams.m_positions[v] = AZ::Vector3::CreateZero();
+                    streams.m_normals[v] = AZ::Vector3::CreateZero();
+                    if (streams.m_tangents)
+                    {
+                        streams.m_tangents[v] = AZ::Vector4(0.0f, 0.0f, 0.0f, streams.m_tangents[v].GetW());
+                        if (streams.m_bitangents)
+                        {
+                            streams.m_bitangents[v] = AZ::Vector3::CreateZero();
+                        }
+                    }
+                }
+            }
+        };
+
+        struct DualQuaternionKernel
+        {
+            using BoneType = MCore::DualQuaternion;
+
+            template<size_t NumInfluences, bool HasTangents, bool HasBitangents>
+            static void Skin(const VertexRange& range, const MCore::DualQuaternion* boneDualQuats, const VertexStreams& streams)
+            {
+                const size_t numInfluences = (NumInfluences != AnyNumInfluences) ? NumInfluences : range.m_numInfluences;
+                const uint16* boneIndices = range.m_boneIndices;
+                const float* weights = range.m_weights;
+
+                for (size_t i = 0; i < range.m_numVertices; ++i)
+                {
+                    // Blend the dual quaternions. The weights of the influences that are on the other hemisphere than the first
+                    // influence, the pivot, get negated, which is the same as negating their dual quaternions.
+                    const MCore::DualQuaternion& pivotQuat = boneDualQuats[boneIndices[0]];
+                    FloatType weight = Vec4::Splat(weights[0]);
+                    FloatType real = Vec4::Mul(pivotQuat.m_real.GetSimdValue(), weight);
+                    FloatType dual = Vec4::Mul(pivotQuat.m_dual.GetSimdValue(), weight);
+                    for (size_t j = 1; j < numInfluences; ++j)
+                    {
+                        const MCore::DualQuaternion& influenceQuat = boneDualQuats[boneIndices[j]];
+                        weight = Vec4::Splat(influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f ? -weights[j] : weights[j]);
+                        real = Vec4::Madd(influenceQuat.m_real.GetSimdValue(), weight, real);
+                        dual = Vec4::Madd(influenceQuat.m_dual.GetSimdValue(), weight, dual);
+                    }
+                    boneIndices += numInfluences;
+                    weights += numInfluences;
+
+                    MCore::DualQuaternion skinQuat{ AZ::Quaternion(real), AZ::Quaternion(dual) };
+                    skinQuat.Normalize();
+
+                    const uint32 v = range.m_vertices[i];
+                    streams.m_positions[v] = skinQuat.TransformPoint(streams.m_positions[v]);
+                    streams.m_normals[v] = skinQuat.TransformVector(streams.m_normals[v]);
+                    if constexpr (HasTangents)
+                    {
+                        AZ::Vector4& tangent = streams.m_tangents[v];
+                        tangent = AZ::Vector4::CreateFromVector3AndFloat(skinQuat.TransformVector(tangent.GetAsVector3()), tangent.GetW());
+                    }
+                    if constexpr (HasBitangents)
+                    {
+                        streams.m_bitangents[v] = skinQuat.TransformVector(streams.m_bitangents[v]);
+                    }
+                }
+            }
+
+            // Vertices without any influences keep their values.
+            static void SkinWithoutInfluences([[maybe_unused]] const VertexRange& range, [[maybe_unused]] const VertexStreams& streams)
+            {
+            }
+        };
+
+        // Run the kernel with a fixed number of influences for the most common cases, so that the compiler can unroll the influence loop.
+        template<typename Kernel, bool HasTangents, bool HasBitangents>
+        void SkinRange(const VertexRange& range, const typename Kernel::BoneType* bones, const VertexStreams& streams)
+        {
+            switch (range.m_numInfluences)
+            {
+            case 1:
+                Kernel::template Skin<1, HasTangents, HasBitangents>(range, bones, streams);
+                break;
+            case 2:
+                Kernel::template Skin<2, HasTangents, HasBitangents>(range, bones, streams);
+                break;
+            case 3:
+                Kernel::template Skin<3, HasTangents, HasBitangents>(range, bones, streams);
+                break;
+            case 4:
+                Kernel::template Skin<4, HasTangents, HasBitangents>(range, bones, streams);
+                break;
+            default:
+                Kernel::template Skin<AnyNumInfluences, HasTangents, HasBitangents>(range, bones, streams);
+                break;
+            }
+        }
+
+        template<typename Kernel>
+        void SkinGroups(const SkinningInfluences& influences, size_t startIndex, size_t endIndex, const typename Kernel::BoneType* bones, const VertexStreams& streams)
+        {
+            AZ_Assert(startIndex <= endIndex && endIndex <= influences.GetNumVertices(), "The vertex range [%zu..%zu) is out of bounds.", startIndex, endIndex);
+
+            for (const SkinningInfluences::Group& group : influences.GetGroups())
+            {
+                // Skin the part of the group that overlaps with the vertex range.
+                const size_t groupStartIndex = AZStd::max<size_t>(group.m_firstVertex, startIndex);
+                const size_t groupEndIndex = AZStd::min<size_t>(group.m_firstVertex + group.m_numVertices, endIndex);
+                if (groupStartIndex >= groupEndIndex)
+                {
+                    continue;
+                }
+
+                const size_t firstInfluence = group.m_firstInfluence + (groupStartIndex - group.m_firstVertex) * group.m_numInfluences;
+                const VertexRange range{
+                    influences.GetVertices().data() + groupStartIndex,
+                    influences.GetBoneIndices().data() + firstInfluence,
+                    influences.GetWeights().data() + firstInfluence,
+                    groupEndIndex - groupStartIndex,
+                    group.m_numInfluences };
+
+                if (group.m_numInfluences == 0)
+                {
+                    Kernel::SkinWithoutInfluences(range, streams);
+                }
+                else if (streams.m_tangents && streams.m_bitangents)
+                {
+                    SkinRange<Kernel, true, true>(range, bones, streams);
+                }
+                else if (streams.m_tangents)
+                {
+                    SkinRange<Kernel, true, false>(range, bones, streams);
+                }
+                else
+                {
+                    SkinRange<Kernel, false, false>(range, bones, streams);
+                }
+            }
+        }
+    } // namespace
+
+    VertexStreams VertexStreams::Create(Mesh* mesh)
+    {
+        VertexStreams streams;
+        streams.m_positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        streams.m_normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        streams.m_tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+        streams.m_bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+        return streams;
+    }
+
+    void LinearBlend(const SkinningInfluences& influences, size_t startIndex, size_t endIndex, const AZ::Matrix3x4* boneMatrices, const VertexStreams& streams)
+    {
+        SkinGroups<LinearBlendKernel>(influences, startIndex, endIndex, boneMatrices, streams);
+    }
+
+    void DualQuaternion(const SkinningInfluences& influences, size_t startIndex, size_t endIndex, const MCore::DualQuaternion* boneDualQuats, const VertexStreams& streams)
+    {
+        SkinGroups<DualQuaternionKernel>(influences, startIndex, endIndex, boneDualQuats, streams);
+    }
+} // namespace EMotionFX::SkinningKernels
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+namespace MCore
+{
+    class DualQuaternion;
+}
+
+namespace EMotionFX
+{
+    class Mesh;
+
+    /**
+     * The skinning influences of all vertices of a mesh, pre-sorted by the number of influences per vertex.
+     * The vertices are grouped by their number of influences, so that the skinning kernels can run a loop with a fixed number of
+     * influences for each group. The bone indices and weights are stored in separate streams, where the influences of a vertex are
+     * stored next to each other. The vertices are addressed through their index in the sorted order, which is in range of
+     * [0..GetNumVertices()-1].
+     */
+    class EMFX_API SkinningInfluences
+    {
+    public:
+        struct Group
+        {
+            uint32 m_numInfluences = 0;     /**< The number of influences of every vertex in this group. */
+            uint32 m_firstVertex = 0;       /**< The index of the first vertex of this group in the sorted order. */
+            uint32 m_numVertices = 0;       /**< The number of vertices in this group. */
+            uint32 m_firstInfluence = 0;    /**< The index of the first influence of the first vertex of this group. */
+        };
+
+        /**
+         * Build the sorted influences from the skinning info layer of the mesh.
+         * The bone numbers of the influences have to be set to the local bone indices of the deformer already.
+         * @param mesh The mesh to build the influences for. Clears the influences in case the mesh has no skinning info.
+         */
+        void Init(Mesh* mesh);
+        void Clear();
+
+        size_t GetNumVertices() const                                   { return m_vertices.size(); }
+        const AZStd::vector<Group>& GetGroups() const                   { return m_groups; }
+        const AZStd::vector<uint32>& GetVertices() const                { return m_vertices; }
+        const AZStd::vector<uint16>& GetBoneIndices() const             { return m_boneIndices; }
+        const AZStd::vector<float>& GetWeights() const                  { return m_weights; }
+
+    private:
+        AZStd::vector<Group>    m_groups;       /**< The groups, sorted by their number of influences. */
+        AZStd::vector<uint32>   m_vertices;     /**< The mesh vertex index of every vertex in the sorted order. */
+        AZStd::vector<uint16>   m_boneIndices;  /**< The local bone index of every influence. */
+        AZStd::vector<float>    m_weights;      /**< The weight of every influence. */
+    };
+
+    /**
+     * SIMD kernels for skinning the vertices of a mesh on the CPU.
+     * The kernels skin a range of vertices in the sorted order of the skinning influences, so that the mesh can be split into
+     * batches that get skinned in parallel. The influences of a vertex are blended using SIMD multiply-adds on the rows of the bone
+     * matrices or on the parts of the bone dual quaternions, followed by a single transform per vertex attribute.
+     */
+    namespace SkinningKernels
+    {
+        /**
+         * The vertex attributes that get skinned. The tangents and bitangents are optional and can be nullptr.
+         */
+        struct EMFX_API VertexStreams
+        {
+            AZ::Vector3* m_positions = nullptr;
+            AZ::Vector3* m_normals = nullptr;
+            AZ::Vector4* m_tangents = nullptr;
+            AZ::Vector3* m_bitangents = nullptr;
+
+            /**
+             * Get the current vertex data of the given mesh.
+             * @param mesh The mesh to get the vertex data from.
+             * @result The vertex streams pointing into the vertex data of the mesh.
+             */
+            static VertexStreams Create(Mesh* mesh);
+        };
+
+        /**
+         * Skin the vertices using linear blend skinning, which gives the same result as accumulating MCore::Skin for every influence.
+         * Vertices without any influences end up at the origin. The w component of the tangents is kept.
+         * @param influences The sorted skinning influences of the mesh.
+         * @param startIndex The first vertex to skin, as index in the sorted order.
+         * @param endIndex The vertex after the last vertex to skin, as index in the sorted order.
+         * @param boneMatrices The skinning matrices, indexed by the local bone indices of the influences.
+         * @param streams The vertex attributes to skin.
+         */
+        void LinearBlend(const SkinningInfluences& influences, size_t startIndex, size_t endIndex, const AZ::Matrix3x4* boneMatrices, const VertexStreams& streams);
+
+        /**
+         * Skin the vertices using dual quaternion skinning. The dual quaternions of the influences get flipped onto the hemisphere of the
+         * first influence before blending them. Vertices without any influences keep their values. The w component of the tangents is kept.
+         * @param influences The sorted skinning influences of the mesh.
+         * @param startIndex The first vertex to skin, as index in the sorted order.
+         * @param endIndex The vertex after the last vertex to skin, as index in the sorted order.
+         * @param boneDualQuats The skinning dual quaternions, indexed by the local bone indices of the influences.
+         * @param streams The vertex attributes to skin.
+         */
+        void DualQuaternion(const SkinningInfluences& influences, size_t startIndex, size_t endIndex, const MCore::DualQuaternion* boneDualQuats, const VertexStreams& streams);
+    } // namespace SkinningKernels
+} // namespace EMotionFX
@@ -7,6 +7,8 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
 #include "Mesh.h"
@@ -69,6 +71,7 @@ namespace EMotionFX
         // copy the bone info (for precalc/optimization reasons)
         result->m_nodeNumbers    = m_nodeNumbers;
         result->m_boneMatrices   = m_boneMatrices;
+        result->m_influences     = m_influences;
 
         // return the result
         return result;
@@ -93,111 +96,42 @@ namespace EMotionFX
             m_boneMatrices[i] = skinningMatrices[nodeIndex];
         }
 
-        // find the skinning layer
-        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
-        AZ_Assert(layer, "Cannot find skinning info");
-
-        // Perform the skinning.
-        AZ::Vector3* __restrict positions    = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
-        AZ::Vector3* __restrict normals      = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
-        AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
-        AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
-        AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
-    }
-
-
-    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
-    {
-        AZ::Vector3 newPos, newNormal;
-        AZ::Vector3 vtxPos, normal;
-        AZ::Vector4 tangent, newTangent;
-        AZ::Vector3 bitangent, newBitangent;
-
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
+        const SkinningKernels::VertexStreams streams = SkinningKernels::VertexStreams::Create(m_mesh);
+        const size_t numVertices = m_influences.GetNumVertices();
+        const size_t numBatches = (numVertices + s_numVerticesPerBatch - 1) / s_numVerticesPerBatch;
+        if (numBatches <= 1)
         {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
-                newBitangent = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-                bitangent = bitangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &bitangent, &newPos, &newNormal, &newTangent, &newBitangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
-
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-                bitangents[v]   = newBitangent;
-            }
+            SkinRange(0, numVertices, streams);
         }
-        else if (tangents) // only tangents but no bitangents
+        else
         {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
+            AZ::JobCompletion jobCompletion;
 
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &newPos, &newNormal, &newTangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
-
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-            }
-        }
-        else // there are no tangents and bitangents to skin
-        {
-            for (uint32 v = startVertex; v < endVertex; ++v)
+            // Split up the skinned vertices into batches.
+            for (size_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
             {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
+                const size_t startIndex = batchIndex * s_numVerticesPerBatch;
+                const size_t endIndex = AZStd::min(startIndex + s_numVerticesPerBatch, numVertices);
+
+                // Create a job for every batch and skin them simultaneously.
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([this, startIndex, endIndex, &streams]()
+                    {
+                        SkinRange(startIndex, endIndex, streams);
+                    }, /*isAutoDelete=*/true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
 
-                vtxPos  = positions[v];
-                normal  = normals[v];
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
 
-                // skin the vertex
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &newPos, &newNormal, influence->GetWeight());
-                }
 
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-            }
-        }
+    void SoftSkinDeformer::SkinRange(size_t startIndex, size_t endIndex, const SkinningKernels::VertexStreams& streams) const
+    {
+        SkinningKernels::LinearBlend(m_influences, startIndex, endIndex, m_boneMatrices.data(), streams);
     }
 
 
@@ -212,6 +146,7 @@ namespace EMotionFX
         // clear the bone information array
         m_boneMatrices.clear();
         m_nodeNumbers.clear();
+        m_influences.Clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -257,5 +192,8 @@ namespace EMotionFX
                 influence->SetBoneNr(boneIndex);
             }
         }
+
+        // sort the influences by their number per vertex, now that their bone numbers are set
+        m_influences.Init(m_mesh);
     }
 } // namespace EMotionFX
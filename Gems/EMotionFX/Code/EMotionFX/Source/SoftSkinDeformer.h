@@ -13,6 +13,7 @@
 #include <AzCore/Math/Transform.h>
 #include "EMotionFXConfig.h"
 #include "MeshDeformer.h"
+#include "SkinningKernels.h"
 
 
 namespace EMotionFX
@@ -20,7 +21,6 @@ namespace EMotionFX
     // forward declarations
     class Actor;
     class Node;
-    class SkinningInfoVertexAttributeLayer;
     class Mesh;
 
 
@@ -120,6 +120,10 @@ namespace EMotionFX
     protected:
         AZStd::vector<AZ::Matrix3x4>    m_boneMatrices;
         AZStd::vector<size_t>           m_nodeNumbers;
+        SkinningInfluences              m_influences;   /**< The skinning influences of the mesh, sorted by the number of influences per vertex. */
+
+        //! Number of vertices per batch/job used for multi-threaded software skinning.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
 
         /**
          * Default constructor.
@@ -143,6 +147,12 @@ namespace EMotionFX
             return foundBoneIndex != end(m_nodeNumbers) ? AZStd::distance(begin(m_nodeNumbers), foundBoneIndex) : InvalidIndex;
         }
 
-        void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+        /**
+         * Skin a part of the mesh.
+         * @param startIndex The first vertex to skin, as index in the sorted order of the skinning influences.
+         * @param endIndex The vertex after the last vertex to skin, as index in the sorted order of the skinning influences.
+         * @param streams The vertex attributes to skin.
+         */
+        void SkinRange(size_t startIndex, size_t endIndex, const SkinningKernels::VertexStreams& streams) const;
     };
 } // namespace EMotionFX
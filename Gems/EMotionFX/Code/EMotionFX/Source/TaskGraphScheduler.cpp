@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "TaskGraphScheduler.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "Attachment.h"
+#include "EMotionFXManager.h"
+#include <EMotionFX/Source/Allocators.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(TaskGraphScheduler, ActorUpdateAllocator)
+
+    // constructor
+    TaskGraphScheduler::TaskGraphScheduler()
+        : ActorUpdateScheduler()
+    {
+        m_actorInstances.reserve(1024);
+    }
+
+
+    // destructor
+    TaskGraphScheduler::~TaskGraphScheduler()
+    {
+    }
+
+
+    // create
+    TaskGraphScheduler* TaskGraphScheduler::Create()
+    {
+        return aznew TaskGraphScheduler();
+    }
+
+
+    // clear the schedule
+    void TaskGraphScheduler::Clear()
+    {
+        Lock();
+        m_actorInstances.clear();
+        m_taskGraphDirty = true;
+        Unlock();
+    }
+
+
+    // log it, for debugging purposes
+    void TaskGraphScheduler::Print()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        for (size_t i = 0; i < m_actorInstances.size(); ++i)
+        {
+            const ActorInstance* actorInstance = m_actorInstances[i];
+            const ActorInstance* attachedTo = actorInstance->GetAttachedTo();
+            AZ_Printf("EMotionFX", "ACTOR INSTANCE %.3zu - ID %u, waits for %s", i, actorInstance->GetID(),
+                attachedTo ? AZStd::string::format("ID %u", attachedTo->GetID()).c_str() : "nothing");
+        }
+
+        AZ_Printf("EMotionFX", "---------");
+    }
+
+
+    // rebuild the task graph from the actor instances in the schedule
+    void TaskGraphScheduler::BuildTaskGraph()
+    {
+        AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::BuildTaskGraph");
+
+        m_taskGraph.Reset();
+
+        const AZ::TaskDescriptor taskDescriptor{ "ActorInstanceUpdate", "Animation" };
+        AZStd::vector<AZ::TaskToken> taskTokens;
+        taskTokens.reserve(m_actorInstances.size());
+        AZStd::unordered_map<const ActorInstance*, size_t> taskIndices;
+        taskIndices.reserve(m_actorInstances.size());
+
+        for (ActorInstance* actorInstance : m_actorInstances)
+        {
+            taskIndices.emplace(actorInstance, taskTokens.size());
+            taskTokens.emplace_back(m_taskGraph.AddTask(taskDescriptor, [this, actorInstance]()
+            {
+                ExecuteActorInstance(actorInstance);
+            }));
+        }
+
+        // an attachment reads the pose of the actor instance it is attached to, so it has to wait for that one to be updated
+        for (size_t i = 0; i < m_actorInstances.size(); ++i)
+        {
+            const ActorInstance* attachedTo = m_actorInstances[i]->GetAttachedTo();
+            if (!attachedTo)
+            {
+                continue;
+            }
+
+            const auto parentTask = taskIndices.find(attachedTo);
+            if (parentTask != taskIndices.end())
+            {
+                taskTokens[parentTask->second].Precedes(taskTokens[i]);
+            }
+        }
+
+        m_taskGraphDirty = false;
+    }
+
+
+    // execute the schedule
+    void TaskGraphScheduler::Execute(float timePassedInSeconds)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (m_actorInstances.empty())
+        {
+            return;
+        }
+
+        // propagate root actor instance visibility to their attachments
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+            if (rootInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
+        }
+
+        // reset stats
+        m_numUpdated.SetValue(0);
+        m_numVisible.SetValue(0);
+        m_numSampled.SetValue(0);
+
+        // the actor instances use their thread index to get their temporary poses, which is sized for the task workers at initialization
+        AZ_Assert(GetEMotionFX().GetNumThreads() >= AZ::TaskExecutor::Instance().GetThreadCount(),
+            "EMotion FX has less thread data than there are task graph workers. Was the task graph system active when EMotion FX got initialized?");
+
+        if (m_taskGraphDirty)
+        {
+            BuildTaskGraph();
+        }
+
+        m_timePassedInSeconds = timePassedInSeconds;
+
+        AZ::TaskGraphEvent finishedEvent{ "TaskGraphScheduler Wait" };
+        m_taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+
+    // update a single actor instance from within its task
+    void TaskGraphScheduler::ExecuteActorInstance(ActorInstance* actorInstance)
+    {
+        if (actorInstance->GetIsEnabled() == false)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::Execute::ActorInstanceUpdateTask");
+
+        actorInstance->SetThreadIndex(AZ::TaskExecutor::Instance().GetCurrentWorkerIndex());
+        m_numUpdated.Increment();
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        const float timePassedInSeconds = m_timePassedInSeconds;
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+    }
+
+
+    void TaskGraphScheduler::RecursiveInsertActorInstance(ActorInstance* instance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        AZ_Assert(AZStd::find(m_actorInstances.begin(), m_actorInstances.end(), instance) == m_actorInstances.end(),
+            "Expected the actor instance not being part of the schedule already.");
+
+        m_actorInstances.emplace_back(instance);
+        m_taskGraphDirty = true;
+
+        // recursively add all attachments too
+        const size_t numAttachments = instance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = instance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveInsertActorInstance(attachment);
+            }
+        }
+    }
+
+
+    // remove the actor instance from the schedule (excluding attachments)
+    size_t TaskGraphScheduler::RemoveActorInstance(ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        const auto newEnd = AZStd::remove(m_actorInstances.begin(), m_actorInstances.end(), actorInstance);
+        if (newEnd != m_actorInstances.end())
+        {
+            m_actorInstances.erase(newEnd, m_actorInstances.end());
+            m_taskGraphDirty = true;
+        }
+
+        return 0;
+    }
+
+
+    // remove the actor instance (including all of its attachments)
+    void TaskGraphScheduler::RecursiveRemoveActorInstance(ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        // remove the actual actor instance
+        RemoveActorInstance(actorInstance);
+
+        // recursively remove all attachments as well
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveRemoveActorInstance(attachment);
+            }
+        }
+    }
+
+
+    void TaskGraphScheduler::Lock()
+    {
+        m_mutex.Lock();
+    }
+
+
+    void TaskGraphScheduler::Unlock()
+    {
+        m_mutex.Unlock();
+    }
+}   // namespace EMotionFX
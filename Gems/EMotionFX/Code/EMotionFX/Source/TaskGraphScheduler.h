@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the required headers
+#include "EMotionFXConfig.h"
+#include "ActorUpdateScheduler.h"
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+
+
+    /**
+     * The task graph scheduler.
+     * This scheduler builds a dependency graph of all actor instances in the schedule, in which every attachment depends on the actor instance
+     * it is attached to, and submits it as a single AZ::TaskGraph. Actor instances that don't depend on each other, like the members of a crowd,
+     * are updated fully in parallel, while an attachment starts as soon as its parent has been updated instead of waiting for a whole schedule step.
+     * The task graph is only rebuilt when actor instances get inserted or removed, otherwise the same graph is resubmitted every update.
+     * This scheduler requires the task graph system to be active.
+     */
+    class EMFX_API TaskGraphScheduler
+        : public ActorUpdateScheduler
+    {
+        AZ_CLASS_ALLOCATOR_DECL
+    public:
+        /**
+         * The unique type ID of this scheduler, as returned by the GetType() method.
+         */
+        enum
+        {
+            TYPE_ID = 0x00000003
+        };
+
+        /**
+         * The constructor.
+         */
+        static TaskGraphScheduler* Create();
+
+        /**
+         * Get the name of this class, or a description.
+         * @result The string containing the name of the scheduler.
+         */
+        const char* GetName() const override        { return "TaskGraphScheduler"; }
+
+        /**
+         * Get the unique type ID of the scheduler type.
+         * All schedulers will have another ID, so that you can use this to identify what scheduler you are dealing with.
+         * @result The unique ID of the scheduler type.
+         */
+        uint32 GetType() const override             { return TYPE_ID; }
+
+        /**
+         * Update all actor instances in the schedule by submitting the task graph, and wait for it to finish.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void Execute(float timePassedInSeconds) override;
+
+        /**
+         * LOG the schedule using the LOG method.
+         * This shows every actor instance in the schedule together with the actor instance it has to wait for.
+         */
+        void Print() override;
+
+        /**
+         * Clear the schedule.
+         */
+        void Clear() override;
+
+        /**
+         * Recursively insert an actor instance into the schedule, including all its attachments.
+         * @param actorInstance The actor instance to insert.
+         * @param startStep Unused, as this scheduler doesn't work with schedule steps.
+         */
+        void RecursiveInsertActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Recursively remove an actor instance and its attachments from the schedule.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep Unused, as this scheduler doesn't work with schedule steps.
+         */
+        void RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Remove a single actor instance from the schedule. This will not remove its attachments.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep Unused, as this scheduler doesn't work with schedule steps.
+         * @result Always returns 0, as this scheduler doesn't work with schedule steps.
+         */
+        size_t RemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        void Lock();
+        void Unlock();
+
+        size_t GetNumActorInstances() const                     { return m_actorInstances.size(); }
+        ActorInstance* GetActorInstance(size_t index) const     { return m_actorInstances[index]; }
+
+        /**
+         * Check if the task graph needs to be rebuilt before the next update, because the schedule changed since it was last built.
+         * @result Returns true when the task graph will be rebuilt on the next call to Execute.
+         */
+        bool GetIsTaskGraphDirty() const                        { return m_taskGraphDirty; }
+
+    protected:
+        AZStd::vector<ActorInstance*>   m_actorInstances;                                   /**< The actor instances in the schedule, in insertion order. */
+        AZ::TaskGraph                   m_taskGraph{ "EMotionFX::TaskGraphScheduler" };     /**< The retained task graph, with one task per actor instance. */
+        MCore::MutexRecursive           m_mutex;
+        float                           m_timePassedInSeconds = 0.0f;                       /**< The time passed of the current update, read by the tasks. */
+        bool                            m_taskGraphDirty = true;                            /**< Set when the schedule changed and the task graph has to be rebuilt. */
+
+        /**
+         * The constructor.
+         */
+        TaskGraphScheduler();
+
+        /**
+         * The destructor.
+         */
+        ~TaskGraphScheduler() override;
+
+        /**
+         * Rebuild the task graph from the current schedule.
+         * Every actor instance gets its own task, which has to wait for the task of the actor instance it is attached to.
+         */
+        void BuildTaskGraph();
+
+        /**
+         * Update a single actor instance. This is what every task in the task graph executes.
+         * @param actorInstance The actor instance to update.
+         */
+        void ExecuteActorInstance(ActorInstance* actorInstance);
+    };
+}   // namespace EMotionFX
@@ -103,6 +103,8 @@ set(FILES
     Source/PoseDataFactory.h
     Source/PoseDataRagdoll.cpp
     Source/PoseDataRagdoll.h
+    Source/PoseKernels.cpp
+    Source/PoseKernels.h
     Source/RagdollInstance.cpp
     Source/RagdollInstance.h
     Source/RagdollVelocityEvaluators.cpp
@@ -123,6 +125,8 @@ set(FILES
     Source/Skeleton.h
     Source/SkinningInfoVertexAttributeLayer.cpp
     Source/SkinningInfoVertexAttributeLayer.h
+    Source/SkinningKernels.cpp
+    Source/SkinningKernels.h
     Source/SoftSkinDeformer.cpp
     Source/SoftSkinDeformer.h
     Source/SoftSkinManager.cpp
@@ -131,6 +135,8 @@ set(FILES
     Source/SpringSolver.h
     Source/SubMesh.cpp
     Source/SubMesh.h
+    Source/TaskGraphScheduler.cpp
+    Source/TaskGraphScheduler.h
     Source/ThreadData.cpp
     Source/ThreadData.h
     Source/Transform.cpp
@@ -345,6 +351,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
@@ -449,6 +449,7 @@ namespace EMotionFX
         {
             dependent.push_back(AZ_CRC("AssetCatalogService", 0xc68ffc57));
             dependent.push_back(AZ_CRC("JobsService", 0xd5ab5a50));
+            dependent.push_back(AZ_CRC_CE("TaskExecutorService"));
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/MotionDataSampleSettings.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Pose.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataBenchmarkFixture
+        : public SystemComponentBenchmarkFixture
+    {
+    public:
+        static constexpr float s_duration = 2.0f;
+        static constexpr float s_sampleRate = 30.0f;
+
+        // Samples a full pose per iteration from motion data of the given type, created from animated data for every joint of the actor.
+        template<class MotionDataType>
+        void RunSamplePoseBenchmark(benchmark::State& state)
+        {
+            const size_t numJoints = aznumeric_cast<size_t>(state.range(0));
+            auto actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(numJoints);
+            ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+            {
+                Pose pose;
+                pose.LinkToActorInstance(actorInstance);
+                pose.InitFromBindPose(actorInstance);
+
+                NonUniformMotionData sourceMotionData;
+                InitSourceMotionData(sourceMotionData, numJoints);
+                MotionDataType motionData;
+                motionData.InitFromNonUniformData(&sourceMotionData);
+
+                MotionDataSampleSettings sampleSettings;
+                sampleSettings.m_actorInstance = actorInstance;
+                constexpr float timeStep = 1.0f / 60.0f;
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    sampleSettings.m_sampleTime = AZ::GetMod(sampleSettings.m_sampleTime + timeStep, s_duration);
+                    motionData.SamplePose(sampleSettings, &pose);
+                }
+
+                state.SetItemsProcessed(state.iterations() * state.range(0));
+                state.counters["SaveSizeInBytes"] = aznumeric_cast<double>(motionData.CalcStreamSaveSizeInBytes(MotionData::SaveSettings()));
+            }
+            actorInstance->Destroy();
+        }
+
+    private:
+        // Create non uniform motion data with animated positions and rotations for the joints of a SimpleJointChainActor.
+        static void InitSourceMotionData(NonUniformMotionData& motionData, size_t numJoints)
+        {
+            AZ::SimpleLcgRandom random;
+            motionData.Resize(numJoints, 0, 0);
+            motionData.SetSampleRate(s_sampleRate);
+
+            const size_t numKeys = static_cast<size_t>(s_duration * s_sampleRate) + 1;
+            const float keySpacing = s_duration / static_cast<float>(numKeys - 1);
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                motionData.SetJointName(i, i == 0 ? AZStd::string("rootJoint") : "joint" + AZStd::to_string(i));
+                motionData.AllocateJointPositionSamples(i, numKeys);
+                motionData.AllocateJointRotationSamples(i, numKeys);
+                for (size_t k = 0; k < numKeys; ++k)
+                {
+                    const float time = k * keySpacing;
+                    const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() + 0.1f).GetNormalized();
+                    const AZ::Vector3 position = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 10.0f - AZ::Vector3(5.0f);
+                    motionData.SetJointPositionSample(i, k, { time, position });
+                    motionData.SetJointRotationSample(i, k, { time, AZ::Quaternion::CreateFromAxisAngle(axis, random.GetRandomFloat() * AZ::Constants::Pi) });
+                }
+            }
+            motionData.UpdateDuration();
+        }
+    };
+
+    BENCHMARK_DEFINE_F(CompressedMotionDataBenchmarkFixture, BM_UniformMotionDataSamplePose)(benchmark::State& state)
+    {
+        RunSamplePoseBenchmark<UniformMotionData>(state);
+    }
+
+    BENCHMARK_DEFINE_F(CompressedMotionDataBenchmarkFixture, BM_CompressedMotionDataSamplePose)(benchmark::State& state)
+    {
+        RunSamplePoseBenchmark<CompressedMotionData>(state);
+    }
+
+    BENCHMARK_REGISTER_F(CompressedMotionDataBenchmarkFixture, BM_UniformMotionDataSamplePose)
+        ->Arg(100)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(CompressedMotionDataBenchmarkFixture, BM_CompressedMotionDataSamplePose)
+        ->Arg(100)
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX
+
+#endif
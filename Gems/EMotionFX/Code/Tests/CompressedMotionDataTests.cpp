@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr float s_duration = 2.0f;
+        static constexpr float s_sampleRate = 30.0f;
+
+    protected:
+        // Create non uniform motion data for the joints of a SimpleJointChainActor, where the last joint isn't animated and only
+        // every other joint has animated positions.
+        void InitSourceMotionData(size_t numJoints)
+        {
+            m_sourceMotionData.Resize(numJoints, 1, 1);
+            m_sourceMotionData.SetSampleRate(s_sampleRate);
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                m_sourceMotionData.SetJointName(i, i == 0 ? AZStd::string("rootJoint") : "joint" + AZStd::to_string(i));
+                m_sourceMotionData.SetJointStaticPosition(i, AZ::Vector3(static_cast<float>(i), 0.0f, 0.0f));
+                m_sourceMotionData.SetJointStaticRotation(i, AZ::Quaternion::CreateIdentity());
+            }
+            m_sourceMotionData.SetMorphName(0, "morph");
+            m_sourceMotionData.SetFloatName(0, "float");
+
+            // Place the keys at the sample rate, so that the interpolated values of the compressed data match the source data.
+            const size_t numKeys = 61;
+            const float keySpacing = s_duration / static_cast<float>(numKeys - 1);
+            for (size_t i = 0; i + 1 < numJoints; ++i)
+            {
+                const bool positionAnimated = (i % 2 == 0);
+                if (positionAnimated)
+                {
+                    m_sourceMotionData.AllocateJointPositionSamples(i, numKeys);
+                }
+                m_sourceMotionData.AllocateJointRotationSamples(i, numKeys);
+                EMFX_SCALECODE
+                (
+                    m_sourceMotionData.AllocateJointScaleSamples(i, numKeys);
+                )
+
+                for (size_t k = 0; k < numKeys; ++k)
+                {
+                    const float time = k * keySpacing;
+                    const AZ::Vector3 axis = AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat() + 0.1f).GetNormalized();
+                    const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(axis, (m_random.GetRandomFloat() * 2.0f - 1.0f) * AZ::Constants::Pi);
+                    if (positionAnimated)
+                    {
+                        const AZ::Vector3 position = AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat()) * 10.0f - AZ::Vector3(5.0f);
+                        m_sourceMotionData.SetJointPositionSample(i, k, { time, position });
+                    }
+                    m_sourceMotionData.SetJointRotationSample(i, k, { time, rotation });
+                    EMFX_SCALECODE
+                    (
+                        const AZ::Vector3 scale = AZ::Vector3(0.5f) + AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat());
+                        m_sourceMotionData.SetJointScaleSample(i, k, { time, scale });
+                    )
+                }
+            }
+
+            m_sourceMotionData.AllocateMorphSamples(0, numKeys);
+            m_sourceMotionData.AllocateFloatSamples(0, numKeys);
+            for (size_t k = 0; k < numKeys; ++k)
+            {
+                m_sourceMotionData.SetMorphSample(0, k, { k * keySpacing, m_random.GetRandomFloat() });
+                m_sourceMotionData.SetFloatSample(0, k, { k * keySpacing, m_random.GetRandomFloat() * 100.0f });
+            }
+            m_sourceMotionData.UpdateDuration();
+        }
+
+        // Compare the samples of two motion datas at a set of times in between the sample times.
+        void CompareSamples(const MotionData& expected, const MotionData& actual)
+        {
+            ASSERT_EQ(actual.GetNumJoints(), expected.GetNumJoints());
+            for (float time = 0.0f; time <= expected.GetDuration(); time += 0.0123f)
+            {
+                for (size_t i = 0; i < expected.GetNumJoints(); ++i)
+                {
+                    const Transform expectedTransform = expected.SampleJointTransform(time, i);
+                    const Transform actualTransform = actual.SampleJointTransform(time, i);
+                    EXPECT_TRUE(actualTransform.m_position.IsClose(expectedTransform.m_position, 0.01f));
+                    EXPECT_GT(AZ::Abs(actualTransform.m_rotation.Dot(expectedTransform.m_rotation)), 0.999f);
+                    EMFX_SCALECODE
+                    (
+                        EXPECT_TRUE(actualTransform.m_scale.IsClose(expectedTransform.m_scale, 0.01f));
+                    )
+                }
+
+                EXPECT_NEAR(actual.SampleMorph(time, 0), expected.SampleMorph(time, 0), 0.001f);
+                EXPECT_NEAR(actual.SampleFloat(time, 0), expected.SampleFloat(time, 0), 0.01f);
+            }
+        }
+
+        AZ::SimpleLcgRandom m_random;
+        NonUniformMotionData m_sourceMotionData;
+    };
+
+    TEST_F(CompressedMotionDataFixture, InitFromNonUniformData)
+    {
+        constexpr size_t numJoints = 5;
+        InitSourceMotionData(numJoints);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceMotionData, /*keepSameSampleRate=*/true);
+        EXPECT_EQ(motionData.GetNumSamples(), 61);
+        EXPECT_NEAR(motionData.GetDuration(), s_duration, 0.0001f);
+
+        size_t expectedFrameSize = 2;
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            EXPECT_EQ(motionData.IsJointAnimated(i), m_sourceMotionData.IsJointAnimated(i));
+            EXPECT_EQ(motionData.IsJointPositionAnimated(i), m_sourceMotionData.IsJointPositionAnimated(i));
+            EXPECT_EQ(motionData.IsJointRotationAnimated(i), m_sourceMotionData.IsJointRotationAnimated(i));
+            expectedFrameSize += motionData.IsJointPositionAnimated(i) ? 3 : 0;
+            expectedFrameSize += motionData.IsJointRotationAnimated(i) ? 3 : 0;
+            EMFX_SCALECODE
+            (
+                EXPECT_EQ(motionData.IsJointScaleAnimated(i), m_sourceMotionData.IsJointScaleAnimated(i));
+                expectedFrameSize += motionData.IsJointScaleAnimated(i) ? 3 : 0;
+            )
+        }
+        EXPECT_EQ(motionData.GetFrameSize(), expectedFrameSize);
+        EXPECT_FALSE(motionData.IsJointAnimated(numJoints - 1));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_TRUE(motionData.IsFloatAnimated(0));
+
+        CompareSamples(m_sourceMotionData, motionData);
+    }
+
+    TEST_F(CompressedMotionDataFixture, ClearSamples)
+    {
+        constexpr size_t numJoints = 5;
+        InitSourceMotionData(numJoints);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceMotionData);
+        const size_t frameSize = motionData.GetFrameSize();
+
+        // Removing tracks from the frames shouldn't affect the other tracks.
+        motionData.ClearJointPositionSamples(0);
+        m_sourceMotionData.ClearJointPositionSamples(0);
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(0));
+        EXPECT_EQ(motionData.GetFrameSize(), frameSize - 3);
+
+        motionData.ClearMorphSamples(0);
+        m_sourceMotionData.ClearMorphSamples(0);
+        EXPECT_FALSE(motionData.IsMorphAnimated(0));
+        EXPECT_EQ(motionData.GetFrameSize(), frameSize - 4);
+        CompareSamples(m_sourceMotionData, motionData);
+
+        // Removing a joint removes all of its tracks.
+        motionData.RemoveJoint(1);
+        m_sourceMotionData.RemoveJoint(1);
+        CompareSamples(m_sourceMotionData, motionData);
+
+        motionData.ClearAllJointTransformSamples();
+        EXPECT_EQ(motionData.GetFrameSize(), 1);
+        for (size_t i = 0; i < motionData.GetNumJoints(); ++i)
+        {
+            EXPECT_FALSE(motionData.IsJointAnimated(i));
+        }
+        EXPECT_NEAR(motionData.SampleFloat(1.0f, 0), m_sourceMotionData.SampleFloat(1.0f, 0), 0.01f);
+    }
+
+    TEST_F(CompressedMotionDataFixture, SaveAndRead)
+    {
+        InitSourceMotionData(5);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceMotionData);
+
+        const MotionData::SaveSettings saveSettings;
+        MCore::MemoryFile file;
+        file.Open();
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        CompressedMotionData loadedMotionData;
+        file.Seek(0);
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedMotionData.Read(&file, readSettings));
+
+        EXPECT_EQ(loadedMotionData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedMotionData.GetFrameSize(), motionData.GetFrameSize());
+        EXPECT_FLOAT_EQ(loadedMotionData.GetDuration(), motionData.GetDuration());
+        EXPECT_STREQ(loadedMotionData.GetJointName(1).c_str(), "joint1");
+        EXPECT_STREQ(loadedMotionData.GetMorphName(0).c_str(), "morph");
+        for (size_t i = 0; i < motionData.GetNumJoints(); ++i)
+        {
+            for (float time = 0.0f; time <= motionData.GetDuration(); time += 0.1f)
+            {
+                const Transform expectedTransform = motionData.SampleJointTransform(time, i);
+                const Transform loadedTransform = loadedMotionData.SampleJointTransform(time, i);
+                EXPECT_TRUE(loadedTransform.m_position.IsClose(expectedTransform.m_position));
+                EXPECT_TRUE(loadedTransform.m_rotation.IsClose(expectedTransform.m_rotation));
+            }
+        }
+        EXPECT_FLOAT_EQ(loadedMotionData.SampleFloat(0.5f, 0), motionData.SampleFloat(0.5f, 0));
+    }
+} // namespace EMotionFX
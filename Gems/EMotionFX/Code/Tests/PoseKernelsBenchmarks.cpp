@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Transform.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class PoseKernelsBenchmarkFixture
+        : public SystemComponentBenchmarkFixture
+    {
+    public:
+        void internalSetUp(const benchmark::State& state)
+        {
+            SystemComponentBenchmarkFixture::internalSetUp();
+
+            const size_t numJoints = aznumeric_cast<size_t>(state.range(0));
+            m_actor = ActorFactory::CreateAndInit<QuadTreeActor>(numJoints);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+
+            m_pose = AZStd::make_unique<Pose>();
+            m_pose->LinkToActorInstance(m_actorInstance);
+            m_pose->InitFromBindPose(m_actorInstance);
+            m_destPose = AZStd::make_unique<Pose>();
+            m_destPose->LinkToActorInstance(m_actorInstance);
+            m_destPose->InitFromBindPose(m_actorInstance);
+
+            AZ::SimpleLcgRandom random;
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() + 0.1f).GetNormalized();
+                m_destPose->SetLocalSpaceTransform(i, Transform(
+                    AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 10.0f - AZ::Vector3(5.0f),
+                    AZ::Quaternion::CreateFromAxisAngle(axis, (random.GetRandomFloat() * 2.0f - 1.0f) * AZ::Constants::Pi)));
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_pose.reset();
+            m_destPose.reset();
+            m_actorInstance->Destroy();
+            m_actor.reset();
+
+            SystemComponentBenchmarkFixture::internalTearDown();
+        }
+
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        static constexpr float s_weight = 0.4f;
+
+        AZStd::unique_ptr<QuadTreeActor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        AZStd::unique_ptr<Pose> m_pose;
+        AZStd::unique_ptr<Pose> m_destPose;
+    };
+
+    // Blends the pose one transform at a time, which is what the pose did before it used the pose kernels.
+    BENCHMARK_DEFINE_F(PoseKernelsBenchmarkFixture, BM_BlendPerTransform)(benchmark::State& state)
+    {
+        const size_t numJoints = m_pose->GetNumTransforms();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                Transform& transform = const_cast<Transform&>(m_pose->GetLocalSpaceTransform(i));
+                transform.Blend(m_destPose->GetLocalSpaceTransform(i), s_weight);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseKernelsBenchmarkFixture, BM_BlendPose)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_pose->Blend(m_destPose.get(), s_weight);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseKernelsBenchmarkFixture, BM_UpdateFullModelSpacePose)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_pose->ForceUpdateFullModelSpacePose();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(PoseKernelsBenchmarkFixture, BM_BlendPerTransform)
+        ->Arg(64)
+        ->Arg(256)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(PoseKernelsBenchmarkFixture, BM_BlendPose)
+        ->Arg(64)
+        ->Arg(256)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(PoseKernelsBenchmarkFixture, BM_UpdateFullModelSpacePose)
+        ->Arg(64)
+        ->Arg(256)
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX
+
+#endif
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/PoseKernels.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/Transform.h>
+#include <Tests/Matchers.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class PoseKernelsFixture
+        : public SystemComponentFixture
+    {
+    public:
+        // The number of transforms isn't a multiple of four on purpose, to also run through the remaining transforms.
+        static constexpr size_t s_numTransforms = 63;
+
+    protected:
+        Transform CreateRandomTransform()
+        {
+            const AZ::Vector3 axis = AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat() + 0.1f).GetNormalized();
+            Transform transform(
+                AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat()) * 10.0f - AZ::Vector3(5.0f),
+                AZ::Quaternion::CreateFromAxisAngle(axis, (m_random.GetRandomFloat() * 2.0f - 1.0f) * AZ::Constants::Pi));
+            EMFX_SCALECODE
+            (
+                transform.m_scale = AZ::Vector3(0.5f) + AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat());
+            )
+            return transform;
+        }
+
+        AZStd::vector<Transform> CreateRandomTransforms(size_t numTransforms)
+        {
+            AZStd::vector<Transform> transforms(numTransforms);
+            for (Transform& transform : transforms)
+            {
+                transform = CreateRandomTransform();
+            }
+            return transforms;
+        }
+
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    TEST_F(PoseKernelsFixture, Blend)
+    {
+        const AZStd::vector<Transform> sourceTransforms = CreateRandomTransforms(s_numTransforms);
+        const AZStd::vector<Transform> destTransforms = CreateRandomTransforms(s_numTransforms);
+
+        for (const float weight : { 0.0f, 0.25f, 0.5f, 0.77f, 1.0f })
+        {
+            AZStd::vector<Transform> transforms = sourceTransforms;
+            PoseKernels::Blend(transforms.data(), destTransforms.data(), nullptr, s_numTransforms, weight);
+
+            for (size_t i = 0; i < s_numTransforms; ++i)
+            {
+                Transform expectedResult = sourceTransforms[i];
+                expectedResult.Blend(destTransforms[i], weight);
+                EXPECT_THAT(transforms[i], IsClose(expectedResult));
+            }
+        }
+    }
+
+    TEST_F(PoseKernelsFixture, BlendNodeIndices)
+    {
+        const AZStd::vector<Transform> sourceTransforms = CreateRandomTransforms(s_numTransforms);
+        const AZStd::vector<Transform> destTransforms = CreateRandomTransforms(s_numTransforms);
+
+        // only blend every other transform, in reverse order
+        AZStd::vector<uint16> nodeIndices;
+        for (size_t i = 0; i < s_numTransforms; i += 2)
+        {
+            nodeIndices.emplace_back(static_cast<uint16>(s_numTransforms - 1 - i));
+        }
+
+        const float weight = 0.33f;
+        AZStd::vector<Transform> transforms = sourceTransforms;
+        PoseKernels::Blend(transforms.data(), destTransforms.data(), nodeIndices.data(), nodeIndices.size(), weight);
+
+        for (size_t i = 0; i < s_numTransforms; ++i)
+        {
+            Transform expectedResult = sourceTransforms[i];
+            if (AZStd::find(nodeIndices.begin(), nodeIndices.end(), static_cast<uint16>(i)) != nodeIndices.end())
+            {
+                expectedResult.Blend(destTransforms[i], weight);
+            }
+            EXPECT_THAT(transforms[i], IsClose(expectedResult));
+        }
+    }
+
+    TEST_F(PoseKernelsFixture, ApplyAdditive)
+    {
+        const AZStd::vector<Transform> sourceTransforms = CreateRandomTransforms(s_numTransforms);
+        const AZStd::vector<Transform> additiveTransforms = CreateRandomTransforms(s_numTransforms);
+
+        for (const float weight : { 0.1f, 0.5f, 0.9f })
+        {
+            AZStd::vector<Transform> transforms = sourceTransforms;
+            PoseKernels::ApplyAdditive(transforms.data(), additiveTransforms.data(), nullptr, s_numTransforms, weight);
+
+            for (size_t i = 0; i < s_numTransforms; ++i)
+            {
+                Transform expectedResult = sourceTransforms[i];
+                expectedResult.m_position += additiveTransforms[i].m_position * weight;
+                expectedResult.m_rotation = expectedResult.m_rotation.NLerp(additiveTransforms[i].m_rotation * expectedResult.m_rotation, weight);
+                EMFX_SCALECODE
+                (
+                    expectedResult.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransforms[i].m_scale, weight);
+                )
+                expectedResult.m_rotation.Normalize();
+                EXPECT_THAT(transforms[i], IsClose(expectedResult));
+            }
+        }
+    }
+
+    TEST_F(PoseKernelsFixture, LocalToModel)
+    {
+        auto actor = ActorFactory::CreateAndInit<QuadTreeActor>(s_numTransforms);
+        const Skeleton& skeleton = *actor->GetSkeleton();
+        const AZStd::vector<Transform> localTransforms = CreateRandomTransforms(s_numTransforms);
+
+        AZStd::vector<Transform> modelTransforms(s_numTransforms);
+        PoseKernels::LocalToModel(skeleton, localTransforms.data(), modelTransforms.data());
+
+        AZStd::vector<Transform> expectedTransforms(s_numTransforms);
+        for (size_t i = 0; i < s_numTransforms; ++i)
+        {
+            const size_t parentIndex = skeleton.GetNode(i)->GetParentIndex();
+            if (parentIndex != InvalidIndex)
+            {
+                expectedTransforms[parentIndex].PreMultiply(localTransforms[i], &expectedTransforms[i]);
+            }
+            else
+            {
+                expectedTransforms[i] = localTransforms[i];
+            }
+
+            EXPECT_THAT(modelTransforms[i], IsClose(expectedTransforms[i]));
+        }
+    }
+} // namespace EMotionFX
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <Tests/SkinningKernelsTestMesh.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class SkinningKernelsBenchmarkFixture
+        : public SystemComponentBenchmarkFixture
+        , public SkinningKernelsTestMesh
+    {
+    public:
+        static constexpr size_t s_numBones = 100;
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            SystemComponentBenchmarkFixture::internalSetUp();
+
+            CreateMesh(aznumeric_cast<uint32>(state.range(0)), s_numBones, /*minInfluences=*/1, /*maxInfluences=*/4);
+            m_boneMatrices = CreateRandomBoneMatrices(s_numBones);
+            m_boneDualQuats = CreateRandomBoneDualQuats(s_numBones);
+            m_input = GetVertexData();
+        }
+
+        void internalTearDown()
+        {
+            m_input = {};
+            m_boneMatrices = {};
+            m_boneDualQuats = {};
+            DestroyMesh();
+
+            SystemComponentBenchmarkFixture::internalTearDown();
+        }
+
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        AZStd::vector<AZ::Matrix3x4> m_boneMatrices;
+        AZStd::vector<MCore::DualQuaternion> m_boneDualQuats;
+        VertexData m_input;
+    };
+
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, BM_InitInfluences)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SkinningInfluences influences;
+            influences.Init(m_mesh);
+            benchmark::DoNotOptimize(influences.GetNumVertices());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, BM_LinearBlendReference)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(SkinLinearBlendReference(m_input, m_boneMatrices));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Both kernel benchmarks restore the input vertices every iteration, the same as the reference skinning copies them to its output.
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, BM_LinearBlendKernel)(benchmark::State& state)
+    {
+        SkinningInfluences influences;
+        influences.Init(m_mesh);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SetVertexData(m_input);
+            SkinningKernels::LinearBlend(influences, 0, influences.GetNumVertices(), m_boneMatrices.data(), SkinningKernels::VertexStreams::Create(m_mesh));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, BM_DualQuaternionReference)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(SkinDualQuatReference(m_input, m_boneDualQuats));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, BM_DualQuaternionKernel)(benchmark::State& state)
+    {
+        SkinningInfluences influences;
+        influences.Init(m_mesh);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SetVertexData(m_input);
+            SkinningKernels::DualQuaternion(influences, 0, influences.GetNumVertices(), m_boneDualQuats.data(), SkinningKernels::VertexStreams::Create(m_mesh));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, BM_InitInfluences)
+        ->Arg(100000)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, BM_LinearBlendReference)
+        ->Arg(100000)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, BM_LinearBlendKernel)
+        ->Arg(100000)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, BM_DualQuaternionReference)
+        ->Arg(100000)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, BM_DualQuaternionKernel)
+        ->Arg(100000)
+        ->Unit(::benchmark::kMillisecond);
+} // namespace EMotionFX
+
+#endif
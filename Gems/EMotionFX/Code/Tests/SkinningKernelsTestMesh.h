@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SkinningKernels.h>
+#include <EMotionFX/Source/VertexAttributeLayerAbstractData.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <MCore/Source/DualQuaternion.h>
+#include <Tests/TestAssetCode/MeshFactory.h>
+
+namespace EMotionFX
+{
+    // A randomly skinned mesh, along with the scalar skinning that the skinning kernels replaced to compare against.
+    // Shared by the skinning kernel tests and benchmarks.
+    class SkinningKernelsTestMesh
+    {
+    public:
+        // The vertex data of a mesh, which is used to reset the mesh and to calculate the expected results.
+        struct VertexData
+        {
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Vector3> m_normals;
+            AZStd::vector<AZ::Vector4> m_tangents;
+            AZStd::vector<AZ::Vector3> m_bitangents;
+        };
+
+        void DestroyMesh()
+        {
+            if (m_mesh)
+            {
+                m_mesh->Destroy();
+                m_mesh = nullptr;
+            }
+        }
+
+        // Create a mesh with tangents and bitangents, where the vertices use between minInfluences and maxInfluences influences.
+        void CreateMesh(uint32 numVertices, size_t numBones, size_t minInfluences, size_t maxInfluences)
+        {
+            AZStd::vector<AZ::u32> indices(numVertices);
+            AZStd::vector<AZ::Vector3> positions(numVertices);
+            AZStd::vector<AZ::Vector3> normals(numVertices);
+            for (uint32 v = 0; v < numVertices; ++v)
+            {
+                indices[v] = v;
+                positions[v] = CreateRandomVector() * 10.0f;
+                normals[v] = CreateRandomVector().GetNormalizedSafe();
+            }
+            m_mesh = MeshFactory::Create(indices, positions, normals);
+
+            auto* tangentsLayer = VertexAttributeLayerAbstractData::Create(numVertices, Mesh::ATTRIB_TANGENTS, sizeof(AZ::Vector4), true);
+            m_mesh->AddVertexAttributeLayer(tangentsLayer);
+            auto* bitangentsLayer = VertexAttributeLayerAbstractData::Create(numVertices, Mesh::ATTRIB_BITANGENTS, sizeof(AZ::Vector3), true);
+            m_mesh->AddVertexAttributeLayer(bitangentsLayer);
+            AZ::Vector4* tangents = static_cast<AZ::Vector4*>(tangentsLayer->GetData());
+            AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(bitangentsLayer->GetData());
+            for (uint32 v = 0; v < numVertices; ++v)
+            {
+                tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(CreateRandomVector().GetNormalizedSafe(), (v % 2) ? 1.0f : -1.0f);
+                bitangents[v] = CreateRandomVector().GetNormalizedSafe();
+            }
+
+            // The bone numbers are set to the bone indices directly, like the skinning deformers do when reinitializing.
+            auto* skinningLayer = SkinningInfoVertexAttributeLayer::Create(numVertices);
+            for (uint32 v = 0; v < numVertices; ++v)
+            {
+                const size_t numInfluences = minInfluences + (v % (maxInfluences - minInfluences + 1));
+                float totalWeight = 0.0f;
+                AZStd::vector<float> weights(numInfluences);
+                for (float& weight : weights)
+                {
+                    weight = m_random.GetRandomFloat() + 0.1f;
+                    totalWeight += weight;
+                }
+
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const size_t boneIndex = m_random.GetRandom() % numBones;
+                    skinningLayer->AddInfluence(v, boneIndex, weights[i] / totalWeight, boneIndex);
+                }
+            }
+            m_mesh->AddSharedVertexAttributeLayer(skinningLayer);
+        }
+
+        AZ::Vector3 CreateRandomVector()
+        {
+            return AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat()) * 2.0f - AZ::Vector3::CreateOne();
+        }
+
+        AZ::Quaternion CreateRandomRotation()
+        {
+            const AZ::Vector3 axis = AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat() + 0.1f).GetNormalized();
+            return AZ::Quaternion::CreateFromAxisAngle(axis, (m_random.GetRandomFloat() * 2.0f - 1.0f) * AZ::Constants::Pi);
+        }
+
+        AZStd::vector<AZ::Matrix3x4> CreateRandomBoneMatrices(size_t numBones)
+        {
+            AZStd::vector<AZ::Matrix3x4> boneMatrices(numBones);
+            for (AZ::Matrix3x4& boneMatrix : boneMatrices)
+            {
+                boneMatrix = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(CreateRandomRotation(), CreateRandomVector() * 5.0f);
+            }
+            return boneMatrices;
+        }
+
+        AZStd::vector<MCore::DualQuaternion> CreateRandomBoneDualQuats(size_t numBones)
+        {
+            AZStd::vector<MCore::DualQuaternion> boneDualQuats(numBones);
+            for (size_t i = 0; i < numBones; ++i)
+            {
+                boneDualQuats[i] = MCore::DualQuaternion::ConvertFromRotationTranslation(CreateRandomRotation(), CreateRandomVector() * 5.0f);
+
+                // Negating a dual quaternion results in the same transformation, but puts it on the other hemisphere.
+                if (i % 2)
+                {
+                    boneDualQuats[i] *= -1.0f;
+                }
+            }
+            return boneDualQuats;
+        }
+
+        VertexData GetVertexData() const
+        {
+            const uint32 numVertices = m_mesh->GetNumVertices();
+            const SkinningKernels::VertexStreams streams = SkinningKernels::VertexStreams::Create(m_mesh);
+            VertexData vertexData;
+            vertexData.m_positions.assign(streams.m_positions, streams.m_positions + numVertices);
+            vertexData.m_normals.assign(streams.m_normals, streams.m_normals + numVertices);
+            vertexData.m_tangents.assign(streams.m_tangents, streams.m_tangents + numVertices);
+            vertexData.m_bitangents.assign(streams.m_bitangents, streams.m_bitangents + numVertices);
+            return vertexData;
+        }
+
+        void SetVertexData(const VertexData& vertexData)
+        {
+            const SkinningKernels::VertexStreams streams = SkinningKernels::VertexStreams::Create(m_mesh);
+            AZStd::copy(vertexData.m_positions.begin(), vertexData.m_positions.end(), streams.m_positions);
+            AZStd::copy(vertexData.m_normals.begin(), vertexData.m_normals.end(), streams.m_normals);
+            AZStd::copy(vertexData.m_tangents.begin(), vertexData.m_tangents.end(), streams.m_tangents);
+            AZStd::copy(vertexData.m_bitangents.begin(), vertexData.m_bitangents.end(), streams.m_bitangents);
+        }
+
+        // Linear blend skinning one influence at a time, like the soft skin deformer did before using the skinning kernels.
+        VertexData SkinLinearBlendReference(const VertexData& input, const AZStd::vector<AZ::Matrix3x4>& boneMatrices) const
+        {
+            SkinningInfoVertexAttributeLayer* layer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+
+            VertexData output = input;
+            for (size_t v = 0; v < input.m_positions.size(); ++v)
+            {
+                AZ::Vector3 position = AZ::Vector3::CreateZero();
+                AZ::Vector3 normal = AZ::Vector3::CreateZero();
+                AZ::Vector4 tangent = AZ::Vector4::CreateZero();
+                AZ::Vector3 bitangent = AZ::Vector3::CreateZero();
+
+                const size_t numInfluences = layer->GetNumInfluences(v);
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const SkinInfluence* influence = layer->GetInfluence(v, i);
+                    MCore::Skin(boneMatrices[influence->GetBoneNr()], &input.m_positions[v], &input.m_normals[v], &input.m_tangents[v], &input.m_bitangents[v],
+                        &position, &normal, &tangent, &bitangent, influence->GetWeight());
+                }
+                tangent.SetW(input.m_tangents[v].GetW());
+
+                output.m_positions[v] = position;
+                output.m_normals[v] = normal;
+                output.m_tangents[v] = tangent;
+                output.m_bitangents[v] = bitangent;
+            }
+            return output;
+        }
+
+        // Dual quaternion skinning with the scalar math, like the dual quaternion skin deformer did before using the skinning kernels.
+        VertexData SkinDualQuatReference(const VertexData& input, const AZStd::vector<MCore::DualQuaternion>& boneDualQuats) const
+        {
+            SkinningInfoVertexAttributeLayer* layer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+
+            VertexData output = input;
+            for (size_t v = 0; v < input.m_positions.size(); ++v)
+            {
+                const size_t numInfluences = layer->GetNumInfluences(v);
+                if (numInfluences == 0)
+                {
+                    continue;
+                }
+
+                const MCore::DualQuaternion& pivotQuat = boneDualQuats[layer->GetInfluence(v, 0)->GetBoneNr()];
+                MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const SkinInfluence* influence = layer->GetInfluence(v, i);
+                    MCore::DualQuaternion influenceQuat = boneDualQuats[influence->GetBoneNr()];
+                    if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
+                    {
+                        influenceQuat *= -1.0f;
+                    }
+                    skinQuat += influenceQuat * influence->GetWeight();
+                }
+                skinQuat.Normalize();
+
+                output.m_positions[v] = skinQuat.TransformPoint(input.m_positions[v]);
+                output.m_normals[v] = skinQuat.TransformVector(input.m_normals[v]);
+                output.m_tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(skinQuat.TransformVector(input.m_tangents[v].GetAsVector3()), input.m_tangents[v].GetW());
+                output.m_bitangents[v] = skinQuat.TransformVector(input.m_bitangents[v]);
+            }
+            return output;
+        }
+
+        Mesh* m_mesh = nullptr;
+        AZ::SimpleLcgRandom m_random;
+    };
+} // namespace EMotionFX
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Tests/Matchers.h>
+#include <Tests/SkinningKernelsTestMesh.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class SkinningKernelsFixture
+        : public SystemComponentFixture
+        , public SkinningKernelsTestMesh
+    {
+    public:
+        void TearDown() override
+        {
+            DestroyMesh();
+            SystemComponentFixture::TearDown();
+        }
+
+    protected:
+        void ExpectVertexData(const VertexData& expected) const
+        {
+            const VertexData actual = GetVertexData();
+            for (size_t v = 0; v < expected.m_positions.size(); ++v)
+            {
+                EXPECT_THAT(actual.m_positions[v], IsClose(expected.m_positions[v]));
+                EXPECT_THAT(actual.m_normals[v], IsClose(expected.m_normals[v]));
+                EXPECT_THAT(actual.m_tangents[v], IsClose(expected.m_tangents[v]));
+                EXPECT_THAT(actual.m_bitangents[v], IsClose(expected.m_bitangents[v]));
+            }
+        }
+    };
+
+    TEST_F(SkinningKernelsFixture, InfluencesSortedByCount)
+    {
+        CreateMesh(/*numVertices=*/100, /*numBones=*/10, /*minInfluences=*/0, /*maxInfluences=*/6);
+
+        SkinningInfluences influences;
+        influences.Init(m_mesh);
+        ASSERT_EQ(influences.GetNumVertices(), 100);
+        ASSERT_EQ(influences.GetGroups().size(), 7);
+
+        // Every vertex is part of the group with its number of influences, and the groups cover all vertices in order.
+        SkinningInfoVertexAttributeLayer* layer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        size_t nextVertex = 0;
+        for (const SkinningInfluences::Group& group : influences.GetGroups())
+        {
+            EXPECT_EQ(group.m_firstVertex, nextVertex);
+            nextVertex += group.m_numVertices;
+
+            for (size_t i = 0; i < group.m_numVertices; ++i)
+            {
+                const uint32 vertex = influences.GetVertices()[group.m_firstVertex + i];
+                ASSERT_EQ(layer->GetNumInfluences(vertex), group.m_numInfluences);
+                for (size_t j = 0; j < group.m_numInfluences; ++j)
+                {
+                    const size_t influenceIndex = group.m_firstInfluence + i * group.m_numInfluences + j;
+                    EXPECT_EQ(influences.GetBoneIndices()[influenceIndex], layer->GetInfluence(vertex, j)->GetBoneNr());
+                    EXPECT_FLOAT_EQ(influences.GetWeights()[influenceIndex], layer->GetInfluence(vertex, j)->GetWeight());
+                }
+            }
+        }
+        EXPECT_EQ(nextVertex, influences.GetNumVertices());
+
+        influences.Clear();
+        EXPECT_EQ(influences.GetNumVertices(), 0);
+        EXPECT_TRUE(influences.GetGroups().empty());
+    }
+
+    TEST_F(SkinningKernelsFixture, LinearBlend)
+    {
+        constexpr size_t numBones = 20;
+        CreateMesh(/*numVertices=*/999, numBones, /*minInfluences=*/0, /*maxInfluences=*/6);
+        const AZStd::vector<AZ::Matrix3x4> boneMatrices = CreateRandomBoneMatrices(numBones);
+        const VertexData input = GetVertexData();
+
+        SkinningInfluences influences;
+        influences.Init(m_mesh);
+
+        // Skin in batches that don't line up with the groups.
+        const SkinningKernels::VertexStreams streams = SkinningKernels::VertexStreams::Create(m_mesh);
+        for (size_t startIndex = 0; startIndex < influences.GetNumVertices(); startIndex += 100)
+        {
+            const size_t endIndex = AZStd::min(startIndex + 100, influences.GetNumVertices());
+            SkinningKernels::LinearBlend(influences, startIndex, endIndex, boneMatrices.data(), streams);
+        }
+
+        ExpectVertexData(SkinLinearBlendReference(input, boneMatrices));
+    }
+
+    TEST_F(SkinningKernelsFixture, DualQuaternion)
+    {
+        constexpr size_t numBones = 20;
+        CreateMesh(/*numVertices=*/999, numBones, /*minInfluences=*/0, /*maxInfluences=*/6);
+        const AZStd::vector<MCore::DualQuaternion> boneDualQuats = CreateRandomBoneDualQuats(numBones);
+        const VertexData input = GetVertexData();
+
+        SkinningInfluences influences;
+        influences.Init(m_mesh);
+
+        // Skin in batches that don't line up with the groups.
+        const SkinningKernels::VertexStreams streams = SkinningKernels::VertexStreams::Create(m_mesh);
+        for (size_t startIndex = 0; startIndex < influences.GetNumVertices(); startIndex += 100)
+        {
+            const size_t endIndex = AZStd::min(startIndex + 100, influences.GetNumVertices());
+            SkinningKernels::DualQuaternion(influences, startIndex, endIndex, boneDualQuats.data(), streams);
+        }
+
+        ExpectVertexData(SkinDualQuatReference(input, boneDualQuats));
+    }
+
+    TEST_F(SkinningKernelsFixture, WithoutTangents)
+    {
+        constexpr size_t numBones = 8;
+        CreateMesh(/*numVertices=*/99, numBones, /*minInfluences=*/1, /*maxInfluences=*/4);
+        const AZStd::vector<AZ::Matrix3x4> boneMatrices = CreateRandomBoneMatrices(numBones);
+        const VertexData input = GetVertexData();
+        const VertexData expected = SkinLinearBlendReference(input, boneMatrices);
+
+        SkinningInfluences influences;
+        influences.Init(m_mesh);
+
+        // The tangents and bitangents are optional and stay untouched when not passed to the kernel.
+        SkinningKernels::VertexStreams streams = SkinningKernels::VertexStreams::Create(m_mesh);
+        streams.m_tangents = nullptr;
+        streams.m_bitangents = nullptr;
+        SkinningKernels::LinearBlend(influences, 0, influences.GetNumVertices(), boneMatrices.data(), streams);
+
+        const VertexData actual = GetVertexData();
+        for (size_t v = 0; v < input.m_positions.size(); ++v)
+        {
+            EXPECT_THAT(actual.m_positions[v], IsClose(expected.m_positions[v]));
+            EXPECT_THAT(actual.m_normals[v], IsClose(expected.m_normals[v]));
+            EXPECT_EQ(actual.m_tangents[v], input.m_tangents[v]);
+            EXPECT_EQ(actual.m_bitangents[v], input.m_bitangents[v]);
+        }
+    }
+} // namespace EMotionFX
@@ -221,6 +221,70 @@ namespace EMotionFX
         EMotionFX::Integration::SystemComponent
     >;
 
+#ifdef HAVE_BENCHMARK
+    //! The benchmark counterpart of the ComponentFixture
+    /*!
+     * Starts the application with the given system components for every benchmark run, and stops it again afterwards.
+    */
+    template<class... Components>
+    class ComponentBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void internalSetUp()
+        {
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadAssetCatalog = false;
+            startupParameters.m_loadSettingsRegistry = false;
+
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                AZ::Test::AddActiveGem("EMotionFX", *settingsRegistry);
+            }
+
+            m_app.reset(aznew ComponentFixtureApp<Components...>());
+            m_app->Start(AZ::ComponentApplication::Descriptor{}, startupParameters);
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+        }
+
+        void internalTearDown()
+        {
+            EMotionFX::Integration::ActorNotificationBus::ClearQueuedEvents();
+            m_app->Stop();
+            m_app.reset();
+        }
+
+    protected:
+        void SetUp([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+        void SetUp([[maybe_unused]] benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        AZStd::unique_ptr<ComponentFixtureApp<Components...>> m_app;
+    };
+
+    using SystemComponentBenchmarkFixture = ComponentBenchmarkFixture<
+        AZ::AssetManagerComponent,
+        AZ::JobManagerComponent,
+        AZ::StreamerComponent,
+        Physics::MaterialSystemComponent,
+        EMotionFX::Integration::SystemComponent
+    >;
+#endif
+
     // Use this fixture if you want to load asset catalog. Some assets (reference anim graph for example)
     // can only be loaded when asset catalog is loaded.
     using SystemComponentFixtureWithCatalog = ComponentFixture<
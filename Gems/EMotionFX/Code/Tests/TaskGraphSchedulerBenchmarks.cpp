@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Task/TaskGraphSystemComponent.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/MotionSystem.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class TaskGraphSchedulerBenchmarkFixture
+        : public ComponentBenchmarkFixture<
+            AZ::AssetManagerComponent,
+            AZ::JobManagerComponent,
+            AZ::StreamerComponent,
+            AZ::TaskGraphSystemComponent,
+            Physics::MaterialSystemComponent,
+            Integration::SystemComponent>
+    {
+    public:
+        // Updates a crowd of actor instances that each play a looping motion, with the given scheduler.
+        void RunCrowdUpdateBenchmark(benchmark::State& state, ActorUpdateScheduler* scheduler)
+        {
+            // The scheduler has to be set before creating any actor instances, as these get inserted into the schedule on creation.
+            GetEMotionFX().GetActorManager()->SetScheduler(scheduler);
+
+            auto actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(50);
+            Motion* motion = aznew Motion("CrowdMotion");
+            motion->SetMotionData(aznew UniformMotionData());
+            motion->GetMotionData()->SetDuration(10.0f);
+
+            PlayBackInfo playBackInfo;
+            playBackInfo.m_numLoops = EMFX_LOOPFOREVER;
+            playBackInfo.m_playNow = true;
+
+            const size_t numActorInstances = aznumeric_cast<size_t>(state.range(0));
+            AZStd::vector<ActorInstance*> crowd;
+            crowd.reserve(numActorInstances);
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+                actorInstance->GetMotionSystem()->PlayMotion(motion, &playBackInfo);
+                crowd.emplace_back(actorInstance);
+            }
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                GetEMotionFX().Update(1.0f / 60.0f);
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+
+            for (ActorInstance* actorInstance : crowd)
+            {
+                actorInstance->Destroy();
+            }
+            motion->Destroy();
+        }
+    };
+
+    BENCHMARK_DEFINE_F(TaskGraphSchedulerBenchmarkFixture, BM_CrowdUpdateMultiThreadScheduler)(benchmark::State& state)
+    {
+        RunCrowdUpdateBenchmark(state, MultiThreadScheduler::Create());
+    }
+
+    BENCHMARK_DEFINE_F(TaskGraphSchedulerBenchmarkFixture, BM_CrowdUpdateTaskGraphScheduler)(benchmark::State& state)
+    {
+        RunCrowdUpdateBenchmark(state, TaskGraphScheduler::Create());
+    }
+
+    BENCHMARK_REGISTER_F(TaskGraphSchedulerBenchmarkFixture, BM_CrowdUpdateMultiThreadScheduler)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(TaskGraphSchedulerBenchmarkFixture, BM_CrowdUpdateTaskGraphScheduler)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Unit(::benchmark::kMillisecond);
+} // namespace EMotionFX
+
+#endif
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraphSystemComponent.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    // EMotion FX sizes its thread data for the task graph workers when it gets initialized, so the task graph system has to be there first.
+    using TaskGraphSystemComponentFixture = ComponentFixture<
+        AZ::AssetManagerComponent,
+        AZ::JobManagerComponent,
+        AZ::StreamerComponent,
+        AZ::TaskGraphSystemComponent,
+        Physics::MaterialSystemComponent,
+        Integration::SystemComponent
+    >;
+
+    class TaskGraphSchedulerFixture
+        : public TaskGraphSystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            TaskGraphSystemComponentFixture::SetUp();
+
+            // The scheduler has to be set before creating any actor instances, as these get inserted into the schedule on creation.
+            m_scheduler = TaskGraphScheduler::Create();
+            GetEMotionFX().GetActorManager()->SetScheduler(m_scheduler);
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(5);
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+
+            TaskGraphSystemComponentFixture::TearDown();
+        }
+
+    protected:
+        TaskGraphScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<SimpleJointChainActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(TaskGraphSchedulerFixture, UpdatesAllEnabledActorInstances)
+    {
+        constexpr size_t numActorInstances = 64;
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            m_actorInstances.emplace_back(ActorInstance::Create(m_actor.get()));
+        }
+        EXPECT_EQ(m_scheduler->GetNumActorInstances(), numActorInstances);
+        EXPECT_TRUE(m_scheduler->GetIsTaskGraphDirty());
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), numActorInstances);
+        EXPECT_FALSE(m_scheduler->GetIsTaskGraphDirty()) << "The task graph should have been built by the update.";
+
+        // Every actor instance has been updated on one of the task workers.
+        const AZ::u32 numWorkers = AZ::TaskExecutor::Instance().GetThreadCount();
+        EXPECT_GE(GetEMotionFX().GetNumThreads(), numWorkers);
+        for (const ActorInstance* actorInstance : m_actorInstances)
+        {
+            EXPECT_LT(actorInstance->GetThreadIndex(), numWorkers);
+        }
+
+        // Disabled actor instances stay in the schedule, but aren't updated, and the task graph doesn't have to be rebuilt.
+        m_actorInstances[0]->SetIsEnabled(false);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), numActorInstances - 1);
+        EXPECT_FALSE(m_scheduler->GetIsTaskGraphDirty());
+
+        // Removing an actor instance rebuilds the task graph.
+        m_actorInstances.back()->Destroy();
+        m_actorInstances.pop_back();
+        EXPECT_EQ(m_scheduler->GetNumActorInstances(), numActorInstances - 1);
+        EXPECT_TRUE(m_scheduler->GetIsTaskGraphDirty());
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), numActorInstances - 2);
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, AttachmentsFollowTheirParent)
+    {
+        ActorInstance* parent = ActorInstance::Create(m_actor.get());
+        ActorInstance* attachment = ActorInstance::Create(m_actor.get());
+        m_actorInstances = { parent, attachment };
+
+        parent->AddAttachment(AttachmentNode::Create(parent, 4, attachment));
+        ASSERT_EQ(m_scheduler->GetNumActorInstances(), 2);
+        EXPECT_EQ(m_scheduler->GetActorInstance(0), parent);
+        EXPECT_EQ(m_scheduler->GetActorInstance(1), attachment);
+
+        // The attachment is placed at the last joint of the parent's chain, which only works when the parent got updated first.
+        parent->SetLocalSpacePosition(AZ::Vector3(10.0f, 0.0f, 0.0f));
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 2);
+
+        const AZ::Vector3 jointPosition = parent->GetTransformData()->GetCurrentPose()->GetWorldSpaceTransform(4).m_position;
+        EXPECT_TRUE(attachment->GetWorldSpaceTransform().m_position.IsClose(jointPosition));
+
+        // Removing the attachment from the parent keeps both actor instances in the schedule.
+        parent->RemoveAttachment(attachment);
+        EXPECT_EQ(m_scheduler->GetNumActorInstances(), 2);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 2);
+    }
+} // namespace EMotionFX
@@ -51,6 +51,25 @@ namespace EMotionFX
         }
     }
 
+    QuadTreeActor::QuadTreeActor(size_t jointCount, const char* name)
+        : Actor(name)
+    {
+        if (jointCount)
+        {
+            AddNode(0, "rootJoint");
+            GetBindPose()->SetLocalSpaceTransform(0, Transform::CreateIdentity());
+        }
+
+        for (uint32 i = 1; i < jointCount; ++i)
+        {
+            AddNode(i, ("joint" + AZStd::to_string(i)).c_str(), (i - 1) / 4);
+
+            Transform transform = Transform::CreateIdentity();
+            transform.m_position = AZ::Vector3(static_cast<float>(i), 0.0f, 0.0f);
+            GetBindPose()->SetLocalSpaceTransform(i, transform);
+        }
+    }
+
     PlaneActor::PlaneActor(const char* name)
         : SimpleJointChainActor(1, name)
     {
@@ -30,6 +30,14 @@ namespace EMotionFX
         explicit AllRootJointsActor(size_t jointCount, const char* name = "Test actor");
     };
 
+    // An actor where every joint has four children, so that it contains both joints that depend on each other and independent joints.
+    class QuadTreeActor
+        : public Actor
+    {
+    public:
+        explicit QuadTreeActor(size_t jointCount, const char* name = "Test actor");
+    };
+
     class PlaneActor
         : public SimpleJointChainActor
     {
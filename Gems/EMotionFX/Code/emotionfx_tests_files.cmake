@@ -78,6 +78,8 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataBenchmarks.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -97,6 +99,8 @@ set(FILES
     Tests/MotionInstanceTests.cpp
     Tests/MotionLayerSystemTests.cpp
     Tests/MultiThreadSchedulerTests.cpp
+    Tests/PoseKernelsBenchmarks.cpp
+    Tests/PoseKernelsTests.cpp
     Tests/PoseTests.cpp
     Tests/Printers.cpp
     Tests/QuaternionParameterTests.cpp
@@ -109,9 +113,14 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SkinningKernelsBenchmarks.cpp
+    Tests/SkinningKernelsTestMesh.h
+    Tests/SkinningKernelsTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
+    Tests/TaskGraphSchedulerBenchmarks.cpp
+    Tests/TaskGraphSchedulerTests.cpp
     Tests/TransformUnitTests.cpp
     Tests/Vector2ToVector3CompatibilityTests.cpp
     Tests/Vector3ParameterTests.cpp
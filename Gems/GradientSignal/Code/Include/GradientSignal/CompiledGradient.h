@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <GradientSignal/GradientProgram.h>
+#include <GradientSignal/GradientSampler.h>
+#include <LmbrCentral/Dependency/DependencyNotificationBus.h>
+
+namespace GradientSignal
+{
+    //! Evaluates a GradientSampler through a compiled GradientProgram.
+    //! The program is compiled on first use and recompiled lazily whenever anything in the sampled gradient hierarchy
+    //! reports a change through the DependencyNotificationBus. If the hierarchy can't be compiled, queries fall back to the sampler.
+    //! Queries are safe to run from multiple threads at once.
+    class CompiledGradient final : private LmbrCentral::DependencyNotificationBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompiledGradient, AZ::SystemAllocator);
+
+        CompiledGradient() = default;
+        explicit CompiledGradient(const GradientSampler& sampler);
+        ~CompiledGradient() override;
+
+        CompiledGradient(const CompiledGradient&) = delete;
+        CompiledGradient& operator=(const CompiledGradient&) = delete;
+
+        //! Changes the sampler being compiled. This must not be called while queries are running on other threads.
+        void SetGradientSampler(const GradientSampler& sampler);
+        const GradientSampler& GetGradientSampler() const;
+
+        //! Forces the program to be recompiled on the next query.
+        void Invalidate();
+
+        float GetValue(const GradientSampleParams& sampleParams) const;
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        //! Returns the current program, compiling it first if it is out of date.
+        AZStd::shared_ptr<const GradientProgram> GetProgram() const;
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        // DependencyNotificationBus
+        void OnCompositionChanged() override;
+
+        GradientSampler m_sampler;
+        mutable AZStd::mutex m_programMutex;
+        mutable AZStd::shared_ptr<const GradientProgram> m_program;
+        mutable AZStd::atomic_bool m_dirty{ true };
+    };
+} // namespace GradientSignal
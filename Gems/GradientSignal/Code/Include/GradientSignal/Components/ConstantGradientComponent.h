@@ -64,6 +64,7 @@ namespace GradientSignal
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
+        bool CompileGradient(GradientProgramBuilder& builder, GradientProgramRegister positions, GradientProgramRegister output) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
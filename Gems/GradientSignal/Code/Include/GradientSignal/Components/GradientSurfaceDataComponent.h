@@ -9,7 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/CompiledGradient.h>
 #include <GradientSignal/Ebuses/GradientSurfaceDataRequestBus.h>
 #include <SurfaceData/SurfaceDataModifierRequestBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -105,7 +105,8 @@ namespace GradientSignal
 
         SurfaceData::SurfaceDataRegistryHandle m_modifierHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
         GradientSurfaceDataConfig m_configuration;
-        GradientSampler m_gradientSampler;
+        // Surface points are modified in bulk, so the gradient is sampled through its compiled program.
+        CompiledGradient m_compiledGradient;
 
         // cached shape constraint data that allows us to safely perform bounds tests from the vegetation
         // thread while the main thread potentially updates the bounds.
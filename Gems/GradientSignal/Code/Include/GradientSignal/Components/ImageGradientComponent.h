@@ -11,6 +11,7 @@
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
@@ -192,8 +193,19 @@ namespace GradientSignal
         void UpdateCachedImageBufferData(const AZ::RHI::ImageDescriptor& imageDescriptor, AZStd::span<const uint8_t> imageData);
 
         void GetSubImageData();
+        //! The pixel samples needed to filter a batch of 4 points. Each sample is stored for all 4 points together so that
+        //! the filtering math can run on the whole batch at once with SIMD math.
+        struct SampleBatch
+        {
+            static constexpr size_t BatchSize = 4;
+
+            alignas(16) float m_samples[16][BatchSize];
+            alignas(16) float m_deltaX[BatchSize];
+            alignas(16) float m_deltaY[BatchSize];
+        };
+
         void GetValuesInternal(SamplingType samplingType, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
-        float GetValueFromImageData(SamplingType samplingType, const AZ::Vector3& uvw, float defaultValue) const;
+        void GetPixelLookup(const AZ::Vector3& uvw, AZ::u32& x, AZ::u32& y, float& pixelX, float& pixelY) const;
 
         //! Read the pixel from our image data at the given XY coordinates.
         //! This will read from image modification buffer if it exists or else from the image asset, using the component's
@@ -221,7 +233,8 @@ namespace GradientSignal
         void SetupManualScaleMultiplierAndOffset();
         void Get4x4Neighborhood(uint32_t x, uint32_t y, AZStd::array<AZStd::array<float, 4>, 4>& values) const;
         float GetClampedValue(int32_t x, int32_t y) const;
-        float GetValueForSamplingType(SamplingType samplingType, AZ::u32 x0, AZ::u32 y0, float pixelX, float pixelY) const;
+        void GetSamplesForSamplingType(SamplingType samplingType, AZ::u32 x0, AZ::u32 y0, size_t lane, SampleBatch& batch) const;
+        static AZ::Simd::Vec4::FloatType FilterSamples(SamplingType samplingType, const SampleBatch& batch);
 
         float GetTilingX() const override;
         void SetTilingX(float tilingX) override;
@@ -101,6 +101,7 @@ namespace GradientSignal
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
+        bool CompileGradient(GradientProgramBuilder& builder, GradientProgramRegister positions, GradientProgramRegister output) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
     protected:
@@ -111,7 +112,8 @@ namespace GradientSignal
         void RemoveLayer(int layerIndex) override;
         MixedGradientLayer* GetLayer(int layerIndex) override;
 
-    private:
+    public:
+        //! Combines a layer value with the accumulated value of the previous layers.
         static float PerformMixingOperation(MixedGradientLayer::MixingOperation operation, float prevValue, float currentUnpremultiplied)
         {
             switch (operation)
@@ -142,6 +144,7 @@ namespace GradientSignal
             }
         }
 
+    private:
         MixedGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
         mutable AZStd::shared_mutex m_queryMutex;
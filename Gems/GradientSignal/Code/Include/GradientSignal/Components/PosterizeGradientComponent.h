@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/PosterizeGradientRequestBus.h>
@@ -75,6 +76,7 @@ namespace GradientSignal
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
+        bool CompileGradient(GradientProgramBuilder& builder, GradientProgramRegister positions, GradientProgramRegister output) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
     protected:
@@ -87,8 +89,8 @@ namespace GradientSignal
 
         GradientSampler& GetGradientSampler() override;
 
-    private:
-
+    public:
+        //! Quantizes a value into one of the given number of bands.
         static float PosterizeValue(float input, float bands, PosterizeGradientConfig::ModeType mode)
         {
             const float clampedInput = AZ::GetClamp(input, 0.0f, 1.0f);
@@ -121,6 +123,51 @@ namespace GradientSignal
             return AZ::GetMin(output, 1.0f);
         }
 
+        //! Quantizes a list of values into one of the given number of bands, processing 4 values at a time with SIMD math.
+        static void PosterizeValues(AZStd::span<float> inOutValues, float bands, PosterizeGradientConfig::ModeType mode)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+
+            const size_t batchedCount = inOutValues.size() & ~size_t(3);
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType bandsSplat = Vec4::Splat(bands);
+            const Vec4::FloatType lastBand = Vec4::Splat(bands - 1.0f);
+
+            // These match the band offsets and divisors of each mode in PosterizeValue().
+            Vec4::FloatType bandOffset = zero;
+            Vec4::FloatType bandDivisor = bandsSplat;
+            switch (mode)
+            {
+            default:
+            case PosterizeGradientConfig::ModeType::Floor:
+                break;
+            case PosterizeGradientConfig::ModeType::Round:
+                bandOffset = Vec4::Splat(0.5f);
+                break;
+            case PosterizeGradientConfig::ModeType::Ceiling:
+                bandOffset = one;
+                break;
+            case PosterizeGradientConfig::ModeType::Ps:
+                bandDivisor = lastBand;
+                break;
+            }
+
+            for (size_t index = 0; index < batchedCount; index += 4)
+            {
+                const Vec4::FloatType clampedInput = Vec4::Clamp(Vec4::LoadUnaligned(&inOutValues[index]), zero, one);
+                const Vec4::FloatType band = Vec4::Min(Vec4::Floor(Vec4::Mul(clampedInput, bandsSplat)), lastBand);
+                const Vec4::FloatType output = Vec4::Div(Vec4::Add(band, bandOffset), bandDivisor);
+                Vec4::StoreUnaligned(&inOutValues[index], Vec4::Min(output, one));
+            }
+
+            for (size_t index = batchedCount; index < inOutValues.size(); ++index)
+            {
+                inOutValues[index] = PosterizeValue(inOutValues[index], bands, mode);
+            }
+        }
+
+    private:
         PosterizeGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
         mutable AZStd::shared_mutex m_queryMutex;
@@ -19,6 +19,7 @@
 #include <SurfaceData/SurfaceDataSystemNotificationBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfacePointList.h>
+#include <SurfaceData/Utility/ObjectPool.h>
 
 namespace LmbrCentral
 {
@@ -120,6 +121,8 @@ namespace GradientSignal
 
     private:
         mutable AZStd::shared_mutex m_queryMutex;
+        //! Surface point lists reserved for reuse across queries, since queries can run on multiple threads at once.
+        mutable SurfaceData::ObjectPool<SurfaceData::SurfacePointList> m_surfacePointListPool;
         SurfaceAltitudeGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
         AZStd::atomic_bool m_dirty{ false };
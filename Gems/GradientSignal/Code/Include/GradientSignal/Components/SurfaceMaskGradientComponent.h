@@ -18,6 +18,7 @@
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfacePointList.h>
+#include <SurfaceData/Utility/ObjectPool.h>
 
 namespace LmbrCentral
 {
@@ -96,5 +97,7 @@ namespace GradientSignal
         SurfaceMaskGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
         mutable AZStd::shared_mutex m_queryMutex;
+        //! Surface point lists reserved for reuse across queries, since queries can run on multiple threads at once.
+        mutable SurfaceData::ObjectPool<SurfaceData::SurfacePointList> m_surfacePointListPool;
     };
 }
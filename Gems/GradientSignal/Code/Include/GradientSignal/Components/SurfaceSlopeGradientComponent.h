@@ -15,6 +15,7 @@
 #include <GradientSignal/Ebuses/SurfaceSlopeGradientRequestBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfacePointList.h>
+#include <SurfaceData/Utility/ObjectPool.h>
 #include <GradientSignal/SmoothStep.h>
 #include <GradientSignal/Util.h>
 
@@ -127,5 +128,7 @@ namespace GradientSignal
     private:
         SurfaceSlopeGradientConfig m_configuration;
         mutable AZStd::shared_mutex m_queryMutex;
+        //! Surface point lists reserved for reuse across queries, since queries can run on multiple threads at once.
+        mutable SurfaceData::ObjectPool<SurfaceData::SurfacePointList> m_surfacePointListPool;
     };
 }
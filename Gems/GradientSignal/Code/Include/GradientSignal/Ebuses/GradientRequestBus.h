@@ -15,6 +15,11 @@
 
 namespace GradientSignal
 {
+    class GradientProgramBuilder;
+
+    //! Index of a register in a compiled gradient program, see GradientProgramBuilder.
+    using GradientProgramRegister = AZ::u16;
+
     struct GradientSampleParams final
     {
         AZ_CLASS_ALLOCATOR(GradientSampleParams, AZ::SystemAllocator);
@@ -75,6 +80,22 @@ namespace GradientSignal
             }
         }
 
+        /**
+         * Appends the instructions that produce this gradient's values to a compiled gradient program.
+         * Gradients that don't implement this are evaluated by the program through GetValues() instead.
+         * \param builder The builder of the program being compiled.
+         * \param positions The register holding the positions to evaluate.
+         * \param output The register to write the values to.
+         * \return true if the gradient was compiled, false if the program should call GetValues() instead.
+         */
+        virtual bool CompileGradient(
+            [[maybe_unused]] GradientProgramBuilder& builder,
+            [[maybe_unused]] GradientProgramRegister positions,
+            [[maybe_unused]] GradientProgramRegister output) const
+        {
+            return false;
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
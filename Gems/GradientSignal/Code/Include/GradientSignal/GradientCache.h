@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/GridTileCache.h>
+#include <LmbrCentral/Dependency/DependencyNotificationBus.h>
+
+namespace GradientSignal
+{
+    //! Caches the values of a GradientSampler in tiles of grid-aligned points so that repeated queries of unchanged regions
+    //! become simple copies.
+    //! Each tile covers TileSize x TileSize points on a grid with a given sample spacing, at a single height. Tiles for different
+    //! sample spacings are cached side by side, so callers querying the same gradient at several resolutions share one cache.
+    //! Query positions that don't line up with the requested grid are passed straight through to the sampler.
+    //! Tiles are evicted in least-recently-used order once the cache is full, and are invalidated through the
+    //! DependencyNotificationBus whenever anything in the sampled gradient hierarchy reports a change.
+    //! Queries are safe to run from multiple threads at once.
+    class GradientCache final : private LmbrCentral::DependencyNotificationBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientCache, AZ::SystemAllocator);
+
+        //! The number of points along each side of a cache tile.
+        static constexpr AZ::s32 TileSize = GridTileCache<float>::TileSize;
+
+        //! The default maximum number of tiles to keep in the cache (4 MB of values).
+        static constexpr size_t DefaultMaxTiles = 1024;
+
+        //! How far a query position can be from a grid point, as a fraction of the sample spacing, and still use that grid point's
+        //! cached value. This allows for the rounding error in positions that callers compute as start + index * spacing.
+        static constexpr float GridTolerance = 0.001f;
+
+        GradientCache();
+        explicit GradientCache(const GradientSampler& sampler, size_t maxTiles = DefaultMaxTiles);
+        ~GradientCache() override;
+
+        GradientCache(const GradientCache&) = delete;
+        GradientCache& operator=(const GradientCache&) = delete;
+
+        //! Changes the sampler being cached and clears the cache. This must not be called while queries are running on other threads.
+        void SetGradientSampler(const GradientSampler& sampler);
+        const GradientSampler& GetGradientSampler() const;
+
+        //! Changes the maximum number of cached tiles, evicting the least recently used tiles if needed.
+        void SetMaxTiles(size_t maxTiles);
+        size_t GetMaxTiles() const;
+
+        //! Returns the number of tiles currently in the cache.
+        size_t GetTileCount() const;
+
+        //! Removes every tile from the cache.
+        void Invalidate();
+
+        //! Removes every tile that overlaps the given world space region from the cache. An invalid region clears the entire cache.
+        void InvalidateRegion(const AZ::Aabb& dirtyRegion);
+
+        //! Gets the gradient values for a list of positions, using cached values for every position that lies on a grid with the
+        //! given sample spacing. Missing tiles are only filled if the query has at least TileSize positions in them, so small
+        //! queries are passed straight through to the sampler unless their tiles are already cached.
+        //! @param positions The input list of positions to query.
+        //! @param outValues The output list of values. This list is expected to be the same size as the positions list.
+        //! @param sampleSpacing The distance between grid points in world space. Must be greater than 0.
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, float sampleSpacing) const;
+
+    private:
+        using TileCache = GridTileCache<float>;
+
+        //////////////////////////////////////////////////////////////////////////
+        // DependencyNotificationBus
+        void OnCompositionChanged() override;
+        void OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion) override;
+
+        GradientSampler m_sampler;
+        mutable TileCache m_tileCache;
+    };
+} // namespace GradientSignal
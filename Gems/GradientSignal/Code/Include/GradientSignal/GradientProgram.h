@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <GradientSignal/Components/MixedGradientComponent.h>
+#include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+#include <GradientSignal/SmoothStep.h>
+
+namespace GradientSignal
+{
+    class GradientSampler;
+
+    //! The operations a compiled gradient program is made of. Every operation processes one tile of points at a time.
+    enum class GradientProgramOp : AZ::u8
+    {
+        Fill,               //!< values[dst] = param0
+        SampleGradient,     //!< values[dst] = GetValues() on the gradient entity, evaluated at positions[src]
+        TransformPositions, //!< positions[dst] = matrix * positions[src]
+        OneMinus,           //!< values[dst] = 1 - values[dst]
+        Invert,             //!< values[dst] = 1 - clamp(values[dst], 0, 1)
+        Scale,              //!< values[dst] = values[dst] * param0
+        Clamp,              //!< values[dst] = clamp(values[dst], 0, 1)
+        Levels,             //!< values[dst] = levels(values[dst]) using params 0-4 as mid, min, max, output min, output max
+        Threshold,          //!< values[dst] = (values[dst] <= param0) ? 0 : 1
+        Posterize,          //!< values[dst] = posterize(values[dst]) with param0 bands
+        SmoothStep,         //!< values[dst] = smoothstep(values[dst])
+        Mix,                //!< values[dst] = mix(values[dst], values[src]) with param0 opacity
+    };
+
+    //! A single instruction of a compiled gradient program.
+    struct GradientProgramInstruction
+    {
+        GradientProgramOp m_op = GradientProgramOp::Fill;
+        AZ::u8 m_mode = 0; //!< Posterize mode or mixing operation
+        GradientProgramRegister m_dst = 0;
+        GradientProgramRegister m_src = 0;
+        AZ::u16 m_dataIndex = 0; //!< Index of the entity, matrix or smooth step used by the instruction
+        AZStd::array<float, 5> m_params = {};
+    };
+
+    //! A gradient hierarchy flattened into a linear list of instructions.
+    //! Rather than every gradient component producing a full buffer of values for its input gradients through the
+    //! GradientRequestBus, a program evaluates its entire hierarchy one small tile of points at a time, so intermediate values
+    //! stay in cache. Gradients that can't be compiled are sampled by the program through GradientRequests::GetValues().
+    class GradientProgram final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientProgram, AZ::SystemAllocator);
+
+        //! The number of points each instruction processes at a time.
+        static constexpr size_t TileSize = 256;
+
+        //! The register holding the positions passed to Execute().
+        static constexpr GradientProgramRegister InputPositions = 0;
+
+        //! Returns whether the program compiled successfully and can be executed.
+        bool IsValid() const;
+
+        //! Returns the number of instructions in the program.
+        size_t GetInstructionCount() const;
+
+        //! Evaluates the program for a list of positions.
+        //! @param positions The input list of positions to query.
+        //! @param outValues The output list of values. This list is expected to be the same size as the positions list.
+        void Execute(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+    private:
+        friend class GradientProgramBuilder;
+
+        AZStd::vector<GradientProgramInstruction> m_instructions;
+        AZStd::vector<AZ::EntityId> m_entities;
+        AZStd::vector<AZ::Matrix3x4> m_matrices;
+        AZStd::vector<SmoothStep> m_smoothSteps;
+        GradientProgramRegister m_valueRegisterCount = 0;
+        GradientProgramRegister m_positionRegisterCount = 1;
+        GradientProgramRegister m_outputRegister = 0;
+        bool m_valid = false;
+    };
+
+    //! Compiles a gradient hierarchy into a GradientProgram.
+    //! Gradient components take part in compilation by implementing GradientRequests::CompileGradient() with the Emit functions below,
+    //! reading values from and writing values to the registers they are given.
+    class GradientProgramBuilder final
+    {
+    public:
+        //! Gradient hierarchies deeper than this fail to compile and are evaluated through the GradientRequestBus instead.
+        static constexpr size_t MaxHierarchyDepth = 64;
+
+        //! Compiles the gradient referenced by the sampler, including the transform, levels, invert and opacity of the sampler itself.
+        //! @param sampler The sampler to compile.
+        //! @return The compiled program, which is invalid if the gradient hierarchy contains a cycle or is too deep.
+        static GradientProgram Compile(const GradientSampler& sampler);
+
+        //! Allocates a register for a tile of values.
+        GradientProgramRegister AllocateValues();
+
+        //! Returns a value register that is no longer needed, so later instructions can reuse it.
+        void ReleaseValues(GradientProgramRegister values);
+
+        //! Emits the instructions that sample a gradient through a GradientSampler, recursively compiling the sampled gradient.
+        void EmitSampler(const GradientSampler& sampler, GradientProgramRegister positions, GradientProgramRegister output);
+
+        void EmitFill(GradientProgramRegister values, float value);
+        void EmitOneMinus(GradientProgramRegister values);
+        void EmitInvert(GradientProgramRegister values);
+        void EmitScale(GradientProgramRegister values, float scale);
+        void EmitClamp(GradientProgramRegister values);
+        void EmitLevels(GradientProgramRegister values, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax);
+        void EmitThreshold(GradientProgramRegister values, float threshold);
+        void EmitPosterize(GradientProgramRegister values, float bands, PosterizeGradientConfig::ModeType mode);
+        void EmitSmoothStep(GradientProgramRegister values, const SmoothStep& smoothStep);
+        void EmitMix(
+            GradientProgramRegister accumulator, GradientProgramRegister layerValues, MixedGradientLayer::MixingOperation operation, float opacity);
+
+    private:
+        GradientProgramBuilder() = default;
+
+        GradientProgramRegister AllocatePositions();
+        void EmitGradient(const AZ::EntityId& gradientId, GradientProgramRegister positions, GradientProgramRegister output);
+        GradientProgramInstruction& Emit(GradientProgramOp op, GradientProgramRegister dst);
+
+        GradientProgram m_program;
+        AZStd::vector<AZ::EntityId> m_gradientStack;
+        AZStd::vector<GradientProgramRegister> m_freeValueRegisters;
+        bool m_failed = false;
+    };
+} // namespace GradientSignal
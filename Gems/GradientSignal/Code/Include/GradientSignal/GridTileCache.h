@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace GradientSignal
+{
+    //! Caches samples for square tiles of points on a world space XY grid, with a limit on the number of tiles.
+    //! The cache only stores and looks up tiles. Its owner fills the missing tiles that lookups report, either right away or in the
+    //! background, and hands them back through StoreTile().
+    //! Lookups only take a shared lock, so lookups on multiple threads don't block each other. To keep lookups from writing to the
+    //! cache structure, every tile records when it was last used, and the least recently used tiles are searched for when storing a
+    //! tile overflows the cache.
+    //! All methods are safe to call from multiple threads at once.
+    template<typename SampleType>
+    class GridTileCache
+    {
+    public:
+        //! The number of grid points along each side of a tile.
+        static constexpr AZ::s32 TileSize = 32;
+
+        struct TileKey
+        {
+            AZ::s32 m_tileX = 0;
+            AZ::s32 m_tileY = 0;
+            float m_sampleSpacing = 0.0f;
+            float m_height = 0.0f;
+
+            bool operator==(const TileKey& rhs) const
+            {
+                return (m_tileX == rhs.m_tileX) && (m_tileY == rhs.m_tileY) && (m_sampleSpacing == rhs.m_sampleSpacing) &&
+                    (m_height == rhs.m_height);
+            }
+
+            bool operator!=(const TileKey& rhs) const
+            {
+                return !(*this == rhs);
+            }
+        };
+
+        struct TileKeyHash
+        {
+            size_t operator()(const TileKey& key) const
+            {
+                size_t seed = 0;
+                AZStd::hash_combine(seed, key.m_tileX, key.m_tileY, key.m_sampleSpacing, key.m_height);
+                return seed;
+            }
+        };
+
+        //! Controls how Lookup() matches positions to grid points, and which missing tiles it reports.
+        struct LookupSettings
+        {
+            //! The distance between grid points in world space. Must be greater than 0.
+            float m_sampleSpacing = 1.0f;
+
+            //! How far a position can be from a grid point in world space and still use the grid point's sample.
+            float m_tolerance = 0.0f;
+
+            //! Whether positions at different heights use separate tiles. Otherwise every tile is stored at a height of 0.
+            bool m_keyByHeight = false;
+
+            //! Missing tiles are only reported if at least this many of the positions fall in them, so that small queries don't
+            //! cause whole tiles to be filled.
+            size_t m_minPositionsPerMissingTile = 1;
+
+            //! Reserve the reported missing tiles until StoreTile() or CancelTile() is called for them, so that lookups running at
+            //! the same time don't report them again. No more tiles are reserved at once than the cache can hold.
+            bool m_reserveMissingTiles = false;
+        };
+
+        //! Sets the maximum number of tiles to keep, evicting the least recently used tiles if needed. A maximum of 0 disables the cache.
+        void SetMaxTiles(size_t maxTiles);
+        size_t GetMaxTiles() const;
+
+        //! Returns true if the cache can hold any tiles.
+        bool IsEnabled() const;
+
+        //! Returns the number of tiles in the cache.
+        size_t GetTileCount() const;
+
+        //! Removes every tile from the cache and cancels the storing of any tiles that are currently being filled.
+        void Clear();
+
+        //! Removes every tile that overlaps the given region in XY from the cache, regardless of the height of the tile, and cancels
+        //! the storing of any tiles that are currently being filled. An invalid region clears the entire cache.
+        void InvalidateRegion(const AZ::Aabb& dirtyRegion);
+
+        //! Looks up the cached samples for a list of positions.
+        //! @param settings The grid to match the positions against and the missing tiles to report.
+        //! @param positions The positions to look up.
+        //! @param outSamples The cached samples, filled in for every position that was found in the cache.
+        //! @param outFound Set to true for every position that was found in the cache, and false otherwise.
+        //! @param outMissingTiles Gets the tiles that positions on the grid fell in that aren't in the cache.
+        //! @return The cache generation, which needs to be passed to StoreTile() and CancelTile() for the missing tiles.
+        AZ::u64 Lookup(
+            const LookupSettings& settings,
+            AZStd::span<const AZ::Vector3> positions,
+            AZStd::span<SampleType> outSamples,
+            AZStd::span<bool> outFound,
+            AZStd::vector<TileKey>& outMissingTiles);
+
+        //! Stores a filled tile. The tile is discarded if the cache was invalidated since the Lookup() that reported it.
+        //! @param key The tile to store.
+        //! @param samples The samples at the positions from GetTilePositions(), in the same order.
+        //! @param generation The generation returned by the Lookup() that reported the tile.
+        void StoreTile(const TileKey& key, AZStd::vector<SampleType>&& samples, AZ::u64 generation);
+
+        //! Releases a tile reserved by Lookup() that won't be filled.
+        void CancelTile(const TileKey& key, AZ::u64 generation);
+
+        //! Finds the tile and the index of the sample within the tile for a position.
+        //! @return False if the position isn't within the tolerance of a grid point.
+        static bool GetGridPoint(const LookupSettings& settings, const AZ::Vector3& position, TileKey& outKey, size_t& outSampleIndex);
+
+        //! Returns the world space bounds of the grid points in a tile.
+        static AZ::Aabb GetTileBounds(const TileKey& key);
+
+        //! Gets the grid positions of a tile at the given height, in the order StoreTile() expects the samples.
+        static void GetTilePositions(const TileKey& key, float z, AZStd::vector<AZ::Vector3>& outPositions);
+
+    private:
+        struct Tile
+        {
+            AZStd::vector<SampleType> m_samples;
+            AZStd::atomic<AZ::u64> m_lastUsed{ 0 };
+        };
+
+        //! Removes every tile and reservation. The exclusive lock must be held when calling this.
+        void ClearInternal();
+
+        //! Evicts the least recently used tiles until the cache fits within its limit. The exclusive lock must be held when calling this.
+        void EvictTiles();
+
+        mutable AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<TileKey, Tile, TileKeyHash> m_tiles;
+        AZStd::unordered_set<TileKey, TileKeyHash> m_reservedTiles;
+        size_t m_maxTiles = 0;
+
+        //! Incremented by Clear() and InvalidateRegion(), so that tiles filled with data from before an invalidation are never stored.
+        AZ::u64 m_generation = 0;
+
+        //! Incremented by every lookup and stored tile, to order the tiles by when they were last used.
+        AZStd::atomic<AZ::u64> m_useCount{ 0 };
+    };
+
+    template<typename SampleType>
+    void GridTileCache<SampleType>::SetMaxTiles(size_t maxTiles)
+    {
+        AZStd::unique_lock lock(m_mutex);
+        m_maxTiles = maxTiles;
+        EvictTiles();
+    }
+
+    template<typename SampleType>
+    size_t GridTileCache<SampleType>::GetMaxTiles() const
+    {
+        AZStd::shared_lock lock(m_mutex);
+        return m_maxTiles;
+    }
+
+    template<typename SampleType>
+    bool GridTileCache<SampleType>::IsEnabled() const
+    {
+        return GetMaxTiles() > 0;
+    }
+
+    template<typename SampleType>
+    size_t GridTileCache<SampleType>::GetTileCount() const
+    {
+        AZStd::shared_lock lock(m_mutex);
+        return m_tiles.size();
+    }
+
+    template<typename SampleType>
+    void GridTileCache<SampleType>::Clear()
+    {
+        AZStd::unique_lock lock(m_mutex);
+        ClearInternal();
+    }
+
+    template<typename SampleType>
+    void GridTileCache<SampleType>::ClearInternal()
+    {
+        m_generation++;
+        m_tiles.clear();
+        m_reservedTiles.clear();
+    }
+
+    template<typename SampleType>
+    void GridTileCache<SampleType>::InvalidateRegion(const AZ::Aabb& dirtyRegion)
+    {
+        AZStd::unique_lock lock(m_mutex);
+
+        if (!dirtyRegion.IsValid())
+        {
+            ClearInternal();
+            return;
+        }
+
+        // Tiles that are being filled right now might have read data in the dirty region, so none of them can be stored.
+        m_generation++;
+        m_reservedTiles.clear();
+
+        for (auto tileIter = m_tiles.begin(); tileIter != m_tiles.end();)
+        {
+            const AZ::Aabb tileBounds = GetTileBounds(tileIter->first);
+            const bool overlaps = (tileBounds.GetMin().GetX() <= dirtyRegion.GetMax().GetX()) &&
+                (tileBounds.GetMax().GetX() >= dirtyRegion.GetMin().GetX()) &&
+                (tileBounds.GetMin().GetY() <= dirtyRegion.GetMax().GetY()) &&
+                (tileBounds.GetMax().GetY() >= dirtyRegion.GetMin().GetY());
+
+            tileIter = overlaps ? m_tiles.erase(tileIter) : AZStd::next(tileIter);
+        }
+    }
+
+    template<typename SampleType>
+    AZ::u64 GridTileCache<SampleType>::Lookup(
+        const LookupSettings& settings,
+        AZStd::span<const AZ::Vector3> positions,
+        AZStd::span<SampleType> outSamples,
+        AZStd::span<bool> outFound,
+        AZStd::vector<TileKey>& outMissingTiles)
+    {
+        AZ_Assert(
+            (positions.size() == outSamples.size()) && (positions.size() == outFound.size()),
+            "The sizes of the position, sample, and found lists should match.");
+        AZ_Assert(settings.m_sampleSpacing > 0.0f, "Invalid sample spacing for a tile cache: %f", settings.m_sampleSpacing);
+
+        // The missing tiles, along with the number of positions that fell in each of them.
+        AZStd::vector<AZStd::pair<TileKey, size_t>> missingTiles;
+        AZStd::unordered_map<TileKey, size_t, TileKeyHash> missingTileIndices;
+        AZ::u64 generation = 0;
+
+        {
+            AZStd::shared_lock lock(m_mutex);
+            generation = m_generation;
+
+            if ((m_maxTiles == 0) || !(settings.m_sampleSpacing > 0.0f))
+            {
+                AZStd::fill(outFound.begin(), outFound.end(), false);
+                return generation;
+            }
+
+            const AZ::u64 useCount = ++m_useCount;
+
+            // Consecutive positions are usually close together, so the tile of the previous position is checked before the map.
+            TileKey lastKey;
+            Tile* lastTile = nullptr;
+            size_t lastMissingTileIndex = 0;
+            bool hasLastKey = false;
+
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                TileKey key;
+                size_t sampleIndex = 0;
+                if (!GetGridPoint(settings, positions[index], key, sampleIndex))
+                {
+                    outFound[index] = false;
+                    continue;
+                }
+
+                if (!hasLastKey || (key != lastKey))
+                {
+                    lastKey = key;
+                    hasLastKey = true;
+
+                    if (auto tileIter = m_tiles.find(key); tileIter != m_tiles.end())
+                    {
+                        lastTile = &(tileIter->second);
+                        lastTile->m_lastUsed.store(useCount, AZStd::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        lastTile = nullptr;
+                        auto [missingIter, inserted] = missingTileIndices.emplace(key, missingTiles.size());
+                        if (inserted)
+                        {
+                            missingTiles.emplace_back(key, 0);
+                        }
+                        lastMissingTileIndex = missingIter->second;
+                    }
+                }
+
+                if (lastTile)
+                {
+                    outSamples[index] = lastTile->m_samples[sampleIndex];
+                    outFound[index] = true;
+                }
+                else
+                {
+                    missingTiles[lastMissingTileIndex].second++;
+                    outFound[index] = false;
+                }
+            }
+        }
+
+        if (!settings.m_reserveMissingTiles)
+        {
+            for (const auto& [key, numPositions] : missingTiles)
+            {
+                if (numPositions >= settings.m_minPositionsPerMissingTile)
+                {
+                    outMissingTiles.push_back(key);
+                }
+            }
+            return generation;
+        }
+
+        if (missingTiles.empty())
+        {
+            return generation;
+        }
+
+        // Reserving tiles changes the cache, so it needs the exclusive lock. The generation can have changed since the samples were
+        // read, and the reserved tiles belong to the current one.
+        AZStd::unique_lock lock(m_mutex);
+        for (const auto& [key, numPositions] : missingTiles)
+        {
+            if ((numPositions >= settings.m_minPositionsPerMissingTile) && (m_reservedTiles.size() < m_maxTiles) &&
+                (m_tiles.find(key) == m_tiles.end()) && m_reservedTiles.insert(key).second)
+            {
+                outMissingTiles.push_back(key);
+            }
+        }
+        return m_generation;
+    }
+
+    template<typename SampleType>
+    void GridTileCache<SampleType>::StoreTile(const TileKey& key, AZStd::vector<SampleType>&& samples, AZ::u64 generation)
+    {
+        AZ_Assert(samples.size() == (TileSize * TileSize), "Unexpected number of samples for a cache tile: %zu", samples.size());
+
+        AZStd::unique_lock lock(m_mutex);
+
+        // Reservations from older generations were already dropped by the invalidation.
+        if (generation != m_generation)
+        {
+            return;
+        }
+
+        m_reservedTiles.erase(key);
+
+        if (m_maxTiles == 0)
+        {
+            return;
+        }
+
+        // Another lookup might have filled the same tile at the same time.
+        auto [tileIter, inserted] = m_tiles.try_emplace(key);
+        if (inserted)
+        {
+            tileIter->second.m_samples = AZStd::move(samples);
+            tileIter->second.m_lastUsed.store(++m_useCount, AZStd::memory_order_relaxed);
+            EvictTiles();
+        }
+    }
+
+    template<typename SampleType>
+    void GridTileCache<SampleType>::CancelTile(const TileKey& key, AZ::u64 generation)
+    {
+        AZStd::unique_lock lock(m_mutex);
+        if (generation == m_generation)
+        {
+            m_reservedTiles.erase(key);
+        }
+    }
+
+    template<typename SampleType>
+    void GridTileCache<SampleType>::EvictTiles()
+    {
+        while (m_tiles.size() > m_maxTiles)
+        {
+            auto oldestTile = m_tiles.begin();
+            for (auto tileIter = m_tiles.begin(); tileIter != m_tiles.end(); ++tileIter)
+            {
+                if (tileIter->second.m_lastUsed.load(AZStd::memory_order_relaxed) <
+                    oldestTile->second.m_lastUsed.load(AZStd::memory_order_relaxed))
+                {
+                    oldestTile = tileIter;
+                }
+            }
+            m_tiles.erase(oldestTile);
+        }
+    }
+
+    template<typename SampleType>
+    bool GridTileCache<SampleType>::GetGridPoint(
+        const LookupSettings& settings, const AZ::Vector3& position, TileKey& outKey, size_t& outSampleIndex)
+    {
+        // Grid indices beyond this range aren't cached, so that the tile and sample index calculations can't overflow.
+        constexpr float MaxGridIndex = static_cast<float>(1 << 30);
+
+        const float gridX = AZStd::round(position.GetX() / settings.m_sampleSpacing);
+        const float gridY = AZStd::round(position.GetY() / settings.m_sampleSpacing);
+
+        // The comparisons are arranged so that NaN positions fail them.
+        if (!((AZStd::abs(gridX) < MaxGridIndex) && (AZStd::abs(gridY) < MaxGridIndex) &&
+              (AZStd::abs(position.GetX() - (gridX * settings.m_sampleSpacing)) <= settings.m_tolerance) &&
+              (AZStd::abs(position.GetY() - (gridY * settings.m_sampleSpacing)) <= settings.m_tolerance)))
+        {
+            return false;
+        }
+
+        const AZ::s32 gridIndexX = aznumeric_cast<AZ::s32>(gridX);
+        const AZ::s32 gridIndexY = aznumeric_cast<AZ::s32>(gridY);
+
+        // Round the tile coordinates towards negative infinity, so that negative grid indices map to the correct tile.
+        auto floorDivide = [](AZ::s32 value)
+        {
+            return (value >= 0) ? (value / TileSize) : ((value - TileSize + 1) / TileSize);
+        };
+
+        outKey.m_tileX = floorDivide(gridIndexX);
+        outKey.m_tileY = floorDivide(gridIndexY);
+        outKey.m_sampleSpacing = settings.m_sampleSpacing;
+        // Adding 0 turns -0 into +0 so that both heights share the same tiles.
+        outKey.m_height = settings.m_keyByHeight ? (position.GetZ() + 0.0f) : 0.0f;
+
+        outSampleIndex = ((gridIndexY - (outKey.m_tileY * TileSize)) * TileSize) + (gridIndexX - (outKey.m_tileX * TileSize));
+        return true;
+    }
+
+    template<typename SampleType>
+    AZ::Aabb GridTileCache<SampleType>::GetTileBounds(const TileKey& key)
+    {
+        // The bounds include the last grid point in each direction, but not the first grid point of the next tile.
+        const AZ::Vector3 firstPoint(
+            aznumeric_cast<float>(key.m_tileX * TileSize) * key.m_sampleSpacing,
+            aznumeric_cast<float>(key.m_tileY * TileSize) * key.m_sampleSpacing,
+            key.m_height);
+        const float lastPointOffset = key.m_sampleSpacing * (TileSize - 1);
+        return AZ::Aabb::CreateFromMinMax(firstPoint, firstPoint + AZ::Vector3(lastPointOffset, lastPointOffset, 0.0f));
+    }
+
+    template<typename SampleType>
+    void GridTileCache<SampleType>::GetTilePositions(const TileKey& key, float z, AZStd::vector<AZ::Vector3>& outPositions)
+    {
+        // These are computed the same way as GetGridPoint() computes grid positions, so the positions exactly match the grid.
+        outPositions.clear();
+        outPositions.reserve(TileSize * TileSize);
+        for (AZ::s32 y = 0; y < TileSize; y++)
+        {
+            const float gridY = aznumeric_cast<float>((key.m_tileY * TileSize) + y);
+            for (AZ::s32 x = 0; x < TileSize; x++)
+            {
+                const float gridX = aznumeric_cast<float>((key.m_tileX * TileSize) + x);
+                outPositions.emplace_back(gridX * key.m_sampleSpacing, gridY * key.m_sampleSpacing, z);
+            }
+        }
+    }
+} // namespace GradientSignal
@@ -64,9 +64,23 @@ namespace GradientSignal
         const float max = m_falloffMidpoint + m_falloffRange / 2.0f;
         const float valueFalloffStrength = AZ::GetClamp(m_falloffStrength, 0.0f, 1.0f);
 
-        for (auto& inOutValue : inOutValues)
+        // Values are processed 4 at a time with SIMD math, and any remaining values go through the single value version.
+        using Vec4 = AZ::Simd::Vec4;
+        const size_t batchedCount = inOutValues.size() & ~size_t(3);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        for (size_t index = 0; index < batchedCount; index += 4)
+        {
+            const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadUnaligned(&inOutValues[index]), zero, one);
+            const Vec4::FloatType result1 = GetSmoothStep(GetRatio(min, min + valueFalloffStrength, value));
+            const Vec4::FloatType result2 = GetSmoothStep(GetRatio(max - valueFalloffStrength, max, value));
+            Vec4::StoreUnaligned(&inOutValues[index], Vec4::Mul(result1, Vec4::Sub(one, result2)));
+        }
+
+        for (size_t index = batchedCount; index < inOutValues.size(); ++index)
         {
-            inOutValue = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValue);
+            inOutValues[index] = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValues[index]);
         }
     }
 } // namespace GradientSignal
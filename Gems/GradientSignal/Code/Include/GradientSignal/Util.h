@@ -11,6 +11,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/span.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
@@ -42,6 +43,19 @@ namespace GradientSignal
         return AZ::GetClamp((t - a) / (b - a), 0.0f, 1.0f);
     }
 
+    //! GetRatio() for 4 values at once.
+    inline AZ::Simd::Vec4::FloatType GetRatio(float a, float b, AZ::Simd::Vec4::FloatArgType t)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        if (a == b)
+        {
+            return Vec4::Select(Vec4::Splat(1.0f), Vec4::ZeroFloat(), Vec4::CmpGt(t, Vec4::Splat(a)));
+        }
+
+        return Vec4::Clamp(Vec4::Div(Vec4::Sub(t, Vec4::Splat(a)), Vec4::Splat(b - a)), Vec4::ZeroFloat(), Vec4::Splat(1.0f));
+    }
+
     inline float GetLerp(float a, float b, float t)
     {
         return a + GetRatio(a, b, t) + (b - a);
@@ -52,6 +66,13 @@ namespace GradientSignal
         return t * t * (3.0f - 2.0f * t);
     }
 
+    //! GetSmoothStep() for 4 values at once.
+    inline AZ::Simd::Vec4::FloatType GetSmoothStep(AZ::Simd::Vec4::FloatArgType t)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+    }
+
     inline float GetLevels(float input, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
     {
         inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f); // Clamp the midpoint to a non-zero value so that it's always safe to divide by it.
@@ -81,34 +102,70 @@ namespace GradientSignal
 
     inline void GetLevels(AZStd::span<float> inOutValues, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
     {
+        using Vec4 = AZ::Simd::Vec4;
+
         inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f); // Clamp the midpoint to a non-zero value so that it's always safe to divide by it.
         inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
         inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
         outputMin = AZ::GetClamp(outputMin, 0.0f, 1.0f);
         outputMax = AZ::GetClamp(outputMax, 0.0f, 1.0f);
 
+        // Values are processed 4 at a time with SIMD math, and any remaining values go through the single value version.
+        const size_t batchedCount = inOutValues.size() & ~size_t(3);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType outputMinSplat = Vec4::Splat(outputMin);
+        const Vec4::FloatType outputMaxSplat = Vec4::Splat(outputMax);
+
         if (inputMin == inputMax)
         {
-            for (auto& inOutValue : inOutValues)
+            const Vec4::FloatType inputMinSplat = Vec4::Splat(inputMin);
+            for (size_t index = 0; index < batchedCount; index += 4)
             {
-                inOutValue = (AZ::GetClamp(inOutValue, 0.0f, 1.0f) <= inputMin) ? outputMin : outputMax;
+                const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadUnaligned(&inOutValues[index]), zero, one);
+                Vec4::StoreUnaligned(&inOutValues[index], Vec4::Select(outputMinSplat, outputMaxSplat, Vec4::CmpLtEq(value, inputMinSplat)));
             }
+            for (size_t index = batchedCount; index < inOutValues.size(); ++index)
+            {
+                inOutValues[index] = (AZ::GetClamp(inOutValues[index], 0.0f, 1.0f) <= inputMin) ? outputMin : outputMax;
+            }
+            return;
         }
 
         const float inputMidReciprocal = 1.0f / inputMid;
         const float inputExtentsReciprocal = 1.0f / (inputMax - inputMin);
 
-        for (auto& inOutValue : inOutValues)
+        const Vec4::FloatType inputMinSplat = Vec4::Splat(inputMin);
+        const Vec4::FloatType inputExtentsReciprocalSplat = Vec4::Splat(inputExtentsReciprocal);
+        const Vec4::FloatType outputExtents = Vec4::Sub(outputMaxSplat, outputMinSplat);
+
+        for (size_t index = 0; index < batchedCount; index += 4)
         {
-            const float inputRemapped =
-                AZ::GetMin(AZ::GetMax(AZ::GetClamp(inOutValue, 0.0f, 1.0f) - inputMin, 0.0f) * inputExtentsReciprocal, 1.0f);
+            const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadUnaligned(&inOutValues[index]), zero, one);
+            Vec4::FloatType inputCorrected =
+                Vec4::Min(Vec4::Mul(Vec4::Max(Vec4::Sub(value, inputMinSplat), zero), inputExtentsReciprocalSplat), one);
 
             // Note:  Some paint programs map the midpoint using 1/mid where low values are dark and high values are light,
             // others do the reverse and use mid directly, so low values are light and high values are dark.  We've chosen to
             // align with 1/mid since it appears to be the more prevalent of the two approaches.
-            const float inputCorrected = powf(inputRemapped, inputMidReciprocal);
+            // There's no SIMD power function, but the default midpoint of 1 doesn't need one.
+            if (inputMidReciprocal != 1.0f)
+            {
+                alignas(16) float remapped[4];
+                Vec4::StoreAligned(remapped, inputCorrected);
+                for (float& remappedValue : remapped)
+                {
+                    remappedValue = powf(remappedValue, inputMidReciprocal);
+                }
+                inputCorrected = Vec4::LoadAligned(remapped);
+            }
 
-            inOutValue = AZ::Lerp(outputMin, outputMax, inputCorrected);
+            Vec4::StoreUnaligned(&inOutValues[index], Vec4::Add(outputMinSplat, Vec4::Mul(outputExtents, inputCorrected)));
+        }
+
+        for (size_t index = batchedCount; index < inOutValues.size(); ++index)
+        {
+            inOutValues[index] = GetLevels(inOutValues[index], inputMid, inputMin, inputMax, outputMin, outputMax);
         }
     }
 } // namespace GradientSignal
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/CompiledGradient.h>
+#include <AzCore/Debug/Profiler.h>
+
+namespace GradientSignal
+{
+    CompiledGradient::CompiledGradient(const GradientSampler& sampler)
+    {
+        SetGradientSampler(sampler);
+    }
+
+    CompiledGradient::~CompiledGradient()
+    {
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+    }
+
+    void CompiledGradient::SetGradientSampler(const GradientSampler& sampler)
+    {
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        m_sampler = sampler;
+
+        // Every gradient in the hierarchy forwards the changes of its inputs to its own entity, so listening to the
+        // sampled gradient is enough to hear about changes anywhere beneath it.
+        if (m_sampler.m_gradientId.IsValid())
+        {
+            LmbrCentral::DependencyNotificationBus::Handler::BusConnect(m_sampler.m_gradientId);
+        }
+        Invalidate();
+    }
+
+    const GradientSampler& CompiledGradient::GetGradientSampler() const
+    {
+        return m_sampler;
+    }
+
+    void CompiledGradient::Invalidate()
+    {
+        m_dirty = true;
+    }
+
+    void CompiledGradient::OnCompositionChanged()
+    {
+        // Only flag the program here. Notifications can arrive while the notifying component holds its own lock,
+        // so compiling (which queries that same component) is deferred until the next query.
+        Invalidate();
+    }
+
+    AZStd::shared_ptr<const GradientProgram> CompiledGradient::GetProgram() const
+    {
+        AZStd::scoped_lock lock(m_programMutex);
+        if (m_dirty.exchange(false))
+        {
+            m_program = AZStd::make_shared<const GradientProgram>(GradientProgramBuilder::Compile(m_sampler));
+        }
+        return m_program;
+    }
+
+    float CompiledGradient::GetValue(const GradientSampleParams& sampleParams) const
+    {
+        // Single points gain nothing from tiling, so they go straight through the sampler.
+        return m_sampler.GetValue(sampleParams);
+    }
+
+    void CompiledGradient::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::shared_ptr<const GradientProgram> program = GetProgram();
+        if (program->IsValid())
+        {
+            program->Execute(positions, outValues);
+        }
+        else
+        {
+            m_sampler.GetValues(positions, outValues);
+        }
+    }
+} // namespace GradientSignal
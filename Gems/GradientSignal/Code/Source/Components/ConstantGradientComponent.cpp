@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -154,6 +155,15 @@ namespace GradientSignal
         AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_value);
     }
 
+    bool ConstantGradientComponent::CompileGradient(
+        GradientProgramBuilder& builder, [[maybe_unused]] GradientProgramRegister positions, GradientProgramRegister output) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.EmitFill(output, m_configuration.m_value);
+        return true;
+    }
+
     float ConstantGradientComponent::GetConstantValue() const
     {
         return m_configuration.m_value;
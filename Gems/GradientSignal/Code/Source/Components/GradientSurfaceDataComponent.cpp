@@ -167,8 +167,10 @@ namespace GradientSignal
 
     void GradientSurfaceDataComponent::Activate()
     {
-        m_gradientSampler.m_gradientId = GetEntityId();
-        m_gradientSampler.m_ownerEntityId = GetEntityId();
+        GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = GetEntityId();
+        gradientSampler.m_ownerEntityId = GetEntityId();
+        m_compiledGradient.SetGradientSampler(gradientSampler);
 
         LmbrCentral::DependencyNotificationBus::Handler::BusConnect(GetEntityId());
 
@@ -194,6 +196,9 @@ namespace GradientSignal
         AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->UnregisterSurfaceDataModifier(m_modifierHandle);
         SurfaceData::SurfaceDataModifierRequestBus::Handler::BusDisconnect();
         m_modifierHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+
+        // Release the compiled program now that no more surface points can be modified.
+        m_compiledGradient.SetGradientSampler(GradientSampler());
     }
 
     bool GradientSurfaceDataComponent::ReadInConfig(const AZ::ComponentConfig* baseConfig)
@@ -272,7 +277,7 @@ namespace GradientSignal
 
         // Get all of the potential gradient values in one bulk call.
         AZStd::vector<float, SurfaceData::mixed_stack_heap_allocator<float, SmallQuerySize>> gradientValues(positions.size());
-        m_gradientSampler.GetValues(positions, gradientValues);
+        m_compiledGradient.GetValues(positions, gradientValues);
 
         for (size_t index = 0; index < positions.size(); index++)
         {
@@ -352,59 +352,44 @@ namespace GradientSignal
         }
     }
 
-    float ImageGradientComponent::GetValueFromImageData(SamplingType samplingType, const AZ::Vector3& uvw, float defaultValue) const
+    void ImageGradientComponent::GetPixelLookup(const AZ::Vector3& uvw, AZ::u32& x, AZ::u32& y, float& pixelX, float& pixelY) const
     {
-        if (!m_imageData.empty())
-        {
-            const auto width = m_imageDescriptor.m_size.m_width;
-            const auto height = m_imageDescriptor.m_size.m_height;
+        const auto width = m_imageDescriptor.m_size.m_width;
+        const auto height = m_imageDescriptor.m_size.m_height;
 
-            if (width > 0 && height > 0)
-            {
-                // When "rasterizing" from uvs, a range of 0-1 has slightly different meanings depending on the sampler state.
-                // For repeating states (Unbounded/None, Repeat), a uv value of 1 should wrap around back to our 0th pixel.
-                // For clamping states (Clamp to Zero, Clamp to Edge), a uv value of 1 should point to the last pixel.
-
-                // We assume here that the code handling sampler states has handled this for us in the clamping cases
-                // by reducing our uv by a small delta value such that anything that wants the last pixel has a value
-                // just slightly less than 1.
-
-                // Keeping that in mind, we scale our uv from 0-1 to 0-image size inclusive.  So a 4-pixel image will scale
-                // uv values of 0-1 to 0-4, not 0-3 as you might expect.  This is because we want the following range mappings:
-                // [0 - 1/4)   = pixel 0
-                // [1/4 - 1/2) = pixel 1
-                // [1/2 - 3/4) = pixel 2
-                // [3/4 - 1)   = pixel 3
-                // [1 - 1 1/4) = pixel 0
-                // ...
-
-                // Also, based on our tiling settings, we extend the size of our image virtually by a factor of tilingX and tilingY.  
-                // A 16x16 pixel image and tilingX = tilingY = 1  maps the uv range of 0-1 to 0-16 pixels.  
-                // A 16x16 pixel image and tilingX = tilingY = 1.5 maps the uv range of 0-1 to 0-24 pixels.
-
-                const AZ::Vector2 tiledDimensions(width * GetTilingX(), height * GetTilingY());
-
-                // Convert from uv space back to pixel space
-                AZ::Vector2 pixelLookup = (AZ::Vector2(uvw) * tiledDimensions);
-
-                // UVs outside the 0-1 range are treated as infinitely tiling, so that we behave the same as the 
-                // other gradient generators.  As mentioned above, if clamping is desired, we expect it to be applied
-                // outside of this function.
-                float pixelX = pixelLookup.GetX();
-                float pixelY = pixelLookup.GetY();
-                auto x = aznumeric_cast<AZ::u32>(pixelX) % width;
-                auto y = aznumeric_cast<AZ::u32>(pixelY) % height;
-
-                // Retrieve our pixel value based on our sampling type
-                const float value = GetValueForSamplingType(samplingType, x, y, pixelX, pixelY);
-
-                // Scale (inverse lerp) the value into a 0 - 1 range. We also clamp it because manual scale values could cause
-                // the result to fall outside of the expected output range.
-                return AZStd::clamp((value - m_offset) * m_multiplier, 0.0f, 1.0f);
-            }
-        }
+        // When "rasterizing" from uvs, a range of 0-1 has slightly different meanings depending on the sampler state.
+        // For repeating states (Unbounded/None, Repeat), a uv value of 1 should wrap around back to our 0th pixel.
+        // For clamping states (Clamp to Zero, Clamp to Edge), a uv value of 1 should point to the last pixel.
 
-        return defaultValue;
+        // We assume here that the code handling sampler states has handled this for us in the clamping cases
+        // by reducing our uv by a small delta value such that anything that wants the last pixel has a value
+        // just slightly less than 1.
+
+        // Keeping that in mind, we scale our uv from 0-1 to 0-image size inclusive.  So a 4-pixel image will scale
+        // uv values of 0-1 to 0-4, not 0-3 as you might expect.  This is because we want the following range mappings:
+        // [0 - 1/4)   = pixel 0
+        // [1/4 - 1/2) = pixel 1
+        // [1/2 - 3/4) = pixel 2
+        // [3/4 - 1)   = pixel 3
+        // [1 - 1 1/4) = pixel 0
+        // ...
+
+        // Also, based on our tiling settings, we extend the size of our image virtually by a factor of tilingX and tilingY.  
+        // A 16x16 pixel image and tilingX = tilingY = 1  maps the uv range of 0-1 to 0-16 pixels.  
+        // A 16x16 pixel image and tilingX = tilingY = 1.5 maps the uv range of 0-1 to 0-24 pixels.
+
+        const AZ::Vector2 tiledDimensions(width * GetTilingX(), height * GetTilingY());
+
+        // Convert from uv space back to pixel space
+        AZ::Vector2 pixelLookup = (AZ::Vector2(uvw) * tiledDimensions);
+
+        // UVs outside the 0-1 range are treated as infinitely tiling, so that we behave the same as the 
+        // other gradient generators.  As mentioned above, if clamping is desired, we expect it to be applied
+        // outside of this function.
+        pixelX = pixelLookup.GetX();
+        pixelY = pixelLookup.GetY();
+        x = aznumeric_cast<AZ::u32>(pixelX) % width;
+        y = aznumeric_cast<AZ::u32>(pixelY) % height;
     }
 
     float ImageGradientComponent::InvertYAndGetPixelValue(AZ::u32 x, AZ::u32 invertedY) const
@@ -563,14 +548,56 @@ namespace GradientSignal
         }
     }
 
-    float ImageGradientComponent::GetValueForSamplingType(SamplingType samplingType, AZ::u32 x0, AZ::u32 y0, float pixelX, float pixelY) const
+    void ImageGradientComponent::GetSamplesForSamplingType(
+        SamplingType samplingType, AZ::u32 x0, AZ::u32 y0, size_t lane, SampleBatch& batch) const
     {
         switch (samplingType)
         {
         case SamplingType::Point:
         default:
             // Retrieve the pixel value for the single point
-            return InvertYAndGetPixelValue(x0, y0);
+            batch.m_samples[0][lane] = InvertYAndGetPixelValue(x0, y0);
+            break;
+
+        case SamplingType::Bilinear:
+            // Retrieve the 4 corners of the grid square around the desired pixel, see FilterSamples() for details.
+            batch.m_samples[0][lane] = GetClampedValue(x0, y0);
+            batch.m_samples[1][lane] = GetClampedValue(x0 + 1, y0);
+            batch.m_samples[2][lane] = GetClampedValue(x0, y0 + 1);
+            batch.m_samples[3][lane] = GetClampedValue(x0 + 1, y0 + 1);
+            break;
+
+        case SamplingType::Bicubic:
+        {
+            // Retrieve the 4x4 neighborhood around the desired pixel, stored as sample [x * 4 + y].
+            AZStd::array<AZStd::array<float, 4>, 4> values;
+            Get4x4Neighborhood(x0, y0, values);
+            for (size_t xIndex = 0; xIndex < 4; ++xIndex)
+            {
+                for (size_t yIndex = 0; yIndex < 4; ++yIndex)
+                {
+                    batch.m_samples[(xIndex * 4) + yIndex][lane] = values[xIndex][yIndex];
+                }
+            }
+            break;
+        }
+        }
+    }
+
+    AZ::Simd::Vec4::FloatType ImageGradientComponent::FilterSamples(SamplingType samplingType, const SampleBatch& batch)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        auto lerp = [](Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType t)
+        {
+            return Vec4::Add(a, Vec4::Mul(Vec4::Sub(b, a), t));
+        };
+
+        switch (samplingType)
+        {
+        case SamplingType::Point:
+        default:
+            return Vec4::LoadAligned(batch.m_samples[0]);
 
         case SamplingType::Bilinear:
         {
@@ -590,16 +617,11 @@ namespace GradientSignal
             // amount the position exists between those corners.
             // Ex: (3.3, 4.4) would have a x0,y0 of (3, 4), a x1,y1 of (4, 5), and a deltaX/Y of (0.3, 0.4).
 
-            const float valueX0Y0 = GetClampedValue(x0, y0);
-            const float valueX1Y0 = GetClampedValue(x0 + 1, y0);
-            const float valueX0Y1 = GetClampedValue(x0, y0 + 1);
-            const float valueX1Y1 = GetClampedValue(x0 + 1, y0 + 1);
-
-            float deltaX = pixelX - floor(pixelX);
-            float deltaY = pixelY - floor(pixelY);
-            const float valueXY0 = AZ::Lerp(valueX0Y0, valueX1Y0, deltaX);
-            const float valueXY1 = AZ::Lerp(valueX0Y1, valueX1Y1, deltaX);
-            return AZ::Lerp(valueXY0, valueXY1, deltaY);
+            const Vec4::FloatType deltaX = Vec4::LoadAligned(batch.m_deltaX);
+            const Vec4::FloatType deltaY = Vec4::LoadAligned(batch.m_deltaY);
+            const Vec4::FloatType valueXY0 = lerp(Vec4::LoadAligned(batch.m_samples[0]), Vec4::LoadAligned(batch.m_samples[1]), deltaX);
+            const Vec4::FloatType valueXY1 = lerp(Vec4::LoadAligned(batch.m_samples[2]), Vec4::LoadAligned(batch.m_samples[3]), deltaX);
+            return lerp(valueXY0, valueXY1, deltaY);
         }
         case SamplingType::Bicubic:
         {
@@ -607,21 +629,32 @@ namespace GradientSignal
             // in between discrete sample locations. See https://en.wikipedia.org/wiki/Bicubic_interpolation
 
             // Simplified interpolation function
-            auto cubicInterpolate = [](float p0, float p1, float p2, float p3, float delta) -> float
+            // p1 + 0.5f * delta * (p2 - p0 + delta * (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 + delta * (3.0f * (p1 - p2) + p3 - p0)))
+            auto cubicInterpolate = [](Vec4::FloatArgType p0, Vec4::FloatArgType p1, Vec4::FloatArgType p2, Vec4::FloatArgType p3,
+                                       Vec4::FloatArgType delta)
             {
-                return p1 + 0.5f * delta * (p2 - p0 + delta * (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 + delta * (3.0f * (p1 - p2) + p3 - p0)));
+                const Vec4::FloatType cubic = Vec4::Sub(Vec4::Add(Vec4::Mul(Vec4::Splat(3.0f), Vec4::Sub(p1, p2)), p3), p0);
+                const Vec4::FloatType quadratic = Vec4::Add(
+                    Vec4::Sub(
+                        Vec4::Add(Vec4::Sub(Vec4::Mul(Vec4::Splat(2.0f), p0), Vec4::Mul(Vec4::Splat(5.0f), p1)), Vec4::Mul(Vec4::Splat(4.0f), p2)),
+                        p3),
+                    Vec4::Mul(delta, cubic));
+                const Vec4::FloatType linear = Vec4::Add(Vec4::Sub(p2, p0), Vec4::Mul(delta, quadratic));
+                return Vec4::Add(p1, Vec4::Mul(Vec4::Mul(Vec4::Splat(0.5f), delta), linear));
             };
 
-            AZStd::array<AZStd::array<float, 4>, 4> values;
-            Get4x4Neighborhood(x0, y0, values);
+            auto sample = [&batch](size_t xIndex, size_t yIndex)
+            {
+                return Vec4::LoadAligned(batch.m_samples[(xIndex * 4) + yIndex]);
+            };
 
-            float deltaX = pixelX - floor(pixelX);
-            float deltaY = pixelY - floor(pixelY);
+            const Vec4::FloatType deltaX = Vec4::LoadAligned(batch.m_deltaX);
+            const Vec4::FloatType deltaY = Vec4::LoadAligned(batch.m_deltaY);
 
-            const float valueXY0 = cubicInterpolate(values[0][0], values[1][0], values[2][0], values[3][0], deltaX);
-            const float valueXY1 = cubicInterpolate(values[0][1], values[1][1], values[2][1], values[3][1], deltaX);
-            const float valueXY2 = cubicInterpolate(values[0][2], values[1][2], values[2][2], values[3][2], deltaX);
-            const float valueXY3 = cubicInterpolate(values[0][3], values[1][3], values[2][3], values[3][3], deltaX);
+            const Vec4::FloatType valueXY0 = cubicInterpolate(sample(0, 0), sample(1, 0), sample(2, 0), sample(3, 0), deltaX);
+            const Vec4::FloatType valueXY1 = cubicInterpolate(sample(0, 1), sample(1, 1), sample(2, 1), sample(3, 1), deltaX);
+            const Vec4::FloatType valueXY2 = cubicInterpolate(sample(0, 2), sample(1, 2), sample(2, 2), sample(3, 2), deltaX);
+            const Vec4::FloatType valueXY3 = cubicInterpolate(sample(0, 3), sample(1, 3), sample(2, 3), sample(3, 3), deltaX);
 
             return cubicInterpolate(valueXY0, valueXY1, valueXY2, valueXY3, deltaY);
         }
@@ -892,20 +925,56 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        if (m_imageDescriptor.m_size.m_width == 0 || m_imageDescriptor.m_size.m_height == 0)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
 
-        for (size_t index = 0; index < positions.size(); index++)
+        using Vec4 = AZ::Simd::Vec4;
+        constexpr size_t BatchSize = SampleBatch::BatchSize;
+
+        const Vec4::FloatType offset = Vec4::Splat(m_offset);
+        const Vec4::FloatType multiplier = Vec4::Splat(m_multiplier);
+
+        // The pixel lookups depend on the image format and wrapping type, so they happen one point at a time, but the
+        // filtering and scaling of the looked up pixels run on a batch of 4 points at once.
+        SampleBatch batch = {};
+        alignas(16) float batchValues[BatchSize];
+        AZStd::array<bool, BatchSize> wasPointRejected;
+
+        for (size_t batchStart = 0; batchStart < positions.size(); batchStart += BatchSize)
         {
-            m_gradientTransform.TransformPositionToUVWNormalized(positions[index], uvw, wasPointRejected);
+            const size_t batchCount = AZStd::min(BatchSize, positions.size() - batchStart);
 
-            if (!wasPointRejected)
+            for (size_t lane = 0; lane < batchCount; lane++)
             {
-                outValues[index] = GetValueFromImageData(samplingType, uvw, 0.0f);
+                AZ::Vector3 uvw;
+                m_gradientTransform.TransformPositionToUVWNormalized(positions[batchStart + lane], uvw, wasPointRejected[lane]);
+
+                if (!wasPointRejected[lane])
+                {
+                    AZ::u32 x = 0;
+                    AZ::u32 y = 0;
+                    float pixelX = 0.0f;
+                    float pixelY = 0.0f;
+                    GetPixelLookup(uvw, x, y, pixelX, pixelY);
+
+                    batch.m_deltaX[lane] = pixelX - floor(pixelX);
+                    batch.m_deltaY[lane] = pixelY - floor(pixelY);
+                    GetSamplesForSamplingType(samplingType, x, y, lane, batch);
+                }
             }
-            else
+
+            // Scale (inverse lerp) the value into a 0 - 1 range. We also clamp it because manual scale values could cause
+            // the result to fall outside of the expected output range.
+            const Vec4::FloatType value = FilterSamples(samplingType, batch);
+            Vec4::StoreAligned(
+                batchValues, Vec4::Clamp(Vec4::Mul(Vec4::Sub(value, offset), multiplier), Vec4::ZeroFloat(), Vec4::Splat(1.0f)));
+
+            for (size_t lane = 0; lane < batchCount; lane++)
             {
-                outValues[index] = 0.0f;
+                outValues[batchStart + lane] = wasPointRejected[lane] ? 0.0f : batchValues[lane];
             }
         }
     }
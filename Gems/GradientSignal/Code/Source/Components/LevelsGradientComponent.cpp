@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <GradientSignal/Util.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -208,6 +209,17 @@ namespace GradientSignal
                 m_configuration.m_outputMin, m_configuration.m_outputMax);
     }
 
+    bool LevelsGradientComponent::CompileGradient(GradientProgramBuilder& builder, GradientProgramRegister positions, GradientProgramRegister output) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.EmitSampler(m_configuration.m_gradientSampler, positions, output);
+        builder.EmitLevels(
+            output, m_configuration.m_inputMid, m_configuration.m_inputMin, m_configuration.m_inputMax,
+            m_configuration.m_outputMin, m_configuration.m_outputMax);
+        return true;
+    }
+
     bool LevelsGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -366,6 +367,29 @@ namespace GradientSignal
 
 
 
+    bool MixedGradientComponent::CompileGradient(GradientProgramBuilder& builder, GradientProgramRegister positions, GradientProgramRegister output) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        // Mirrors GetValues(), accumulating each layer into the output register one tile at a time.
+        builder.EmitFill(output, 0.0f);
+
+        const GradientProgramRegister layerValues = builder.AllocateValues();
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                builder.EmitSampler(layer.m_gradientSampler, positions, layerValues);
+                builder.EmitMix(output, layerValues, layer.m_operation, layer.m_gradientSampler.m_opacity);
+            }
+        }
+        builder.ReleaseValues(layerValues);
+
+        builder.EmitClamp(output);
+        return true;
+    }
+
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         for (const auto& layer : m_configuration.m_layers)
@@ -12,6 +12,7 @@
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -215,24 +216,38 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        // Positions are transformed a chunk at a time so that the noise itself can be generated in batches with SIMD math.
+        constexpr size_t ChunkSize = 256;
+        AZStd::array<AZ::Vector3, ChunkSize> uvws;
+        AZStd::array<bool, ChunkSize> wasPointRejected;
 
         AZStd::shared_lock lock(m_queryMutex);
 
-        for (size_t index = 0; index < positions.size(); index++)
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += ChunkSize)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            const size_t chunkCount = AZStd::min(ChunkSize, positions.size() - chunkStart);
+            bool anyPointRejected = false;
 
-            if (!wasPointRejected)
+            for (size_t index = 0; index < chunkCount; index++)
             {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
+                m_gradientTransform.TransformPositionToUVW(positions[chunkStart + index], uvws[index], wasPointRejected[index]);
+                anyPointRejected = anyPointRejected || wasPointRejected[index];
             }
-            else
+
+            AZStd::span<float> chunkValues = outValues.subspan(chunkStart, chunkCount);
+            m_perlinImprovedNoise->GenerateOctaveNoise(
+                AZStd::span<const AZ::Vector3>(uvws.data(), chunkCount), m_configuration.m_octave, m_configuration.m_amplitude,
+                m_configuration.m_frequency, chunkValues);
+
+            if (anyPointRejected)
             {
-                outValues[index] = 0.0f;
+                for (size_t index = 0; index < chunkCount; index++)
+                {
+                    if (wasPointRejected[index])
+                    {
+                        chunkValues[index] = 0.0f;
+                    }
+                }
             }
         }
     }
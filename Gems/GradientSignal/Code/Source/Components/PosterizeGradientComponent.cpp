@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -177,10 +178,18 @@ namespace GradientSignal
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
 
         // Run through all the input values and posterize them.
-        for (auto& outValue : outValues)
-        {
-            outValue = PosterizeValue(outValue, bands, m_configuration.m_mode);
-        }
+        PosterizeValues(outValues, bands, m_configuration.m_mode);
+    }
+
+    bool PosterizeGradientComponent::CompileGradient(GradientProgramBuilder& builder, GradientProgramRegister positions, GradientProgramRegister output) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
+
+        builder.EmitSampler(m_configuration.m_gradientSampler, positions, output);
+        builder.EmitPosterize(output, bands, m_configuration.m_mode);
+        return true;
     }
 
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -149,6 +150,12 @@ namespace GradientSignal
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
     }
 
+    bool ReferenceGradientComponent::CompileGradient(GradientProgramBuilder& builder, GradientProgramRegister positions, GradientProgramRegister output) const
+    {
+        builder.EmitSampler(m_configuration.m_gradientSampler, positions, output);
+        return true;
+    }
+
     bool ReferenceGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Util.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -192,6 +193,15 @@ namespace GradientSignal
         m_configuration.m_smoothStep.GetSmoothedValues(outValues);
     }
 
+    bool SmoothStepGradientComponent::CompileGradient(GradientProgramBuilder& builder, GradientProgramRegister positions, GradientProgramRegister output) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.EmitSampler(m_configuration.m_gradientSampler, positions, output);
+        builder.EmitSmoothStep(output, m_configuration.m_smoothStep);
+        return true;
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -230,7 +230,8 @@ namespace GradientSignal
 
         AZStd::shared_lock lock(m_queryMutex);
 
-        SurfaceData::SurfacePointList points;
+        auto pointsHandle = m_surfacePointListPool.Acquire();
+        SurfaceData::SurfacePointList& points = *pointsHandle;
         AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromList(
             positions, m_configuration.m_surfaceTagsToSample, points);
 
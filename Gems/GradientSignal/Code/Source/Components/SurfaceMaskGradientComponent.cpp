@@ -197,7 +197,8 @@ namespace GradientSignal
 
         if (!m_configuration.m_surfaceTagList.empty())
         {
-            SurfaceData::SurfacePointList points;
+            auto pointsHandle = m_surfacePointListPool.Acquire();
+            SurfaceData::SurfacePointList& points = *pointsHandle;
             AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromList(
                 positions, m_configuration.m_surfaceTagList, points);
 
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientCache.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace GradientSignal
+{
+    GradientCache::GradientCache()
+    {
+        m_tileCache.SetMaxTiles(DefaultMaxTiles);
+    }
+
+    GradientCache::GradientCache(const GradientSampler& sampler, size_t maxTiles)
+    {
+        m_tileCache.SetMaxTiles(maxTiles);
+        SetGradientSampler(sampler);
+    }
+
+    GradientCache::~GradientCache()
+    {
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+    }
+
+    void GradientCache::SetGradientSampler(const GradientSampler& sampler)
+    {
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
+        m_sampler = sampler;
+
+        // Every gradient in the hierarchy forwards the changes of its inputs to its own entity, so listening to the
+        // sampled gradient is enough to hear about changes anywhere beneath it.
+        if (m_sampler.m_gradientId.IsValid())
+        {
+            LmbrCentral::DependencyNotificationBus::Handler::BusConnect(m_sampler.m_gradientId);
+        }
+        Invalidate();
+    }
+
+    const GradientSampler& GradientCache::GetGradientSampler() const
+    {
+        return m_sampler;
+    }
+
+    void GradientCache::SetMaxTiles(size_t maxTiles)
+    {
+        m_tileCache.SetMaxTiles(maxTiles);
+    }
+
+    size_t GradientCache::GetMaxTiles() const
+    {
+        return m_tileCache.GetMaxTiles();
+    }
+
+    size_t GradientCache::GetTileCount() const
+    {
+        return m_tileCache.GetTileCount();
+    }
+
+    void GradientCache::Invalidate()
+    {
+        m_tileCache.Clear();
+    }
+
+    void GradientCache::InvalidateRegion(const AZ::Aabb& dirtyRegion)
+    {
+        // Gradients are generally only dependent on XY, so the tile cache invalidates tiles regardless of their height.
+        m_tileCache.InvalidateRegion(dirtyRegion);
+    }
+
+    void GradientCache::OnCompositionChanged()
+    {
+        Invalidate();
+    }
+
+    void GradientCache::OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion)
+    {
+        InvalidateRegion(m_sampler.TransformDirtyRegion(dirtyRegion));
+    }
+
+    void GradientCache::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, float sampleSpacing) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The position list size doesn't match the outValues list size.");
+        AZ_Assert(sampleSpacing > 0.0f, "Invalid sample spacing for the gradient cache: %f", sampleSpacing);
+
+        if (!(sampleSpacing > 0.0f) || !m_tileCache.IsEnabled())
+        {
+            m_sampler.GetValues(positions, outValues);
+            return;
+        }
+
+        TileCache::LookupSettings settings;
+        settings.m_sampleSpacing = sampleSpacing;
+        settings.m_tolerance = sampleSpacing * GridTolerance;
+        settings.m_keyByHeight = true;
+        // Filling a tile costs as much as querying all of its points, so only fill tiles that the query has at least a row's worth of positions in.
+        settings.m_minPositionsPerMissingTile = TileSize;
+
+        AZStd::vector<bool> valueFound(positions.size());
+        AZStd::vector<TileCache::TileKey> missingTiles;
+        const AZ::u64 generation = m_tileCache.Lookup(settings, positions, outValues, valueFound, missingTiles);
+
+        // Fill the missing tiles without holding any cache locks, since querying the gradients can take a while.
+        AZStd::unordered_map<TileCache::TileKey, AZStd::vector<float>, TileCache::TileKeyHash> filledTiles;
+        AZStd::vector<AZ::Vector3> tilePositions;
+        for (const TileCache::TileKey& tileKey : missingTiles)
+        {
+            // Always sample at the exact grid positions so that the cached values don't depend on which query filled the tile.
+            TileCache::GetTilePositions(tileKey, tileKey.m_height, tilePositions);
+            AZStd::vector<float>& tileValues = filledTiles[tileKey];
+            tileValues.resize(tilePositions.size());
+            m_sampler.GetValues(tilePositions, tileValues);
+        }
+
+        // Copy the values out of the filled tiles, and gather up the positions that still need to be queried from the sampler.
+        AZStd::vector<size_t> uncachedIndices;
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            if (valueFound[index])
+            {
+                continue;
+            }
+
+            TileCache::TileKey tileKey;
+            size_t valueIndex = 0;
+            if (!filledTiles.empty() && TileCache::GetGridPoint(settings, positions[index], tileKey, valueIndex))
+            {
+                if (auto tileIter = filledTiles.find(tileKey); tileIter != filledTiles.end())
+                {
+                    outValues[index] = tileIter->second[valueIndex];
+                    continue;
+                }
+            }
+
+            uncachedIndices.push_back(index);
+        }
+
+        for (auto& [tileKey, tileValues] : filledTiles)
+        {
+            m_tileCache.StoreTile(tileKey, AZStd::move(tileValues), generation);
+        }
+
+        if (uncachedIndices.size() == positions.size())
+        {
+            m_sampler.GetValues(positions, outValues);
+        }
+        else if (!uncachedIndices.empty())
+        {
+            AZStd::vector<AZ::Vector3> uncachedPositions(uncachedIndices.size());
+            for (size_t index = 0; index < uncachedIndices.size(); index++)
+            {
+                uncachedPositions[index] = positions[uncachedIndices[index]];
+            }
+
+            AZStd::vector<float> uncachedValues(uncachedIndices.size());
+            m_sampler.GetValues(uncachedPositions, uncachedValues);
+
+            for (size_t index = 0; index < uncachedIndices.size(); index++)
+            {
+                outValues[uncachedIndices[index]] = uncachedValues[index];
+            }
+        }
+    }
+} // namespace GradientSignal
@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientProgram.h>
+#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/Util.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace GradientSignal
+{
+    namespace
+    {
+        struct GradientProgramRegisterFile
+        {
+            AZStd::vector<float> m_values;
+            AZStd::vector<AZ::Vector3> m_positions;
+        };
+
+        // Register files are reused by every Execute() call on a thread, so executing a program doesn't allocate once the thread has
+        // run a program with as many registers. A gradient sampled through the bus can execute its own program on the same thread,
+        // so every nested Execute() call gets its own register file.
+        thread_local AZStd::vector<AZStd::unique_ptr<GradientProgramRegisterFile>> t_registerFiles;
+        thread_local size_t t_registerFileDepth = 0;
+
+        class ScopedRegisterFile
+        {
+        public:
+            ScopedRegisterFile()
+            {
+                if (t_registerFileDepth == t_registerFiles.size())
+                {
+                    t_registerFiles.emplace_back(AZStd::make_unique<GradientProgramRegisterFile>());
+                }
+                m_registerFile = t_registerFiles[t_registerFileDepth++].get();
+            }
+
+            ~ScopedRegisterFile()
+            {
+                --t_registerFileDepth;
+            }
+
+            GradientProgramRegisterFile* operator->() const
+            {
+                return m_registerFile;
+            }
+
+        private:
+            GradientProgramRegisterFile* m_registerFile = nullptr;
+        };
+    } // namespace
+
+    bool GradientProgram::IsValid() const
+    {
+        return m_valid;
+    }
+
+    size_t GradientProgram::GetInstructionCount() const
+    {
+        return m_instructions.size();
+    }
+
+    void GradientProgram::Execute(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        if (!m_valid)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // The register file only ever holds a single tile, so it stays small enough to remain in cache regardless of query size.
+        // The input positions are read in place, so only positions produced by transforms need storage.
+        ScopedRegisterFile registerFile;
+        registerFile->m_values.resize(m_valueRegisterCount * TileSize);
+        registerFile->m_positions.resize((m_positionRegisterCount - 1) * TileSize);
+        AZStd::span<float> valueRegisters(registerFile->m_values);
+        AZStd::span<AZ::Vector3> positionRegisters(registerFile->m_positions);
+
+        for (size_t tileStart = 0; tileStart < positions.size(); tileStart += TileSize)
+        {
+            const size_t tileCount = AZStd::min(TileSize, positions.size() - tileStart);
+
+            auto GetValues = [valueRegisters, tileCount](GradientProgramRegister values)
+            {
+                return AZStd::span<float>(valueRegisters.data() + (values * TileSize), tileCount);
+            };
+
+            auto GetPositions = [positionRegisters, positions, tileStart, tileCount](GradientProgramRegister positionsRegister)
+            {
+                if (positionsRegister == InputPositions)
+                {
+                    return positions.subspan(tileStart, tileCount);
+                }
+                return AZStd::span<const AZ::Vector3>(positionRegisters.data() + ((positionsRegister - 1) * TileSize), tileCount);
+            };
+
+            for (const GradientProgramInstruction& instruction : m_instructions)
+            {
+                const float* params = instruction.m_params.data();
+
+                switch (instruction.m_op)
+                {
+                case GradientProgramOp::Fill:
+                {
+                    AZStd::span<float> values = GetValues(instruction.m_dst);
+                    AZStd::fill(values.begin(), values.end(), params[0]);
+                    break;
+                }
+                case GradientProgramOp::SampleGradient:
+                {
+                    // Gradients without a compiled form leave their output untouched if they can't be reached, so start from zero.
+                    AZStd::span<float> values = GetValues(instruction.m_dst);
+                    AZStd::fill(values.begin(), values.end(), 0.0f);
+                    GradientRequestBus::Event(
+                        m_entities[instruction.m_dataIndex], &GradientRequestBus::Events::GetValues, GetPositions(instruction.m_src), values);
+                    break;
+                }
+                case GradientProgramOp::TransformPositions:
+                {
+                    const AZ::Matrix3x4& matrix = m_matrices[instruction.m_dataIndex];
+                    AZStd::span<const AZ::Vector3> input = GetPositions(instruction.m_src);
+                    AZ::Vector3* output = positionRegisters.data() + ((instruction.m_dst - 1) * TileSize);
+                    for (size_t index = 0; index < tileCount; ++index)
+                    {
+                        output[index] = matrix * input[index];
+                    }
+                    break;
+                }
+                case GradientProgramOp::OneMinus:
+                    for (float& value : GetValues(instruction.m_dst))
+                    {
+                        value = 1.0f - value;
+                    }
+                    break;
+                case GradientProgramOp::Invert:
+                    for (float& value : GetValues(instruction.m_dst))
+                    {
+                        value = 1.0f - AZ::GetClamp(value, 0.0f, 1.0f);
+                    }
+                    break;
+                case GradientProgramOp::Scale:
+                    for (float& value : GetValues(instruction.m_dst))
+                    {
+                        value *= params[0];
+                    }
+                    break;
+                case GradientProgramOp::Clamp:
+                    for (float& value : GetValues(instruction.m_dst))
+                    {
+                        value = AZ::GetClamp(value, 0.0f, 1.0f);
+                    }
+                    break;
+                case GradientProgramOp::Levels:
+                    GetLevels(GetValues(instruction.m_dst), params[0], params[1], params[2], params[3], params[4]);
+                    break;
+                case GradientProgramOp::Threshold:
+                    for (float& value : GetValues(instruction.m_dst))
+                    {
+                        value = (value <= params[0]) ? 0.0f : 1.0f;
+                    }
+                    break;
+                case GradientProgramOp::Posterize:
+                {
+                    const auto mode = static_cast<PosterizeGradientConfig::ModeType>(instruction.m_mode);
+                    PosterizeGradientComponent::PosterizeValues(GetValues(instruction.m_dst), params[0], mode);
+                    break;
+                }
+                case GradientProgramOp::SmoothStep:
+                    m_smoothSteps[instruction.m_dataIndex].GetSmoothedValues(GetValues(instruction.m_dst));
+                    break;
+                case GradientProgramOp::Mix:
+                {
+                    const auto operation = static_cast<MixedGradientLayer::MixingOperation>(instruction.m_mode);
+                    const float opacity = params[0];
+
+                    // In the one case of "Initialize" blending, the accumulated values are erased rather than blended with.
+                    const float inverseOpacity = (operation == MixedGradientLayer::MixingOperation::Initialize) ? 0.0f : (1.0f - opacity);
+
+                    AZStd::span<float> accumulator = GetValues(instruction.m_dst);
+                    AZStd::span<float> layerValues = GetValues(instruction.m_src);
+                    for (size_t index = 0; index < tileCount; ++index)
+                    {
+                        const float currentUnpremultiplied = layerValues[index] / opacity;
+                        const float operationResult =
+                            MixedGradientComponent::PerformMixingOperation(operation, accumulator[index], currentUnpremultiplied);
+                        accumulator[index] = (accumulator[index] * inverseOpacity) + (operationResult * opacity);
+                    }
+                    break;
+                }
+                default:
+                    AZ_Assert(false, "Unknown gradient program op %u", aznumeric_cast<AZ::u32>(instruction.m_op));
+                    break;
+                }
+            }
+
+            AZStd::span<float> results = GetValues(m_outputRegister);
+            AZStd::copy(results.begin(), results.end(), outValues.begin() + tileStart);
+        }
+    }
+
+    GradientProgram GradientProgramBuilder::Compile(const GradientSampler& sampler)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        GradientProgramBuilder builder;
+        const GradientProgramRegister output = builder.AllocateValues();
+        builder.EmitSampler(sampler, GradientProgram::InputPositions, output);
+
+        builder.m_program.m_outputRegister = output;
+        builder.m_program.m_valid = !builder.m_failed;
+        return AZStd::move(builder.m_program);
+    }
+
+    GradientProgramRegister GradientProgramBuilder::AllocateValues()
+    {
+        if (!m_freeValueRegisters.empty())
+        {
+            const GradientProgramRegister values = m_freeValueRegisters.back();
+            m_freeValueRegisters.pop_back();
+            return values;
+        }
+        return m_program.m_valueRegisterCount++;
+    }
+
+    void GradientProgramBuilder::ReleaseValues(GradientProgramRegister values)
+    {
+        m_freeValueRegisters.push_back(values);
+    }
+
+    GradientProgramRegister GradientProgramBuilder::AllocatePositions()
+    {
+        return m_program.m_positionRegisterCount++;
+    }
+
+    void GradientProgramBuilder::EmitSampler(const GradientSampler& sampler, GradientProgramRegister positions, GradientProgramRegister output)
+    {
+        // This mirrors GradientSampler::GetValues()
+        if (sampler.m_opacity <= 0.0f || !sampler.m_gradientId.IsValid())
+        {
+            EmitFill(output, 0.0f);
+            return;
+        }
+
+        GradientProgramRegister samplePositions = positions;
+        if (sampler.m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(sampler))
+        {
+            // We use the inverse here because we're going from world space to gradient space.
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(sampler.m_rotate);
+            matrix3x4.MultiplyByScale(sampler.m_scale);
+            matrix3x4.SetTranslation(sampler.m_translate);
+
+            samplePositions = AllocatePositions();
+            GradientProgramInstruction& instruction = Emit(GradientProgramOp::TransformPositions, samplePositions);
+            instruction.m_src = positions;
+            instruction.m_dataIndex = aznumeric_cast<AZ::u16>(m_program.m_matrices.size());
+            m_program.m_matrices.push_back(matrix3x4.GetInverseFull());
+        }
+
+        EmitGradient(sampler.m_gradientId, samplePositions, output);
+
+        if (sampler.m_invertInput)
+        {
+            EmitOneMinus(output);
+        }
+
+        if (sampler.m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(sampler))
+        {
+            EmitLevels(output, sampler.m_inputMid, sampler.m_inputMin, sampler.m_inputMax, sampler.m_outputMin, sampler.m_outputMax);
+        }
+
+        if (sampler.m_opacity != 1.0f)
+        {
+            EmitScale(output, sampler.m_opacity);
+        }
+    }
+
+    void GradientProgramBuilder::EmitGradient(const AZ::EntityId& gradientId, GradientProgramRegister positions, GradientProgramRegister output)
+    {
+        if (AZStd::find(m_gradientStack.begin(), m_gradientStack.end(), gradientId) != m_gradientStack.end())
+        {
+            AZ_ErrorOnce("GradientSignal", false, "Detected cyclic dependencies with gradient entity references on entity id %s",
+                gradientId.ToString().c_str());
+            m_failed = true;
+            EmitFill(output, 0.0f);
+            return;
+        }
+
+        if (m_gradientStack.size() >= MaxHierarchyDepth)
+        {
+            m_failed = true;
+            EmitFill(output, 0.0f);
+            return;
+        }
+
+        m_gradientStack.push_back(gradientId);
+        bool compiled = false;
+        GradientRequestBus::EventResult(compiled, gradientId, &GradientRequestBus::Events::CompileGradient, *this, positions, output);
+        m_gradientStack.pop_back();
+
+        if (!compiled)
+        {
+            GradientProgramInstruction& instruction = Emit(GradientProgramOp::SampleGradient, output);
+            instruction.m_src = positions;
+            instruction.m_dataIndex = aznumeric_cast<AZ::u16>(m_program.m_entities.size());
+            m_program.m_entities.push_back(gradientId);
+        }
+    }
+
+    GradientProgramInstruction& GradientProgramBuilder::Emit(GradientProgramOp op, GradientProgramRegister dst)
+    {
+        GradientProgramInstruction& instruction = m_program.m_instructions.emplace_back();
+        instruction.m_op = op;
+        instruction.m_dst = dst;
+        return instruction;
+    }
+
+    void GradientProgramBuilder::EmitFill(GradientProgramRegister values, float value)
+    {
+        Emit(GradientProgramOp::Fill, values).m_params[0] = value;
+    }
+
+    void GradientProgramBuilder::EmitOneMinus(GradientProgramRegister values)
+    {
+        Emit(GradientProgramOp::OneMinus, values);
+    }
+
+    void GradientProgramBuilder::EmitInvert(GradientProgramRegister values)
+    {
+        Emit(GradientProgramOp::Invert, values);
+    }
+
+    void GradientProgramBuilder::EmitScale(GradientProgramRegister values, float scale)
+    {
+        Emit(GradientProgramOp::Scale, values).m_params[0] = scale;
+    }
+
+    void GradientProgramBuilder::EmitClamp(GradientProgramRegister values)
+    {
+        Emit(GradientProgramOp::Clamp, values);
+    }
+
+    void GradientProgramBuilder::EmitLevels(
+        GradientProgramRegister values, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        Emit(GradientProgramOp::Levels, values).m_params = { inputMid, inputMin, inputMax, outputMin, outputMax };
+    }
+
+    void GradientProgramBuilder::EmitThreshold(GradientProgramRegister values, float threshold)
+    {
+        Emit(GradientProgramOp::Threshold, values).m_params[0] = threshold;
+    }
+
+    void GradientProgramBuilder::EmitPosterize(GradientProgramRegister values, float bands, PosterizeGradientConfig::ModeType mode)
+    {
+        GradientProgramInstruction& instruction = Emit(GradientProgramOp::Posterize, values);
+        instruction.m_mode = static_cast<AZ::u8>(mode);
+        instruction.m_params[0] = bands;
+    }
+
+    void GradientProgramBuilder::EmitSmoothStep(GradientProgramRegister values, const SmoothStep& smoothStep)
+    {
+        GradientProgramInstruction& instruction = Emit(GradientProgramOp::SmoothStep, values);
+        instruction.m_dataIndex = aznumeric_cast<AZ::u16>(m_program.m_smoothSteps.size());
+        m_program.m_smoothSteps.push_back(smoothStep);
+    }
+
+    void GradientProgramBuilder::EmitMix(
+        GradientProgramRegister accumulator, GradientProgramRegister layerValues, MixedGradientLayer::MixingOperation operation, float opacity)
+    {
+        GradientProgramInstruction& instruction = Emit(GradientProgramOp::Mix, accumulator);
+        instruction.m_src = layerValues;
+        instruction.m_mode = static_cast<AZ::u8>(operation);
+        instruction.m_params[0] = opacity;
+    }
+} // namespace GradientSignal
@@ -60,6 +60,42 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        using Vec4 = AZ::Simd::Vec4;
+
+        // Branchless version of Gradient() for 4 hashes at once. Ken Perlin's reference implementation selects the gradient
+        // vector with the bits of the hash, which produces exactly the table in Gradient() above.
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+
+            // u = (h < 8) ? x : y
+            const Vec4::FloatType hLessThan8 = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(8)));
+            const Vec4::FloatType u = Vec4::Select(x, y, hLessThan8);
+
+            // v = (h < 4) ? y : ((h == 12 || h == 14) ? x : z)
+            const Vec4::FloatType hLessThan4 = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(4)));
+            const Vec4::FloatType hIs12Or14 = Vec4::CastToFloat(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(0xD)), Vec4::Splat(12)));
+            const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, hIs12Or14), hLessThan4);
+
+            // Bit 0 of the hash negates u, and bit 1 negates v.
+            const Vec4::FloatType negateU = Vec4::CastToFloat(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(1)), Vec4::Splat(1)));
+            const Vec4::FloatType negateV = Vec4::CastToFloat(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(2)), Vec4::Splat(2)));
+            const Vec4::FloatType signMask = Vec4::CastToFloat(Vec4::Splat(static_cast<int32_t>(0x80000000)));
+            return Vec4::Add(Vec4::Xor(u, Vec4::And(negateU, signMask)), Vec4::Xor(v, Vec4::And(negateV, signMask)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            // t * t * t * (t * (t * 6 - 15) + 10)
+            const Vec4::FloatType inner = Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f));
+            return Vec4::Mul(Vec4::Mul(Vec4::Mul(t, t), t), inner);
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +128,67 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, int octaves, float persistence, float initialFrequency, AZStd::span<float> outValues)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        // The amplitude of every octave is the same for all positions, so the normalization factor only needs computing once.
+        float maxValue = 0.0f;
+        {
+            float amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                maxValue += amplitude;
+                amplitude *= persistence;
+            }
+        }
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        const size_t batchedCount = positions.size() & ~size_t(3);
+        for (size_t index = 0; index < batchedCount; index += 4)
+        {
+            const AZ::Vector3& p0 = positions[index];
+            const AZ::Vector3& p1 = positions[index + 1];
+            const AZ::Vector3& p2 = positions[index + 2];
+            const AZ::Vector3& p3 = positions[index + 3];
+            const Vec4::FloatType x = Vec4::LoadImmediate(p0.GetX(), p1.GetX(), p2.GetX(), p3.GetX());
+            const Vec4::FloatType y = Vec4::LoadImmediate(p0.GetY(), p1.GetY(), p2.GetY(), p3.GetY());
+            const Vec4::FloatType z = Vec4::LoadImmediate(p0.GetZ(), p1.GetZ(), p2.GetZ(), p3.GetZ());
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencySplat = Vec4::Splat(frequency);
+                const Vec4::FloatType noise =
+                    GenerateNoise(Vec4::Mul(x, frequencySplat), Vec4::Mul(y, frequencySplat), Vec4::Mul(z, frequencySplat));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+            Vec4::StoreUnaligned(&outValues[index], Vec4::Div(total, Vec4::Splat(maxValue)));
+        }
+
+        for (size_t index = batchedCount; index < positions.size(); ++index)
+        {
+            const AZ::Vector3& position = positions[index];
+            outValues[index] =
+                GenerateOctaveNoise(position.GetX(), position.GetY(), position.GetZ(), octaves, persistence, initialFrequency);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -138,6 +235,72 @@ namespace GradientSignal
         return (PerlinImprovedNoiseDetails::Lerp(y1, y2, w) + 1.0f) / 2.0f;
     }
 
+    AZ::Simd::Vec4::FloatType PerlinImprovedNoise::GenerateNoise(
+        AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        // This is the same algorithm as the scalar GenerateNoise() above, see there for details.
+        const Vec4::FloatType floorX = Vec4::Floor(x);
+        const Vec4::FloatType floorY = Vec4::Floor(y);
+        const Vec4::FloatType floorZ = Vec4::Floor(z);
+        const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+        const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+        const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+
+        const Vec4::Int32Type mask255 = Vec4::Splat(255);
+        alignas(16) int32_t xi0[4];
+        alignas(16) int32_t yi0[4];
+        alignas(16) int32_t zi0[4];
+        Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), mask255));
+        Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), mask255));
+        Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), mask255));
+
+        // There's no gather instruction available on every platform, so the permutation table lookups are done per lane.
+        const AZStd::array<int, 512>& p = m_permutationTable;
+        alignas(16) int32_t hashes[8][4];
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const int a = p[xi0[lane]];
+            const int b = p[xi0[lane] + 1];
+            const int aa = p[a + yi0[lane]];
+            const int ab = p[a + yi0[lane] + 1];
+            const int ba = p[b + yi0[lane]];
+            const int bb = p[b + yi0[lane] + 1];
+            hashes[0][lane] = p[aa + zi0[lane]];     // aaa
+            hashes[1][lane] = p[ba + zi0[lane]];     // baa
+            hashes[2][lane] = p[ab + zi0[lane]];     // aba
+            hashes[3][lane] = p[bb + zi0[lane]];     // bba
+            hashes[4][lane] = p[aa + zi0[lane] + 1]; // aab
+            hashes[5][lane] = p[ba + zi0[lane] + 1]; // bab
+            hashes[6][lane] = p[ab + zi0[lane] + 1]; // abb
+            hashes[7][lane] = p[bb + zi0[lane] + 1]; // bbb
+        }
+
+        const Vec4::FloatType u = PerlinImprovedNoiseDetails::Fade(xf);
+        const Vec4::FloatType v = PerlinImprovedNoiseDetails::Fade(yf);
+        const Vec4::FloatType w = PerlinImprovedNoiseDetails::Fade(zf);
+
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+        const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+        const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+        auto gradient = [&hashes](int corner, Vec4::FloatArgType gx, Vec4::FloatArgType gy, Vec4::FloatArgType gz)
+        {
+            return PerlinImprovedNoiseDetails::Gradient(Vec4::LoadAligned(hashes[corner]), gx, gy, gz);
+        };
+
+        Vec4::FloatType x1 = PerlinImprovedNoiseDetails::Lerp(gradient(0, xf, yf, zf), gradient(1, xf1, yf, zf), u);
+        Vec4::FloatType x2 = PerlinImprovedNoiseDetails::Lerp(gradient(2, xf, yf1, zf), gradient(3, xf1, yf1, zf), u);
+        const Vec4::FloatType y1 = PerlinImprovedNoiseDetails::Lerp(x1, x2, v);
+        x1 = PerlinImprovedNoiseDetails::Lerp(gradient(4, xf, yf, zf1), gradient(5, xf1, yf, zf1), u);
+        x2 = PerlinImprovedNoiseDetails::Lerp(gradient(6, xf, yf1, zf1), gradient(7, xf1, yf1, zf1), u);
+        const Vec4::FloatType y2 = PerlinImprovedNoiseDetails::Lerp(x1, x2, v);
+
+        return Vec4::Mul(Vec4::Add(PerlinImprovedNoiseDetails::Lerp(y1, y2, w), one), Vec4::Splat(0.5f));
+    }
+
     void PerlinImprovedNoise::PrepareTable(int seed)
     {
         AZStd::array<int, 256> randtable;
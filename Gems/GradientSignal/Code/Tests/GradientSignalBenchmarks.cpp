@@ -20,6 +20,10 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <GradientSignal/Components/ConstantGradientComponent.h>
 #include <GradientSignal/Components/GradientSurfaceDataComponent.h>
+#include <GradientSignal/Components/ImageGradientComponent.h>
+#include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/PerlinImprovedNoise.h>
+#include <GradientSignal/SmoothStep.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
@@ -134,6 +138,20 @@ namespace UnitTest
         GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entity->GetId());
     }
 
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_ModifierChainGradient)(benchmark::State& state)
+    {
+        // Chain several modifiers together to measure the cost of the intermediate buffers in deep gradient hierarchies.
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto mixedChainEntity = BuildTestMixedGradient(TestShapeHalfBounds, smoothStepEntity->GetId(), mixedEntity->GetId());
+        auto posterizeEntity = BuildTestPosterizeGradient(TestShapeHalfBounds, mixedChainEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, posterizeEntity->GetId());
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, invertEntity->GetId());
+        GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entity->GetId());
+    }
+
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_DitherGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_InvertGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_LevelsGradient);
@@ -142,6 +160,7 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ReferenceGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SmoothStepGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ThresholdGradient);
+    GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ModifierChainGradient);
 
     // --------------------------------------------------------------------------------------
     // Surface Gradients
@@ -168,6 +187,196 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceMaskGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceSlopeGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Gradient Kernels
+
+    class GradientKernels : public GradientSignalBenchmarkFixture
+    {
+    public:
+        // Each kernel benchmark runs once through the single value version of the kernel and once through the batched SIMD version.
+        enum KernelPermutation : int64_t
+        {
+            SCALAR,
+            SIMD,
+        };
+
+        static AZStd::vector<AZ::Vector3> CreatePositions(int64_t count)
+        {
+            AZStd::vector<AZ::Vector3> positions(count);
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                const float x = aznumeric_cast<float>(index % 1024);
+                const float y = aznumeric_cast<float>(index / 1024);
+                positions[index] = AZ::Vector3(x * 0.1f, y * 0.1f, 0.0f);
+            }
+            return positions;
+        }
+
+        static AZStd::vector<float> CreateValues(int64_t count)
+        {
+            AZStd::vector<float> values(count);
+            for (size_t index = 0; index < values.size(); ++index)
+            {
+                values[index] = aznumeric_cast<float>(index % 1024) / 1023.0f;
+            }
+            return values;
+        }
+
+        // Runs an image gradient with the given filtering through GetValue one point at a time, or through the batched GetValues.
+        void RunImageGradientFilterBenchmark(benchmark::State& state, GradientSignal::SamplingType samplingType)
+        {
+            auto entity = BuildTestImageGradient(TestShapeHalfBounds, samplingType);
+            const auto* imageGradient = entity->FindComponent<GradientSignal::ImageGradientComponent>();
+            const AZStd::vector<AZ::Vector3> positions = CreatePositions(state.range(1));
+            AZStd::vector<float> results(positions.size());
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                if (state.range(0) == KernelPermutation::SCALAR)
+                {
+                    GradientSignal::GradientSampleParams sampleParams;
+                    for (size_t index = 0; index < positions.size(); ++index)
+                    {
+                        sampleParams.m_position = positions[index];
+                        results[index] = imageGradient->GetValue(sampleParams);
+                    }
+                }
+                else
+                {
+                    imageGradient->GetValues(positions, results);
+                }
+                benchmark::DoNotOptimize(results);
+            }
+        }
+
+        // The positions from CreatePositions() fall within this range.
+        const float TestShapeHalfBounds = 128.0f;
+    };
+
+#ifndef GRADIENT_SIGNAL_KERNEL_BENCHMARK_REGISTER_F
+#define GRADIENT_SIGNAL_KERNEL_BENCHMARK_REGISTER_F(Fixture, Func)                                                                        \
+    BENCHMARK_REGISTER_F(Fixture, Func)                                                                                                   \
+        ->Args({ GradientKernels::KernelPermutation::SCALAR, 1024 * 1024 })                                                              \
+        ->ArgNames({ "Scalar", "size" })                                                                                                  \
+        ->Unit(::benchmark::kMillisecond);                                                                                                \
+    BENCHMARK_REGISTER_F(Fixture, Func)                                                                                                   \
+        ->Args({ GradientKernels::KernelPermutation::SIMD, 1024 * 1024 })                                                                \
+        ->ArgNames({ "Simd", "size" })                                                                                                    \
+        ->Unit(::benchmark::kMillisecond);
+#endif
+
+    BENCHMARK_DEFINE_F(GradientKernels, BM_PerlinNoise)(benchmark::State& state)
+    {
+        GradientSignal::PerlinImprovedNoise perlinNoise(1);
+        const AZStd::vector<AZ::Vector3> positions = CreatePositions(state.range(1));
+        AZStd::vector<float> results(positions.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (state.range(0) == KernelPermutation::SCALAR)
+            {
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    results[index] = perlinNoise.GenerateOctaveNoise(
+                        positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), 4, 0.5f, 1.0f);
+                }
+            }
+            else
+            {
+                perlinNoise.GenerateOctaveNoise(positions, 4, 0.5f, 1.0f, results);
+            }
+            benchmark::DoNotOptimize(results);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(GradientKernels, BM_SmoothStep)(benchmark::State& state)
+    {
+        GradientSignal::SmoothStep smoothStep;
+        const AZStd::vector<float> values = CreateValues(state.range(1));
+        AZStd::vector<float> results(values.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (state.range(0) == KernelPermutation::SCALAR)
+            {
+                for (size_t index = 0; index < values.size(); ++index)
+                {
+                    results[index] = smoothStep.GetSmoothedValue(values[index]);
+                }
+            }
+            else
+            {
+                results = values;
+                smoothStep.GetSmoothedValues(results);
+            }
+            benchmark::DoNotOptimize(results);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(GradientKernels, BM_Levels)(benchmark::State& state)
+    {
+        const AZStd::vector<float> values = CreateValues(state.range(1));
+        AZStd::vector<float> results(values.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (state.range(0) == KernelPermutation::SCALAR)
+            {
+                for (size_t index = 0; index < values.size(); ++index)
+                {
+                    results[index] = GradientSignal::GetLevels(values[index], 1.0f, 0.1f, 0.9f, 0.0f, 1.0f);
+                }
+            }
+            else
+            {
+                results = values;
+                GradientSignal::GetLevels(results, 1.0f, 0.1f, 0.9f, 0.0f, 1.0f);
+            }
+            benchmark::DoNotOptimize(results);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(GradientKernels, BM_Posterize)(benchmark::State& state)
+    {
+        const AZStd::vector<float> values = CreateValues(state.range(1));
+        AZStd::vector<float> results(values.size());
+        constexpr auto mode = GradientSignal::PosterizeGradientConfig::ModeType::Round;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (state.range(0) == KernelPermutation::SCALAR)
+            {
+                for (size_t index = 0; index < values.size(); ++index)
+                {
+                    results[index] = GradientSignal::PosterizeGradientComponent::PosterizeValue(values[index], 5.0f, mode);
+                }
+            }
+            else
+            {
+                results = values;
+                GradientSignal::PosterizeGradientComponent::PosterizeValues(results, 5.0f, mode);
+            }
+            benchmark::DoNotOptimize(results);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(GradientKernels, BM_ImageBilinearFilter)(benchmark::State& state)
+    {
+        RunImageGradientFilterBenchmark(state, GradientSignal::SamplingType::Bilinear);
+    }
+
+    BENCHMARK_DEFINE_F(GradientKernels, BM_ImageBicubicFilter)(benchmark::State& state)
+    {
+        RunImageGradientFilterBenchmark(state, GradientSignal::SamplingType::Bicubic);
+    }
+
+    GRADIENT_SIGNAL_KERNEL_BENCHMARK_REGISTER_F(GradientKernels, BM_PerlinNoise);
+    GRADIENT_SIGNAL_KERNEL_BENCHMARK_REGISTER_F(GradientKernels, BM_SmoothStep);
+    GRADIENT_SIGNAL_KERNEL_BENCHMARK_REGISTER_F(GradientKernels, BM_Levels);
+    GRADIENT_SIGNAL_KERNEL_BENCHMARK_REGISTER_F(GradientKernels, BM_Posterize);
+    GRADIENT_SIGNAL_KERNEL_BENCHMARK_REGISTER_F(GradientKernels, BM_ImageBilinearFilter);
+    GRADIENT_SIGNAL_KERNEL_BENCHMARK_REGISTER_F(GradientKernels, BM_ImageBicubicFilter);
+
     // --------------------------------------------------------------------------------------
     // Gradient Surface Data
 
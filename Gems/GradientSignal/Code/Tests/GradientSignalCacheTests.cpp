@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <Tests/GradientSignalTestFixtures.h>
+#include <AzTest/AzTest.h>
+#include <GradientSignal/Ebuses/ConstantGradientRequestBus.h>
+#include <GradientSignal/GradientCache.h>
+
+namespace UnitTest
+{
+    struct GradientSignalCacheTestsFixture
+        : public GradientSignalTest
+    {
+        const float TestShapeHalfBounds = 100.0f;
+
+        GradientSignal::GradientSampler CreateSampler(const AZ::EntityId& gradientId)
+        {
+            GradientSignal::GradientSampler gradientSampler;
+            gradientSampler.m_gradientId = gradientId;
+            return gradientSampler;
+        }
+
+        // Creates a grid of positions starting at the given point, computed the same way that most callers compute query grids.
+        AZStd::vector<AZ::Vector3> CreateGridPositions(const AZ::Vector3& start, size_t numPoints, float sampleSpacing)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            positions.reserve(numPoints * numPoints);
+            for (size_t yIndex = 0; yIndex < numPoints; yIndex++)
+            {
+                for (size_t xIndex = 0; xIndex < numPoints; xIndex++)
+                {
+                    positions.emplace_back(
+                        start.GetX() + (xIndex * sampleSpacing), start.GetY() + (yIndex * sampleSpacing), start.GetZ());
+                }
+            }
+            return positions;
+        }
+
+        void CompareSamplerAndCache(
+            const GradientSignal::GradientSampler& gradientSampler,
+            const GradientSignal::GradientCache& gradientCache,
+            AZStd::span<const AZ::Vector3> positions,
+            float sampleSpacing)
+        {
+            AZStd::vector<float> expectedResults(positions.size());
+            gradientSampler.GetValues(positions, expectedResults);
+
+            AZStd::vector<float> cachedResults(positions.size(), -1.0f);
+            gradientCache.GetValues(positions, cachedResults, sampleSpacing);
+
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                ASSERT_NEAR(expectedResults[index], cachedResults[index], 0.000001f);
+            }
+        }
+    };
+
+    TEST_F(GradientSignalCacheTestsFixture, CachedValues_MatchSampler)
+    {
+        auto entity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        GradientSignal::GradientSampler gradientSampler = CreateSampler(entity->GetId());
+        GradientSignal::GradientCache gradientCache(gradientSampler);
+
+        // Query the same regions twice so that both the uncached and the cached values are compared. The regions include negative
+        // positions and aren't aligned to the cache tiles.
+        for (float sampleSpacing : { 1.0f, 0.5f })
+        {
+            auto positions = CreateGridPositions(AZ::Vector3(-45.0f, -13.0f, 0.0f), 70, sampleSpacing);
+            CompareSamplerAndCache(gradientSampler, gradientCache, positions, sampleSpacing);
+            CompareSamplerAndCache(gradientSampler, gradientCache, positions, sampleSpacing);
+        }
+        EXPECT_GT(gradientCache.GetTileCount(), 0u);
+
+        // Positions that don't lie on the grid should get passed through to the sampler.
+        auto offGridPositions = CreateGridPositions(AZ::Vector3(0.25f, 0.3f, 0.0f), 10, 1.0f);
+        CompareSamplerAndCache(gradientSampler, gradientCache, offGridPositions, 1.0f);
+    }
+
+    TEST_F(GradientSignalCacheTestsFixture, LeastRecentlyUsedTiles_AreEvicted)
+    {
+        auto entity = BuildTestRandomGradient(TestShapeHalfBounds);
+        GradientSignal::GradientSampler gradientSampler = CreateSampler(entity->GetId());
+        GradientSignal::GradientCache gradientCache(gradientSampler, 2);
+
+        // A few positions aren't enough to fill a tile.
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(1.0f, 0.0f, 0.0f) };
+        CompareSamplerAndCache(gradientSampler, gradientCache, positions, 1.0f);
+        EXPECT_EQ(gradientCache.GetTileCount(), 0u);
+
+        // A full row of positions in each of three tiles fills them, but only two of them fit in the cache.
+        positions = CreateGridPositions(AZ::Vector3(0.0f), GradientSignal::GradientCache::TileSize * 3, 1.0f);
+        positions.resize(GradientSignal::GradientCache::TileSize * 3);
+        CompareSamplerAndCache(gradientSampler, gradientCache, positions, 1.0f);
+        EXPECT_EQ(gradientCache.GetTileCount(), 2u);
+
+        gradientCache.SetMaxTiles(1);
+        EXPECT_EQ(gradientCache.GetTileCount(), 1u);
+
+        // Values should still be correct after their tiles have been evicted.
+        CompareSamplerAndCache(gradientSampler, gradientCache, positions, 1.0f);
+        EXPECT_EQ(gradientCache.GetTileCount(), 1u);
+    }
+
+    TEST_F(GradientSignalCacheTestsFixture, DirtyRegion_InvalidatesOverlappingTiles)
+    {
+        auto entity = BuildTestRandomGradient(TestShapeHalfBounds);
+        GradientSignal::GradientCache gradientCache(CreateSampler(entity->GetId()));
+
+        // Fill a 2 x 2 block of tiles.
+        const float tileWorldSize = aznumeric_cast<float>(GradientSignal::GradientCache::TileSize);
+        auto positions = CreateGridPositions(AZ::Vector3(0.0f), GradientSignal::GradientCache::TileSize * 2, 1.0f);
+        AZStd::vector<float> results(positions.size());
+        gradientCache.GetValues(positions, results, 1.0f);
+        EXPECT_EQ(gradientCache.GetTileCount(), 4u);
+
+        // A dirty region inside the first tile only removes that tile.
+        LmbrCentral::DependencyNotificationBus::Event(
+            entity->GetId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionRegionChanged,
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(1.0f, 1.0f, -10.0f), AZ::Vector3(2.0f, 2.0f, 10.0f)));
+        EXPECT_EQ(gradientCache.GetTileCount(), 3u);
+
+        // A dirty region spanning the boundary between the remaining tiles removes both of them.
+        gradientCache.InvalidateRegion(AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(tileWorldSize - 1.0f, tileWorldSize - 1.0f, 0.0f), AZ::Vector3(tileWorldSize + 1.0f, tileWorldSize + 1.0f, 0.0f)));
+        EXPECT_EQ(gradientCache.GetTileCount(), 0u);
+
+        // An invalid region means the entire gradient changed.
+        gradientCache.GetValues(positions, results, 1.0f);
+        EXPECT_EQ(gradientCache.GetTileCount(), 4u);
+        gradientCache.InvalidateRegion(AZ::Aabb::CreateNull());
+        EXPECT_EQ(gradientCache.GetTileCount(), 0u);
+    }
+
+    TEST_F(GradientSignalCacheTestsFixture, GradientChange_InvalidatesCache)
+    {
+        auto entity = BuildTestConstantGradient(TestShapeHalfBounds, 0.25f);
+        GradientSignal::GradientCache gradientCache(CreateSampler(entity->GetId()));
+
+        auto positions = CreateGridPositions(AZ::Vector3(0.0f), 8, 1.0f);
+        AZStd::vector<float> results(positions.size());
+        gradientCache.GetValues(positions, results, 1.0f);
+        EXPECT_EQ(results[0], 0.25f);
+
+        // Changing the constant value notifies the DependencyNotificationBus, which should clear the cached tiles.
+        GradientSignal::ConstantGradientRequestBus::Event(
+            entity->GetId(), &GradientSignal::ConstantGradientRequestBus::Events::SetConstantValue, 0.5f);
+        EXPECT_EQ(gradientCache.GetTileCount(), 0u);
+
+        gradientCache.GetValues(positions, results, 1.0f);
+        for (float result : results)
+        {
+            EXPECT_EQ(result, 0.5f);
+        }
+    }
+}
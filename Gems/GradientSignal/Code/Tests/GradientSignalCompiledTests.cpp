@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <Tests/GradientSignalTestFixtures.h>
+#include <Tests/GradientSignalTestHelpers.h>
+#include <AzTest/AzTest.h>
+#include <GradientSignal/CompiledGradient.h>
+#include <GradientSignal/Components/ReferenceGradientComponent.h>
+#include <GradientSignal/Ebuses/ThresholdGradientRequestBus.h>
+
+namespace UnitTest
+{
+    struct GradientSignalCompiledTestsFixture
+        : public GradientSignalTest
+    {
+        // Create an arbitrary size shape for comparing values within. The query region is deliberately not a multiple of the
+        // program tile size so that partial tiles get verified as well.
+        const float TestShapeHalfBounds = 50.0f;
+
+        GradientSignal::GradientSampler CreateSampler(const AZ::EntityId& gradientId)
+        {
+            GradientSignal::GradientSampler gradientSampler;
+            gradientSampler.m_gradientId = gradientId;
+            return gradientSampler;
+        }
+    };
+
+    TEST_F(GradientSignalCompiledTestsFixture, ModifierChain_VerifySamplerAndCompiledMatch)
+    {
+        // Chain every compilable modifier together on top of a gradient that can't be compiled.
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto posterizeEntity = BuildTestPosterizeGradient(TestShapeHalfBounds, smoothStepEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, posterizeEntity->GetId());
+        auto referenceEntity = BuildTestReferenceGradient(TestShapeHalfBounds, invertEntity->GetId());
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, referenceEntity->GetId());
+
+        GradientSignalTestHelpers::CompareSamplerAndCompiledGetValues(CreateSampler(entity->GetId()), 0.0f, TestShapeHalfBounds * 2.0f);
+        GradientSignalTestHelpers::CompareSamplerAndCompiledGetValues(
+            CreateSampler(posterizeEntity->GetId()), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, MixedGradient_VerifySamplerAndCompiledMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, baseEntity->GetId(), mixedEntity->GetId());
+
+        GradientSignalTestHelpers::CompareSamplerAndCompiledGetValues(CreateSampler(entity->GetId()), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, SamplerSettings_VerifySamplerAndCompiledMatch)
+    {
+        // The sampler's own transform, invert, levels and opacity settings are compiled into the program too.
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestSmoothStepGradient(TestShapeHalfBounds, baseEntity->GetId());
+
+        GradientSignal::GradientSampler gradientSampler = CreateSampler(entity->GetId());
+        gradientSampler.m_opacity = 0.5f;
+        gradientSampler.m_invertInput = true;
+        gradientSampler.m_enableTransform = true;
+        gradientSampler.m_translate = AZ::Vector3(3.0f, -7.0f, 0.0f);
+        gradientSampler.m_rotate = AZ::Vector3(0.0f, 0.0f, 30.0f);
+        gradientSampler.m_scale = AZ::Vector3(2.0f, 0.5f, 1.0f);
+        gradientSampler.m_enableLevels = true;
+        gradientSampler.m_inputMid = 0.8f;
+        gradientSampler.m_inputMin = 0.1f;
+        gradientSampler.m_outputMax = 0.9f;
+
+        GradientSignalTestHelpers::CompareSamplerAndCompiledGetValues(gradientSampler, 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, CompiledGradient_RecompilesOnDependencyChange)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, baseEntity->GetId());
+
+        GradientSignal::CompiledGradient compiledGradient(CreateSampler(entity->GetId()));
+        auto program = compiledGradient.GetProgram();
+        EXPECT_TRUE(program->IsValid());
+        EXPECT_EQ(program, compiledGradient.GetProgram());
+
+        // Changing the threshold notifies the DependencyNotificationBus, which should cause the program to be rebuilt with the
+        // new threshold on the next query.
+        GradientSignal::ThresholdGradientRequestBus::Event(
+            entity->GetId(), &GradientSignal::ThresholdGradientRequestBus::Events::SetThreshold, 1.0f);
+        EXPECT_NE(program, compiledGradient.GetProgram());
+
+        AZStd::vector<AZ::Vector3> positions(GradientSignal::GradientProgram::TileSize + 1, AZ::Vector3(1.0f, 2.0f, 0.0f));
+        AZStd::vector<float> results(positions.size(), -1.0f);
+        compiledGradient.GetValues(positions, results);
+        for (float result : results)
+        {
+            EXPECT_EQ(result, 0.0f);
+        }
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, CyclicHierarchy_FailsToCompile)
+    {
+        // Create a Reference Gradient that points back at itself. Compilation should detect the cycle and fall back to the sampler.
+        auto entity = CreateTestEntity(TestShapeHalfBounds);
+        GradientSignal::ReferenceGradientConfig config;
+        config.m_gradientSampler.m_gradientId = entity->GetId();
+        entity->CreateComponent<GradientSignal::ReferenceGradientComponent>(config);
+        ActivateEntity(entity.get());
+
+        GradientSignal::CompiledGradient compiledGradient(CreateSampler(entity->GetId()));
+        EXPECT_FALSE(compiledGradient.GetProgram()->IsValid());
+    }
+}
@@ -10,6 +10,9 @@
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/PerlinImprovedNoise.h>
+#include <GradientSignal/SmoothStep.h>
 
 namespace UnitTest
 {
@@ -128,6 +131,105 @@ namespace UnitTest
         auto entity = BuildTestSurfaceSlopeGradient(TestShapeHalfBounds);
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
+
+    // The batched kernels process values 4 at a time with SIMD math. These use value counts that aren't a multiple of 4 so that
+    // both the SIMD and the remainder code paths are compared against the single value versions of the kernels.
+
+    static AZStd::vector<float> CreateKernelTestValues()
+    {
+        AZStd::vector<float> values(1031);
+        for (size_t index = 0; index < values.size(); ++index)
+        {
+            // Include values slightly outside of the 0-1 range to verify the clamping.
+            values[index] = (aznumeric_cast<float>(index % 101) / 90.0f) - 0.05f;
+        }
+        return values;
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, PerlinImprovedNoise_VerifyScalarAndBatchMatch)
+    {
+        GradientSignal::PerlinImprovedNoise perlinNoise(1234);
+
+        AZStd::vector<AZ::Vector3> positions(1031);
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const float indexFloat = aznumeric_cast<float>(index);
+            positions[index] = AZ::Vector3((indexFloat * 0.37f) - 100.0f, (indexFloat * -0.11f) + 3.0f, indexFloat * 0.05f);
+        }
+
+        AZStd::vector<float> results(positions.size());
+        perlinNoise.GenerateOctaveNoise(positions, 4, 0.5f, 0.7f, results);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const float value = perlinNoise.GenerateOctaveNoise(
+                positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), 4, 0.5f, 0.7f);
+            ASSERT_NEAR(value, results[index], 0.000001f);
+        }
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, SmoothStep_VerifyScalarAndBatchMatch)
+    {
+        const AZStd::vector<float> values = CreateKernelTestValues();
+
+        // A falloff strength of 0 uses a separate code path for the ratio calculation.
+        for (float falloffStrength : { 0.0f, 0.25f })
+        {
+            GradientSignal::SmoothStep smoothStep;
+            smoothStep.m_falloffMidpoint = 0.4f;
+            smoothStep.m_falloffStrength = falloffStrength;
+
+            AZStd::vector<float> results = values;
+            smoothStep.GetSmoothedValues(results);
+
+            for (size_t index = 0; index < values.size(); ++index)
+            {
+                ASSERT_NEAR(smoothStep.GetSmoothedValue(values[index]), results[index], 0.000001f);
+            }
+        }
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, Levels_VerifyScalarAndBatchMatch)
+    {
+        const AZStd::vector<float> values = CreateKernelTestValues();
+
+        // Verify the default midpoint, a non-default midpoint, and an empty input range.
+        const AZStd::array<AZStd::array<float, 5>, 3> levelsParams = { {
+            { 1.0f, 0.1f, 0.9f, 0.2f, 0.8f },
+            { 0.7f, 0.1f, 0.9f, 0.2f, 0.8f },
+            { 1.0f, 0.4f, 0.4f, 0.2f, 0.8f },
+        } };
+
+        for (const auto& params : levelsParams)
+        {
+            AZStd::vector<float> results = values;
+            GradientSignal::GetLevels(results, params[0], params[1], params[2], params[3], params[4]);
+
+            for (size_t index = 0; index < values.size(); ++index)
+            {
+                const float value = GradientSignal::GetLevels(values[index], params[0], params[1], params[2], params[3], params[4]);
+                ASSERT_NEAR(value, results[index], 0.000001f);
+            }
+        }
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, Posterize_VerifyScalarAndBatchMatch)
+    {
+        const AZStd::vector<float> values = CreateKernelTestValues();
+
+        using ModeType = GradientSignal::PosterizeGradientConfig::ModeType;
+        for (ModeType mode : { ModeType::Floor, ModeType::Round, ModeType::Ceiling, ModeType::Ps })
+        {
+            AZStd::vector<float> results = values;
+            GradientSignal::PosterizeGradientComponent::PosterizeValues(results, 5.0f, mode);
+
+            for (size_t index = 0; index < values.size(); ++index)
+            {
+                const float value = GradientSignal::PosterizeGradientComponent::PosterizeValue(values[index], 5.0f, mode);
+                ASSERT_NEAR(value, results[index], 0.000001f);
+            }
+        }
+    }
 }
 
 
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <gmock/gmock.h>
+
+#include <GradientSignal/GridTileCache.h>
+
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    class GridTileCacheTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        using TileCache = GradientSignal::GridTileCache<float>;
+
+        static constexpr float QueryResolution = 0.5f;
+
+        static TileCache::LookupSettings GetLookupSettings()
+        {
+            TileCache::LookupSettings settings;
+            settings.m_sampleSpacing = QueryResolution;
+            settings.m_reserveMissingTiles = true;
+            return settings;
+        }
+
+        // Bakes a tile by giving every grid point a value computed from its position.
+        static void BakeTile(TileCache& cache, const TileCache::TileKey& key, AZ::u64 generation)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            TileCache::GetTilePositions(key, 0.0f, positions);
+
+            AZStd::vector<float> samples(positions.size());
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                samples[index] = GetExpectedValue(positions[index]);
+            }
+            cache.StoreTile(key, AZStd::move(samples), generation);
+        }
+
+        static float GetExpectedValue(const AZ::Vector3& position)
+        {
+            return (position.GetX() * 1000.0f) + position.GetY();
+        }
+
+        // Looks up the positions and bakes every tile that the cache requests.
+        static void LookupAndBake(TileCache& cache, const AZStd::vector<AZ::Vector3>& positions)
+        {
+            AZStd::vector<float> samples(positions.size());
+            AZStd::vector<bool> found(positions.size());
+            AZStd::vector<TileCache::TileKey> tilesToBake;
+            AZ::u64 generation = cache.Lookup(GetLookupSettings(), positions, samples, found, tilesToBake);
+            for (auto& tileKey : tilesToBake)
+            {
+                BakeTile(cache, tileKey, generation);
+            }
+        }
+    };
+
+    TEST_F(GridTileCacheTests, BakedTiles_ReturnCachedSamplesForGridPositions)
+    {
+        TileCache cache;
+        cache.SetMaxTiles(16);
+
+        // Include negative positions and positions on both sides of a tile boundary.
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(0.0f, 0.0f, 5.0f), AZ::Vector3(-0.5f, -0.5f, 5.0f),
+                                                 AZ::Vector3(15.5f, 3.0f, 5.0f), AZ::Vector3(16.0f, 3.0f, 5.0f),
+                                                 AZ::Vector3(0.25f, 0.0f, 5.0f) };
+
+        AZStd::vector<float> samples(positions.size());
+        AZStd::vector<bool> found(positions.size());
+        AZStd::vector<TileCache::TileKey> tilesToBake;
+
+        // Nothing is cached yet, so every aligned tile should get requested, and the unaligned position should be ignored.
+        AZ::u64 generation = cache.Lookup(GetLookupSettings(), positions, samples, found, tilesToBake);
+        EXPECT_THAT(found, ::testing::Each(false));
+        EXPECT_EQ(tilesToBake.size(), 3u);
+
+        // Tiles that are already being baked shouldn't be requested a second time.
+        AZStd::vector<TileCache::TileKey> duplicateTilesToBake;
+        cache.Lookup(GetLookupSettings(), positions, samples, found, duplicateTilesToBake);
+        EXPECT_TRUE(duplicateTilesToBake.empty());
+
+        for (auto& tileKey : tilesToBake)
+        {
+            BakeTile(cache, tileKey, generation);
+        }
+        EXPECT_EQ(cache.GetTileCount(), 3u);
+
+        tilesToBake.clear();
+        cache.Lookup(GetLookupSettings(), positions, samples, found, tilesToBake);
+        EXPECT_TRUE(tilesToBake.empty());
+        for (size_t index = 0; index < positions.size() - 1; index++)
+        {
+            EXPECT_TRUE(found[index]);
+            EXPECT_EQ(samples[index], GetExpectedValue(positions[index]));
+        }
+        EXPECT_FALSE(found.back());
+    }
+
+    TEST_F(GridTileCacheTests, StaleBakes_AreDiscarded)
+    {
+        TileCache cache;
+        cache.SetMaxTiles(16);
+
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(1.0f, 1.0f, 0.0f) };
+        AZStd::vector<float> samples(positions.size());
+        AZStd::vector<bool> found(positions.size());
+        AZStd::vector<TileCache::TileKey> tilesToBake;
+
+        AZ::u64 generation = cache.Lookup(GetLookupSettings(), positions, samples, found, tilesToBake);
+        ASSERT_EQ(tilesToBake.size(), 1u);
+
+        // The data changed while the tile was being baked, so the baked tile shouldn't get stored.
+        cache.InvalidateRegion(AZ::Aabb::CreateFromMinMax(AZ::Vector3(100.0f), AZ::Vector3(101.0f)));
+        BakeTile(cache, tilesToBake[0], generation);
+        EXPECT_EQ(cache.GetTileCount(), 0u);
+
+        // The tile should get requested again on the next lookup.
+        tilesToBake.clear();
+        generation = cache.Lookup(GetLookupSettings(), positions, samples, found, tilesToBake);
+        ASSERT_EQ(tilesToBake.size(), 1u);
+
+        // Cancelled tiles should get requested again as well.
+        cache.CancelTile(tilesToBake[0], generation);
+        tilesToBake.clear();
+        cache.Lookup(GetLookupSettings(), positions, samples, found, tilesToBake);
+        EXPECT_EQ(tilesToBake.size(), 1u);
+    }
+
+    TEST_F(GridTileCacheTests, DirtyRegion_InvalidatesOverlappingTiles)
+    {
+        TileCache cache;
+        cache.SetMaxTiles(16);
+
+        // Bake a 2 x 2 block of tiles.
+        const float tileWorldSize = QueryResolution * TileCache::TileSize;
+        LookupAndBake(
+            cache,
+            { AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(tileWorldSize, 0.0f, 0.0f), AZ::Vector3(0.0f, tileWorldSize, 0.0f),
+              AZ::Vector3(tileWorldSize, tileWorldSize, 0.0f) });
+        EXPECT_EQ(cache.GetTileCount(), 4u);
+
+        // A region inside the first tile only removes that tile, regardless of its height.
+        cache.InvalidateRegion(AZ::Aabb::CreateFromMinMax(AZ::Vector3(1.0f, 1.0f, 1000.0f), AZ::Vector3(2.0f, 2.0f, 1001.0f)));
+        EXPECT_EQ(cache.GetTileCount(), 3u);
+
+        // A region between the last grid point of one tile and the first grid point of the next doesn't touch either tile.
+        const float gapMin = tileWorldSize - QueryResolution + 0.1f;
+        const float gapMax = tileWorldSize - 0.1f;
+        cache.InvalidateRegion(AZ::Aabb::CreateFromMinMax(AZ::Vector3(gapMin, 0.0f, 0.0f), AZ::Vector3(gapMax, 0.0f, 0.0f)));
+        EXPECT_EQ(cache.GetTileCount(), 3u);
+
+        // A region that spans the boundary between the remaining tiles removes all of them.
+        cache.InvalidateRegion(AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(tileWorldSize - 1.0f, tileWorldSize - 1.0f, 0.0f), AZ::Vector3(tileWorldSize + 1.0f, tileWorldSize + 1.0f, 0.0f)));
+        EXPECT_EQ(cache.GetTileCount(), 0u);
+
+        // An invalid region means that everything changed.
+        LookupAndBake(cache, { AZ::Vector3(0.0f, 0.0f, 0.0f) });
+        EXPECT_EQ(cache.GetTileCount(), 1u);
+        cache.InvalidateRegion(AZ::Aabb::CreateNull());
+        EXPECT_EQ(cache.GetTileCount(), 0u);
+    }
+
+    TEST_F(GridTileCacheTests, LeastRecentlyUsedTiles_AreEvicted)
+    {
+        TileCache cache;
+        cache.SetMaxTiles(2);
+
+        const float tileWorldSize = QueryResolution * TileCache::TileSize;
+        const AZ::Vector3 tile0(0.0f, 0.0f, 0.0f);
+        const AZ::Vector3 tile1(tileWorldSize, 0.0f, 0.0f);
+        const AZ::Vector3 tile2(tileWorldSize * 2.0f, 0.0f, 0.0f);
+
+        LookupAndBake(cache, { tile0 });
+        LookupAndBake(cache, { tile1 });
+
+        // Touch the first tile so that the second one becomes the least recently used tile.
+        LookupAndBake(cache, { tile0 });
+        LookupAndBake(cache, { tile2 });
+        EXPECT_EQ(cache.GetTileCount(), 2u);
+
+        AZStd::vector<AZ::Vector3> positions = { tile0, tile1, tile2 };
+        AZStd::vector<float> samples(positions.size());
+        AZStd::vector<bool> found(positions.size());
+        AZStd::vector<TileCache::TileKey> tilesToBake;
+        cache.Lookup(GetLookupSettings(), positions, samples, found, tilesToBake);
+        EXPECT_TRUE(found[0]);
+        EXPECT_FALSE(found[1]);
+        EXPECT_TRUE(found[2]);
+
+        // Shrinking the cache evicts tiles immediately, and a size of 0 disables the cache.
+        cache.SetMaxTiles(1);
+        EXPECT_EQ(cache.GetTileCount(), 1u);
+        cache.SetMaxTiles(0);
+        EXPECT_EQ(cache.GetTileCount(), 0u);
+        EXPECT_FALSE(cache.IsEnabled());
+    }
+
+    TEST_F(GridTileCacheTests, LookupSettings_ControlTileKeysAndRequests)
+    {
+        TileCache cache;
+        cache.SetMaxTiles(16);
+
+        const float tileWorldSize = QueryResolution * TileCache::TileSize;
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(0.0f, 0.0f, 1.0f), AZ::Vector3(QueryResolution, 0.0f, 2.0f),
+                                                 AZ::Vector3(tileWorldSize, 0.0f, 1.0f) };
+        AZStd::vector<float> samples(positions.size());
+        AZStd::vector<bool> found(positions.size());
+        AZStd::vector<TileCache::TileKey> tilesToBake;
+
+        // Only the first tile has enough positions in it to get requested.
+        TileCache::LookupSettings settings;
+        settings.m_sampleSpacing = QueryResolution;
+        settings.m_minPositionsPerMissingTile = 2;
+        cache.Lookup(settings, positions, samples, found, tilesToBake);
+        ASSERT_EQ(tilesToBake.size(), 1u);
+        EXPECT_EQ(tilesToBake[0].m_tileX, 0);
+
+        // Keying by height puts the positions at different heights in separate tiles, so none of them have enough positions.
+        tilesToBake.clear();
+        settings.m_keyByHeight = true;
+        cache.Lookup(settings, positions, samples, found, tilesToBake);
+        EXPECT_TRUE(tilesToBake.empty());
+
+        // Positions within the tolerance of a grid point use the grid point's tile.
+        TileCache::TileKey key;
+        size_t sampleIndex = 0;
+        settings.m_tolerance = 0.01f;
+        EXPECT_TRUE(TileCache::GetGridPoint(settings, AZ::Vector3(QueryResolution + 0.005f, 0.0f, 1.0f), key, sampleIndex));
+        EXPECT_EQ(sampleIndex, 1u);
+        EXPECT_FALSE(TileCache::GetGridPoint(settings, AZ::Vector3(QueryResolution + 0.02f, 0.0f, 1.0f), key, sampleIndex));
+        EXPECT_FALSE(TileCache::GetGridPoint(settings, AZ::Vector3(AZStd::numeric_limits<float>::quiet_NaN()), key, sampleIndex));
+    }
+} // namespace UnitTest
@@ -181,7 +181,8 @@ namespace UnitTest
         return entity;
     }
 
-    AZStd::unique_ptr<AZ::Entity> GradientSignalBaseFixture::BuildTestImageGradient(float shapeHalfBounds)
+    AZStd::unique_ptr<AZ::Entity> GradientSignalBaseFixture::BuildTestImageGradient(
+        float shapeHalfBounds, GradientSignal::SamplingType samplingType)
     {
         // Create an Image Gradient Component with arbitrary sizes and parameters.
         auto entity = CreateTestEntity(shapeHalfBounds);
@@ -190,6 +191,7 @@ namespace UnitTest
         const int32_t imageSeed = 12345;
         config.m_imageAsset = UnitTest::CreateImageAsset(imageSize, imageSize, imageSeed);
         config.m_tiling = AZ::Vector2::CreateOne();
+        config.m_samplingType = samplingType;
         entity->CreateComponent<GradientSignal::ImageGradientComponent>(config);
 
         // Create a Gradient Transform Component with arbitrary parameters.
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Tests/GradientSignalTestMocks.h>
+#include <GradientSignal/Components/ImageGradientComponent.h>
 #include <LmbrCentral/Shape/MockShapes.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <AzTest/GemTestEnvironment.h>
@@ -86,7 +87,8 @@ namespace UnitTest
 
         // Create and activate an entity with a gradient component of the requested type, initialized with test data.
         AZStd::unique_ptr<AZ::Entity> BuildTestConstantGradient(float shapeHalfBounds, float value = 0.75f);
-        AZStd::unique_ptr<AZ::Entity> BuildTestImageGradient(float shapeHalfBounds);
+        AZStd::unique_ptr<AZ::Entity> BuildTestImageGradient(
+            float shapeHalfBounds, GradientSignal::SamplingType samplingType = GradientSignal::SamplingType::Point);
         AZStd::unique_ptr<AZ::Entity> BuildTestPerlinGradient(float shapeHalfBounds);
         AZStd::unique_ptr<AZ::Entity> BuildTestRandomGradient(float shapeHalfBounds);
         AZStd::unique_ptr<AZ::Entity> BuildTestShapeAreaFalloffGradient(float shapeHalfBounds);
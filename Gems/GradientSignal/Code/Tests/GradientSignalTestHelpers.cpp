@@ -11,6 +11,8 @@
 #include <Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h>
 #include <AzCore/Math/Aabb.h>
+#include <GradientSignal/CompiledGradient.h>
+#include <GradientSignal/GradientCache.h>
 #include <GradientSignal/GradientSampler.h>
 
 namespace UnitTest
@@ -207,6 +209,35 @@ namespace UnitTest
         }
     }
 
+    void GradientSignalTestHelpers::CompareSamplerAndCompiledGetValues(
+        const GradientSignal::GradientSampler& gradientSampler, float queryMin, float queryMax)
+    {
+        // Query a region that's large enough to span several program tiles, including a partial tile at the end.
+        const size_t numSamples = aznumeric_cast<size_t>(ceil(queryMax - queryMin));
+
+        AZStd::vector<AZ::Vector3> positions(numSamples * numSamples);
+        size_t index = 0;
+        for (size_t yIndex = 0; yIndex < numSamples; yIndex++)
+        {
+            for (size_t xIndex = 0; xIndex < numSamples; xIndex++)
+            {
+                positions[index++] = AZ::Vector3(queryMin + aznumeric_cast<float>(xIndex), queryMin + aznumeric_cast<float>(yIndex), 0.0f);
+            }
+        }
+
+        AZStd::vector<float> expectedResults(positions.size());
+        gradientSampler.GetValues(positions, expectedResults);
+
+        GradientSignal::CompiledGradient compiledGradient(gradientSampler);
+        AZStd::vector<float> compiledResults(positions.size());
+        compiledGradient.GetValues(positions, compiledResults);
+
+        for (size_t positionIndex = 0; positionIndex < positions.size(); positionIndex++)
+        {
+            ASSERT_NEAR(expectedResults[positionIndex], compiledResults[positionIndex], 0.000001f);
+        }
+    }
+
 #ifdef HAVE_BENCHMARK
 
     void GradientSignalTestHelpers::FillQueryPositions(AZStd::vector<AZ::Vector3>& positions, float height, float width)
@@ -330,6 +361,76 @@ namespace UnitTest
         }
     }
 
+    void GradientSignalTestHelpers::RunCompiledGetValuesBenchmark(
+        benchmark::State& state, const AZ::EntityId& gradientId, int64_t queryRange)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Create a compiled gradient to use for querying our gradient. The program is compiled outside of the benchmark timing,
+        // since it only gets recompiled when the gradient hierarchy changes.
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = gradientId;
+        GradientSignal::CompiledGradient compiledGradient(gradientSampler);
+        compiledGradient.GetProgram();
+
+        // Get the height and width ranges for querying from our benchmark parameters
+        const float height = aznumeric_cast<float>(queryRange);
+        const float width = aznumeric_cast<float>(queryRange);
+        const int64_t totalQueryPoints = queryRange * queryRange;
+
+        // Call GetValues() through the compiled gradient for every height and width in our ranges.
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Set up our vector of query positions. This is done inside the benchmark timing to keep the timing directly comparable
+            // with the other GetValues() benchmarks.
+            AZStd::vector<AZ::Vector3> positions(totalQueryPoints);
+            FillQueryPositions(positions, height, width);
+
+            // Query and get the results.
+            AZStd::vector<float> results(totalQueryPoints);
+            compiledGradient.GetValues(positions, results);
+            benchmark::DoNotOptimize(results);
+        }
+    }
+
+    void GradientSignalTestHelpers::RunCachedGetValuesBenchmark(
+        benchmark::State& state, const AZ::EntityId& gradientId, int64_t queryRange)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Get the height and width ranges for querying from our benchmark parameters
+        const float height = aznumeric_cast<float>(queryRange);
+        const float width = aznumeric_cast<float>(queryRange);
+        const int64_t totalQueryPoints = queryRange * queryRange;
+
+        // Create a gradient cache that's large enough to hold the entire query region, and fill it outside of the benchmark timing
+        // so that the benchmark measures repeated queries of an unchanged region.
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = gradientId;
+        const size_t tilesPerSide = aznumeric_cast<size_t>(
+            (queryRange + GradientSignal::GradientCache::TileSize - 1) / GradientSignal::GradientCache::TileSize);
+        GradientSignal::GradientCache gradientCache(gradientSampler, tilesPerSide * tilesPerSide);
+
+        AZStd::vector<AZ::Vector3> warmupPositions(totalQueryPoints);
+        FillQueryPositions(warmupPositions, height, width);
+        AZStd::vector<float> warmupResults(totalQueryPoints);
+        gradientCache.GetValues(warmupPositions, warmupResults, 1.0f);
+
+        // Call GetValues() through the gradient cache for every height and width in our ranges.
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Set up our vector of query positions. This is done inside the benchmark timing to keep the timing directly comparable
+            // with the other GetValues() benchmarks.
+            AZStd::vector<AZ::Vector3> positions(totalQueryPoints);
+            FillQueryPositions(positions, height, width);
+
+            // Query and get the results.
+            AZStd::vector<float> results(totalQueryPoints);
+            gradientCache.GetValues(positions, results, 1.0f);
+            benchmark::DoNotOptimize(results);
+        }
+    }
+
     void GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(benchmark::State& state, const AZ::EntityId& gradientId)
     {
         switch (state.range(0))
@@ -346,6 +447,12 @@ namespace UnitTest
         case GetValuePermutation::SAMPLER_GET_VALUES:
             RunSamplerGetValuesBenchmark(state, gradientId, state.range(1));
             break;
+        case GetValuePermutation::COMPILED_GET_VALUES:
+            RunCompiledGetValuesBenchmark(state, gradientId, state.range(1));
+            break;
+        case GetValuePermutation::CACHED_GET_VALUES:
+            RunCachedGetValuesBenchmark(state, gradientId, state.range(1));
+            break;
         default:
             AZ_Assert(false, "Benchmark permutation type not supported.");
         }
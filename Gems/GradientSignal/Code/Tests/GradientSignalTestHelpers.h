@@ -12,6 +12,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/GradientSampler.h>
 
 #include <Atom/RHI.Reflect/ImageSubresource.h>
 #include <Atom/RPI.Reflect/Image/ImageMipChainAsset.h>
@@ -94,6 +95,7 @@ namespace UnitTest
     {
     public:
         static void CompareGetValueAndGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax);
+        static void CompareSamplerAndCompiledGetValues(const GradientSignal::GradientSampler& gradientSampler, float queryMin, float queryMax);
 
 #ifdef HAVE_BENCHMARK
         // We use an enum to list out the different types of GetValue() benchmarks to run so that way we can condense our test cases
@@ -105,6 +107,8 @@ namespace UnitTest
             EBUS_GET_VALUES,
             SAMPLER_GET_VALUE,
             SAMPLER_GET_VALUES,
+            COMPILED_GET_VALUES,
+            CACHED_GET_VALUES,
         };
 
         static void FillQueryPositions(AZStd::vector<AZ::Vector3>& positions, float height, float width);
@@ -113,6 +117,8 @@ namespace UnitTest
         static void RunEBusGetValuesBenchmark(benchmark::State& state, const AZ::EntityId& gradientId, int64_t queryRange);
         static void RunSamplerGetValueBenchmark(benchmark::State& state, const AZ::EntityId& gradientId, int64_t queryRange);
         static void RunSamplerGetValuesBenchmark(benchmark::State& state, const AZ::EntityId& gradientId, int64_t queryRange);
+        static void RunCompiledGetValuesBenchmark(benchmark::State& state, const AZ::EntityId& gradientId, int64_t queryRange);
+        static void RunCachedGetValuesBenchmark(benchmark::State& state, const AZ::EntityId& gradientId, int64_t queryRange);
         static void RunGetValueOrGetValuesBenchmark(benchmark::State& state, const AZ::EntityId& gradientId);
 
 // Because there's no good way to label different enums in the output results (they just appear as integer values), we work around it by
@@ -138,6 +144,16 @@ namespace UnitTest
         ->Args({ GradientSignalTestHelpers::GetValuePermutation::SAMPLER_GET_VALUES, 1024 })                                              \
         ->Args({ GradientSignalTestHelpers::GetValuePermutation::SAMPLER_GET_VALUES, 2048 })                                              \
         ->ArgNames({ "SamplerGetValues", "size" })                                                                                        \
+        ->Unit(::benchmark::kMillisecond);                                                                                                \
+    BENCHMARK_REGISTER_F(Fixture, Func)                                                                                                   \
+        ->Args({ GradientSignalTestHelpers::GetValuePermutation::COMPILED_GET_VALUES, 1024 })                                             \
+        ->Args({ GradientSignalTestHelpers::GetValuePermutation::COMPILED_GET_VALUES, 2048 })                                             \
+        ->ArgNames({ "CompiledGetValues", "size" })                                                                                       \
+        ->Unit(::benchmark::kMillisecond);                                                                                                \
+    BENCHMARK_REGISTER_F(Fixture, Func)                                                                                                   \
+        ->Args({ GradientSignalTestHelpers::GetValuePermutation::CACHED_GET_VALUES, 1024 })                                               \
+        ->Args({ GradientSignalTestHelpers::GetValuePermutation::CACHED_GET_VALUES, 2048 })                                               \
+        ->ArgNames({ "CachedGetValues", "size" })                                                                                         \
         ->Unit(::benchmark::kMillisecond);
 #endif
 
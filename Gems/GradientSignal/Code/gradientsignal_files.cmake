@@ -7,8 +7,12 @@
 #
 
 set(FILES
+    Include/GradientSignal/CompiledGradient.h
+    Include/GradientSignal/GradientCache.h
+    Include/GradientSignal/GradientProgram.h
     Include/GradientSignal/GradientSampler.h
     Include/GradientSignal/GradientTransform.h
+    Include/GradientSignal/GridTileCache.h
     Include/GradientSignal/SmoothStep.h
     Include/GradientSignal/PerlinImprovedNoise.h
     Include/GradientSignal/Util.h
@@ -75,6 +79,9 @@ set(FILES
     Source/Components/SurfaceMaskGradientComponent.cpp
     Source/Components/SurfaceSlopeGradientComponent.cpp
     Source/Components/ThresholdGradientComponent.cpp
+    Source/CompiledGradient.cpp
+    Source/GradientCache.cpp
+    Source/GradientProgram.cpp
     Source/GradientSampler.cpp
     Source/GradientSignalSystemComponent.cpp
     Source/GradientSignalSystemComponent.h
@@ -8,7 +8,10 @@
 
 set(FILES
     Tests/GradientSignalBenchmarks.cpp
+    Tests/GradientSignalCacheTests.cpp
+    Tests/GradientSignalCompiledTests.cpp
     Tests/GradientSignalGetValuesTests.cpp
+    Tests/GradientSignalGridTileCacheTests.cpp
     Tests/GradientSignalImageTests.cpp
     Tests/GradientSignalReferencesTests.cpp
     Tests/GradientSignalSamplerTests.cpp
@@ -21,6 +21,7 @@
 #include <MCore/Source/AzCoreConversions.h>
 #include <MCore/Source/Color.h>
 
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
@@ -28,6 +29,23 @@ namespace EMotionFX::MotionMatching
 {
     AZ_CLASS_ALLOCATOR_IMPL(Feature, MotionMatchAllocator)
 
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using FloatType = Vec4::FloatType;
+
+        // Load the Vector3 stored at the given column of the frame into the first three components, the fourth component is undefined.
+        AZ_FORCE_INLINE FloatType LoadVector3(const FeatureMatrix& featureMatrix, size_t frameIndex, FeatureMatrix::Index column)
+        {
+#ifdef O3DE_USE_EIGEN
+            return Vec4::LoadImmediate(featureMatrix(frameIndex, column), featureMatrix(frameIndex, column + 1), featureMatrix(frameIndex, column + 2), 0.0f);
+#else
+            // The feature matrix is padded, so reading one value past the vector is safe even for the last frame.
+            return Vec4::LoadUnaligned(&featureMatrix(frameIndex, column));
+#endif
+        }
+    } // namespace
+
     Feature::ExtractFeatureContext::ExtractFeatureContext(FeatureMatrix& featureMatrix, AnimGraphPosePool& posePool)
         : m_featureMatrix(featureMatrix)
         , m_posePool(posePool)
@@ -103,6 +121,15 @@ namespace EMotionFX::MotionMatching
         return 0.0f;
     }
 
+    void Feature::CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
+    {
+        AZ_Assert(frameIndices.size() == outCosts.size(), "Expected a cost for each of the frames.");
+        for (size_t i = 0; i < frameIndices.size(); ++i)
+        {
+            outCosts[i] = CalculateFrameCost(frameIndices[i], context);
+        }
+    }
+
     void Feature::SetRelativeToNodeIndex(size_t nodeIndex)
     {
         m_relativeToNodeIndex = nodeIndex;
@@ -138,6 +165,49 @@ namespace EMotionFX::MotionMatching
         return CalcResidual(euclideanDistance);
     }
 
+    void Feature::CalcVector3FrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
+    {
+        AZ_Assert(frameIndices.size() == outCosts.size(), "Expected a cost for each of the frames.");
+        const FeatureMatrix& featureMatrix = context.m_featureMatrix;
+        const AZ::Vector3 queryValue = context.m_queryVector.GetVector3(m_featureColumnOffset);
+        const FloatType queryX = Vec4::Splat(queryValue.GetX());
+        const FloatType queryY = Vec4::Splat(queryValue.GetY());
+        const FloatType queryZ = Vec4::Splat(queryValue.GetZ());
+        const bool squared = (m_residualType == ResidualType::Squared);
+
+        // Load the vectors of four frames and transpose them, so that we can calculate the four distances side by side.
+        const size_t numFrames = frameIndices.size();
+        const size_t numBatchedFrames = numFrames - numFrames % 4;
+        for (size_t i = 0; i < numBatchedFrames; i += 4)
+        {
+            const FloatType rows[4] =
+            {
+                LoadVector3(featureMatrix, frameIndices[i + 0], m_featureColumnOffset),
+                LoadVector3(featureMatrix, frameIndices[i + 1], m_featureColumnOffset),
+                LoadVector3(featureMatrix, frameIndices[i + 2], m_featureColumnOffset),
+                LoadVector3(featureMatrix, frameIndices[i + 3], m_featureColumnOffset)
+            };
+            FloatType columns[4];
+            Vec4::Mat4x4Transpose(rows, columns);
+
+            const FloatType diffX = Vec4::Sub(columns[0], queryX);
+            const FloatType diffY = Vec4::Sub(columns[1], queryY);
+            const FloatType diffZ = Vec4::Sub(columns[2], queryZ);
+            FloatType squaredDistances = Vec4::Mul(diffX, diffX);
+            squaredDistances = Vec4::Madd(diffY, diffY, squaredDistances);
+            squaredDistances = Vec4::Madd(diffZ, diffZ, squaredDistances);
+
+            // The squared residual of the distance is the squared distance itself, and the absolute one is the distance as that is never negative.
+            const FloatType costs = squared ? squaredDistances : Vec4::Sqrt(squaredDistances);
+            Vec4::StoreUnaligned(&outCosts[i], costs);
+        }
+
+        for (size_t i = numBatchedFrames; i < numFrames; ++i)
+        {
+            outCosts[i] = CalcResidual(queryValue, featureMatrix.GetVector3(frameIndices[i], m_featureColumnOffset));
+        }
+    }
+
     AZ::Crc32 Feature::GetCostFactorVisibility() const
     {
         return AZ::Edit::PropertyVisibility::Show;
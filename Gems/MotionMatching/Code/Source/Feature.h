@@ -11,6 +11,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <EMotionFX/Source/AnimGraphPosePool.h>
@@ -106,6 +107,13 @@ namespace EMotionFX::MotionMatching
         };
         virtual float CalculateFrameCost(size_t frameIndex, const FrameCostContext& context) const;
 
+        //! Calculate the costs for a batch of frames, with the same results as calling CalculateFrameCost() for each of them.
+        //! Features that can evaluate several frames at once override this to speed up the narrow-phase search.
+        //! @param frameIndices The frames to calculate the costs for.
+        //! @param context The query values and the feature matrix to compare them to.
+        //! @param outCosts Receives the cost for each of the frames, needs to be of the same size as the frame indices.
+        virtual void CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const;
+
         //! Specifies how the feature value differences (residuals), between the input query values
         //! and the frames in the motion database that sum up the feature cost, are calculated.
         enum ResidualType
@@ -164,6 +172,10 @@ namespace EMotionFX::MotionMatching
         float CalcResidual(float value) const;
         float CalcResidual(const AZ::Vector3& a, const AZ::Vector3& b) const;
 
+        //! Batched version of CalcResidual(a, b) for features that store a single Vector3 at their column offset.
+        //! The query value is compared to four frames at a time using SIMD.
+        void CalcVector3FrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const;
+
         virtual AZ::Crc32 GetCostFactorVisibility() const;
 
         // Shared and reflected data.
@@ -62,6 +62,11 @@ namespace EMotionFX::MotionMatching
         return CalcResidual(queryVelocity, frameVelocity);
     }
 
+    void FeatureAngularVelocity::CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
+    {
+        CalcVector3FrameCosts(frameIndices, context, outCosts);
+    }
+
     void FeatureAngularVelocity::DebugDraw(
         AzFramework::DebugDisplayRequests& debugDisplay,
         const Pose& pose,
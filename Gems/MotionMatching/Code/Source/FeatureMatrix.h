@@ -40,12 +40,15 @@ namespace EMotionFX::MotionMatching
     using FeatureMatrixType = Eigen::Matrix<O3DE_MM_FLOATTYPE, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
 #else
     //! Small wrapper for a 2D matrix similar to the Eigen::Matrix.
+    //! The values are stored row-major and the storage is padded at the end, so that a four-wide SIMD load starting at any of the values stays inside the allocation.
     class FeatureMatrixType
     {
     public:
+        static constexpr size_t s_padding = 3;
+
         size_t size() const
         {
-            return m_data.size();
+            return m_rowCount * m_columnCount;
         }
 
         size_t rows() const
@@ -62,7 +65,7 @@ namespace EMotionFX::MotionMatching
         {
             m_rowCount = rowCount;
             m_columnCount = columnCount;
-            m_data.resize(m_rowCount * m_columnCount);
+            m_data.resize(m_rowCount * m_columnCount + s_padding);
         }
 
         float& operator()(size_t row, size_t column)
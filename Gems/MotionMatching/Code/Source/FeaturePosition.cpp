@@ -51,6 +51,11 @@ namespace EMotionFX::MotionMatching
         return CalcResidual(queryPosition, framePosition);
     }
 
+    void FeaturePosition::CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
+    {
+        CalcVector3FrameCosts(frameIndices, context, outCosts);
+    }
+
     void FeaturePosition::DebugDraw(AzFramework::DebugDisplayRequests& debugDisplay,
         const Pose& currentPose,
         const FeatureMatrix& featureMatrix,
@@ -65,6 +65,11 @@ namespace EMotionFX::MotionMatching
         return CalcResidual(queryVelocity, frameVelocity);
     }
 
+    void FeatureVelocity::CalculateFrameCosts(AZStd::span<const size_t> frameIndices, const FrameCostContext& context, AZStd::span<float> outCosts) const
+    {
+        CalcVector3FrameCosts(frameIndices, context, outCosts);
+    }
+
     void FeatureVelocity::DebugDraw(AzFramework::DebugDisplayRequests& debugDisplay,
         const Pose& pose,
         const AZ::Vector3& velocity,
@@ -16,7 +16,7 @@
 namespace EMotionFX::MotionMatching
 {
     AZ_CLASS_ALLOCATOR_IMPL(KdTree, MotionMatchAllocator);
-    AZ_CLASS_ALLOCATOR_IMPL(KdTree::Node, MotionMatchAllocator);
+    AZ_CLASS_ALLOCATOR_IMPL(KdTree::BuildNode, MotionMatchAllocator);
 
     KdTree::~KdTree()
     {
@@ -90,11 +90,14 @@ namespace EMotionFX::MotionMatching
         const AZStd::vector<size_t> localToSchemaFeatureColumns = CalcLocalToSchemaFeatureColumns(features);
 
         // Build the tree.
-        BuildTreeNodes(frameDatabase, featureMatrix, localToSchemaFeatureColumns, aznew Node(), nullptr, 0);
+        BuildTreeNodes(frameDatabase, featureMatrix, localToSchemaFeatureColumns, aznew BuildNode(), nullptr, 0);
         MergeSmallLeafNodesToParents();
         ClearFramesForNonEssentialNodes();
         RemoveZeroFrameLeafNodes();
 
+        // Store the nodes and their frames in contiguous arrays for the runtime search.
+        FlattenTree();
+
 #if !defined(_RELEASE)
         const float initTime = timer.GetDeltaTimeInSeconds();
         AZ_TracePrintf("Motion Matching", "KD-Tree initialized in %.2f ms (numNodes = %d  numDims = %d  Memory used = %.2f MB).",
@@ -131,26 +134,31 @@ namespace EMotionFX::MotionMatching
 
     void KdTree::Clear()
     {
-        // delete all nodes
-        for (Node* node : m_nodes)
-        {
-            delete node;
-        }
+        ClearBuildNodes();
 
         m_nodes.clear();
+        m_nodes.shrink_to_fit();
+        m_frames.clear();
+        m_frames.shrink_to_fit();
         m_numDimensions = 0;
     }
 
-    size_t KdTree::CalcMemoryUsageInBytes() const
+    void KdTree::ClearBuildNodes()
     {
-        size_t totalBytes = 0;
-
-        for (const Node* node : m_nodes)
+        for (BuildNode* node : m_buildNodes)
         {
-            totalBytes += sizeof(Node);
-            totalBytes += node->m_frames.capacity() * sizeof(size_t);
+            delete node;
         }
 
+        m_buildNodes.clear();
+        m_buildNodes.shrink_to_fit();
+    }
+
+    size_t KdTree::CalcMemoryUsageInBytes() const
+    {
+        size_t totalBytes = 0;
+        totalBytes += m_nodes.capacity() * sizeof(Node);
+        totalBytes += m_frames.capacity() * sizeof(size_t);
         totalBytes += sizeof(KdTree);
         return totalBytes;
     }
@@ -173,14 +181,14 @@ namespace EMotionFX::MotionMatching
     void KdTree::BuildTreeNodes(const FrameDatabase& frameDatabase,
         const FeatureMatrix& featureMatrix,
         const AZStd::vector<size_t>& localToSchemaFeatureColumns,
-        Node* node,
-        Node* parent,
+        BuildNode* node,
+        BuildNode* parent,
         size_t dimension,
         bool leftSide)
     {
         node->m_parent = parent;
         node->m_dimension = dimension;
-        m_nodes.emplace_back(node);
+        m_buildNodes.emplace_back(node);
 
         // Fill the frames array and calculate the median.
         AZStd::vector<float> frameFeatureValues;
@@ -195,13 +203,13 @@ namespace EMotionFX::MotionMatching
         }
 
         // Create the left node.
-        Node* leftNode = aznew Node();
+        BuildNode* leftNode = aznew BuildNode();
         AZ_Assert(!node->m_leftNode, "Expected the parent left node to be a nullptr");
         node->m_leftNode = leftNode;
         BuildTreeNodes(frameDatabase, featureMatrix, localToSchemaFeatureColumns, leftNode, node, dimension + 1, true);
 
         // Create the right node.
-        Node* rightNode = aznew Node();
+        BuildNode* rightNode = aznew BuildNode();
         AZ_Assert(!node->m_rightNode, "Expected the parent right node to be a nullptr");
         node->m_rightNode = rightNode;
         BuildTreeNodes(frameDatabase, featureMatrix, localToSchemaFeatureColumns, rightNode, node, dimension + 1, false);
@@ -209,7 +217,7 @@ namespace EMotionFX::MotionMatching
 
     void KdTree::ClearFramesForNonEssentialNodes()
     {
-        for (Node* node : m_nodes)
+        for (BuildNode* node : m_buildNodes)
         {
             if (node->m_leftNode && node->m_rightNode)
             {
@@ -219,9 +227,9 @@ namespace EMotionFX::MotionMatching
         }
     }
 
-    void KdTree::RemoveLeafNode(Node* node)
+    void KdTree::RemoveLeafNode(BuildNode* node)
     {
-        Node* parent = node->m_parent;
+        BuildNode* parent = node->m_parent;
 
         if (parent->m_leftNode == node)
         {
@@ -234,9 +242,9 @@ namespace EMotionFX::MotionMatching
         }
 
         // Remove it from the node vector.
-        const auto location = AZStd::find(m_nodes.begin(), m_nodes.end(), node);
-        AZ_Assert(location != m_nodes.end(), "Expected to find the item to remove.");
-        m_nodes.erase(location);
+        const auto location = AZStd::find(m_buildNodes.begin(), m_buildNodes.end(), node);
+        AZ_Assert(location != m_buildNodes.end(), "Expected to find the item to remove.");
+        m_buildNodes.erase(location);
 
         delete node;
     }
@@ -244,13 +252,13 @@ namespace EMotionFX::MotionMatching
     void KdTree::MergeSmallLeafNodesToParents()
     {
         // If the tree is empty or only has a single node, there is nothing to merge.
-        if (m_nodes.size() < 2)
+        if (m_buildNodes.size() < 2)
         {
             return;
         }
 
-        AZStd::vector<Node*> nodesToRemove;
-        for (Node* node : m_nodes)
+        AZStd::vector<BuildNode*> nodesToRemove;
+        for (BuildNode* node : m_buildNodes)
         {
             // If we are a leaf node and we don't have enough frames.
             if ((!node->m_leftNode && !node->m_rightNode) &&
@@ -261,7 +269,7 @@ namespace EMotionFX::MotionMatching
         }
 
         // Remove the actual nodes.
-        for (Node* node : nodesToRemove)
+        for (BuildNode* node : nodesToRemove)
         {
             RemoveLeafNode(node);
         }
@@ -269,11 +277,11 @@ namespace EMotionFX::MotionMatching
 
     void KdTree::RemoveZeroFrameLeafNodes()
     {
-        AZStd::vector<Node*> nodesToRemove;
+        AZStd::vector<BuildNode*> nodesToRemove;
 
         // Build a list of leaf nodes to remove.
         // These are ones that have no feature inside them.
-        for (Node* node : m_nodes)
+        for (BuildNode* node : m_buildNodes)
         {
             if ((!node->m_leftNode && !node->m_rightNode) &&
                 node->m_frames.empty())
@@ -283,18 +291,18 @@ namespace EMotionFX::MotionMatching
         }
 
         // Remove the actual nodes.
-        for (Node* node : nodesToRemove)
+        for (BuildNode* node : nodesToRemove)
         {
             RemoveLeafNode(node);
         }
     }
 
-    void KdTree::FillFramesForNode(Node* node,
+    void KdTree::FillFramesForNode(BuildNode* node,
         const FrameDatabase& frameDatabase,
         const FeatureMatrix& featureMatrix,
         const AZStd::vector<size_t>& localToSchemaFeatureColumns,
         AZStd::vector<float>& frameFeatureValues,
-        Node* parent,
+        BuildNode* parent,
         bool leftSide)
     {
         frameFeatureValues.clear();
@@ -353,32 +361,88 @@ namespace EMotionFX::MotionMatching
         }
     }
 
-    void KdTree::RecursiveCalcNumFrames(Node* node, size_t& outNumFrames) const
+    void KdTree::FlattenTree()
+    {
+        m_nodes.clear();
+        m_frames.clear();
+
+        if (!m_buildNodes.empty())
+        {
+            size_t numFrames = 0;
+            for (const BuildNode* buildNode : m_buildNodes)
+            {
+                numFrames += buildNode->m_frames.size();
+            }
+
+            m_nodes.reserve(m_buildNodes.size());
+            m_frames.reserve(numFrames);
+            FlattenNode(m_buildNodes[0]);
+            AZ_Assert(m_nodes.size() == m_buildNodes.size(), "Expected all nodes to be reachable from the root node.");
+        }
+
+        ClearBuildNodes();
+    }
+
+    AZ::u32 KdTree::FlattenNode(const BuildNode* buildNode)
+    {
+        const AZ::u32 nodeIndex = aznumeric_cast<AZ::u32>(m_nodes.size());
+        {
+            Node& node = m_nodes.emplace_back();
+            node.m_median = buildNode->m_median;
+            node.m_dimension = aznumeric_cast<AZ::u32>(buildNode->m_dimension);
+            node.m_firstFrame = aznumeric_cast<AZ::u32>(m_frames.size());
+            node.m_numFrames = aznumeric_cast<AZ::u32>(buildNode->m_frames.size());
+            m_frames.insert(m_frames.end(), buildNode->m_frames.begin(), buildNode->m_frames.end());
+        }
+
+        // The node array might grow while adding the children, so only access the node by index from here on.
+        if (buildNode->m_leftNode)
+        {
+            const AZ::u32 leftNodeIndex = FlattenNode(buildNode->m_leftNode);
+            m_nodes[nodeIndex].m_leftNode = leftNodeIndex;
+        }
+
+        if (buildNode->m_rightNode)
+        {
+            const AZ::u32 rightNodeIndex = FlattenNode(buildNode->m_rightNode);
+            m_nodes[nodeIndex].m_rightNode = rightNodeIndex;
+        }
+
+        return nodeIndex;
+    }
+
+    void KdTree::RecursiveCalcNumFrames(AZ::u32 nodeIndex, size_t& outNumFrames) const
     {
-        if (node->m_leftNode && node->m_rightNode)
+        const Node& node = m_nodes[nodeIndex];
+        if (node.m_leftNode != InvalidIndex32 && node.m_rightNode != InvalidIndex32)
         {
-            RecursiveCalcNumFrames(node->m_leftNode, outNumFrames);
-            RecursiveCalcNumFrames(node->m_rightNode, outNumFrames);
+            RecursiveCalcNumFrames(node.m_leftNode, outNumFrames);
+            RecursiveCalcNumFrames(node.m_rightNode, outNumFrames);
         }
         else
         {
-            outNumFrames += node->m_frames.size();
+            outNumFrames += node.m_numFrames;
         }
     }
 
     void KdTree::PrintStats()
     {
 #if !defined(_RELEASE)
+        if (m_nodes.empty())
+        {
+            return;
+        }
+
         size_t leftNumFrames = 0;
         size_t rightNumFrames = 0;
-        if (m_nodes[0]->m_leftNode)
+        if (m_nodes[0].m_leftNode != InvalidIndex32)
         {
-            RecursiveCalcNumFrames(m_nodes[0]->m_leftNode, leftNumFrames);
+            RecursiveCalcNumFrames(m_nodes[0].m_leftNode, leftNumFrames);
         }
 
-        if (m_nodes[0]->m_rightNode)
+        if (m_nodes[0].m_rightNode != InvalidIndex32)
         {
-            RecursiveCalcNumFrames(m_nodes[0]->m_rightNode, rightNumFrames);
+            RecursiveCalcNumFrames(m_nodes[0].m_rightNode, rightNumFrames);
         }
 
         const float numFrames = static_cast<float>(leftNumFrames + rightNumFrames);
@@ -386,10 +450,10 @@ namespace EMotionFX::MotionMatching
         const float balanceScore = 100.0f - (AZ::GetAbs(halfFrames - static_cast<float>(leftNumFrames)) / numFrames) * 100.0f;
 
         // Get the maximum depth.
-        size_t maxDepth = 0;
-        for (const Node* node : m_nodes)
+        AZ::u32 maxDepth = 0;
+        for (const Node& node : m_nodes)
         {
-            maxDepth = AZ::GetMax(maxDepth, node->m_dimension);
+            maxDepth = AZ::GetMax(maxDepth, node.m_dimension);
         }
 
         AZ_TracePrintf("Motion Matching", "    KdTree Balance Info: leftSide=%d rightSide=%d score=%.2f totalFrames=%d maxDepth=%d", leftNumFrames, rightNumFrames, balanceScore, leftNumFrames + rightNumFrames, maxDepth);
@@ -399,16 +463,16 @@ namespace EMotionFX::MotionMatching
         size_t minFrames = 1000000000;
         size_t maxFrames = 0;
         AZStd::string framesString;
-        for (const Node* node : m_nodes)
+        for (const Node& node : m_nodes)
         {
-            if (node->m_leftNode || node->m_rightNode)
+            if (node.m_leftNode != InvalidIndex32 || node.m_rightNode != InvalidIndex32)
             {
                 continue;
             }
 
             numLeafNodes++;
 
-            if (node->m_frames.empty())
+            if (node.m_numFrames == 0)
             {
                 numZeroNodes++;
             }
@@ -417,10 +481,10 @@ namespace EMotionFX::MotionMatching
             {
                 framesString += ", ";
             }
-            framesString += AZStd::to_string(node->m_frames.size());
+            framesString += AZStd::to_string(node.m_numFrames);
 
-            minFrames = AZ::GetMin(minFrames, node->m_frames.size());
-            maxFrames = AZ::GetMax(maxFrames, node->m_frames.size());
+            minFrames = AZ::GetMin(minFrames, static_cast<size_t>(node.m_numFrames));
+            maxFrames = AZ::GetMax(maxFrames, static_cast<size_t>(node.m_numFrames));
         }
         AZ_TracePrintf("Motion Matching", "    Frames = (%s)", framesString.c_str());
 
@@ -429,68 +493,34 @@ namespace EMotionFX::MotionMatching
 #endif
     }
 
-    void KdTree::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
+    AZStd::span<const size_t> KdTree::FindNearestNeighbors(AZStd::span<const float> frameFloats) const
     {
         AZ_Assert(IsInitialized() && !m_nodes.empty(), "Expecting a valid and initialized kdTree. Did you forget to call KdTree::Init()?");
-        Node* curNode = m_nodes[0];
+        const Node* curNode = &m_nodes[0];
 
         // Step as far as we need to through the kdTree.
-        Node* nodeToSearch = nullptr;
         const size_t numDimensions = frameFloats.size();
         for (size_t d = 0; d < numDimensions; ++d)
         {
             AZ_Assert(curNode->m_dimension == d, "Dimension mismatch");
 
-            // We have children in both directions.
-            if (curNode->m_leftNode && curNode->m_rightNode)
-            {
-                curNode = (frameFloats[d] <= curNode->m_median) ? curNode->m_leftNode : curNode->m_rightNode;
-            }
-            else if (!curNode->m_leftNode && !curNode->m_rightNode) // we have a leaf node
-            {
-                nodeToSearch = curNode;
-            }
-            else
+            // Step into the child on the side of the query value. In case there is no child on that side, the frames of the
+            // current node are the nearest ones. This also handles leaf nodes, which have no children at all.
+            const AZ::u32 childIndex = (frameFloats[d] <= curNode->m_median) ? curNode->m_leftNode : curNode->m_rightNode;
+            if (childIndex == InvalidIndex32)
             {
-                // We have either a left and right node, so we're not at a leaf yet.
-                if (curNode->m_leftNode)
-                {
-                    if (frameFloats[d] <= curNode->m_median)
-                    {
-                        curNode = curNode->m_leftNode;
-                    }
-                    else
-                    {
-                        nodeToSearch = curNode;
-                    }
-                }
-                else // We have a right node.
-                {
-                    if (frameFloats[d] > curNode->m_median)
-                    {
-                        curNode = curNode->m_rightNode;
-                    }
-                    else
-                    {
-                        nodeToSearch = curNode;
-                    }
-                }
+                break;
             }
 
-            // If we found our search node, perform a linear search through the frames inside this node.
-            if (nodeToSearch)
-            {
-                //AZ_Assert(d == nodeToSearch->m_dimension, "Dimension mismatch inside kdTree nearest neighbor search.");
-                FindNearestNeighbors(nodeToSearch, frameFloats, resultFrameIndices);
-                return;
-            }
+            curNode = &m_nodes[childIndex];
         }
 
-        FindNearestNeighbors(curNode, frameFloats, resultFrameIndices);
+        return AZStd::span<const size_t>(m_frames.data() + curNode->m_firstFrame, curNode->m_numFrames);
     }
 
-    void KdTree::FindNearestNeighbors([[maybe_unused]] Node* node, [[maybe_unused]] const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
+    void KdTree::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
     {
-        resultFrameIndices = node->m_frames;
+        const AZStd::span<const size_t> nearestFrames = FindNearestNeighbors(AZStd::span<const float>(frameFloats.data(), frameFloats.size()));
+        resultFrameIndices.assign(nearestFrames.begin(), nearestFrames.end());
     }
 } // namespace EMotionFX::MotionMatching
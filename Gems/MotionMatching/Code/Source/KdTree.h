@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
@@ -19,6 +20,10 @@
 
 namespace EMotionFX::MotionMatching
 {
+    //! KD-tree used for the broad-phase search of the motion matching algorithm.
+    //! The tree gets built using temporary heap-allocated nodes and is flattened afterwards, so that the nodes are stored in one array in
+    //! depth-first order and the frames of all nodes are packed into another array. Walking the tree at runtime therefore only touches
+    //! two contiguous blocks of memory and the search result is a view into the packed frames that does not need to be copied.
     class KdTree
     {
     public:
@@ -48,47 +53,67 @@ namespace EMotionFX::MotionMatching
         size_t CalcMemoryUsageInBytes() const;
         bool IsInitialized() const;
 
+        //! Find the frames that are the closest to the given KD-tree query values.
+        //! @param frameFloats The query values, one for each dimension of the tree.
+        //! @result The indices of the nearest frames. The view points into the tree and stays valid until the tree gets cleared or re-initialized.
+        AZStd::span<const size_t> FindNearestNeighbors(AZStd::span<const float> frameFloats) const;
         void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
 
     private:
-        struct Node
+        // Node used while building the tree, only lives during Init().
+        struct BuildNode
         {
-            AZ_RTTI(KdTree::Node, "{8A7944B3-86F1-4A33-84BC-A3B6D599E0C9}");
+            AZ_RTTI(KdTree::BuildNode, "{8A7944B3-86F1-4A33-84BC-A3B6D599E0C9}");
             AZ_CLASS_ALLOCATOR_DECL;
-            virtual ~Node() = default;
+            virtual ~BuildNode() = default;
 
-            Node* m_leftNode = nullptr;
-            Node* m_rightNode = nullptr;
-            Node* m_parent = nullptr;
+            BuildNode* m_leftNode = nullptr;
+            BuildNode* m_rightNode = nullptr;
+            BuildNode* m_parent = nullptr;
             float m_median = 0.0f;
             size_t m_dimension = 0;
             AZStd::vector<size_t> m_frames;
         };
 
+        // Flattened node, children are referenced by their index in m_nodes and the frames by a range in m_frames.
+        struct Node
+        {
+            float m_median = 0.0f;
+            AZ::u32 m_dimension = 0;
+            AZ::u32 m_leftNode = InvalidIndex32;
+            AZ::u32 m_rightNode = InvalidIndex32;
+            AZ::u32 m_firstFrame = 0;
+            AZ::u32 m_numFrames = 0;
+        };
+
         void BuildTreeNodes(const FrameDatabase& frameDatabase,
             const FeatureMatrix& featureMatrix,
             const AZStd::vector<size_t>& localToSchemaFeatureColumns,
-            Node* node,
-            Node* parent,
+            BuildNode* node,
+            BuildNode* parent,
             size_t dimension = 0,
             bool leftSide = true);
-        void FillFramesForNode(Node* node,
+        void FillFramesForNode(BuildNode* node,
             const FrameDatabase& frameDatabase,
             const FeatureMatrix& featureMatrix,
             const AZStd::vector<size_t>& localToSchemaFeatureColumns,
             AZStd::vector<float>& frameFeatureValues,
-            Node* parent,
+            BuildNode* parent,
             bool leftSide);
-        void RecursiveCalcNumFrames(Node* node, size_t& outNumFrames) const;
+        void RecursiveCalcNumFrames(AZ::u32 nodeIndex, size_t& outNumFrames) const;
         void ClearFramesForNonEssentialNodes();
         void MergeSmallLeafNodesToParents();
         void RemoveZeroFrameLeafNodes();
-        void RemoveLeafNode(Node* node);
-        void FindNearestNeighbors(Node* node, const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
+        void RemoveLeafNode(BuildNode* node);
+        AZ::u32 FlattenNode(const BuildNode* buildNode);
+        void FlattenTree();
+        void ClearBuildNodes();
         AZStd::vector<size_t> CalcLocalToSchemaFeatureColumns(const AZStd::vector<Feature*>& features) const;
 
     private:
-        AZStd::vector<Node*> m_nodes;
+        AZStd::vector<BuildNode*> m_buildNodes; //!< Temporary nodes, the first one being the root, only filled while building the tree.
+        AZStd::vector<Node> m_nodes; //!< The flattened nodes in depth-first order, the first one being the root.
+        AZStd::vector<size_t> m_frames; //!< The frame indices of all nodes, packed.
         size_t m_numDimensions = 0;
         size_t m_maxDepth = 20;
         size_t m_minFramesPerLeaf = 1000;
@@ -508,6 +508,7 @@ namespace EMotionFX::MotionMatching
         }
 
         // 2. Broad-phase search using KD-tree
+        AZStd::span<const size_t> nearestFrames;
         if (mm_useKdTree)
         {
             AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseKDTree");
@@ -525,22 +526,15 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == kdTreeQueryVector.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            nearestFrames = m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector);
         }
 
-        // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
-        float minCost = FLT_MAX;
-        size_t minCostFrameIndex = 0;
-        m_tempCosts.resize(featureSchema.GetNumFeatures());
-        m_minCosts.resize(featureSchema.GetNumFeatures());
-        float minTrajectoryPastCost = 0.0f;
-        float minTrajectoryFutureCost = 0.0f;
-
-        // Iterate through the frames filtered by the broad-phase search.
-        const size_t numFrames = mm_useKdTree ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
+        // Gather the frames filtered by the broad-phase search, or all frames in case the KD-tree is not used.
+        m_candidateFrames.clear();
+        const size_t numFrames = mm_useKdTree ? nearestFrames.size() : frameDatabase.GetNumFrames();
         for (size_t i = 0; i < numFrames; ++i)
         {
-            const size_t frameIndex = mm_useKdTree ? m_nearestFrames[i] : i;
+            const size_t frameIndex = mm_useKdTree ? nearestFrames[i] : i;
             const Frame& frame = frameDatabase.GetFrame(frameIndex);
 
             // TODO: This shouldn't be there, we should be discarding the frames when extracting the features and not at runtime when checking the cost.
@@ -549,55 +543,84 @@ namespace EMotionFX::MotionMatching
                 continue;
             }
 
-            float frameCost = 0.0f;
+            m_candidateFrames.emplace_back(frameIndex);
+        }
 
-            // Calculate the frame cost by accumulating the weighted feature costs.
-            for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+        // 3. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
+        // The costs are calculated feature by feature for all candidate frames at once, so that the features can process the frames in batches.
+        const size_t numCandidateFrames = m_candidateFrames.size();
+        const AZStd::span<const size_t> candidateFrames(m_candidateFrames.data(), numCandidateFrames);
+        m_frameCosts.assign(numCandidateFrames, 0.0f);
+        m_featureCosts.resize(numCandidateFrames);
+        {
+            AZ_PROFILE_SCOPE(Animation, "MM::NarrowPhase");
+
+            // Calculate the frame costs by accumulating the weighted feature costs.
+            for (const Feature* feature : featureSchema.GetFeatures())
             {
-                Feature* feature = featureSchema.GetFeature(featureIndex);
-                if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
+                if (feature->RTTI_GetType() == azrtti_typeid<FeatureTrajectory>())
                 {
-                    const float featureCost = feature->CalculateFrameCost(frameIndex, frameCostContext);
-                    const float featureCostFactor = feature->GetCostFactor();
-                    const float featureFinalCost = featureCost * featureCostFactor;
+                    continue;
+                }
 
-                    frameCost += featureFinalCost;
-                    m_tempCosts[featureIndex] = featureFinalCost;
+                feature->CalculateFrameCosts(candidateFrames, frameCostContext, m_featureCosts);
+                const float featureCostFactor = feature->GetCostFactor();
+                for (size_t i = 0; i < numCandidateFrames; ++i)
+                {
+                    m_frameCosts[i] += m_featureCosts[i] * featureCostFactor;
                 }
             }
 
             // Manually add the trajectory cost.
-            float trajectoryPastCost = 0.0f;
-            float trajectoryFutureCost = 0.0f;
             if (trajectoryFeature)
             {
-                trajectoryPastCost = trajectoryFeature->CalculatePastFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
-                trajectoryFutureCost = trajectoryFeature->CalculateFutureFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
-                frameCost += trajectoryPastCost;
-                frameCost += trajectoryFutureCost;
+                for (size_t i = 0; i < numCandidateFrames; ++i)
+                {
+                    const size_t frameIndex = m_candidateFrames[i];
+                    m_frameCosts[i] += trajectoryFeature->CalculatePastFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
+                    m_frameCosts[i] += trajectoryFeature->CalculateFutureFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
+                }
             }
+        }
 
-            // Track the minimum feature and frame costs.
-            if (frameCost < minCost)
+        // Find the frame with the minimum cost.
+        float minCost = FLT_MAX;
+        size_t minCostFrameIndex = 0;
+        size_t minCostCandidate = InvalidIndex;
+        for (size_t i = 0; i < numCandidateFrames; ++i)
+        {
+            if (m_frameCosts[i] < minCost)
             {
-                minCost = frameCost;
-                minCostFrameIndex = frameIndex;
+                minCost = m_frameCosts[i];
+                minCostCandidate = i;
+            }
+        }
+
+        // Track the individual feature costs of the best matching frame for the debug visualizations.
+        m_minCosts.resize(featureSchema.GetNumFeatures());
+        float minTrajectoryPastCost = 0.0f;
+        float minTrajectoryFutureCost = 0.0f;
+        if (minCostCandidate != InvalidIndex)
+        {
+            minCostFrameIndex = m_candidateFrames[minCostCandidate];
 
-                for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+            for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+            {
+                const Feature* feature = featureSchema.GetFeature(featureIndex);
+                if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
                 {
-                    Feature* feature = featureSchema.GetFeature(featureIndex);
-                    if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                    {
-                        m_minCosts[featureIndex] = m_tempCosts[featureIndex];
-                    }
+                    m_minCosts[featureIndex] = feature->CalculateFrameCost(minCostFrameIndex, frameCostContext) * feature->GetCostFactor();
                 }
+            }
 
-                minTrajectoryPastCost = trajectoryPastCost;
-                minTrajectoryFutureCost = trajectoryFutureCost;
+            if (trajectoryFeature)
+            {
+                minTrajectoryPastCost = trajectoryFeature->CalculatePastFrameCost(minCostFrameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
+                minTrajectoryFutureCost = trajectoryFeature->CalculateFutureFrameCost(minCostFrameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
             }
         }
 
-        // 3. ImGui debug visualization
+        // 4. ImGui debug visualization
         {
             const float time = timer.GetDeltaTimeInSeconds();
             ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushPerformanceHistogramValue, "FindLowestCostFrameIndex", time * 1000.0f);
@@ -104,7 +104,6 @@ namespace EMotionFX::MotionMatching
 
         /// Buffers used for the broad-phase KD-tree search.
         QueryVector m_kdTreeQueryVector; //!< The input query for only the features that are present in the KD-tree.
-        AZStd::vector<size_t> m_nearestFrames; //!< Stores the nearest matching frames / search result from the KD-tree.
 
         FeatureTrajectory* m_cachedTrajectoryFeature = nullptr; //< Cached pointer to the trajectory feature in the feature schema.
         TrajectoryQuery m_trajectoryQuery;
@@ -121,7 +120,9 @@ namespace EMotionFX::MotionMatching
         float m_blendProgressTime = 0.0f; //< How long are we already blending? In seconds.
 
         /// Buffers used for FindLowestCostFrameIndex().
-        AZStd::vector<float> m_tempCosts;
+        AZStd::vector<size_t> m_candidateFrames; //!< The frames to evaluate in the narrow-phase, filtered by the broad-phase search.
+        AZStd::vector<float> m_frameCosts; //!< The accumulated cost of each of the candidate frames.
+        AZStd::vector<float> m_featureCosts; //!< The costs of each of the candidate frames for the feature currently being evaluated.
         AZStd::vector<float> m_minCosts;
     };
 } // namespace EMotionFX::MotionMatching
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <Fixture.h>
+#include <KdTree.h>
+#include <RandomFeatureDatabase.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class KdTreeBenchmarkFixture
+        : public BenchmarkFixture
+        , public RandomFeatureDatabase
+    {
+    public:
+        static constexpr size_t s_numQueries = 100;
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            BenchmarkFixture::internalSetUp();
+
+            const size_t numFrames = aznumeric_cast<size_t>(state.range(0));
+            InitFeatures();
+            InitDatabase(numFrames);
+
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                m_queryVectors.emplace_back(CreateQueryVector(m_random.GetRandom() % numFrames));
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_queryVectors.clear();
+            Clear();
+
+            BenchmarkFixture::internalTearDown();
+        }
+
+        const QueryVector& GetQueryVector(size_t iteration) const
+        {
+            return m_queryVectors[iteration % s_numQueries];
+        }
+
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        AZStd::vector<QueryVector> m_queryVectors;
+    };
+
+    BENCHMARK_DEFINE_F(KdTreeBenchmarkFixture, BM_KdTreeInit)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            KdTree kdTree;
+            kdTree.Init(*m_frameDatabase, m_featureMatrix, m_featurePointers);
+            state.counters["Nodes"] = aznumeric_cast<double>(kdTree.GetNumNodes());
+            state.counters["MemoryUsageInBytes"] = aznumeric_cast<double>(kdTree.CalcMemoryUsageInBytes());
+        }
+    }
+
+    // The KD-tree broad-phase followed by the batched narrow-phase over the nearest frames.
+    BENCHMARK_DEFINE_F(KdTreeBenchmarkFixture, BM_KdTreeSearch)(benchmark::State& state)
+    {
+        KdTree kdTree;
+        kdTree.Init(*m_frameDatabase, m_featureMatrix, m_featurePointers);
+
+        AZStd::vector<float> featureCosts(m_frameDatabase->GetNumFrames());
+        size_t iteration = 0;
+        size_t numNearestFrames = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const QueryVector& queryVector = GetQueryVector(iteration++);
+            const AZStd::span<const size_t> nearestFrames = kdTree.FindNearestNeighbors(queryVector.GetData());
+            numNearestFrames += nearestFrames.size();
+
+            const Feature::FrameCostContext context(queryVector, m_featureMatrix);
+            for (const Feature* feature : m_featurePointers)
+            {
+                feature->CalculateFrameCosts(nearestFrames, context, AZStd::span<float>(featureCosts.data(), nearestFrames.size()));
+            }
+            benchmark::DoNotOptimize(featureCosts.data());
+        }
+
+        state.counters["NearestFrames"] = benchmark::Counter(aznumeric_cast<double>(numNearestFrames), benchmark::Counter::kAvgIterations);
+    }
+
+    // Brute force, one frame and feature at a time.
+    BENCHMARK_DEFINE_F(KdTreeBenchmarkFixture, BM_BruteForceScalar)(benchmark::State& state)
+    {
+        const size_t numFrames = m_frameDatabase->GetNumFrames();
+        AZStd::vector<float> frameCosts(numFrames);
+        size_t iteration = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const Feature::FrameCostContext context(GetQueryVector(iteration++), m_featureMatrix);
+            for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+            {
+                float frameCost = 0.0f;
+                for (const Feature* feature : m_featurePointers)
+                {
+                    frameCost += feature->CalculateFrameCost(frameIndex, context);
+                }
+                frameCosts[frameIndex] = frameCost;
+            }
+            benchmark::DoNotOptimize(frameCosts.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Brute force, all frames at once for each feature.
+    BENCHMARK_DEFINE_F(KdTreeBenchmarkFixture, BM_BruteForceBatched)(benchmark::State& state)
+    {
+        const size_t numFrames = m_frameDatabase->GetNumFrames();
+        AZStd::vector<size_t> allFrames(numFrames);
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            allFrames[i] = i;
+        }
+
+        AZStd::vector<float> frameCosts(numFrames);
+        AZStd::vector<float> featureCosts(numFrames);
+        size_t iteration = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const Feature::FrameCostContext context(GetQueryVector(iteration++), m_featureMatrix);
+            AZStd::fill(frameCosts.begin(), frameCosts.end(), 0.0f);
+            for (const Feature* feature : m_featurePointers)
+            {
+                feature->CalculateFrameCosts(allFrames, context, featureCosts);
+                for (size_t i = 0; i < numFrames; ++i)
+                {
+                    frameCosts[i] += featureCosts[i];
+                }
+            }
+            benchmark::DoNotOptimize(frameCosts.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(KdTreeBenchmarkFixture, BM_KdTreeInit)
+        ->Arg(200000)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(KdTreeBenchmarkFixture, BM_KdTreeSearch)
+        ->Arg(200000)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(KdTreeBenchmarkFixture, BM_BruteForceScalar)
+        ->Arg(200000)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(KdTreeBenchmarkFixture, BM_BruteForceBatched)
+        ->Arg(200000)
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX::MotionMatching
+
+#endif
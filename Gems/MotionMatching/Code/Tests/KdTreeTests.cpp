@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Fixture.h>
+#include <KdTree.h>
+#include <RandomFeatureDatabase.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class KdTreeFixture
+        : public Fixture
+        , public RandomFeatureDatabase
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+            InitFeatures();
+        }
+
+        void TearDown() override
+        {
+            Clear();
+            Fixture::TearDown();
+        }
+    };
+
+    TEST_F(KdTreeFixture, FindNearestNeighborsContainsQueryFrame)
+    {
+        constexpr size_t numFrames = 5000;
+        InitDatabase(numFrames);
+
+        KdTree kdTree;
+        ASSERT_TRUE(kdTree.Init(*m_frameDatabase, m_featureMatrix, m_featurePointers, /*maxDepth=*/10, /*minFramesPerLeaf=*/50));
+        EXPECT_EQ(kdTree.GetNumDimensions(), m_numColumns);
+        EXPECT_GT(kdTree.GetNumNodes(), 1);
+
+        AZStd::vector<size_t> resultFrames;
+        for (size_t frameIndex = 0; frameIndex < numFrames; frameIndex += 7)
+        {
+            // Querying with the values of a frame ends up in the node the frame got sorted into while building the tree.
+            const AZStd::vector<float> queryValues = GetFrameValues(frameIndex);
+            const AZStd::span<const size_t> nearestFrames = kdTree.FindNearestNeighbors(queryValues);
+            EXPECT_FALSE(nearestFrames.empty());
+            EXPECT_NE(AZStd::find(nearestFrames.begin(), nearestFrames.end(), frameIndex), nearestFrames.end());
+
+            // The vector version returns a copy of the same frames.
+            kdTree.FindNearestNeighbors(queryValues, resultFrames);
+            ASSERT_EQ(resultFrames.size(), nearestFrames.size());
+            EXPECT_TRUE(AZStd::equal(resultFrames.begin(), resultFrames.end(), nearestFrames.begin()));
+        }
+    }
+
+    TEST_F(KdTreeFixture, Clear)
+    {
+        InitDatabase(1000);
+
+        KdTree kdTree;
+        ASSERT_TRUE(kdTree.Init(*m_frameDatabase, m_featureMatrix, m_featurePointers, /*maxDepth=*/10, /*minFramesPerLeaf=*/50));
+        EXPECT_TRUE(kdTree.IsInitialized());
+
+        kdTree.Clear();
+        EXPECT_FALSE(kdTree.IsInitialized());
+        EXPECT_EQ(kdTree.GetNumNodes(), 0);
+    }
+
+    TEST_F(KdTreeFixture, BatchedFrameCosts)
+    {
+        // The number of frames isn't a multiple of four on purpose, to also run through the remaining frames.
+        constexpr size_t numFrames = 1003;
+        InitDatabase(numFrames);
+
+        // Evaluate the frames in a scattered order, like the frames of a KD-tree node would be.
+        AZStd::vector<size_t> frameIndices(numFrames);
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            frameIndices[i] = (i * 37) % numFrames;
+        }
+
+        const QueryVector queryVector = CreateQueryVector(numFrames / 2);
+        const Feature::FrameCostContext context(queryVector, m_featureMatrix);
+        AZStd::vector<float> costs(numFrames);
+        for (const Feature* feature : m_featurePointers)
+        {
+            feature->CalculateFrameCosts(frameIndices, context, costs);
+            for (size_t i = 0; i < numFrames; ++i)
+            {
+                EXPECT_NEAR(costs[i], feature->CalculateFrameCost(frameIndices[i], context), 1e-5f);
+            }
+        }
+    }
+
+    TEST_F(KdTreeFixture, LowestCostFrameSearch)
+    {
+        constexpr size_t numFrames = 5000;
+        InitDatabase(numFrames);
+
+        KdTree kdTree;
+        ASSERT_TRUE(kdTree.Init(*m_frameDatabase, m_featureMatrix, m_featurePointers, /*maxDepth=*/10, /*minFramesPerLeaf=*/50));
+
+        // Finds the lowest cost frame among the given frames the same way the motion matching instance does in its narrow-phase.
+        auto findLowestCostFrame = [this](AZStd::span<const size_t> candidateFrames, const Feature::FrameCostContext& context)
+        {
+            AZStd::vector<float> frameCosts(candidateFrames.size(), 0.0f);
+            AZStd::vector<float> featureCosts(candidateFrames.size());
+            for (const Feature* feature : m_featurePointers)
+            {
+                feature->CalculateFrameCosts(candidateFrames, context, featureCosts);
+                for (size_t i = 0; i < candidateFrames.size(); ++i)
+                {
+                    frameCosts[i] += featureCosts[i] * feature->GetCostFactor();
+                }
+            }
+
+            const auto minCostIterator = AZStd::min_element(frameCosts.begin(), frameCosts.end());
+            return candidateFrames[AZStd::distance(frameCosts.begin(), minCostIterator)];
+        };
+
+        AZStd::vector<size_t> allFrames(numFrames);
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            allFrames[i] = i;
+        }
+
+        for (size_t queryFrameIndex = 0; queryFrameIndex < numFrames; queryFrameIndex += 101)
+        {
+            // Querying with the values of a frame has zero cost for that frame, so both the broad-phase filtered and the brute force
+            // search have to find it.
+            const QueryVector queryVector = CreateQueryVector(queryFrameIndex);
+            const Feature::FrameCostContext context(queryVector, m_featureMatrix);
+
+            const AZStd::span<const size_t> nearestFrames = kdTree.FindNearestNeighbors(queryVector.GetData());
+            ASSERT_FALSE(nearestFrames.empty());
+            EXPECT_EQ(findLowestCostFrame(nearestFrames, context), queryFrameIndex);
+            EXPECT_EQ(findLowestCostFrame(allFrames, context), queryFrameIndex);
+        }
+    }
+} // namespace EMotionFX::MotionMatching
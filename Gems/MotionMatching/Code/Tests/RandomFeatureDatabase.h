@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <FeatureMatrix.h>
+#include <FeaturePosition.h>
+#include <FeatureVelocity.h>
+#include <Frame.h>
+#include <FrameDatabase.h>
+#include <QueryVector.h>
+
+namespace EMotionFX::MotionMatching
+{
+    // A frame database with a position and a velocity feature, filled with random feature values.
+    // Shared by the KD-tree tests and benchmarks.
+    class RandomFeatureDatabase
+    {
+    public:
+        void InitFeatures()
+        {
+            m_features.emplace_back(AZStd::make_unique<FeaturePosition>());
+            m_features.emplace_back(AZStd::make_unique<FeatureVelocity>());
+
+            size_t columnOffset = 0;
+            for (const auto& feature : m_features)
+            {
+                feature->SetColumnOffset(columnOffset);
+                columnOffset += feature->GetNumDimensions();
+                m_featurePointers.emplace_back(feature.get());
+            }
+            m_numColumns = columnOffset;
+        }
+
+        void Clear()
+        {
+            m_featurePointers.clear();
+            m_features.clear();
+            m_frameDatabase.reset();
+            m_featureMatrix.resize(0, 0);
+        }
+
+        // Fill the feature matrix with random values for the given number of frames.
+        void InitDatabase(size_t numFrames)
+        {
+            m_frameDatabase = AZStd::make_unique<FrameDatabase>();
+            AZStd::vector<Frame>& frames = m_frameDatabase->GetFrames();
+            frames.reserve(numFrames);
+            for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+            {
+                frames.emplace_back(Frame(frameIndex, nullptr, 0.0f, false));
+            }
+
+            m_featureMatrix.resize(numFrames, m_numColumns);
+            for (size_t row = 0; row < numFrames; ++row)
+            {
+                for (size_t column = 0; column < m_numColumns; ++column)
+                {
+                    m_featureMatrix(row, column) = m_random.GetRandomFloat() * 2.0f - 1.0f;
+                }
+            }
+        }
+
+        // Use the feature values of the given frame as query.
+        AZStd::vector<float> GetFrameValues(size_t frameIndex) const
+        {
+            AZStd::vector<float> values(m_numColumns);
+            for (size_t column = 0; column < m_numColumns; ++column)
+            {
+                values[column] = m_featureMatrix(frameIndex, column);
+            }
+            return values;
+        }
+
+        QueryVector CreateQueryVector(size_t frameIndex) const
+        {
+            QueryVector queryVector;
+            queryVector.GetData() = GetFrameValues(frameIndex);
+            return queryVector;
+        }
+
+        AZStd::vector<AZStd::unique_ptr<Feature>> m_features;
+        AZStd::vector<Feature*> m_featurePointers;
+        AZStd::unique_ptr<FrameDatabase> m_frameDatabase;
+        FeatureMatrix m_featureMatrix;
+        size_t m_numColumns = 0;
+        AZ::SimpleLcgRandom m_random;
+    };
+} // namespace EMotionFX::MotionMatching
@@ -10,7 +10,10 @@ set(FILES
     Tests/Fixture.h
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
+    Tests/KdTreeBenchmarks.cpp
+    Tests/KdTreeTests.cpp
     Tests/MinMaxScalerTests.cpp
     Tests/MotionMatchingTest.cpp
+    Tests/RandomFeatureDatabase.h
     Tests/StandardScalerTests.cpp
 )
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Serialization/TrackChangedSerializer.h>
@@ -28,17 +30,27 @@ namespace AzNetworking
 
 namespace Multiplayer
 {
+    // Replicated properties and rpcs can optionally be bit-packed, so bounded and quantized values only consume the bits their range requires
+    // This changes the wire format, so it is opted into at build time with O3DE_MULTIPLAYER_BIT_PACKED_SERIALIZATION and every peer must agree
+#if O3DE_MULTIPLAYER_BIT_PACKED_SERIALIZATION
+    using NetworkInputSerializerType = AzNetworking::NetworkBitInputSerializer;
+    using NetworkOutputSerializerType = AzNetworking::NetworkBitOutputSerializer;
+#else
+    using NetworkInputSerializerType = AzNetworking::NetworkInputSerializer;
+    using NetworkOutputSerializerType = AzNetworking::NetworkOutputSerializer;
+#endif
+
 #ifdef AZ_RELEASE_BUILD
     // Disable serializer type validation in release
-    using InputSerializer = AzNetworking::NetworkInputSerializer;
-    using OutputSerializer = AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer>;
-    using RpcInputSerializer = AzNetworking::NetworkInputSerializer;
-    using RpcOutputSerializer = AzNetworking::NetworkOutputSerializer;
+    using InputSerializer = NetworkInputSerializerType;
+    using OutputSerializer = AzNetworking::TrackChangedSerializer<NetworkOutputSerializerType>;
+    using RpcInputSerializer = NetworkInputSerializerType;
+    using RpcOutputSerializer = NetworkOutputSerializerType;
 #else
-    using InputSerializer = AzNetworking::TypeValidatingSerializer<AzNetworking::NetworkInputSerializer>;
-    using OutputSerializer = AzNetworking::TypeValidatingSerializer<AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer>>;
-    using RpcInputSerializer = AzNetworking::TypeValidatingSerializer<AzNetworking::NetworkInputSerializer>;
-    using RpcOutputSerializer = AzNetworking::TypeValidatingSerializer<AzNetworking::NetworkOutputSerializer>;
+    using InputSerializer = AzNetworking::TypeValidatingSerializer<NetworkInputSerializerType>;
+    using OutputSerializer = AzNetworking::TypeValidatingSerializer<AzNetworking::TrackChangedSerializer<NetworkOutputSerializerType>>;
+    using RpcInputSerializer = AzNetworking::TypeValidatingSerializer<NetworkInputSerializerType>;
+    using RpcOutputSerializer = AzNetworking::TypeValidatingSerializer<NetworkOutputSerializerType>;
 #endif
 
     //! Collection of types of Multiplayer Connections
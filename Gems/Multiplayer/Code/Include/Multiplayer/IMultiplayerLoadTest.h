@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/Event.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Time/ITime.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    class NetworkInput;
+
+    //! @struct MultiplayerLoadTestReport
+    //! @brief Summary of a load test run, gathered from the host and all of its simulated clients.
+    struct MultiplayerLoadTestReport
+    {
+        uint32_t m_requestedClientCount = 0;
+        uint32_t m_connectedClientCount = 0;
+        uint32_t m_disconnectedClientCount = 0;
+        AZ::TimeMs m_elapsedTimeMs = AZ::Time::ZeroTimeMs;
+
+        //! Host replication tick times, only ticks that sent entity updates are sampled
+        uint64_t m_serverTickCount = 0;
+        AZ::TimeUs m_averageTickTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_p50TickTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_p99TickTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_maxTickTimeUs = AZ::Time::ZeroTimeUs;
+
+        //! Bytes received by all simulated clients, measured after packet decoding
+        uint64_t m_totalBytesReceived = 0;
+        double m_bytesReceivedPerClientPerSecond = 0.0;
+        //! Current upstream datarate of the simulated clients, as measured by their connections
+        double m_bytesSentPerClientPerSecond = 0.0;
+        uint64_t m_entityUpdatePacketsReceived = 0;
+        uint64_t m_inputsSent = 0;
+
+        //! Time from the host sending a frame of entity updates until a simulated client has consumed it
+        uint64_t m_latencySampleCount = 0;
+        AZ::TimeUs m_p50LatencyUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_p95LatencyUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_p99LatencyUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_maxLatencyUs = AZ::Time::ZeroTimeUs;
+    };
+
+    //! Signalled each time a simulated client forms an input, allowing a project to script the input stream.
+    //! The first parameter is the index of the simulated client, the second the input being sent.
+    using LoadTestCreateInputEvent = AZ::Event<uint32_t, NetworkInput&>;
+
+    //! @class IMultiplayerLoadTest
+    //! @brief IMultiplayerLoadTest drives lightweight simulated clients against the local host to measure replication throughput.
+    //!
+    //! Simulated clients connect to the hosting network interface over loopback, perform the regular multiplayer handshake,
+    //! consume entity updates without instantiating entities and send a stream of inputs for their autonomous entity.
+    //! This allows server builds to be regression tested without launching real clients.
+    class IMultiplayerLoadTest
+    {
+    public:
+        AZ_RTTI(IMultiplayerLoadTest, "{5E0B7D0C-37A4-4F1B-9C1E-6A83C3D0F5A2}");
+
+        virtual ~IMultiplayerLoadTest() = default;
+
+        //! Starts a load test, connecting the requested number of simulated clients to the local host.
+        //! @param clientCount number of simulated clients to connect
+        //! @return boolean true if the load test was started
+        virtual bool StartLoadTest(uint32_t clientCount) = 0;
+
+        //! Stops any running load test, disconnecting all simulated clients.
+        virtual void StopLoadTest() = 0;
+
+        //! Returns whether or not a load test is currently running.
+        //! @return boolean true if a load test is running
+        virtual bool IsLoadTestRunning() const = 0;
+
+        //! Generates a report for the running or most recently stopped load test.
+        //! @return the load test report
+        virtual MultiplayerLoadTestReport GetLoadTestReport() const = 0;
+
+        //! Adds a handler invoked whenever a simulated client forms an input.
+        //! @param handler the handler to add
+        virtual void AddCreateInputHandler(LoadTestCreateInputEvent::Handler& handler) = 0;
+    };
+}
@@ -25,6 +25,7 @@ namespace Multiplayer
         AZ::u64 m_entityCount = 0;
         AZ::u64 m_clientConnectionCount = 0;
         AZ::u64 m_serverConnectionCount = 0;
+        AZ::TimeUs m_lastFrameTimeUs = AZ::Time::ZeroTimeUs;
 
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::Time::ZeroTimeMs;
@@ -8,12 +8,22 @@
 
 #pragma once
 
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Time/ITime.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace Multiplayer
 {
+    //! A single entity found by a batched rewind volume query.
+    struct RewindQueryHit
+    {
+        uint32_t m_volumeIndex = 0; //!< Index of the query volume the entity overlaps
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+    };
+
     //! @class INetworkTime
     //! @brief This is an AZ::Interface<> for managing multiplayer specific time related operations.
     class INetworkTime
@@ -68,6 +78,17 @@ namespace Multiplayer
         //! @param rewindVolume the volume to rewind entities within (needed for physics entities)
         virtual void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) = 0;
 
+        //! Syncs all entities contained within any of the provided volumes to the current rewind state.
+        //! Prefer this over repeated calls to SyncEntitiesToRewindState when resolving many hit checks in the same rewind scope.
+        //! @param rewindVolumes the volumes to rewind entities within
+        virtual void SyncEntitiesToRewindVolumes(AZStd::span<const AZ::Aabb> rewindVolumes) = 0;
+
+        //! Finds the entities whose bounds at the current rewound frame overlap the provided volumes, without syncing them.
+        //! Only entities captured in the rewind history are returned, this is empty outside of a rewind scope.
+        //! @param rewindVolumes the volumes to test against
+        //! @param outHits receives one hit per overlapping entity and volume pair
+        virtual void QueryRewoundEntities(AZStd::span<const AZ::Aabb> rewindVolumes, AZStd::vector<RewindQueryHit>& outHits) const = 0;
+
         //! Restores all rewound entities to the current application time.
         virtual void ClearRewoundEntities() = 0;
 
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/MultiplayerLoadTestClient.h>
+#include <Source/LoadTest/MultiplayerLoadTestMetrics.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/LocalPredictionPlayerInputComponent.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    MultiplayerLoadTestClient::MultiplayerLoadTestClient(uint32_t clientIndex, MultiplayerLoadTestMetrics& metrics, LoadTestCreateInputEvent& createInputEvent)
+        : m_clientIndex(clientIndex)
+        , m_metrics(metrics)
+        , m_createInputEvent(createInputEvent)
+    {
+        m_interfaceName = AZ::Name(AZStd::string::format("MultiplayerLoadTestClient%u", clientIndex));
+        m_networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_interfaceName, ProtocolType::Udp, TrustZone::ExternalClientToServer, *this);
+    }
+
+    MultiplayerLoadTestClient::~MultiplayerLoadTestClient()
+    {
+        if (m_connection != nullptr)
+        {
+            m_connection->Disconnect(DisconnectReason::TerminatedByUser, TerminationEndpoint::Local);
+        }
+        AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(m_interfaceName);
+    }
+
+    bool MultiplayerLoadTestClient::Connect(const IpAddress& hostAddress)
+    {
+        if (m_networkInterface == nullptr)
+        {
+            return false;
+        }
+        return m_networkInterface->Connect(hostAddress) != InvalidConnectionId;
+    }
+
+    void MultiplayerLoadTestClient::UpdateInput(AZ::TimeMs currentTimeMs, AZ::TimeMs inputRateMs)
+    {
+        if ((m_connection == nullptr) || (m_inputComponentId == InvalidNetComponentId))
+        {
+            return;
+        }
+
+        if (m_nextInputTimeMs == AZ::Time::ZeroTimeMs)
+        {
+            m_nextInputTimeMs = currentTimeMs;
+        }
+
+        // Bound the number of inputs sent per update so a stalled host frame does not cause a burst that trips input banking
+        for (uint32_t inputCount = 0; (m_nextInputTimeMs <= currentTimeMs) && (inputCount < NetworkInputArray::MaxElements); ++inputCount)
+        {
+            SendInput();
+            m_nextInputTimeMs += inputRateMs;
+        }
+        m_nextInputTimeMs = AZStd::max(m_nextInputTimeMs, currentTimeMs - inputRateMs);
+    }
+
+    bool MultiplayerLoadTestClient::IsConnected() const
+    {
+        return m_didHandshake && (m_connection != nullptr);
+    }
+
+    bool MultiplayerLoadTestClient::WasDisconnected() const
+    {
+        return m_wasDisconnected;
+    }
+
+    uint64_t MultiplayerLoadTestClient::GetBytesReceived() const
+    {
+        return m_bytesReceived;
+    }
+
+    float MultiplayerLoadTestClient::GetSendBytesPerSecond() const
+    {
+        return (m_connection != nullptr) ? m_connection->GetMetrics().m_sendDatarate.GetBytesPerSecond() : 0.0f;
+    }
+
+    uint64_t MultiplayerLoadTestClient::GetEntityUpdatePacketsReceived() const
+    {
+        return m_entityUpdatePacketsReceived;
+    }
+
+    uint64_t MultiplayerLoadTestClient::GetInputsSent() const
+    {
+        return m_inputsSent;
+    }
+
+    bool MultiplayerLoadTestClient::IsHandshakeComplete([[maybe_unused]] IConnection* connection) const
+    {
+        return m_didHandshake;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Connect& packet
+    )
+    {
+        // Simulated clients never accept connections
+        return false;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Accept& packet
+    )
+    {
+        // Simulated clients have no level to load, so immediately ready the connection for entity updates
+        m_didHandshake = true;
+        connection->SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(true));
+        return true;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ReadyForEntityUpdates& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::SyncConsole& packet
+    )
+    {
+        // Simulated clients share a console with the host, replicated cvars must not be applied
+        return true;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ConsoleCommand& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityUpdates& packet
+    )
+    {
+        ++m_entityUpdatePacketsReceived;
+        if ((packet.GetHostFrameId() != InvalidHostFrameId) && (packet.GetHostFrameId() != m_lastHostFrameId))
+        {
+            m_lastHostFrameId = packet.GetHostFrameId();
+            m_lastHostTimeMs = packet.GetHostTimeMs();
+            m_metrics.RecordHostFrameReceived(m_lastHostFrameId, AZ::GetRealElapsedTimeUs());
+        }
+
+        for (const NetworkEntityUpdateMessage& updateMessage : packet.GetEntityMessages())
+        {
+            if (updateMessage.GetIsDelete())
+            {
+                if (updateMessage.GetEntityId() == m_autonomousEntityId)
+                {
+                    SetAutonomousEntity(InvalidNetEntityId);
+                }
+            }
+            else if ((updateMessage.GetNetworkRole() == NetEntityRole::Autonomous) && (updateMessage.GetEntityId() != m_autonomousEntityId))
+            {
+                SetAutonomousEntity(updateMessage.GetEntityId());
+            }
+        }
+        return true;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityRpcs& packet
+    )
+    {
+        // Rpcs such as input corrections are consumed but not applied, simulated clients do not predict
+        return true;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::RequestReplicatorReset& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigration& packet
+    )
+    {
+        // Migration is not supported by simulated clients
+        return false;
+    }
+
+    bool MultiplayerLoadTestClient::HandleRequest
+    (
+        [[maybe_unused]] IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::VersionMismatch& packet
+    )
+    {
+        AZLOG_WARN("Load test client %u was rejected by the host due to a multiplayer component version mismatch", m_clientIndex);
+        return false;
+    }
+
+    ConnectResult MultiplayerLoadTestClient::ValidateConnect
+    (
+        [[maybe_unused]] const IpAddress& remoteAddress,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] ISerializer& serializer
+    )
+    {
+        return ConnectResult::Rejected;
+    }
+
+    void MultiplayerLoadTestClient::OnConnect(IConnection* connection)
+    {
+        m_connection = connection;
+        const uint64_t temporaryUserId = 0;
+        connection->SendReliablePacket(MultiplayerPackets::Connect(
+            0,
+            temporaryUserId,
+            "",
+            GetMultiplayerComponentRegistry()->GetSystemVersionHash()));
+    }
+
+    PacketDispatchResult MultiplayerLoadTestClient::OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        const PacketDispatchResult result = MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+        // The serializer spans the whole receive buffer, count only the bytes the packet actually consumed
+        m_bytesReceived += serializer.GetSize();
+        return result;
+    }
+
+    void MultiplayerLoadTestClient::OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId)
+    {
+        ;
+    }
+
+    void MultiplayerLoadTestClient::OnDisconnect
+    (
+        [[maybe_unused]] IConnection* connection,
+        DisconnectReason reason,
+        [[maybe_unused]] TerminationEndpoint endpoint
+    )
+    {
+        if (endpoint == TerminationEndpoint::Remote)
+        {
+            const AZStd::string reasonString = ToString(reason);
+            AZLOG_WARN("Load test client %u was disconnected by the host due to %s", m_clientIndex, reasonString.c_str());
+        }
+        m_connection = nullptr;
+        m_didHandshake = false;
+        m_wasDisconnected = true;
+        SetAutonomousEntity(InvalidNetEntityId);
+    }
+
+    void MultiplayerLoadTestClient::SetAutonomousEntity(NetEntityId entityId)
+    {
+        m_autonomousEntityId = entityId;
+        m_inputComponentId = InvalidNetComponentId;
+        m_inputArray = NetworkInputArray();
+
+        // Simulated clients run within the host process, so the host entity is used to allocate the component inputs.
+        // This ensures inputs carry the same set of component inputs a real client would send for this entity.
+        ConstNetworkEntityHandle entityHandle = GetNetworkEntityManager()->GetEntity(entityId);
+        if (const LocalPredictionPlayerInputComponent* inputComponent = entityHandle.FindComponent<LocalPredictionPlayerInputComponent>())
+        {
+            m_inputComponentId = inputComponent->GetNetComponentId();
+            m_inputArray = NetworkInputArray(entityHandle);
+        }
+    }
+
+    void MultiplayerLoadTestClient::SendInput()
+    {
+        // Age the previously sent inputs so the array carries redundant history, as a real client would
+        for (uint32_t i = NetworkInputArray::MaxElements - 1; i > 0; --i)
+        {
+            m_inputArray[i] = m_inputArray[i - 1];
+        }
+
+        ++m_clientInputId;
+        NetworkInput& input = m_inputArray[0];
+        input.SetClientInputId(m_clientInputId);
+        input.SetHostFrameId(m_lastHostFrameId);
+        input.SetHostTimeMs(m_lastHostTimeMs);
+        input.SetHostBlendFactor(1.0f);
+        m_createInputEvent.Signal(m_clientIndex, input);
+
+        // Built through the generated component so the rpc index and parameters always match LocalPredictionPlayerInputComponent
+        NetworkEntityRpcMessage rpcMessage = LocalPredictionPlayerInputComponent::CreateSendClientInputRpcMessage(
+            m_autonomousEntityId, m_inputComponentId, m_inputArray, AZ::HashValue32{ 0 });
+
+        MultiplayerPackets::EntityRpcs entityRpcsPacket;
+        entityRpcsPacket.ModifyEntityRpcs().push_back(AZStd::move(rpcMessage));
+        m_connection->SendUnreliablePacket(entityRpcsPacket);
+        ++m_inputsSent;
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
+#include <AzCore/Name/Name.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <Multiplayer/IMultiplayerLoadTest.h>
+#include <Multiplayer/NetworkInput/NetworkInputArray.h>
+
+namespace AzNetworking
+{
+    class INetworkInterface;
+}
+
+namespace Multiplayer
+{
+    class MultiplayerLoadTestMetrics;
+
+    //! @class MultiplayerLoadTestClient
+    //! @brief A lightweight simulated client used by the multiplayer load test.
+    //!
+    //! Each simulated client owns its own udp network interface and connection to the host. It performs the same handshake as
+    //! a real client, consumes entity updates without instantiating any entities and sends inputs for its autonomous entity.
+    class MultiplayerLoadTestClient final
+        : public AzNetworking::IConnectionListener
+    {
+    public:
+        MultiplayerLoadTestClient(uint32_t clientIndex, MultiplayerLoadTestMetrics& metrics, LoadTestCreateInputEvent& createInputEvent);
+        ~MultiplayerLoadTestClient() override;
+
+        //! Opens a connection to the provided host address.
+        //! @param hostAddress address of the host to connect to
+        //! @return boolean true if the connection attempt was started
+        bool Connect(const AzNetworking::IpAddress& hostAddress);
+
+        //! Sends any inputs that are due for this client.
+        //! @param currentTimeMs the current real elapsed time
+        //! @param inputRateMs   the rate at which inputs are sent
+        void UpdateInput(AZ::TimeMs currentTimeMs, AZ::TimeMs inputRateMs);
+
+        bool IsConnected() const;
+        bool WasDisconnected() const;
+        uint64_t GetBytesReceived() const;
+        float GetSendBytesPerSecond() const;
+        uint64_t GetEntityUpdatePacketsReceived() const;
+        uint64_t GetInputsSent() const;
+
+        bool IsHandshakeComplete(AzNetworking::IConnection* connection) const;
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Connect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Accept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ReadyForEntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::SyncConsole& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ConsoleCommand& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::RequestReplicatorReset& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::VersionMismatch& packet);
+
+        //! IConnectionListener interface
+        //! @{
+        AzNetworking::ConnectResult ValidateConnect(const AzNetworking::IpAddress& remoteAddress, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnConnect(AzNetworking::IConnection* connection) override;
+        AzNetworking::PacketDispatchResult OnPacketReceived(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnPacketLost(AzNetworking::IConnection* connection, AzNetworking::PacketId packetId) override;
+        void OnDisconnect(AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        //! @}
+
+    private:
+        void SetAutonomousEntity(NetEntityId entityId);
+        void SendInput();
+
+        uint32_t m_clientIndex = 0;
+        MultiplayerLoadTestMetrics& m_metrics;
+        LoadTestCreateInputEvent& m_createInputEvent;
+
+        AZ::Name m_interfaceName;
+        AzNetworking::INetworkInterface* m_networkInterface = nullptr;
+        AzNetworking::IConnection* m_connection = nullptr;
+        bool m_didHandshake = false;
+        bool m_wasDisconnected = false;
+
+        NetEntityId m_autonomousEntityId = InvalidNetEntityId;
+        NetComponentId m_inputComponentId = InvalidNetComponentId;
+        NetworkInputArray m_inputArray;
+        ClientInputId m_clientInputId = ClientInputId{ 0 };
+        HostFrameId m_lastHostFrameId = InvalidHostFrameId;
+        AZ::TimeMs m_lastHostTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_nextInputTimeMs = AZ::Time::ZeroTimeMs;
+
+        uint64_t m_bytesReceived = 0;
+        uint64_t m_entityUpdatePacketsReceived = 0;
+        uint64_t m_inputsSent = 0;
+    };
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/MultiplayerLoadTestMetrics.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    void MultiplayerLoadTestMetrics::Reset()
+    {
+        m_hostFrames.fill(HostFrameEntry());
+        m_tickTimes.clear();
+        m_latencies.clear();
+    }
+
+    void MultiplayerLoadTestMetrics::RecordTickTime(AZ::TimeUs tickTimeUs)
+    {
+        m_tickTimes.push_back(tickTimeUs);
+    }
+
+    void MultiplayerLoadTestMetrics::RecordHostFrameSent(HostFrameId hostFrameId, AZ::TimeUs sendTimeUs)
+    {
+        HostFrameEntry& entry = m_hostFrames[static_cast<uint32_t>(hostFrameId) % HostFrameHistorySize];
+        entry.m_hostFrameId = hostFrameId;
+        entry.m_sendTimeUs = sendTimeUs;
+    }
+
+    void MultiplayerLoadTestMetrics::RecordHostFrameReceived(HostFrameId hostFrameId, AZ::TimeUs receiveTimeUs)
+    {
+        const HostFrameEntry& entry = m_hostFrames[static_cast<uint32_t>(hostFrameId) % HostFrameHistorySize];
+        if (entry.m_hostFrameId != hostFrameId)
+        {
+            // Either the host frame was never recorded or it has already been overwritten by a newer frame
+            return;
+        }
+        m_latencies.push_back(AZStd::max(receiveTimeUs - entry.m_sendTimeUs, AZ::Time::ZeroTimeUs));
+    }
+
+    void MultiplayerLoadTestMetrics::FillReport(MultiplayerLoadTestReport& report) const
+    {
+        AZStd::vector<AZ::TimeUs> tickTimes = m_tickTimes;
+        report.m_serverTickCount = tickTimes.size();
+        if (!tickTimes.empty())
+        {
+            AZ::TimeUs totalTickTimeUs = AZ::Time::ZeroTimeUs;
+            for (AZ::TimeUs tickTimeUs : tickTimes)
+            {
+                totalTickTimeUs += tickTimeUs;
+            }
+            report.m_averageTickTimeUs = totalTickTimeUs / static_cast<AZ::TimeUs>(tickTimes.size());
+            report.m_p50TickTimeUs = ComputePercentile(tickTimes, 50.0f);
+            report.m_p99TickTimeUs = ComputePercentile(tickTimes, 99.0f);
+            report.m_maxTickTimeUs = ComputePercentile(tickTimes, 100.0f);
+        }
+
+        AZStd::vector<AZ::TimeUs> latencies = m_latencies;
+        report.m_latencySampleCount = latencies.size();
+        report.m_p50LatencyUs = ComputePercentile(latencies, 50.0f);
+        report.m_p95LatencyUs = ComputePercentile(latencies, 95.0f);
+        report.m_p99LatencyUs = ComputePercentile(latencies, 99.0f);
+        report.m_maxLatencyUs = ComputePercentile(latencies, 100.0f);
+    }
+
+    AZ::TimeUs MultiplayerLoadTestMetrics::ComputePercentile(AZStd::vector<AZ::TimeUs>& samples, float percentile)
+    {
+        if (samples.empty())
+        {
+            return AZ::Time::ZeroTimeUs;
+        }
+
+        // Nearest-rank method, the smallest sample such that at least percentile% of the samples are less than or equal to it
+        const float clampedPercentile = AZStd::clamp(percentile, 0.0f, 100.0f);
+        const size_t rank = static_cast<size_t>(AZStd::ceil(clampedPercentile / 100.0f * static_cast<float>(samples.size())));
+        const size_t index = AZStd::clamp<size_t>(rank, 1, samples.size()) - 1;
+        AZStd::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index];
+    }
+}
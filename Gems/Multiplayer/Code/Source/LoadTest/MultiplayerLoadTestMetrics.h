@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/IMultiplayerLoadTest.h>
+
+namespace Multiplayer
+{
+    //! @class MultiplayerLoadTestMetrics
+    //! @brief Accumulates host tick times and replication latency samples over the course of a load test.
+    class MultiplayerLoadTestMetrics
+    {
+    public:
+        //! Number of recent host frames whose send time is retained for latency measurement.
+        static constexpr uint32_t HostFrameHistorySize = 256;
+
+        //! Discards all recorded samples.
+        void Reset();
+
+        //! Records the time spent in a host replication tick.
+        //! @param tickTimeUs duration of the host tick
+        void RecordTickTime(AZ::TimeUs tickTimeUs);
+
+        //! Records the time at which the host sent the entity updates for a frame.
+        //! @param hostFrameId the host frame that was sent
+        //! @param sendTimeUs  the real elapsed time at which the frame was sent
+        void RecordHostFrameSent(HostFrameId hostFrameId, AZ::TimeUs sendTimeUs);
+
+        //! Records the consumption of a frame of entity updates by a simulated client.
+        //! Updates for frames that are no longer in the host frame history are ignored.
+        //! @param hostFrameId   the host frame the updates belong to
+        //! @param receiveTimeUs the real elapsed time at which the updates were consumed
+        void RecordHostFrameReceived(HostFrameId hostFrameId, AZ::TimeUs receiveTimeUs);
+
+        //! Fills in the tick time and latency members of a load test report.
+        //! @param report the report to fill in
+        void FillReport(MultiplayerLoadTestReport& report) const;
+
+        //! Returns the nearest-rank percentile of a set of samples.
+        //! @param samples    the samples to compute the percentile of, these will be reordered
+        //! @param percentile the percentile to compute, in the range [0, 100]
+        //! @return the sample at the requested percentile, or zero if there are no samples
+        static AZ::TimeUs ComputePercentile(AZStd::vector<AZ::TimeUs>& samples, float percentile);
+
+    private:
+        struct HostFrameEntry
+        {
+            HostFrameId m_hostFrameId = InvalidHostFrameId;
+            AZ::TimeUs m_sendTimeUs = AZ::Time::ZeroTimeUs;
+        };
+
+        AZStd::array<HostFrameEntry, HostFrameHistorySize> m_hostFrames;
+        AZStd::vector<AZ::TimeUs> m_tickTimes;
+        AZStd::vector<AZ::TimeUs> m_latencies;
+    };
+}
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/MultiplayerLoadTestSystemComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/API/ApplicationAPI.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/MultiplayerConstants.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    AZ_CVAR(uint32_t, mp_loadtest_clientCount, 100, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of simulated clients mp_loadtest_start connects when no count is provided");
+    AZ_CVAR(uint32_t, mp_loadtest_connectsPerTick, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The maximum number of simulated clients that begin connecting each tick, avoids flooding the host with handshakes");
+    AZ_CVAR(AZ::TimeMs, mp_loadtest_inputRateMs, AZ::TimeMs{ 33 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The rate at which simulated clients send inputs, should match cl_InputRateMs");
+    AZ_CVAR(AZ::TimeMs, mp_loadtest_durationMs, AZ::Time::ZeroTimeMs, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If non-zero, the load test stops itself and reports its results after running for this long");
+    AZ_CVAR(bool, mp_loadtest_exitOnComplete, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the application exits once a load test with a duration has completed");
+    AZ_CVAR(AZ::CVarFixedString, mp_loadtest_reportFile, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If set, load test reports are also written as json to this file, placed under <ProjectFolder>/user/Metrics");
+
+    static void LogLoadTestReport(const MultiplayerLoadTestReport& report)
+    {
+        AZLOG_INFO("Load test clients: %u requested, %u connected, %u disconnected",
+            report.m_requestedClientCount, report.m_connectedClientCount, report.m_disconnectedClientCount);
+        AZLOG_INFO("Load test duration: %lld ms", static_cast<long long>(report.m_elapsedTimeMs));
+        AZLOG_INFO("Host tick time: %llu ticks, avg %lld us, p50 %lld us, p99 %lld us, max %lld us",
+            aznumeric_cast<AZ::u64>(report.m_serverTickCount),
+            static_cast<long long>(report.m_averageTickTimeUs),
+            static_cast<long long>(report.m_p50TickTimeUs),
+            static_cast<long long>(report.m_p99TickTimeUs),
+            static_cast<long long>(report.m_maxTickTimeUs));
+        AZLOG_INFO("Client traffic: %llu bytes received, %.1f bytes/s received per client, %.1f bytes/s sent per client",
+            aznumeric_cast<AZ::u64>(report.m_totalBytesReceived),
+            report.m_bytesReceivedPerClientPerSecond,
+            report.m_bytesSentPerClientPerSecond);
+        AZLOG_INFO("Client packets: %llu entity update packets received, %llu inputs sent",
+            aznumeric_cast<AZ::u64>(report.m_entityUpdatePacketsReceived),
+            aznumeric_cast<AZ::u64>(report.m_inputsSent));
+        AZLOG_INFO("Replication latency: %llu samples, p50 %lld us, p95 %lld us, p99 %lld us, max %lld us",
+            aznumeric_cast<AZ::u64>(report.m_latencySampleCount),
+            static_cast<long long>(report.m_p50LatencyUs),
+            static_cast<long long>(report.m_p95LatencyUs),
+            static_cast<long long>(report.m_p99LatencyUs),
+            static_cast<long long>(report.m_maxLatencyUs));
+    }
+
+    static void WriteLoadTestReport(const MultiplayerLoadTestReport& report)
+    {
+        const AZ::CVarFixedString reportFile = mp_loadtest_reportFile;
+        if (reportFile.empty())
+        {
+            return;
+        }
+
+        const AZStd::string reportJson = AZStd::string::format(
+            "{\n"
+            "    \"requestedClientCount\": %u,\n"
+            "    \"connectedClientCount\": %u,\n"
+            "    \"disconnectedClientCount\": %u,\n"
+            "    \"elapsedTimeMs\": %lld,\n"
+            "    \"serverTickCount\": %llu,\n"
+            "    \"averageTickTimeUs\": %lld,\n"
+            "    \"p50TickTimeUs\": %lld,\n"
+            "    \"p99TickTimeUs\": %lld,\n"
+            "    \"maxTickTimeUs\": %lld,\n"
+            "    \"totalBytesReceived\": %llu,\n"
+            "    \"bytesReceivedPerClientPerSecond\": %.3f,\n"
+            "    \"bytesSentPerClientPerSecond\": %.3f,\n"
+            "    \"entityUpdatePacketsReceived\": %llu,\n"
+            "    \"inputsSent\": %llu,\n"
+            "    \"latencySampleCount\": %llu,\n"
+            "    \"p50LatencyUs\": %lld,\n"
+            "    \"p95LatencyUs\": %lld,\n"
+            "    \"p99LatencyUs\": %lld,\n"
+            "    \"maxLatencyUs\": %lld\n"
+            "}\n",
+            report.m_requestedClientCount,
+            report.m_connectedClientCount,
+            report.m_disconnectedClientCount,
+            static_cast<long long>(report.m_elapsedTimeMs),
+            aznumeric_cast<AZ::u64>(report.m_serverTickCount),
+            static_cast<long long>(report.m_averageTickTimeUs),
+            static_cast<long long>(report.m_p50TickTimeUs),
+            static_cast<long long>(report.m_p99TickTimeUs),
+            static_cast<long long>(report.m_maxTickTimeUs),
+            aznumeric_cast<AZ::u64>(report.m_totalBytesReceived),
+            report.m_bytesReceivedPerClientPerSecond,
+            report.m_bytesSentPerClientPerSecond,
+            aznumeric_cast<AZ::u64>(report.m_entityUpdatePacketsReceived),
+            aznumeric_cast<AZ::u64>(report.m_inputsSent),
+            aznumeric_cast<AZ::u64>(report.m_latencySampleCount),
+            static_cast<long long>(report.m_p50LatencyUs),
+            static_cast<long long>(report.m_p95LatencyUs),
+            static_cast<long long>(report.m_p99LatencyUs),
+            static_cast<long long>(report.m_maxLatencyUs));
+
+        const AZ::IO::FixedMaxPath reportFilepath = AZ::IO::FixedMaxPath(AZ::Utils::GetProjectPath()) / "user/Metrics" / reportFile;
+        constexpr int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+        AZ::IO::SystemFile outputFile;
+        if (!outputFile.Open(reportFilepath.c_str(), openMode) || (outputFile.Write(reportJson.data(), reportJson.size()) != reportJson.size()))
+        {
+            AZLOG_ERROR("Failed to write load test report to %s", reportFilepath.c_str());
+        }
+    }
+
+    void MultiplayerLoadTestSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<MultiplayerLoadTestSystemComponent, AZ::Component>()->Version(1);
+        }
+    }
+
+    void MultiplayerLoadTestSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("MultiplayerLoadTestService"));
+    }
+
+    void MultiplayerLoadTestSystemComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("MultiplayerService"));
+    }
+
+    void MultiplayerLoadTestSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("MultiplayerLoadTestService"));
+    }
+
+    MultiplayerLoadTestSystemComponent::MultiplayerLoadTestSystemComponent()
+    {
+        AZ::Interface<IMultiplayerLoadTest>::Register(this);
+    }
+
+    MultiplayerLoadTestSystemComponent::~MultiplayerLoadTestSystemComponent()
+    {
+        AZ::Interface<IMultiplayerLoadTest>::Unregister(this);
+    }
+
+    void MultiplayerLoadTestSystemComponent::Activate()
+    {
+        ;
+    }
+
+    void MultiplayerLoadTestSystemComponent::Deactivate()
+    {
+        StopLoadTest();
+    }
+
+    void MultiplayerLoadTestSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerLoadTestSystemComponent: OnTick");
+
+        // Ticking after the multiplayer system means any new host frame has just been sent, so record its send time
+        // and the time the host spent producing it before any simulated client has had a chance to consume it
+        const HostFrameId hostFrameId = GetNetworkTime()->GetHostFrameId();
+        if (hostFrameId != m_lastHostFrameId)
+        {
+            m_lastHostFrameId = hostFrameId;
+            m_metrics.RecordHostFrameSent(hostFrameId, AZ::GetRealElapsedTimeUs());
+            m_metrics.RecordTickTime(GetMultiplayer()->GetStats().m_lastFrameTimeUs);
+        }
+
+        ConnectPendingClients();
+
+        const AZ::TimeMs currentTimeMs = AZ::GetRealElapsedTimeMs();
+        const AZ::TimeMs inputRateMs = AZStd::max(static_cast<AZ::TimeMs>(mp_loadtest_inputRateMs), AZ::TimeMs{ 1 });
+        for (AZStd::unique_ptr<MultiplayerLoadTestClient>& client : m_clients)
+        {
+            client->UpdateInput(currentTimeMs, inputRateMs);
+        }
+
+        const AZ::TimeMs durationMs = mp_loadtest_durationMs;
+        if ((durationMs > AZ::Time::ZeroTimeMs) && (currentTimeMs - m_startTimeMs >= durationMs))
+        {
+            CompleteLoadTest();
+        }
+    }
+
+    int MultiplayerLoadTestSystemComponent::GetTickOrder()
+    {
+        // Tick immediately after the multiplayer system component
+        return AZ::TICK_PLACEMENT + 2;
+    }
+
+    bool MultiplayerLoadTestSystemComponent::StartLoadTest(uint32_t clientCount)
+    {
+        if (m_isRunning)
+        {
+            AZLOG_WARN("A load test is already running, stop it before starting another");
+            return false;
+        }
+
+        const MultiplayerAgentType agentType = GetMultiplayer()->GetAgentType();
+        if ((agentType != MultiplayerAgentType::DedicatedServer) && (agentType != MultiplayerAgentType::ClientServer))
+        {
+            AZLOG_ERROR("Cannot start a load test, this application isn't hosting, please call the 'host' command first");
+            return false;
+        }
+
+        INetworkInterface* hostInterface = AZ::Interface<INetworking>::Get()->RetrieveNetworkInterface(AZ::Name(MpNetworkInterfaceName));
+        if ((hostInterface == nullptr) || (hostInterface->GetType() != ProtocolType::Udp))
+        {
+            AZLOG_ERROR("Cannot start a load test, simulated clients require the host to use the udp protocol");
+            return false;
+        }
+
+        m_hostAddress = IpAddress(LocalHost.data(), hostInterface->GetPort(), ProtocolType::Udp);
+        m_requestedClientCount = clientCount;
+        m_clients.clear();
+        m_clients.reserve(clientCount);
+        m_metrics.Reset();
+        m_lastHostFrameId = GetNetworkTime()->GetHostFrameId();
+        m_startTimeMs = AZ::GetRealElapsedTimeMs();
+        m_isRunning = true;
+        AZ::TickBus::Handler::BusConnect();
+
+        AZLOG_INFO("Starting load test with %u simulated clients connecting to %s", clientCount, m_hostAddress.GetString().c_str());
+        return true;
+    }
+
+    void MultiplayerLoadTestSystemComponent::StopLoadTest()
+    {
+        if (!m_isRunning)
+        {
+            return;
+        }
+
+        AZ::TickBus::Handler::BusDisconnect();
+        m_stopTimeMs = AZ::GetRealElapsedTimeMs();
+
+        // Capture the final report before the simulated clients, and the statistics they hold, are torn down
+        m_completedReport = GenerateReport(m_stopTimeMs);
+        m_isRunning = false;
+        m_clients.clear();
+
+        LogLoadTestReport(m_completedReport);
+        WriteLoadTestReport(m_completedReport);
+    }
+
+    bool MultiplayerLoadTestSystemComponent::IsLoadTestRunning() const
+    {
+        return m_isRunning;
+    }
+
+    MultiplayerLoadTestReport MultiplayerLoadTestSystemComponent::GetLoadTestReport() const
+    {
+        return m_isRunning ? GenerateReport(AZ::GetRealElapsedTimeMs()) : m_completedReport;
+    }
+
+    void MultiplayerLoadTestSystemComponent::AddCreateInputHandler(LoadTestCreateInputEvent::Handler& handler)
+    {
+        handler.Connect(m_createInputEvent);
+    }
+
+    MultiplayerLoadTestReport MultiplayerLoadTestSystemComponent::GenerateReport(AZ::TimeMs endTimeMs) const
+    {
+        MultiplayerLoadTestReport report;
+        report.m_requestedClientCount = m_requestedClientCount;
+        report.m_elapsedTimeMs = endTimeMs - m_startTimeMs;
+
+        double totalSendBytesPerSecond = 0.0;
+        for (const AZStd::unique_ptr<MultiplayerLoadTestClient>& client : m_clients)
+        {
+            report.m_connectedClientCount += client->IsConnected() ? 1 : 0;
+            report.m_disconnectedClientCount += client->WasDisconnected() ? 1 : 0;
+            report.m_totalBytesReceived += client->GetBytesReceived();
+            report.m_entityUpdatePacketsReceived += client->GetEntityUpdatePacketsReceived();
+            report.m_inputsSent += client->GetInputsSent();
+            totalSendBytesPerSecond += client->GetSendBytesPerSecond();
+        }
+
+        if (!m_clients.empty())
+        {
+            const double clientCount = static_cast<double>(m_clients.size());
+            const double elapsedSeconds = AZ::TimeMsToSecondsDouble(report.m_elapsedTimeMs);
+            report.m_bytesReceivedPerClientPerSecond = (elapsedSeconds > 0.0)
+                ? static_cast<double>(report.m_totalBytesReceived) / clientCount / elapsedSeconds
+                : 0.0;
+            report.m_bytesSentPerClientPerSecond = totalSendBytesPerSecond / clientCount;
+        }
+
+        m_metrics.FillReport(report);
+        return report;
+    }
+
+    void MultiplayerLoadTestSystemComponent::ConnectPendingClients()
+    {
+        const uint32_t pendingCount = m_requestedClientCount - aznumeric_cast<uint32_t>(m_clients.size());
+        const uint32_t connectCount = AZStd::min<uint32_t>(pendingCount, AZStd::max<uint32_t>(mp_loadtest_connectsPerTick, 1));
+        for (uint32_t i = 0; i < connectCount; ++i)
+        {
+            const uint32_t clientIndex = aznumeric_cast<uint32_t>(m_clients.size());
+            AZStd::unique_ptr<MultiplayerLoadTestClient> client = AZStd::make_unique<MultiplayerLoadTestClient>(clientIndex, m_metrics, m_createInputEvent);
+            if (!client->Connect(m_hostAddress))
+            {
+                AZLOG_WARN("Load test client %u failed to open a connection to the host", clientIndex);
+            }
+            m_clients.push_back(AZStd::move(client));
+        }
+    }
+
+    void MultiplayerLoadTestSystemComponent::CompleteLoadTest()
+    {
+        StopLoadTest();
+        if (mp_loadtest_exitOnComplete)
+        {
+            AzFramework::ApplicationRequests::Bus::Broadcast(&AzFramework::ApplicationRequests::ExitMainLoop);
+        }
+    }
+
+    void mp_loadtest_start(const AZ::ConsoleCommandContainer& arguments)
+    {
+        IMultiplayerLoadTest* loadTest = AZ::Interface<IMultiplayerLoadTest>::Get();
+        if (loadTest == nullptr)
+        {
+            AZLOG_ERROR("mp_loadtest_start failed. MultiplayerLoadTestSystemComponent hasn't been constructed yet.");
+            return;
+        }
+
+        uint32_t clientCount = mp_loadtest_clientCount;
+        if (!arguments.empty())
+        {
+            const AZ::CVarFixedString clientCountString{ arguments.front() };
+            int requestedClientCount = 0;
+            if (!AZ::StringFunc::LooksLikeInt(clientCountString.c_str(), &requestedClientCount) || (requestedClientCount <= 0))
+            {
+                AZLOG_ERROR("mp_loadtest_start failed. '%s' is not a valid client count, expected a positive integer.", clientCountString.c_str());
+                return;
+            }
+            clientCount = aznumeric_cast<uint32_t>(requestedClientCount);
+        }
+        loadTest->StartLoadTest(clientCount);
+    }
+    AZ_CONSOLEFREEFUNC(mp_loadtest_start, AZ::ConsoleFunctorFlags::DontReplicate, "Connects simulated clients to this host over loopback, optionally takes the number of clients (only works if currently hosting)");
+
+    void mp_loadtest_stop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (IMultiplayerLoadTest* loadTest = AZ::Interface<IMultiplayerLoadTest>::Get())
+        {
+            loadTest->StopLoadTest();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mp_loadtest_stop, AZ::ConsoleFunctorFlags::DontReplicate, "Stops the running load test, disconnects all simulated clients and reports the results");
+
+    void mp_loadtest_report([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (IMultiplayerLoadTest* loadTest = AZ::Interface<IMultiplayerLoadTest>::Get())
+        {
+            LogLoadTestReport(loadTest->GetLoadTestReport());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mp_loadtest_report, AZ::ConsoleFunctorFlags::DontReplicate, "Reports the results of the running or most recently stopped load test");
+}
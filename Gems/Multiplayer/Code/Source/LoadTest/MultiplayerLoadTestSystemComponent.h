@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/LoadTest/MultiplayerLoadTestClient.h>
+#include <Source/LoadTest/MultiplayerLoadTestMetrics.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <Multiplayer/IMultiplayerLoadTest.h>
+
+namespace Multiplayer
+{
+    //! @class MultiplayerLoadTestSystemComponent
+    //! @brief Headless load generator that connects simulated clients to the local host.
+    //!
+    //! Start a host as normal, then run mp_loadtest_start to connect simulated clients over loopback.
+    //! Results are reported with mp_loadtest_report, or when the test is stopped.
+    //! When mp_loadtest_durationMs is set the test stops itself, writes a report and optionally exits the application,
+    //! allowing server builds to be regression tested in automation without a network or real clients.
+    class MultiplayerLoadTestSystemComponent final
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public IMultiplayerLoadTest
+    {
+    public:
+        AZ_COMPONENT(MultiplayerLoadTestSystemComponent, "{A3C6B3F1-6E0D-4D55-8F63-0B0D6B8A9E27}", IMultiplayerLoadTest);
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        MultiplayerLoadTestSystemComponent();
+        ~MultiplayerLoadTestSystemComponent() override;
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+        //! AZ::TickBus::Handler overrides.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
+        //! IMultiplayerLoadTest overrides.
+        //! @{
+        bool StartLoadTest(uint32_t clientCount) override;
+        void StopLoadTest() override;
+        bool IsLoadTestRunning() const override;
+        MultiplayerLoadTestReport GetLoadTestReport() const override;
+        void AddCreateInputHandler(LoadTestCreateInputEvent::Handler& handler) override;
+        //! @}
+
+    private:
+        void ConnectPendingClients();
+        void CompleteLoadTest();
+        MultiplayerLoadTestReport GenerateReport(AZ::TimeMs endTimeMs) const;
+
+        AZStd::vector<AZStd::unique_ptr<MultiplayerLoadTestClient>> m_clients;
+        MultiplayerLoadTestMetrics m_metrics;
+        LoadTestCreateInputEvent m_createInputEvent;
+        AzNetworking::IpAddress m_hostAddress;
+
+        uint32_t m_requestedClientCount = 0;
+        bool m_isRunning = false;
+        AZ::TimeMs m_startTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_stopTimeMs = AZ::Time::ZeroTimeMs;
+        MultiplayerLoadTestReport m_completedReport;
+        HostFrameId m_lastHostFrameId = InvalidHostFrameId;
+    };
+}
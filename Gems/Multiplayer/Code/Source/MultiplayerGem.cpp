@@ -12,6 +12,7 @@
 #include <Multiplayer/Components/SimplePlayerSpawnerComponent.h>
 #include <Source/MultiplayerGem.h>
 #include <Source/MultiplayerSystemComponent.h>
+#include <Source/LoadTest/MultiplayerLoadTestSystemComponent.h>
 #include <Source/MultiplayerStatSystemComponent.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
 
@@ -25,6 +26,7 @@ namespace Multiplayer
             {
                 MultiplayerSystemComponent::CreateDescriptor(),
                 MultiplayerStatSystemComponent::CreateDescriptor(),
+                MultiplayerLoadTestSystemComponent::CreateDescriptor(),
                 NetBindComponent::CreateDescriptor(),
                 SimplePlayerSpawnerComponent::CreateDescriptor(),
 #ifdef MULTIPLAYER_EDITOR
@@ -40,6 +42,7 @@ namespace Multiplayer
         return AZ::ComponentTypeList{
             azrtti_typeid<MultiplayerSystemComponent>(),
             azrtti_typeid<MultiplayerStatSystemComponent>(),
+            azrtti_typeid<MultiplayerLoadTestSystemComponent>(),
 #ifdef MULTIPLAYER_EDITOR
             azrtti_typeid<MultiplayerToolsSystemComponent>(),
 #endif
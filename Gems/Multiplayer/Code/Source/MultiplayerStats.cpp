@@ -261,6 +261,7 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordFrameTime(AZ::TimeUs networkFrameTime)
     {
+        m_lastFrameTimeUs = networkFrameTime;
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
 } // namespace Multiplayer
@@ -594,6 +594,7 @@ namespace Multiplayer
                 return;
             }
             m_serverSendAccumulator -= serverRateSeconds;
+            m_networkTime.CaptureRewindState();
             m_networkTime.IncrementHostFrameId();
         }
 
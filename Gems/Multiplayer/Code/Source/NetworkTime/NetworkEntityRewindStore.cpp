@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/NetworkEntityRewindStore.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace Multiplayer
+{
+    void NetworkEntityRewindStore::FrameSnapshot::Resize(uint32_t slotCount)
+    {
+        m_netEntityIds.resize(slotCount, InvalidNetEntityId);
+        m_minX.resize(slotCount);
+        m_minY.resize(slotCount);
+        m_minZ.resize(slotCount);
+        m_maxX.resize(slotCount);
+        m_maxY.resize(slotCount);
+        m_maxZ.resize(slotCount);
+    }
+
+    void NetworkEntityRewindStore::Reset()
+    {
+        for (FrameSnapshot& frame : m_frames)
+        {
+            frame = FrameSnapshot();
+        }
+        m_capturingFrame = nullptr;
+        m_slotMap.clear();
+        m_slotRecordedFrames.clear();
+        m_slotEntityIds.clear();
+        m_freeSlots.clear();
+    }
+
+    void NetworkEntityRewindStore::BeginFrame(HostFrameId frameId)
+    {
+        AZ_Assert(m_capturingFrame == nullptr, "BeginFrame called while a frame is already being captured");
+        m_capturingFrame = &m_frames[static_cast<uint32_t>(frameId) % FrameCount];
+        m_capturingFrame->m_frameId = frameId;
+
+        // Reuse the storage of the frame being overwritten, any slot that isn't recorded this frame is left invalid
+        const uint32_t slotCount = aznumeric_cast<uint32_t>(m_slotEntityIds.size());
+        m_capturingFrame->Resize(slotCount);
+        AZStd::fill(m_capturingFrame->m_netEntityIds.begin(), m_capturingFrame->m_netEntityIds.end(), InvalidNetEntityId);
+    }
+
+    void NetworkEntityRewindStore::RecordEntity(NetEntityId netEntityId, const AZ::Aabb& worldBounds)
+    {
+        AZ_Assert(m_capturingFrame != nullptr, "RecordEntity called outside of BeginFrame and EndFrame");
+        const uint32_t slot = AcquireSlot(netEntityId);
+        m_slotRecordedFrames[slot] = m_capturingFrame->m_frameId;
+
+        FrameSnapshot& frame = *m_capturingFrame;
+        const AZ::Vector3& boundsMin = worldBounds.GetMin();
+        const AZ::Vector3& boundsMax = worldBounds.GetMax();
+        frame.m_netEntityIds[slot] = netEntityId;
+        frame.m_minX[slot] = boundsMin.GetX();
+        frame.m_minY[slot] = boundsMin.GetY();
+        frame.m_minZ[slot] = boundsMin.GetZ();
+        frame.m_maxX[slot] = boundsMax.GetX();
+        frame.m_maxY[slot] = boundsMax.GetY();
+        frame.m_maxZ[slot] = boundsMax.GetZ();
+    }
+
+    void NetworkEntityRewindStore::EndFrame()
+    {
+        AZ_Assert(m_capturingFrame != nullptr, "EndFrame called without a matching BeginFrame");
+        const HostFrameId frameId = m_capturingFrame->m_frameId;
+        m_capturingFrame = nullptr;
+
+        // Release the slots of entities that no longer exist, older frames still reference the released entity by id
+        // so a reused slot never blends between two different entities
+        const uint32_t slotCount = aznumeric_cast<uint32_t>(m_slotEntityIds.size());
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            if ((m_slotEntityIds[slot] != InvalidNetEntityId) && (m_slotRecordedFrames[slot] != frameId))
+            {
+                m_slotMap.erase(m_slotEntityIds[slot]);
+                m_slotEntityIds[slot] = InvalidNetEntityId;
+                m_freeSlots.push_back(slot);
+            }
+        }
+    }
+
+    bool NetworkEntityRewindStore::HasFrame(HostFrameId frameId) const
+    {
+        return FindFrame(frameId) != nullptr;
+    }
+
+    uint32_t NetworkEntityRewindStore::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_slotMap.size());
+    }
+
+    bool NetworkEntityRewindStore::QueryRewoundEntities
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        AZStd::span<const AZ::Aabb> volumes,
+        AZStd::vector<RewindQueryHit>& outHits
+    ) const
+    {
+        const FrameSnapshot* frame = FindFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        const FrameSnapshot* previousFrame = nullptr;
+        if (!AZ::IsClose(blendFactor, 1.0f))
+        {
+            previousFrame = FindFrame(HostFrameId{ static_cast<uint32_t>(frameId) - 1 });
+        }
+
+        const uint32_t slotCount = aznumeric_cast<uint32_t>(frame->m_netEntityIds.size());
+        const uint32_t previousSlotCount = (previousFrame != nullptr) ? aznumeric_cast<uint32_t>(previousFrame->m_netEntityIds.size()) : 0;
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            const NetEntityId netEntityId = frame->m_netEntityIds[slot];
+            if (netEntityId == InvalidNetEntityId)
+            {
+                continue;
+            }
+
+            float minX = frame->m_minX[slot];
+            float minY = frame->m_minY[slot];
+            float minZ = frame->m_minZ[slot];
+            float maxX = frame->m_maxX[slot];
+            float maxY = frame->m_maxY[slot];
+            float maxZ = frame->m_maxZ[slot];
+            if ((slot < previousSlotCount) && (previousFrame->m_netEntityIds[slot] == netEntityId))
+            {
+                // Blend from the previous frame, matching the interpolation applied to rewound network transforms
+                minX = AZ::Lerp(previousFrame->m_minX[slot], minX, blendFactor);
+                minY = AZ::Lerp(previousFrame->m_minY[slot], minY, blendFactor);
+                minZ = AZ::Lerp(previousFrame->m_minZ[slot], minZ, blendFactor);
+                maxX = AZ::Lerp(previousFrame->m_maxX[slot], maxX, blendFactor);
+                maxY = AZ::Lerp(previousFrame->m_maxY[slot], maxY, blendFactor);
+                maxZ = AZ::Lerp(previousFrame->m_maxZ[slot], maxZ, blendFactor);
+            }
+
+            for (uint32_t volumeIndex = 0; volumeIndex < volumes.size(); ++volumeIndex)
+            {
+                const AZ::Vector3& volumeMin = volumes[volumeIndex].GetMin();
+                const AZ::Vector3& volumeMax = volumes[volumeIndex].GetMax();
+                const bool overlaps = (minX <= volumeMax.GetX()) && (maxX >= volumeMin.GetX())
+                                   && (minY <= volumeMax.GetY()) && (maxY >= volumeMin.GetY())
+                                   && (minZ <= volumeMax.GetZ()) && (maxZ >= volumeMin.GetZ());
+                if (overlaps)
+                {
+                    outHits.push_back(RewindQueryHit{ volumeIndex, netEntityId });
+                }
+            }
+        }
+        return true;
+    }
+
+    const NetworkEntityRewindStore::FrameSnapshot* NetworkEntityRewindStore::FindFrame(HostFrameId frameId) const
+    {
+        if (frameId == InvalidHostFrameId)
+        {
+            return nullptr;
+        }
+
+        const FrameSnapshot& frame = m_frames[static_cast<uint32_t>(frameId) % FrameCount];
+        if ((frame.m_frameId != frameId) || (&frame == m_capturingFrame))
+        {
+            return nullptr;
+        }
+        return &frame;
+    }
+
+    uint32_t NetworkEntityRewindStore::AcquireSlot(NetEntityId netEntityId)
+    {
+        auto slotIter = m_slotMap.find(netEntityId);
+        if (slotIter != m_slotMap.end())
+        {
+            return slotIter->second;
+        }
+
+        uint32_t slot = 0;
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slot = aznumeric_cast<uint32_t>(m_slotEntityIds.size());
+            m_slotEntityIds.push_back(InvalidNetEntityId);
+            m_slotRecordedFrames.push_back(InvalidHostFrameId);
+            m_capturingFrame->Resize(slot + 1);
+        }
+
+        m_slotEntityIds[slot] = netEntityId;
+        m_slotMap.emplace(netEntityId, slot);
+        return slot;
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class NetworkEntityRewindStore
+    //! @brief Centralized history of networked entity bounds used for server side lag compensation.
+    //!
+    //! Every host frame the world bounds of all rewindable entities are captured into a ring of snapshots.
+    //! Each snapshot stores its bounds as structure of arrays indexed by a stable per entity slot, so rewound volume
+    //! queries scan contiguous memory instead of visiting the components of every entity in the world.
+    class NetworkEntityRewindStore
+    {
+    public:
+        static constexpr uint32_t FrameCount = RewindHistorySize;
+
+        //! Discards all captured frames and slot assignments.
+        void Reset();
+
+        //! Begins capturing a new frame, overwriting the oldest frame in the history.
+        //! @param frameId the host frame being captured
+        void BeginFrame(HostFrameId frameId);
+
+        //! Records the world bounds of an entity for the frame being captured.
+        //! @param netEntityId the entity being recorded
+        //! @param worldBounds the world space bounds of the entity
+        void RecordEntity(NetEntityId netEntityId, const AZ::Aabb& worldBounds);
+
+        //! Completes the frame being captured, releasing the slots of any entities that were not recorded.
+        void EndFrame();
+
+        //! Returns whether the provided frame is still held in the history.
+        //! @param frameId the host frame to check for
+        //! @return boolean true if the frame can be queried
+        bool HasFrame(HostFrameId frameId) const;
+
+        //! Returns the number of entities currently assigned a slot.
+        //! @return the number of entities currently tracked by the store
+        uint32_t GetEntityCount() const;
+
+        //! Finds all entities whose rewound bounds overlap any of the provided volumes.
+        //! @param frameId     the host frame to rewind to
+        //! @param blendFactor the factor used to blend between the bounds at the previous and requested frame
+        //! @param volumes     the world space volumes to test against
+        //! @param outHits     receives one hit per overlapping entity and volume pair
+        //! @return boolean true if the frame was available, false if the caller must fall back to another method
+        bool QueryRewoundEntities(HostFrameId frameId, float blendFactor, AZStd::span<const AZ::Aabb> volumes, AZStd::vector<RewindQueryHit>& outHits) const;
+
+    private:
+        struct FrameSnapshot
+        {
+            void Resize(uint32_t slotCount);
+
+            HostFrameId m_frameId = InvalidHostFrameId;
+            AZStd::vector<NetEntityId> m_netEntityIds;
+            AZStd::vector<float> m_minX;
+            AZStd::vector<float> m_minY;
+            AZStd::vector<float> m_minZ;
+            AZStd::vector<float> m_maxX;
+            AZStd::vector<float> m_maxY;
+            AZStd::vector<float> m_maxZ;
+        };
+
+        const FrameSnapshot* FindFrame(HostFrameId frameId) const;
+        uint32_t AcquireSlot(NetEntityId netEntityId);
+
+        AZStd::array<FrameSnapshot, FrameCount> m_frames;
+        FrameSnapshot* m_capturingFrame = nullptr;
+
+        AZStd::unordered_map<NetEntityId, uint32_t> m_slotMap;
+        AZStd::vector<HostFrameId> m_slotRecordedFrames;
+        AZStd::vector<NetEntityId> m_slotEntityIds;
+        AZStd::vector<uint32_t> m_freeSlots;
+    };
+}
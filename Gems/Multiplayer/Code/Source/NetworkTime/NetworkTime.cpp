@@ -11,6 +11,7 @@
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -19,6 +20,19 @@ namespace Multiplayer
 {
     AZ_CVAR(float, sv_RewindVolumeExtrudeDistance, 50.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount to increase rewind volume checks to account for fast moving entities");
     AZ_CVAR(bool, bg_RewindDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true enables debug draw of rewind operations");
+    AZ_CVAR(bool, sv_RewindUseHistory, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true rewind volume checks use the captured rewind history instead of querying the visibility system and each entities network transform");
+
+    static AzFramework::DebugDisplayRequests* GetRewindDebugDisplay()
+    {
+        if (!bg_RewindDebugDraw)
+        {
+            return nullptr;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        return AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+    }
 
     NetworkTime::NetworkTime()
     {
@@ -85,6 +99,11 @@ namespace Multiplayer
     }
 
     void NetworkTime::SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume)
+    {
+        SyncEntitiesToRewindVolumes(AZStd::span<const AZ::Aabb>(&rewindVolume, 1));
+    }
+
+    void NetworkTime::SyncEntitiesToRewindVolumes(AZStd::span<const AZ::Aabb> rewindVolumes)
     {
         if (!IsTimeRewound())
         {
@@ -93,17 +112,89 @@ namespace Multiplayer
             return;
         }
 
-        // Since the vis system doesn't support rewound queries, first query with an expanded volume to catch any fast moving entities
-        const AZ::Aabb expandedVolume = rewindVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
+        if (!sv_RewindUseHistory || !m_rewindStore.HasFrame(m_hostFrameId))
+        {
+            // The rewound frame isn't held in the rewind history, so rewind by inspecting each entity in the volumes instead
+            for (const AZ::Aabb& rewindVolume : rewindVolumes)
+            {
+                SyncEntitiesToRewindStateFromVisibility(rewindVolume);
+            }
+            return;
+        }
+
+        if (AzFramework::DebugDisplayRequests* debugDisplay = GetRewindDebugDisplay())
+        {
+            debugDisplay->SetColor(AZ::Colors::Red);
+            for (const AZ::Aabb& rewindVolume : rewindVolumes)
+            {
+                debugDisplay->DrawWireBox(rewindVolume.GetMin(), rewindVolume.GetMax());
+            }
+        }
+
+        m_rewindQueryHits.clear();
+        m_rewindStore.QueryRewoundEntities(m_hostFrameId, m_hostBlendFactor, rewindVolumes, m_rewindQueryHits);
+
+        // An entity may overlap several volumes, make sure each is only synced once
+        AZStd::sort(m_rewindQueryHits.begin(), m_rewindQueryHits.end(),
+            [](const RewindQueryHit& lhs, const RewindQueryHit& rhs) { return lhs.m_netEntityId < rhs.m_netEntityId; });
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        NetEntityId previousNetEntityId = InvalidNetEntityId;
+        for (const RewindQueryHit& hit : m_rewindQueryHits)
+        {
+            if (hit.m_netEntityId == previousNetEntityId)
+            {
+                continue;
+            }
+            previousNetEntityId = hit.m_netEntityId;
+
+            NetworkEntityHandle entityHandle = networkEntityTracker->Get(hit.m_netEntityId);
+            if (NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent())
+            {
+                m_rewoundEntities.push_back(entityHandle);
+                netBindComponent->NotifySyncRewindState();
+            }
+        }
+    }
+
+    void NetworkTime::QueryRewoundEntities(AZStd::span<const AZ::Aabb> rewindVolumes, AZStd::vector<RewindQueryHit>& outHits) const
+    {
+        if (IsTimeRewound())
+        {
+            m_rewindStore.QueryRewoundEntities(m_hostFrameId, m_hostBlendFactor, rewindVolumes, outHits);
+        }
+    }
+
+    void NetworkTime::CaptureRewindState()
+    {
+        AZ_Assert(!IsTimeRewound(), "Capturing rewind state is unsupported under a rewound time scope");
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (!sv_RewindUseHistory || (networkEntityTracker == nullptr) || (entityBoundsUnion == nullptr))
+        {
+            return;
+        }
 
-        AzFramework::DebugDisplayRequests* debugDisplay = nullptr;
-        if (bg_RewindDebugDraw)
+        m_rewindStore.BeginFrame(m_unalteredFrameId);
+        for (const auto& [netEntityId, entity] : *networkEntityTracker)
         {
-            AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
-            AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
-            debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+            // Match the entities the visibility based rewind would consider, only those with a network transform are rewound
+            if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active)
+                && (entity->FindComponent<NetworkTransformComponent>() != nullptr))
+            {
+                m_rewindStore.RecordEntity(netEntityId, entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId()));
+            }
         }
+        m_rewindStore.EndFrame();
+    }
+
+    void NetworkTime::SyncEntitiesToRewindStateFromVisibility(const AZ::Aabb& rewindVolume)
+    {
+        // Since the vis system doesn't support rewound queries, first query with an expanded volume to catch any fast moving entities
+        const AZ::Aabb expandedVolume = rewindVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
 
+        AzFramework::DebugDisplayRequests* debugDisplay = GetRewindDebugDisplay();
         if (debugDisplay)
         {
             debugDisplay->SetColor(AZ::Colors::Red);
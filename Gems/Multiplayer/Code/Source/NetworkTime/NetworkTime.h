@@ -10,6 +10,7 @@
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Source/NetworkTime/NetworkEntityRewindStore.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
 
@@ -35,11 +36,21 @@ namespace Multiplayer
         void ForceSetTime(HostFrameId frameId, AZ::TimeMs timeMs) override;
         void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId) override;
         void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) override;
+        void SyncEntitiesToRewindVolumes(AZStd::span<const AZ::Aabb> rewindVolumes) override;
+        void QueryRewoundEntities(AZStd::span<const AZ::Aabb> rewindVolumes, AZStd::vector<RewindQueryHit>& outHits) const override;
         void ClearRewoundEntities() override;
         //! @}
 
+        //! Captures the bounds of all rewindable entities for the current host frame into the rewind history.
+        //! Should be invoked by the host once all updates for a frame are complete, prior to incrementing the frameId.
+        void CaptureRewindState();
+
     private:
 
+        void SyncEntitiesToRewindStateFromVisibility(const AZ::Aabb& rewindVolume);
+
+        NetworkEntityRewindStore m_rewindStore;
+        AZStd::vector<RewindQueryHit> m_rewindQueryHits;
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
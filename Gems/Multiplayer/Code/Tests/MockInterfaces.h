@@ -125,6 +125,8 @@ namespace UnitTest
         MOCK_CONST_METHOD1(GetHostFrameIdForRewindingConnection, Multiplayer::HostFrameId(AzNetworking::ConnectionId));
         MOCK_METHOD4(AlterTime, void (Multiplayer::HostFrameId, AZ::TimeMs, float, AzNetworking::ConnectionId));
         MOCK_METHOD1(SyncEntitiesToRewindState, void(const AZ::Aabb&));
+        MOCK_METHOD1(SyncEntitiesToRewindVolumes, void(AZStd::span<const AZ::Aabb>));
+        MOCK_CONST_METHOD2(QueryRewoundEntities, void(AZStd::span<const AZ::Aabb>, AZStd::vector<Multiplayer::RewindQueryHit>&));
         MOCK_METHOD0(ClearRewoundEntities, void());
     };
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/MultiplayerLoadTestMetrics.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    using MultiplayerLoadTestTests = LeakDetectionFixture;
+
+    TEST_F(MultiplayerLoadTestTests, ComputePercentileEmpty)
+    {
+        AZStd::vector<AZ::TimeUs> samples;
+        EXPECT_EQ(MultiplayerLoadTestMetrics::ComputePercentile(samples, 50.0f), AZ::Time::ZeroTimeUs);
+    }
+
+    TEST_F(MultiplayerLoadTestTests, ComputePercentileNearestRank)
+    {
+        AZStd::vector<AZ::TimeUs> samples;
+        for (int64_t i = 100; i > 0; --i)
+        {
+            samples.push_back(AZ::TimeUs{ i });
+        }
+
+        EXPECT_EQ(MultiplayerLoadTestMetrics::ComputePercentile(samples, 0.0f), AZ::TimeUs{ 1 });
+        EXPECT_EQ(MultiplayerLoadTestMetrics::ComputePercentile(samples, 50.0f), AZ::TimeUs{ 50 });
+        EXPECT_EQ(MultiplayerLoadTestMetrics::ComputePercentile(samples, 95.0f), AZ::TimeUs{ 95 });
+        EXPECT_EQ(MultiplayerLoadTestMetrics::ComputePercentile(samples, 99.0f), AZ::TimeUs{ 99 });
+        EXPECT_EQ(MultiplayerLoadTestMetrics::ComputePercentile(samples, 100.0f), AZ::TimeUs{ 100 });
+    }
+
+    TEST_F(MultiplayerLoadTestTests, TickTimeReport)
+    {
+        MultiplayerLoadTestMetrics metrics;
+        metrics.RecordTickTime(AZ::TimeUs{ 100 });
+        metrics.RecordTickTime(AZ::TimeUs{ 300 });
+        metrics.RecordTickTime(AZ::TimeUs{ 200 });
+
+        MultiplayerLoadTestReport report;
+        metrics.FillReport(report);
+        EXPECT_EQ(report.m_serverTickCount, 3);
+        EXPECT_EQ(report.m_averageTickTimeUs, AZ::TimeUs{ 200 });
+        EXPECT_EQ(report.m_p50TickTimeUs, AZ::TimeUs{ 200 });
+        EXPECT_EQ(report.m_maxTickTimeUs, AZ::TimeUs{ 300 });
+    }
+
+    TEST_F(MultiplayerLoadTestTests, LatencyReport)
+    {
+        MultiplayerLoadTestMetrics metrics;
+        metrics.RecordHostFrameSent(HostFrameId{ 1 }, AZ::TimeUs{ 1000 });
+        metrics.RecordHostFrameSent(HostFrameId{ 2 }, AZ::TimeUs{ 2000 });
+
+        metrics.RecordHostFrameReceived(HostFrameId{ 1 }, AZ::TimeUs{ 1500 });
+        metrics.RecordHostFrameReceived(HostFrameId{ 1 }, AZ::TimeUs{ 1700 });
+        metrics.RecordHostFrameReceived(HostFrameId{ 2 }, AZ::TimeUs{ 2100 });
+
+        // Frames that were never sent are ignored
+        metrics.RecordHostFrameReceived(HostFrameId{ 3 }, AZ::TimeUs{ 3000 });
+
+        MultiplayerLoadTestReport report;
+        metrics.FillReport(report);
+        EXPECT_EQ(report.m_latencySampleCount, 3);
+        EXPECT_EQ(report.m_p50LatencyUs, AZ::TimeUs{ 500 });
+        EXPECT_EQ(report.m_maxLatencyUs, AZ::TimeUs{ 700 });
+
+        metrics.Reset();
+        metrics.FillReport(report);
+        EXPECT_EQ(report.m_latencySampleCount, 0);
+        EXPECT_EQ(report.m_serverTickCount, 0);
+    }
+
+    TEST_F(MultiplayerLoadTestTests, OverwrittenHostFramesAreIgnored)
+    {
+        MultiplayerLoadTestMetrics metrics;
+        metrics.RecordHostFrameSent(HostFrameId{ 1 }, AZ::TimeUs{ 1000 });
+        metrics.RecordHostFrameSent(HostFrameId{ 1 + MultiplayerLoadTestMetrics::HostFrameHistorySize }, AZ::TimeUs{ 5000 });
+
+        metrics.RecordHostFrameReceived(HostFrameId{ 1 }, AZ::TimeUs{ 6000 });
+
+        MultiplayerLoadTestReport report;
+        metrics.FillReport(report);
+        EXPECT_EQ(report.m_latencySampleCount, 0);
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/NetworkEntityRewindStore.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    using NetworkEntityRewindStoreTests = LeakDetectionFixture;
+
+    static AZ::Aabb CreateUnitAabbAt(float x)
+    {
+        return AZ::Aabb::CreateFromMinMax(AZ::Vector3(x, 0.0f, 0.0f), AZ::Vector3(x + 1.0f, 1.0f, 1.0f));
+    }
+
+    static void CaptureFrame(NetworkEntityRewindStore& store, HostFrameId frameId, const AZStd::vector<AZStd::pair<NetEntityId, float>>& entities)
+    {
+        store.BeginFrame(frameId);
+        for (const auto& [netEntityId, x] : entities)
+        {
+            store.RecordEntity(netEntityId, CreateUnitAabbAt(x));
+        }
+        store.EndFrame();
+    }
+
+    TEST_F(NetworkEntityRewindStoreTests, QueryRewoundFrame)
+    {
+        NetworkEntityRewindStore store;
+        CaptureFrame(store, HostFrameId{ 1 }, { { NetEntityId{ 10 }, 0.0f }, { NetEntityId{ 11 }, 20.0f } });
+        CaptureFrame(store, HostFrameId{ 2 }, { { NetEntityId{ 10 }, 10.0f }, { NetEntityId{ 11 }, 20.0f } });
+        EXPECT_EQ(store.GetEntityCount(), 2);
+
+        const AZ::Aabb volumes[] = { CreateUnitAabbAt(0.0f), CreateUnitAabbAt(10.0f), CreateUnitAabbAt(20.0f) };
+
+        AZStd::vector<RewindQueryHit> hits;
+        EXPECT_TRUE(store.QueryRewoundEntities(HostFrameId{ 1 }, 1.0f, volumes, hits));
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_EQ(hits[0].m_volumeIndex, 0);
+        EXPECT_EQ(hits[0].m_netEntityId, NetEntityId{ 10 });
+        EXPECT_EQ(hits[1].m_volumeIndex, 2);
+        EXPECT_EQ(hits[1].m_netEntityId, NetEntityId{ 11 });
+
+        hits.clear();
+        EXPECT_TRUE(store.QueryRewoundEntities(HostFrameId{ 2 }, 1.0f, volumes, hits));
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_EQ(hits[0].m_volumeIndex, 1);
+        EXPECT_EQ(hits[0].m_netEntityId, NetEntityId{ 10 });
+    }
+
+    TEST_F(NetworkEntityRewindStoreTests, QueryBlendsWithPreviousFrame)
+    {
+        NetworkEntityRewindStore store;
+        CaptureFrame(store, HostFrameId{ 1 }, { { NetEntityId{ 10 }, 0.0f } });
+        CaptureFrame(store, HostFrameId{ 2 }, { { NetEntityId{ 10 }, 10.0f } });
+
+        const AZ::Aabb volumes[] = { CreateUnitAabbAt(5.0f) };
+
+        AZStd::vector<RewindQueryHit> hits;
+        EXPECT_TRUE(store.QueryRewoundEntities(HostFrameId{ 2 }, 0.5f, volumes, hits));
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_EQ(hits[0].m_netEntityId, NetEntityId{ 10 });
+
+        hits.clear();
+        EXPECT_TRUE(store.QueryRewoundEntities(HostFrameId{ 2 }, 1.0f, volumes, hits));
+        EXPECT_TRUE(hits.empty());
+    }
+
+    TEST_F(NetworkEntityRewindStoreTests, RemovedEntitiesReleaseSlots)
+    {
+        NetworkEntityRewindStore store;
+        CaptureFrame(store, HostFrameId{ 1 }, { { NetEntityId{ 10 }, 0.0f } });
+        CaptureFrame(store, HostFrameId{ 2 }, {});
+        EXPECT_EQ(store.GetEntityCount(), 0);
+
+        // A new entity reuses the released slot, but must never be blended with the entity that previously held it
+        CaptureFrame(store, HostFrameId{ 3 }, { { NetEntityId{ 12 }, 10.0f } });
+        CaptureFrame(store, HostFrameId{ 4 }, { { NetEntityId{ 12 }, 10.0f } });
+        EXPECT_EQ(store.GetEntityCount(), 1);
+
+        const AZ::Aabb volumes[] = { CreateUnitAabbAt(0.0f) };
+        AZStd::vector<RewindQueryHit> hits;
+        EXPECT_TRUE(store.QueryRewoundEntities(HostFrameId{ 1 }, 1.0f, volumes, hits));
+        ASSERT_EQ(hits.size(), 1);
+        EXPECT_EQ(hits[0].m_netEntityId, NetEntityId{ 10 });
+
+        hits.clear();
+        EXPECT_TRUE(store.QueryRewoundEntities(HostFrameId{ 2 }, 1.0f, volumes, hits));
+        EXPECT_TRUE(hits.empty());
+    }
+
+    TEST_F(NetworkEntityRewindStoreTests, FramesExpireFromHistory)
+    {
+        NetworkEntityRewindStore store;
+        EXPECT_FALSE(store.HasFrame(HostFrameId{ 1 }));
+
+        for (uint32_t frame = 1; frame <= NetworkEntityRewindStore::FrameCount + 1; ++frame)
+        {
+            CaptureFrame(store, HostFrameId{ frame }, { { NetEntityId{ 10 }, 0.0f } });
+        }
+
+        EXPECT_FALSE(store.HasFrame(HostFrameId{ 1 }));
+        EXPECT_TRUE(store.HasFrame(HostFrameId{ 2 }));
+        EXPECT_TRUE(store.HasFrame(HostFrameId{ NetworkEntityRewindStore::FrameCount + 1 }));
+
+        const AZ::Aabb volumes[] = { CreateUnitAabbAt(0.0f) };
+        AZStd::vector<RewindQueryHit> hits;
+        EXPECT_FALSE(store.QueryRewoundEntities(HostFrameId{ 1 }, 1.0f, volumes, hits));
+
+        store.Reset();
+        EXPECT_FALSE(store.HasFrame(HostFrameId{ 2 }));
+        EXPECT_EQ(store.GetEntityCount(), 0);
+    }
+}
@@ -9,6 +9,7 @@
 set(FILES
     Include/Multiplayer/IMultiplayer.h
     Include/Multiplayer/IMultiplayerDebug.h
+    Include/Multiplayer/IMultiplayerLoadTest.h
     Include/Multiplayer/IMultiplayerSpawner.h
     Include/Multiplayer/IMultiplayerTools.h
     Include/Multiplayer/MultiplayerConstants.h
@@ -48,6 +48,12 @@ set(FILES
     Source/ConnectionData/ServerToClientConnectionData.inl
     Source/Editor/MultiplayerEditorConnection.cpp
     Source/Editor/MultiplayerEditorConnection.h
+    Source/LoadTest/MultiplayerLoadTestClient.cpp
+    Source/LoadTest/MultiplayerLoadTestClient.h
+    Source/LoadTest/MultiplayerLoadTestMetrics.cpp
+    Source/LoadTest/MultiplayerLoadTestMetrics.h
+    Source/LoadTest/MultiplayerLoadTestSystemComponent.cpp
+    Source/LoadTest/MultiplayerLoadTestSystemComponent.h
     Source/MultiplayerSystemComponent.cpp
     Source/MultiplayerSystemComponent.h
     Source/NetworkEntity/NetworkEntityAuthorityTracker.cpp
@@ -62,6 +68,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
+    Source/NetworkTime/NetworkEntityRewindStore.cpp
+    Source/NetworkTime/NetworkEntityRewindStore.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
@@ -24,8 +24,10 @@ set(FILES
     Tests/MockInterfaces.h
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
+    Tests/MultiplayerLoadTestTests.cpp
     Tests/MultiplayerSystemTests.cpp
     Tests/NetworkCharacterTests.cpp
+    Tests/NetworkEntityRewindStoreTests.cpp
     Tests/NetworkEntityTests.cpp
     Tests/NetworkInputTests.cpp
     Tests/NetworkRigidBodyTests.cpp
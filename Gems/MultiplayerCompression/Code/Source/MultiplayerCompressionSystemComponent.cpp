@@ -6,15 +6,18 @@
  *
  */
 
+#include <AzCore/Console/ILogger.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzNetworking/Framework/INetworking.h>
 
 #include "MultiplayerCompressionSystemComponent.h"
 #include "LZ4Compressor.h"
 #include "MultiplayerCompressionFactory.h"
+#include "ZstdDictionaryTrainer.h"
 
 namespace MultiplayerCompression
 {
@@ -50,11 +53,101 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+
+        m_packetTraceRecorder = AZStd::make_shared<PacketTraceRecorder>();
+        m_zstdCompressorFactory = AZStd::make_unique<ZstdCompressorFactory>(ZstdCompressor::Mode::Packet, m_packetTraceRecorder);
+        m_zstdStreamCompressorFactory = AZStd::make_unique<ZstdCompressorFactory>(ZstdCompressor::Mode::Stream, m_packetTraceRecorder);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdCompressorFactory.get());
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdStreamCompressorFactory.get());
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdStreamCompressorFactory->GetFactoryName());
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdCompressorFactory->GetFactoryName());
+        m_packetTraceRecorder->Stop();
+
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
     }
+
+    void MultiplayerCompressionSystemComponent::ZstdStartPacketCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 1)
+        {
+            AZLOG_ERROR("ZstdStartPacketCapture requires the path of the trace file to write");
+            return;
+        }
+
+        const AZ::CVarFixedString traceFile(arguments.front());
+        if (!m_packetTraceRecorder->Start(traceFile.c_str()))
+        {
+            AZLOG_ERROR("ZstdStartPacketCapture failed to open %s for writing", traceFile.c_str());
+            return;
+        }
+
+        AZLOG_INFO("Capturing packets sent through zstd compressors into %s", traceFile.c_str());
+    }
+
+    void MultiplayerCompressionSystemComponent::ZstdStopPacketCapture([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (!m_packetTraceRecorder->IsRecording())
+        {
+            AZLOG_WARN("ZstdStopPacketCapture called while no packet capture is in progress");
+            return;
+        }
+
+        m_packetTraceRecorder->Stop();
+        AZLOG_INFO("Captured %llu packets", aznumeric_cast<AZ::u64>(m_packetTraceRecorder->GetRecordedPacketCount()));
+    }
+
+    void MultiplayerCompressionSystemComponent::ZstdTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_ERROR("ZstdTrainDictionary requires the path of the dictionary to write followed by one or more trace files");
+            return;
+        }
+
+        // An optional trailing integer argument overrides the dictionary capacity
+        size_t dictionaryCapacity = DefaultDictionaryCapacity;
+        size_t traceCount = arguments.size() - 1;
+        AZ::u32 requestedCapacity = 0;
+        if (traceCount > 1 && AZ::ConsoleTypeHelpers::StringToValue(requestedCapacity, arguments.back()))
+        {
+            dictionaryCapacity = requestedCapacity;
+            --traceCount;
+        }
+
+        PacketTrace trace;
+        for (size_t traceIndex = 0; traceIndex < traceCount; ++traceIndex)
+        {
+            const AZ::CVarFixedString traceFile(arguments[traceIndex + 1]);
+            if (!LoadPacketTrace(traceFile.c_str(), trace))
+            {
+                AZLOG_ERROR("ZstdTrainDictionary failed to load trace %s", traceFile.c_str());
+                return;
+            }
+        }
+
+        auto dictionary = TrainDictionary(trace, dictionaryCapacity);
+        if (!dictionary.IsSuccess())
+        {
+            AZLOG_ERROR("ZstdTrainDictionary failed: %s", dictionary.GetError().c_str());
+            return;
+        }
+
+        const AZ::CVarFixedString dictionaryFile(arguments.front());
+        const AZStd::vector<AZ::u8>& dictionaryData = dictionary.GetValue();
+        auto writeOutcome = AZ::Utils::WriteFile(
+            AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(dictionaryData.data()), dictionaryData.size()), dictionaryFile);
+        if (!writeOutcome.IsSuccess())
+        {
+            AZLOG_ERROR("ZstdTrainDictionary failed to write %s: %s", dictionaryFile.c_str(), writeOutcome.GetError().c_str());
+            return;
+        }
+
+        AZLOG_INFO("Trained a %llu byte dictionary from %llu packets into %s", aznumeric_cast<AZ::u64>(dictionaryData.size()),
+            aznumeric_cast<AZ::u64>(trace.GetSampleCount()), dictionaryFile.c_str());
+    }
 }
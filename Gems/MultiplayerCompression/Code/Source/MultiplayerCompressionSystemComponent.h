@@ -9,9 +9,12 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include <MultiplayerCompressionFactory.h>
+#include <ZstdCompressorFactory.h>
 
 namespace MultiplayerCompression
 {
@@ -40,6 +43,21 @@ namespace MultiplayerCompression
         void Deactivate() override {}
         ////////////////////////////////////////////////////////////////////////
     private:
+        //! Starts capturing uncompressed payloads sent through zstd compressors. Usage: MultiplayerCompressionSystemComponent.ZstdStartPacketCapture <traceFile>
+        void ZstdStartPacketCapture(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, ZstdStartPacketCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Starts capturing packets sent through zstd compressors into a trace file for dictionary training");
+
+        //! Stops an in progress packet capture.
+        void ZstdStopPacketCapture(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, ZstdStopPacketCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Stops capturing packets sent through zstd compressors");
+
+        //! Trains a dictionary from one or more packet traces. Usage: MultiplayerCompressionSystemComponent.ZstdTrainDictionary <dictionaryFile> <traceFile>... [capacity]
+        void ZstdTrainDictionary(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, ZstdTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a zstd dictionary from captured packet traces");
+
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        AZStd::shared_ptr<PacketTraceRecorder> m_packetTraceRecorder;
+        AZStd::unique_ptr<ZstdCompressorFactory> m_zstdCompressorFactory;
+        AZStd::unique_ptr<ZstdCompressorFactory> m_zstdStreamCompressorFactory;
     };
 }
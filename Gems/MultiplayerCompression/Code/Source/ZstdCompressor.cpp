@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+#include "ZstdDictionaryTrainer.h"
+
+// Required for ZSTD_initCStream_usingCDict and ZSTD_initDStream_usingDDict prior to zstd 1.4.0, zstd is statically linked
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+#include <zstd_errors.h>
+
+namespace MultiplayerCompression
+{
+    ZstdDictionary::ZstdDictionary(const void* dictData, size_t dictSize, int compressionLevel)
+    {
+        m_cdict = ZSTD_createCDict(dictData, dictSize, compressionLevel);
+        m_ddict = ZSTD_createDDict(dictData, dictSize);
+        m_dictionaryId = ZSTD_getDictID_fromDict(dictData, dictSize);
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(m_cdict);
+        ZSTD_freeDDict(m_ddict);
+    }
+
+    bool ZstdDictionary::IsValid() const
+    {
+        return (m_cdict != nullptr) && (m_ddict != nullptr);
+    }
+
+    AZ::u32 ZstdDictionary::GetDictionaryId() const
+    {
+        return m_dictionaryId;
+    }
+
+    ZSTD_CDict_s* ZstdDictionary::GetCompressionDictionary() const
+    {
+        return m_cdict;
+    }
+
+    ZSTD_DDict_s* ZstdDictionary::GetDecompressionDictionary() const
+    {
+        return m_ddict;
+    }
+
+    static AzNetworking::CompressorError ConvertZstdError(size_t result)
+    {
+        return (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+            ? AzNetworking::CompressorError::InsufficientBuffer
+            : AzNetworking::CompressorError::CorruptData;
+    }
+
+    static size_t InitCompressionStream(ZSTD_CCtx* context, const ZstdDictionary* dictionary, int compressionLevel)
+    {
+#if ZSTD_VERSION_NUMBER >= 10400
+        // The parametric API superseded the initCStream variants in zstd 1.4.0
+        const size_t result = ZSTD_CCtx_reset(context, ZSTD_reset_session_only);
+        if (ZSTD_isError(result))
+        {
+            return result;
+        }
+        return dictionary
+            ? ZSTD_CCtx_refCDict(context, dictionary->GetCompressionDictionary())
+            : ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel, compressionLevel);
+#else
+        return dictionary
+            ? ZSTD_initCStream_usingCDict(context, dictionary->GetCompressionDictionary())
+            : ZSTD_initCStream(context, compressionLevel);
+#endif
+    }
+
+    static size_t InitDecompressionStream(ZSTD_DCtx* context, const ZstdDictionary* dictionary)
+    {
+#if ZSTD_VERSION_NUMBER >= 10400
+        const size_t result = ZSTD_DCtx_reset(context, ZSTD_reset_session_only);
+        if (ZSTD_isError(result) || !dictionary)
+        {
+            return result;
+        }
+        return ZSTD_DCtx_refDDict(context, dictionary->GetDecompressionDictionary());
+#else
+        return dictionary
+            ? ZSTD_initDStream_usingDDict(context, dictionary->GetDecompressionDictionary())
+            : ZSTD_initDStream(context);
+#endif
+    }
+
+    ZstdCompressor::ZstdCompressor(Mode mode, int compressionLevel, AZStd::shared_ptr<const ZstdDictionary> dictionary)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_mode(mode)
+        , m_compressionLevel(compressionLevel)
+    {
+        if (m_dictionary && !m_dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Supplied zstd dictionary is invalid, compressing without a dictionary");
+            m_dictionary.reset();
+        }
+        Init();
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        ReleaseContexts();
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        ReleaseContexts();
+
+        // Contexts are reused across packets, so the per packet cost is limited to the actual compression work
+        m_compressionContext = ZSTD_createCCtx();
+        m_decompressionContext = ZSTD_createDCtx();
+        if (m_compressionContext == nullptr || m_decompressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to allocate zstd contexts");
+            ReleaseContexts();
+            return false;
+        }
+
+        if (m_mode == Mode::Stream)
+        {
+            // A single frame spans the whole connection, the dictionary only needs to be referenced once when the frame begins
+            const size_t compInitResult = InitCompressionStream(m_compressionContext, m_dictionary.get(), m_compressionLevel);
+            const size_t decompInitResult = InitDecompressionStream(m_decompressionContext, m_dictionary.get());
+
+            if (ZSTD_isError(compInitResult) || ZSTD_isError(decompInitResult))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Failed to initialize zstd streams: %s",
+                    ZSTD_getErrorName(ZSTD_isError(compInitResult) ? compInitResult : decompInitResult));
+                ReleaseContexts();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void ZstdCompressor::ReleaseContexts()
+    {
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+        m_compressionContext = nullptr;
+        m_decompressionContext = nullptr;
+    }
+
+    void ZstdCompressor::SetPacketTraceRecorder(AZStd::shared_ptr<PacketTraceRecorder> recorder)
+    {
+        m_packetTraceRecorder = AZStd::move(recorder);
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_compressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compressor context is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_packetTraceRecorder)
+        {
+            m_packetTraceRecorder->Record(uncompData, uncompSize);
+        }
+
+        return (m_mode == Mode::Stream)
+            ? CompressStream(uncompData, uncompSize, compData, compDataSize, compSize)
+            : CompressPacket(uncompData, uncompSize, compData, compDataSize, compSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress
+    (
+        const void* compData,
+        size_t compDataSize,
+        void* uncompData,
+        size_t uncompDataSize,
+        size_t& consumedSize,
+        size_t& uncompSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_decompressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompressor context is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        return (m_mode == Mode::Stream)
+            ? DecompressStream(compData, compDataSize, uncompData, uncompDataSize, consumedSize, uncompSize)
+            : DecompressPacket(compData, compDataSize, uncompData, uncompDataSize, consumedSize, uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::CompressPacket(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize)
+    {
+        const size_t result = m_dictionary
+            ? ZSTD_compress_usingCDict(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_dictionary->GetCompressionDictionary())
+            : ZSTD_compressCCtx(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B): %s", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return ConvertZstdError(result);
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::CompressStream(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize)
+    {
+        ZSTD_inBuffer input = { uncompData, uncompSize, 0 };
+        ZSTD_outBuffer output = { compData, compDataSize, 0 };
+
+        while (input.pos < input.size)
+        {
+            const size_t result = ZSTD_compressStream(m_compressionContext, &output, &input);
+            if (ZSTD_isError(result))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Stream compression failed for uncompSize:(%zu B): %s", uncompSize, ZSTD_getErrorName(result));
+                return ConvertZstdError(result);
+            }
+
+            if (output.pos == output.size && input.pos < input.size)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Outbuffer size (%zu B) is insufficient for stream compression", compDataSize);
+                return AzNetworking::CompressorError::InsufficientBuffer;
+            }
+        }
+
+        // Flush so that the remote can decode the entire packet without waiting on further data
+        size_t remaining = 0;
+        do
+        {
+            remaining = ZSTD_flushStream(m_compressionContext, &output);
+            if (ZSTD_isError(remaining))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Stream flush failed: %s", ZSTD_getErrorName(remaining));
+                return ConvertZstdError(remaining);
+            }
+
+            if (remaining > 0 && output.pos == output.size)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Outbuffer size (%zu B) is insufficient to flush the compression stream", compDataSize);
+                return AzNetworking::CompressorError::InsufficientBuffer;
+            }
+        } while (remaining > 0);
+
+        compSize = output.pos;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::DecompressPacket(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize)
+    {
+        const size_t result = m_dictionary
+            ? ZSTD_decompress_usingDDict(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize, m_dictionary->GetDecompressionDictionary())
+            : ZSTD_decompressDCtx(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize);
+        consumedSize = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B): %s", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return ConvertZstdError(result);
+        }
+
+        uncompSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::DecompressStream(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize)
+    {
+        ZSTD_inBuffer input = { compData, compDataSize, 0 };
+        ZSTD_outBuffer output = { uncompData, uncompDataSize, 0 };
+
+        while (input.pos < input.size)
+        {
+            const size_t result = ZSTD_decompressStream(m_decompressionContext, &output, &input);
+            if (ZSTD_isError(result))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Stream decompression failed for compDataSize:(%zu B): %s", compDataSize, ZSTD_getErrorName(result));
+                return ConvertZstdError(result);
+            }
+
+            if (output.pos == output.size && input.pos < input.size)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Outbuffer size (%zu B) is insufficient for stream decompression", uncompDataSize);
+                return AzNetworking::CompressorError::InsufficientBuffer;
+            }
+        }
+
+        consumedSize = input.pos;
+        uncompSize = output.pos;
+        return AzNetworking::CompressorError::Ok;
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    class PacketTraceRecorder;
+
+    static const char* ZstdCompressorName = "Zstd";
+    static const AzNetworking::CompressorType ZstdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdCompressorName)));
+
+    /**
+    * Immutable, pre-digested zstd dictionary shared by every compressor created by a factory.
+    * Dictionaries are trained offline from captured packet traces (see ZstdDictionaryTrainer.h).
+    */
+    class ZstdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionary, AZ::SystemAllocator);
+
+        ZstdDictionary(const void* dictData, size_t dictSize, int compressionLevel);
+        ~ZstdDictionary();
+
+        ZstdDictionary(const ZstdDictionary&) = delete;
+        ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+
+        //! Returns true if both the compression and decompression dictionaries were successfully digested.
+        bool IsValid() const;
+
+        //! Returns the dictionary id embedded in the trained dictionary, or 0 for raw content dictionaries.
+        AZ::u32 GetDictionaryId() const;
+
+        ZSTD_CDict_s* GetCompressionDictionary() const;
+        ZSTD_DDict_s* GetDecompressionDictionary() const;
+
+    private:
+        ZSTD_CDict_s* m_cdict = nullptr;
+        ZSTD_DDict_s* m_ddict = nullptr;
+        AZ::u32 m_dictionaryId = 0;
+    };
+
+    /**
+    * Implements a zstd Compressor against Multiplayer's Compressor interface for use with AzNetworking.
+    * In packet mode, every packet is compressed as an independent frame, which makes it suitable for UDP. Small packets
+    * compress poorly on their own, so a dictionary trained on representative traffic should be supplied.
+    * In streaming mode, a compression and decompression context is kept alive for the lifetime of the compressor (one per
+    * TCP connection) so every packet can reference the history of previously sent packets. Streaming mode is stateful and
+    * only valid for reliable, ordered transports.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator);
+
+        enum class Mode
+        {
+            Packet,   //!< Every packet is an independent frame
+            Stream    //!< Packets are flushed blocks of a single frame spanning the whole connection
+        };
+
+        ZstdCompressor(Mode mode, int compressionLevel, AZStd::shared_ptr<const ZstdDictionary> dictionary = nullptr);
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZstdCompressorType; };
+
+        //! Creates the zstd contexts, resetting any streaming history.
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+        bool IsStateful() const override { return m_mode == Mode::Stream; }
+
+        //! Sets a recorder that receives every uncompressed payload while it is recording, used to capture training traces.
+        void SetPacketTraceRecorder(AZStd::shared_ptr<PacketTraceRecorder> recorder);
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        void ReleaseContexts();
+
+        AzNetworking::CompressorError CompressPacket(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize);
+        AzNetworking::CompressorError CompressStream(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize);
+        AzNetworking::CompressorError DecompressPacket(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize);
+        AzNetworking::CompressorError DecompressStream(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize);
+
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        AZStd::shared_ptr<PacketTraceRecorder> m_packetTraceRecorder;
+        ZSTD_CCtx_s* m_compressionContext = nullptr;
+        ZSTD_DCtx_s* m_decompressionContext = nullptr;
+        Mode m_mode = Mode::Packet;
+        int m_compressionLevel = 0;
+    };
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressorFactory.h"
+#include "ZstdDictionaryTrainer.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(int32_t, mp_zstdCompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Compression level used by the zstd compressors, must be set before creating the network interface");
+    AZ_CVAR(AZ::CVarFixedString, mp_zstdDictionary, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Dictionary used by the zstd compressors, trained with ZstdTrainDictionary. Relative paths resolve against the project folder. "
+        "Both ends of a connection must use the same dictionary");
+
+    ZstdCompressorFactory::ZstdCompressorFactory(ZstdCompressor::Mode mode, AZStd::shared_ptr<PacketTraceRecorder> packetTraceRecorder)
+        : m_packetTraceRecorder(AZStd::move(packetTraceRecorder))
+        , m_mode(mode)
+    {
+        ;
+    }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> ZstdCompressorFactory::Create()
+    {
+        const int compressionLevel = mp_zstdCompressionLevel;
+        auto compressor = AZStd::make_unique<ZstdCompressor>(m_mode, compressionLevel, AcquireDictionary(compressionLevel));
+        compressor->SetPacketTraceRecorder(m_packetTraceRecorder);
+        return compressor;
+    }
+
+    const AZStd::string_view ZstdCompressorFactory::GetFactoryName() const
+    {
+        return (m_mode == ZstdCompressor::Mode::Stream) ? s_streamCompressorName : s_packetCompressorName;
+    }
+
+    AZStd::shared_ptr<const ZstdDictionary> ZstdCompressorFactory::AcquireDictionary(int compressionLevel)
+    {
+        const AZ::CVarFixedString dictionaryCvar = mp_zstdDictionary;
+
+        // Connections can be created from multiple threads, the dictionary is only loaded once
+        AZStd::lock_guard<AZStd::mutex> lock(m_dictionaryMutex);
+        if (dictionaryCvar.empty())
+        {
+            m_dictionary.reset();
+            m_dictionaryPath.clear();
+            return nullptr;
+        }
+
+        if (m_dictionary && m_dictionaryPath == dictionaryCvar.c_str() && m_dictionaryCompressionLevel == compressionLevel)
+        {
+            return m_dictionary;
+        }
+
+        AZ::IO::FixedMaxPath dictionaryPath(dictionaryCvar.c_str());
+        if (dictionaryPath.IsRelative())
+        {
+            dictionaryPath = AZ::IO::FixedMaxPath(AZ::Utils::GetProjectPath()) / dictionaryPath;
+        }
+
+        auto dictionaryData = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(dictionaryPath.Native());
+        if (!dictionaryData.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to load zstd dictionary %s: %s", dictionaryPath.c_str(), dictionaryData.GetError().c_str());
+            return nullptr;
+        }
+
+        const AZStd::vector<uint8_t>& data = dictionaryData.GetValue();
+        auto dictionary = AZStd::make_shared<ZstdDictionary>(data.data(), data.size(), compressionLevel);
+        if (!dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to digest zstd dictionary %s", dictionaryPath.c_str());
+            return nullptr;
+        }
+
+        m_dictionary = AZStd::move(dictionary);
+        m_dictionaryPath = dictionaryCvar.c_str();
+        m_dictionaryCompressionLevel = compressionLevel;
+        return m_dictionary;
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+#include "ZstdCompressor.h"
+
+namespace MultiplayerCompression
+{
+    class PacketTraceRecorder;
+
+    /**
+    * Factory for zstd compressors, selectable through net_UdpCompressor and net_TcpCompressor.
+    * "ZstdCompressor" compresses every packet independently and works for both UDP and TCP.
+    * "ZstdStreamCompressor" keeps a streaming context per TCP connection and must only be used for TCP.
+    * Both load the dictionary referenced by mp_zstdDictionary once and share it between all created compressors.
+    */
+    class ZstdCompressorFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        ZstdCompressorFactory(ZstdCompressor::Mode mode, AZStd::shared_ptr<PacketTraceRecorder> packetTraceRecorder);
+
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the string name of this compressor factory
+        //! @return the string name of this compressor factory
+        const AZStd::string_view GetFactoryName() const override;
+
+    private:
+        //! Loads the dictionary referenced by mp_zstdDictionary, reusing the previously loaded one if the cvars did not change.
+        AZStd::shared_ptr<const ZstdDictionary> AcquireDictionary(int compressionLevel);
+
+        static constexpr AZStd::string_view s_packetCompressorName = "ZstdCompressor";
+        static constexpr AZStd::string_view s_streamCompressorName = "ZstdStreamCompressor";
+
+        AZStd::mutex m_dictionaryMutex;
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        AZStd::string m_dictionaryPath;
+        int m_dictionaryCompressionLevel = 0;
+        AZStd::shared_ptr<PacketTraceRecorder> m_packetTraceRecorder;
+        ZstdCompressor::Mode m_mode;
+    };
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdDictionaryTrainer.h"
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    void PacketTrace::AddSample(const void* data, size_t size)
+    {
+        const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(data);
+        m_samples.insert(m_samples.end(), bytes, bytes + size);
+        m_sampleSizes.push_back(size);
+    }
+
+    size_t PacketTrace::GetSampleCount() const
+    {
+        return m_sampleSizes.size();
+    }
+
+    PacketTraceRecorder::PacketTraceRecorder() = default;
+
+    PacketTraceRecorder::~PacketTraceRecorder()
+    {
+        Stop();
+    }
+
+    bool PacketTraceRecorder::Start(const char* filePath)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath;
+        m_stream = AZStd::make_unique<AZ::IO::SystemFileStream>(filePath, openMode);
+        if (!m_stream->IsOpen())
+        {
+            m_stream.reset();
+            return false;
+        }
+
+        m_recordedPacketCount = 0;
+        m_recording = true;
+        return true;
+    }
+
+    void PacketTraceRecorder::Stop()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_recording = false;
+        m_stream.reset();
+    }
+
+    bool PacketTraceRecorder::IsRecording() const
+    {
+        return m_recording;
+    }
+
+    size_t PacketTraceRecorder::GetRecordedPacketCount() const
+    {
+        return m_recordedPacketCount;
+    }
+
+    void PacketTraceRecorder::Record(const void* data, size_t size)
+    {
+        if (!m_recording)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_stream == nullptr)
+        {
+            return;
+        }
+
+        const uint32_t recordSize = aznumeric_cast<uint32_t>(size);
+        m_stream->Write(sizeof(recordSize), &recordSize);
+        m_stream->Write(size, data);
+        ++m_recordedPacketCount;
+    }
+
+    bool LoadPacketTrace(const char* filePath, PacketTrace& outTrace)
+    {
+        AZ::IO::SystemFileStream stream(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to open packet trace %s", filePath);
+            return false;
+        }
+
+        const AZ::IO::SizeType length = stream.GetLength();
+        AZ::IO::SizeType position = 0;
+        AZStd::vector<AZ::u8> record;
+        while (position < length)
+        {
+            uint32_t recordSize = 0;
+            if (stream.Read(sizeof(recordSize), &recordSize) != sizeof(recordSize) || (position + sizeof(recordSize) + recordSize) > length)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Packet trace %s is truncated at offset %llu", filePath, aznumeric_cast<AZ::u64>(position));
+                return false;
+            }
+
+            record.resize_no_construct(recordSize);
+            stream.Read(recordSize, record.data());
+            outTrace.AddSample(record.data(), recordSize);
+            position += sizeof(recordSize) + recordSize;
+        }
+
+        return true;
+    }
+
+    AZ::Outcome<AZStd::vector<AZ::u8>, AZStd::string> TrainDictionary(const PacketTrace& trace, size_t dictionaryCapacity)
+    {
+        if (trace.GetSampleCount() == 0)
+        {
+            return AZ::Failure(AZStd::string("Packet trace contains no samples"));
+        }
+
+        AZStd::vector<AZ::u8> dictionary;
+        dictionary.resize_no_construct(dictionaryCapacity);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(
+            dictionary.data(),
+            dictionary.size(),
+            trace.m_samples.data(),
+            trace.m_sampleSizes.data(),
+            aznumeric_cast<unsigned>(trace.m_sampleSizes.size()));
+
+        if (ZDICT_isError(dictionarySize))
+        {
+            return AZ::Failure(AZStd::string::format("Dictionary training failed: %s", ZDICT_getErrorName(dictionarySize)));
+        }
+
+        dictionary.resize(dictionarySize);
+        return AZ::Success(AZStd::move(dictionary));
+    }
+}
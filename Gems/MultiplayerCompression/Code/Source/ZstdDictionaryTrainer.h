@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    class SystemFileStream;
+}
+
+namespace MultiplayerCompression
+{
+    //! Default capacity of trained dictionaries, large enough for the common packet shapes of a game while staying cache friendly.
+    static constexpr size_t DefaultDictionaryCapacity = 16 * 1024;
+
+    /**
+    * A set of captured packet payloads, stored back to back in a single buffer.
+    * Trace files are a flat sequence of records, each being a native endian uint32 payload size followed by the payload bytes.
+    */
+    struct PacketTrace
+    {
+        AZStd::vector<AZ::u8> m_samples;
+        AZStd::vector<size_t> m_sampleSizes;
+
+        //! Appends a single packet payload to the trace.
+        void AddSample(const void* data, size_t size);
+
+        //! Returns the number of packets in the trace.
+        size_t GetSampleCount() const;
+    };
+
+    /**
+    * Records uncompressed packet payloads handed to a compressor into a trace file for offline dictionary training.
+    * Recording can be toggled at runtime and is safe to use from multiple network threads.
+    */
+    class PacketTraceRecorder
+    {
+    public:
+        PacketTraceRecorder();
+        ~PacketTraceRecorder();
+
+        //! Starts recording into the provided file, truncating it.
+        //! @return true if the file could be opened for writing
+        bool Start(const char* filePath);
+
+        //! Stops recording and closes the trace file.
+        void Stop();
+
+        //! Returns true if packets are currently being recorded.
+        bool IsRecording() const;
+
+        //! Returns the number of packets recorded since the last call to Start().
+        size_t GetRecordedPacketCount() const;
+
+        //! Appends a packet payload to the trace file if recording.
+        void Record(const void* data, size_t size);
+
+    private:
+        AZStd::mutex m_mutex;
+        AZStd::unique_ptr<AZ::IO::SystemFileStream> m_stream;
+        AZStd::atomic_bool m_recording{ false };
+        AZStd::atomic<size_t> m_recordedPacketCount{ 0 };
+    };
+
+    //! Loads a trace file written by PacketTraceRecorder.
+    //! @param filePath  path of the trace file to load
+    //! @param outTrace  trace to append the loaded packets to
+    //! @return true if the file was successfully parsed
+    bool LoadPacketTrace(const char* filePath, PacketTrace& outTrace);
+
+    //! Trains a zstd dictionary from a packet trace.
+    //! @param trace              packets to train against, should contain at least a few hundred representative packets
+    //! @param dictionaryCapacity maximum size in bytes of the trained dictionary
+    //! @return the trained dictionary, or an error message on failure
+    AZ::Outcome<AZStd::vector<AZ::u8>, AZStd::string> TrainDictionary(const PacketTrace& trace, size_t dictionaryCapacity = DefaultDictionaryCapacity);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <LZ4Compressor.h>
+#include <ZstdCompressor.h>
+#include <ZstdDictionaryTrainer.h>
+#include <PacketTraceGenerator.h>
+
+#include <stdlib.h>
+
+namespace UnitTest
+{
+    //! Compares compression ratio and time per packet of the available packet compressors.
+    //! Set MULTIPLAYER_COMPRESSION_TRACE to the path of a trace captured with ZstdStartPacketCapture to benchmark against
+    //! recorded traffic, the first half of the trace is then used for training and the second half for measurements.
+    //! Otherwise synthetic entity update packets are used.
+    class MultiplayerCompressionBenchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+        void internalSetUp()
+        {
+            MultiplayerCompression::PacketTrace recordedTrace;
+            const char* tracePath = getenv("MULTIPLAYER_COMPRESSION_TRACE");
+            if (tracePath != nullptr && MultiplayerCompression::LoadPacketTrace(tracePath, recordedTrace) && recordedTrace.GetSampleCount() > 1)
+            {
+                SplitTrace(recordedTrace);
+            }
+            else
+            {
+                m_trainingTrace = GenerateSyntheticPacketTrace(4096, 1);
+                m_measuredTrace = GenerateSyntheticPacketTrace(1024, 2);
+            }
+
+            auto dictionaryData = MultiplayerCompression::TrainDictionary(m_trainingTrace);
+            if (dictionaryData.IsSuccess())
+            {
+                m_dictionary = AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(
+                    dictionaryData.GetValue().data(), dictionaryData.GetValue().size(), 3);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_dictionary.reset();
+            m_trainingTrace = {};
+            m_measuredTrace = {};
+        }
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void RunCompressBenchmark(benchmark::State& state, AzNetworking::ICompressor& compressor)
+        {
+            AzNetworking::UdpPacketEncodingBuffer compressedBuffer;
+            size_t uncompressedBytes = 0;
+            size_t compressedBytes = 0;
+            size_t packets = 0;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                size_t sampleOffset = 0;
+                for (size_t sampleSize : m_measuredTrace.m_sampleSizes)
+                {
+                    size_t compressedSize = 0;
+                    compressor.Compress(m_measuredTrace.m_samples.data() + sampleOffset, sampleSize,
+                        compressedBuffer.GetBuffer(), compressedBuffer.GetCapacity(), compressedSize);
+                    benchmark::DoNotOptimize(compressedSize);
+                    sampleOffset += sampleSize;
+                    uncompressedBytes += sampleSize;
+                    compressedBytes += compressedSize;
+                }
+                packets += m_measuredTrace.GetSampleCount();
+            }
+
+            state.SetItemsProcessed(packets);
+            state.SetBytesProcessed(uncompressedBytes);
+            state.counters["Ratio"] = (compressedBytes > 0) ? static_cast<double>(uncompressedBytes) / static_cast<double>(compressedBytes) : 0.0;
+            state.counters["UsPerPacket"] = benchmark::Counter(static_cast<double>(packets) * 1.0e-6, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+        }
+
+    protected:
+        void SplitTrace(const MultiplayerCompression::PacketTrace& trace)
+        {
+            const size_t trainingCount = trace.GetSampleCount() / 2;
+            size_t sampleOffset = 0;
+            for (size_t sampleIndex = 0; sampleIndex < trace.GetSampleCount(); ++sampleIndex)
+            {
+                const size_t sampleSize = trace.m_sampleSizes[sampleIndex];
+                MultiplayerCompression::PacketTrace& target = (sampleIndex < trainingCount) ? m_trainingTrace : m_measuredTrace;
+                target.AddSample(trace.m_samples.data() + sampleOffset, sampleSize);
+                sampleOffset += sampleSize;
+            }
+        }
+
+        MultiplayerCompression::PacketTrace m_trainingTrace;
+        MultiplayerCompression::PacketTrace m_measuredTrace;
+        AZStd::shared_ptr<const MultiplayerCompression::ZstdDictionary> m_dictionary;
+    };
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, BM_LZ4Compress)(benchmark::State& state)
+    {
+        MultiplayerCompression::LZ4Compressor compressor;
+        RunCompressBenchmark(state, compressor);
+    }
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, BM_ZstdCompress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor(MultiplayerCompression::ZstdCompressor::Mode::Packet, 3);
+        RunCompressBenchmark(state, compressor);
+    }
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, BM_ZstdDictionaryCompress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor(MultiplayerCompression::ZstdCompressor::Mode::Packet, 3, m_dictionary);
+        RunCompressBenchmark(state, compressor);
+    }
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, BM_ZstdStreamCompress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor(MultiplayerCompression::ZstdCompressor::Mode::Stream, 3, m_dictionary);
+        RunCompressBenchmark(state, compressor);
+    }
+
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, BM_LZ4Compress)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, BM_ZstdCompress)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, BM_ZstdDictionaryCompress)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, BM_ZstdStreamCompress)->Unit(benchmark::kMicrosecond);
+} // namespace UnitTest
+
+#endif
@@ -10,9 +10,13 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZstdCompressor.h>
+#include <ZstdDictionaryTrainer.h>
+#include <PacketTraceGenerator.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
@@ -115,4 +119,103 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+namespace
+{
+    // Compresses and decompresses every packet of a trace, validating the round trip and returning the total compressed size
+    size_t RoundTripTrace(AzNetworking::ICompressor& compressor, const MultiplayerCompression::PacketTrace& trace)
+    {
+        AzNetworking::UdpPacketEncodingBuffer compressedBuffer;
+        AzNetworking::UdpPacketEncodingBuffer decompressedBuffer;
+        size_t totalCompressedSize = 0;
+        size_t sampleOffset = 0;
+
+        for (size_t sampleSize : trace.m_sampleSizes)
+        {
+            const uint8_t* sample = trace.m_samples.data() + sampleOffset;
+            sampleOffset += sampleSize;
+
+            size_t compressedSize = 0;
+            size_t consumedSize = 0;
+            size_t uncompressedSize = 0;
+            EXPECT_EQ(compressor.Compress(sample, sampleSize, compressedBuffer.GetBuffer(), compressedBuffer.GetCapacity(), compressedSize), AzNetworking::CompressorError::Ok);
+            EXPECT_EQ(compressor.Decompress(compressedBuffer.GetBuffer(), compressedSize, decompressedBuffer.GetBuffer(), decompressedBuffer.GetCapacity(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+            EXPECT_EQ(consumedSize, compressedSize);
+            EXPECT_EQ(uncompressedSize, sampleSize);
+            EXPECT_EQ(memcmp(decompressedBuffer.GetBuffer(), sample, sampleSize), 0);
+            totalCompressedSize += compressedSize;
+        }
+
+        return totalCompressedSize;
+    }
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdPacketRoundTrip)
+{
+    const MultiplayerCompression::PacketTrace trace = UnitTest::GenerateSyntheticPacketTrace(64);
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor(MultiplayerCompression::ZstdCompressor::Mode::Packet, 3);
+    EXPECT_FALSE(zstdCompressor.IsStateful());
+    RoundTripTrace(zstdCompressor, trace);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdDictionaryImprovesRatio)
+{
+    const MultiplayerCompression::PacketTrace trainingTrace = UnitTest::GenerateSyntheticPacketTrace(2048, 1);
+    const MultiplayerCompression::PacketTrace testTrace = UnitTest::GenerateSyntheticPacketTrace(256, 2);
+
+    auto dictionaryData = MultiplayerCompression::TrainDictionary(trainingTrace, 4 * 1024);
+    ASSERT_TRUE(dictionaryData.IsSuccess());
+    auto dictionary = AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(dictionaryData.GetValue().data(), dictionaryData.GetValue().size(), 3);
+    ASSERT_TRUE(dictionary->IsValid());
+
+    MultiplayerCompression::ZstdCompressor plainCompressor(MultiplayerCompression::ZstdCompressor::Mode::Packet, 3);
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor(MultiplayerCompression::ZstdCompressor::Mode::Packet, 3, dictionary);
+
+    const size_t plainSize = RoundTripTrace(plainCompressor, testTrace);
+    const size_t dictionarySize = RoundTripTrace(dictionaryCompressor, testTrace);
+    EXPECT_LT(dictionarySize, plainSize);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdStreamRoundTrip)
+{
+    const MultiplayerCompression::PacketTrace trace = UnitTest::GenerateSyntheticPacketTrace(256);
+
+    // Streaming compressors keep history across packets, so the same instance acts as both ends of the connection here
+    MultiplayerCompression::ZstdCompressor streamCompressor(MultiplayerCompression::ZstdCompressor::Mode::Stream, 3);
+    MultiplayerCompression::ZstdCompressor packetCompressor(MultiplayerCompression::ZstdCompressor::Mode::Packet, 3);
+    EXPECT_TRUE(streamCompressor.IsStateful());
+
+    const size_t streamSize = RoundTripTrace(streamCompressor, trace);
+    const size_t packetSize = RoundTripTrace(packetCompressor, trace);
+    EXPECT_LT(streamSize, packetSize);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdCorruptDataTest)
+{
+    uint8_t garbage[64];
+    memset(garbage, 0xA5, sizeof(garbage));
+    uint8_t output[256];
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor(MultiplayerCompression::ZstdCompressor::Mode::Packet, 3);
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(garbage, sizeof(garbage), output, sizeof(output), consumedSize, uncompressedSize);
+    EXPECT_EQ(decompressStatus, AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdNullTest)
+{
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor(MultiplayerCompression::ZstdCompressor::Mode::Packet, 3);
+
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(nullptr, 4, nullptr, 4, compressedSize);
+    EXPECT_EQ(compressStatus, AzNetworking::CompressorError::Uninitialized);
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(nullptr, 4, nullptr, 4, consumedSize, uncompressedSize);
+    EXPECT_EQ(decompressStatus, AzNetworking::CompressorError::Uninitialized);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Random.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+
+#include <ZstdDictionaryTrainer.h>
+
+namespace UnitTest
+{
+    //! Generates packets shaped like entity replication updates: a header followed by a handful of small property records.
+    //! Consecutive packets share most of their structure, which is what a trained dictionary is expected to exploit.
+    inline MultiplayerCompression::PacketTrace GenerateSyntheticPacketTrace(size_t packetCount, AZ::u64 seed = 1234)
+    {
+        AZ::SimpleLcgRandom random(seed);
+        MultiplayerCompression::PacketTrace trace;
+
+        for (size_t packetIndex = 0; packetIndex < packetCount; ++packetIndex)
+        {
+            AzNetworking::UdpPacketEncodingBuffer buffer;
+            AzNetworking::NetworkInputSerializer inputSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            AzNetworking::ISerializer& serializer = inputSerializer; // To get the default typeinfo parameters in ISerializer
+
+            uint16_t packetType = 7;
+            uint32_t hostFrameId = static_cast<uint32_t>(packetIndex);
+            uint8_t entityCount = static_cast<uint8_t>(2 + random.GetRandom() % 8);
+            serializer.Serialize(packetType, "PacketType");
+            serializer.Serialize(hostFrameId, "HostFrameId");
+            serializer.Serialize(entityCount, "EntityCount");
+
+            for (uint8_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+            {
+                uint32_t netEntityId = 100 + random.GetRandom() % 64;
+                uint16_t componentDirtyBits = (random.GetRandom() % 4 == 0) ? 0x0003 : 0x0001;
+                float positionX = 512.0f + static_cast<float>(random.GetRandom() % 64);
+                float positionY = 512.0f + static_cast<float>(random.GetRandom() % 64);
+                float positionZ = 32.0f;
+                uint16_t health = 100;
+                serializer.Serialize(netEntityId, "NetEntityId");
+                serializer.Serialize(componentDirtyBits, "DirtyBits");
+                serializer.Serialize(positionX, "PositionX");
+                serializer.Serialize(positionY, "PositionY");
+                serializer.Serialize(positionZ, "PositionZ");
+                if (componentDirtyBits & 0x0002)
+                {
+                    serializer.Serialize(health, "Health");
+                }
+            }
+
+            trace.AddSample(buffer.GetBuffer(), inputSerializer.GetSize());
+        }
+
+        return trace;
+    }
+}
@@ -13,4 +13,10 @@ set(FILES
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
     Source/MultiplayerCompressionSystemComponent.h
+    Source/ZstdCompressor.cpp
+    Source/ZstdCompressor.h
+    Source/ZstdCompressorFactory.cpp
+    Source/ZstdCompressorFactory.h
+    Source/ZstdDictionaryTrainer.cpp
+    Source/ZstdDictionaryTrainer.h
 )
@@ -7,5 +7,7 @@
 #
 
 set(FILES
+    Tests/MultiplayerCompressionBenchmarks.cpp
     Tests/MultiplayerCompressionTest.cpp
+    Tests/PacketTraceGenerator.h
 )
@@ -20,6 +20,7 @@ AZ_DECLARE_BUDGET(Cloth);
 namespace NvCloth
 {
     class IClothConfigurator;
+    class ISolver;
 
     //! Interface to a cloth in the system.
     //! A cloth is formed of particles that are simulated with a series of constraints specified by a fabric.
@@ -83,6 +84,9 @@ namespace NvCloth
         //! parameters that define its behavior during simulation.
         virtual IClothConfigurator* GetClothConfigurator() = 0;
 
+        //! Returns the solver the cloth is added to or nullptr if it's not part of any solver.
+        virtual ISolver* GetSolver() = 0;
+
         //! Connects a handler to the PreSimulationEvent.
         //! Note that the events can be triggered from multiple threads at the same time.
         //! Please make sure the handler is reentrant and thread-safe.
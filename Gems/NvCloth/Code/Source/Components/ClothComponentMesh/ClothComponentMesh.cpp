@@ -15,6 +15,7 @@
 #include <Atom/RHI/RHIUtils.h>
 
 #include <NvCloth/IClothSystem.h>
+#include <NvCloth/ISolver.h>
 #include <NvCloth/IFabricCooker.h>
 #include <NvCloth/IClothConfigurator.h>
 #include <NvCloth/ITangentSpaceHelper.h>
@@ -135,6 +136,11 @@ namespace NvCloth
         else if (m_cloth)
         {
             m_config = config;
+            if (IsSolverSimulating())
+            {
+                m_pendingConfigurationUpdate = true;
+                return;
+            }
             ApplyConfigurationToCloth();
 
             // Update the cloth constraints parameters
@@ -244,6 +250,10 @@ namespace NvCloth
             EnableSkinning();
         }
         m_entityId.SetInvalid();
+        m_pendingWorldTransform.reset();
+        m_pendingTeleport = false;
+        m_pendingWindUpdate = false;
+        m_pendingConfigurationUpdate = false;
         m_renderDataBuffer = {};
         m_meshRemappedVertices.clear();
         m_meshNodeInfo = {};
@@ -289,9 +299,15 @@ namespace NvCloth
     {
         // At the moment there is no way to distinguish "move" from "teleport".
         // As a workaround we will consider a teleport if the position has changed considerably.
-        bool teleport = (m_worldPosition.GetDistance(world.GetTranslation()) >= cloth_DistanceToTeleport);
+        const AZ::Vector3 previousWorldPosition = m_pendingWorldTransform ? m_pendingWorldTransform->GetTranslation() : m_worldPosition;
+        bool teleport = (previousWorldPosition.GetDistance(world.GetTranslation()) >= cloth_DistanceToTeleport);
 
-        if (teleport)
+        if (IsSolverSimulating())
+        {
+            m_pendingWorldTransform = world;
+            m_pendingTeleport = m_pendingTeleport || teleport;
+        }
+        else if (teleport)
         {
             TeleportCloth(world);
         }
@@ -303,6 +319,8 @@ namespace NvCloth
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        ApplyPendingChanges();
+
         CopyRenderDataToModel();
     }
 
@@ -313,6 +331,12 @@ namespace NvCloth
 
     void ClothComponentMesh::OnGlobalWindChanged()
     {
+        if (IsSolverSimulating())
+        {
+            m_pendingWindUpdate = true;
+            return;
+        }
+
         m_cloth->GetClothConfigurator()->SetWindVelocity(GetWindBusVelocity());
     }
 
@@ -780,6 +804,47 @@ namespace NvCloth
         m_cloth->GetClothConfigurator()->ClearInertia();
     }
 
+    bool ClothComponentMesh::IsSolverSimulating() const
+    {
+        const ISolver* solver = m_cloth ? m_cloth->GetSolver() : nullptr;
+        return solver && solver->IsSimulating();
+    }
+
+    void ClothComponentMesh::ApplyPendingChanges()
+    {
+        if (!m_cloth)
+        {
+            return;
+        }
+
+        if (m_pendingConfigurationUpdate)
+        {
+            m_pendingConfigurationUpdate = false;
+            UpdateConfiguration(m_entityId, m_config);
+        }
+
+        if (m_pendingWorldTransform)
+        {
+            if (m_pendingTeleport)
+            {
+                TeleportCloth(*m_pendingWorldTransform);
+            }
+            else
+            {
+                MoveCloth(*m_pendingWorldTransform);
+            }
+            m_pendingWorldTransform.reset();
+            m_pendingTeleport = false;
+            m_pendingWindUpdate = false; // Moving the cloth updates the wind velocity already
+        }
+
+        if (m_pendingWindUpdate)
+        {
+            m_pendingWindUpdate = false;
+            OnGlobalWindChanged();
+        }
+    }
+
     AZ::Vector3 ClothComponentMesh::GetWindBusVelocity()
     {
         const Physics::WindRequests* windRequests = AZ::Interface<Physics::WindRequests>::Get();
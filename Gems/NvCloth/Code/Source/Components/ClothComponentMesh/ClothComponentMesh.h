@@ -11,6 +11,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/optional.h>
 
 #include <AzFramework/Physics/WindBus.h>
 
@@ -95,6 +96,11 @@ namespace NvCloth
 
         AZ::Vector3 GetWindBusVelocity();
 
+        // Returns whether the solver of the cloth is simulating asynchronously at the moment,
+        // in which case changes to the cloth need to wait until the simulation has finished.
+        bool IsSolverSimulating() const;
+        void ApplyPendingChanges();
+
         // Entity Id of the cloth component
         AZ::EntityId m_entityId;
 
@@ -107,6 +113,12 @@ namespace NvCloth
         // Instance of cloth simulation
         ICloth* m_cloth = nullptr;
 
+        // Changes received while the solver was simulating, applied once the simulation has finished.
+        AZStd::optional<AZ::Transform> m_pendingWorldTransform;
+        bool m_pendingTeleport = false;
+        bool m_pendingWindUpdate = false;
+        bool m_pendingConfigurationUpdate = false;
+
         // Cloth event handlers
         ICloth::PreSimulationEvent::Handler m_preSimulationEventHandler;
         ICloth::PostSimulationEvent::Handler m_postSimulationEventHandler;
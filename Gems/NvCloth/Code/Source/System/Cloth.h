@@ -14,13 +14,13 @@
 #include <NvCloth/IClothConfigurator.h>
 
 #include <System/NvTypes.h>
+#include <System/Solver.h>
 
 // NvCloth library includes
 #include <NvCloth/PhaseConfig.h>
 
 namespace NvCloth
 {
-    class Solver;
     class Fabric;
 
     //! Implementation of the ICloth and IClothConfigurator interfaces.
@@ -41,9 +41,6 @@ namespace NvCloth
         //! Returns the fabric used to create this cloth.
         Fabric* GetFabric() { return m_fabric; }
 
-        //! Returns the solver this cloth is added to or nullptr if it's not part of any solver.
-        Solver* GetSolver() { return m_solver; }
-
         //! Retrieves the latest simulation data from NvCloth and updates the particles.
         void Update();
 
@@ -57,6 +54,7 @@ namespace NvCloth
         void DiscardParticleDelta() override;
         const FabricCookedData& GetFabricCookedData() const override;
         IClothConfigurator* GetClothConfigurator() override;
+        Solver* GetSolver() override;
 
         // IClothConfigurator overrides ...
         void SetTransform(const AZ::Transform& transformWorld) override;
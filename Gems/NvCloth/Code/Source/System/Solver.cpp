@@ -9,6 +9,7 @@
 #include <System/Solver.h>
 #include <System/Cloth.h>
 
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Jobs/JobFunction.h>
 
 // NvCloth library includes
@@ -113,13 +114,114 @@ namespace NvCloth
         AZ_PROFILE_FUNCTION(Cloth);
 
         m_deltaTime = deltaTime;
-        m_simulationCompletion.Reset(true /*isClearDependent*/);
 
         m_preSimulationEvent.Signal(m_name, deltaTime);
 
         // Set isSimulating flag after the pre-simulation event is sent in case if there are handlers adding/removing cloth from the solver.
         m_isSimulating = true;
 
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        m_isUsingTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        if (m_isUsingTaskGraph)
+        {
+            StartSimulationTaskGraph();
+        }
+        else
+        {
+            StartSimulationJobs();
+        }
+    }
+
+    void Solver::StartSimulationTaskGraph()
+    {
+        // The graph is destroyed once all its tasks are completed, the finished event is used to wait for the simulation pass.
+        AZ::TaskGraph taskGraph{ "NvCloth Solver" };
+        taskGraph.Detach();
+        m_simulationFinishedEvent = AZStd::make_unique<AZ::TaskGraphEvent>("NvCloth Solver Wait");
+
+        // Begin simulation task runs after all pre-simulation tasks are completed.
+        AZ::TaskToken beginSimulationTask = taskGraph.AddTask(
+            AZ::TaskDescriptor{ "NvCloth::BeginSimulationTask", "Cloth" },
+            [this]
+            {
+                AZ_PROFILE_SCOPE(Cloth, "NvCloth::BeginSimulationTask");
+                m_simulationChunkCount = m_nvSolver->beginSimulation(m_deltaTime) ? m_nvSolver->getSimulationChunkCount() : 0;
+            });
+
+        // End simulation task runs after all chunks are finished simulating.
+        AZ::TaskToken endSimulationTask = taskGraph.AddTask(
+            AZ::TaskDescriptor{ "NvCloth::EndSimulationTask", "Cloth" },
+            [this]
+            {
+                AZ_PROFILE_SCOPE(Cloth, "NvCloth::EndSimulationTask");
+
+                // Note that if beginSimulation returned false, there is no simulation to end.
+                if (m_simulationChunkCount > 0)
+                {
+                    m_nvSolver->endSimulation();
+                }
+            });
+
+        for (Cloth* cloth : m_cloths)
+        {
+            AZ::TaskToken preSimulationTask = taskGraph.AddTask(
+                AZ::TaskDescriptor{ "NvCloth::PreSimulationTask", "Cloth" },
+                [cloth, deltaTime = m_deltaTime]
+                {
+                    AZ_PROFILE_SCOPE(Cloth, "NvCloth::PreSimulationTask");
+
+                    // Issue pre-simulation events
+                    cloth->m_preSimulationEvent.Signal(cloth->GetId(), deltaTime);
+                });
+            preSimulationTask.Precedes(beginSimulationTask);
+
+            AZ::TaskToken postSimulationTask = taskGraph.AddTask(
+                AZ::TaskDescriptor{ "NvCloth::PostSimulationTask", "Cloth" },
+                [cloth, deltaTime = m_deltaTime]
+                {
+                    AZ_PROFILE_SCOPE(Cloth, "NvCloth::PostSimulationTask");
+
+                    // Update the cloth data after the simulation
+                    cloth->Update();
+
+                    // Issue post-simulation events
+                    cloth->m_postSimulationEvent.Signal(cloth->GetId(), deltaTime, cloth->GetParticles());
+                });
+            postSimulationTask.Follows(endSimulationTask);
+        }
+
+        // The number of simulation chunks is only known after the simulation began, while the tasks need to be added before submitting
+        // the graph. The NvCloth CPU solver simulates one chunk per cloth, so one chunk task is added per cloth and every task simulates each n-th chunk,
+        // which also covers any additional chunks.
+        const int chunkTaskCount = AZStd::max(aznumeric_cast<int>(m_cloths.size()), 1);
+        for (int chunkTaskIndex = 0; chunkTaskIndex < chunkTaskCount; ++chunkTaskIndex)
+        {
+            AZ::TaskToken chunkSimulationTask = taskGraph.AddTask(
+                AZ::TaskDescriptor{ "NvCloth::ChunkSimulationTask", "Cloth" },
+                [this, chunkTaskIndex, chunkTaskCount]
+                {
+                    SimulateChunks(chunkTaskIndex, chunkTaskCount);
+                });
+            chunkSimulationTask.Follows(beginSimulationTask);
+            chunkSimulationTask.Precedes(endSimulationTask);
+        }
+
+        taskGraph.Submit(m_simulationFinishedEvent.get());
+    }
+
+    void Solver::SimulateChunks(int firstChunkIndex, int chunkIndexStride)
+    {
+        for (int chunkIndex = firstChunkIndex; chunkIndex < m_simulationChunkCount; chunkIndex += chunkIndexStride)
+        {
+            AZ_PROFILE_SCOPE(Cloth, "NvCloth::ChunkSimulationTask");
+            m_nvSolver->simulateChunk(chunkIndex);
+        }
+    }
+
+    void Solver::StartSimulationJobs()
+    {
+        m_simulationCompletion.Reset(true /*isClearDependent*/);
+
         // Setup the chain of jobs for the simulation pass
 
         // Post simulation jobs will unlock the entire simulation pass completion.
@@ -150,12 +252,25 @@ namespace NvCloth
         AZ_PROFILE_FUNCTION(Cloth);
 
         // Waiting for the simulation pass completition.
-        m_simulationCompletion.StartAndWaitForCompletion();
+        if (m_isUsingTaskGraph)
+        {
+            m_simulationFinishedEvent->Wait();
+            m_simulationFinishedEvent.reset();
+        }
+        else
+        {
+            m_simulationCompletion.StartAndWaitForCompletion();
+        }
         m_isSimulating = false;
 
         m_postSimulationEvent.Signal(m_name, m_deltaTime);
     }
 
+    bool Solver::IsSimulating() const
+    {
+        return m_isSimulating;
+    }
+
     void Solver::SetInterCollisionDistance(float distance)
     {
         m_nvSolver->setInterCollisionDistance(distance);
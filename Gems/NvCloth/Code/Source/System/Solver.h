@@ -11,7 +11,9 @@
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <NvCloth/ISolver.h>
 
@@ -46,6 +48,7 @@ namespace NvCloth
         bool IsUserSimulated() const override;
         void StartSimulation(float deltaTime) override;
         void FinishSimulation() override;
+        bool IsSimulating() const override;
         void SetInterCollisionDistance(float distance) override;
         void SetInterCollisionStiffness(float stiffness) override;
         void SetInterCollisionIterations(AZ::u32 iterations) override;
@@ -121,6 +124,15 @@ namespace NvCloth
 
         void RemoveClothInternal(Cloths::iterator clothIt);
 
+        // Sets up and submits the task graph for the simulation pass.
+        void StartSimulationTaskGraph();
+
+        // Sets up and starts the chain of jobs for the simulation pass.
+        void StartSimulationJobs();
+
+        // Simulates the chunks assigned to a chunk task of the task graph.
+        void SimulateChunks(int firstChunkIndex, int chunkIndexStride);
+
         // Name of the solver.
         AZStd::string m_name;
 
@@ -142,8 +154,17 @@ namespace NvCloth
         // Flag indicating if the simulation jobs are currently running.
         bool m_isSimulating = false;
 
+        // Flag indicating if the current simulation pass runs as task graph rather than as jobs.
+        bool m_isUsingTaskGraph = false;
+
         // Simulation synchronization job
         AZ::JobCompletion m_simulationCompletion;
+
+        // Simulation synchronization event when running the simulation pass as task graph.
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_simulationFinishedEvent;
+
+        // Number of chunks to simulate in the current simulation pass, known once the NvCloth simulation began.
+        int m_simulationChunkCount = 0;
     };
 
 } // namespace NvCloth
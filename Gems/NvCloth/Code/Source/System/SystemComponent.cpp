@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -22,6 +23,10 @@
 
 namespace NvCloth
 {
+    AZ_CVAR(bool, cloth_AsyncSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled the cloth simulation started on physics tick is finished right before the render data gets updated, "
+        "letting it run in parallel with the tick handlers in between.");
+
     namespace
     {
         // Implementation of the memory allocation callback interface using nvcloth allocator.
@@ -238,6 +243,8 @@ namespace NvCloth
     {
         if (solver)
         {
+            FinishSolversSimulation();
+
             const AZStd::string& solverName = solver->GetName();
 
             auto solverIt = AZStd::find_if(m_solvers.begin(), m_solvers.end(),
@@ -331,6 +338,8 @@ namespace NvCloth
     {
         if (cloth)
         {
+            FinishSolversSimulation();
+
             FabricId fabricId = cloth->GetFabricCookedData().m_id;
 
             // Cloth will decrement its fabric's counter on destruction.
@@ -359,6 +368,8 @@ namespace NvCloth
     {
         if (cloth)
         {
+            FinishSolversSimulation();
+
             ISolver* solver = GetSolver(solverName);
             if (!solver)
             {
@@ -383,6 +394,8 @@ namespace NvCloth
     {
         if (cloth)
         {
+            FinishSolversSimulation();
+
             Cloth* clothInstance = azdynamic_cast<Cloth*>(cloth);
             AZ_Assert(clothInstance, "Dynamic casting from ICloth to Cloth failed.");
 
@@ -400,14 +413,38 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
+        // In case the previous simulation is still running, it needs to finish before starting a new one.
+        FinishSolversSimulation();
+
+        // Start the simulation of all solvers before waiting for any of them, so that the solvers simulate in parallel.
         for (auto& solverIt : m_solvers)
         {
             if (!solverIt->IsUserSimulated())
             {
                 solverIt->StartSimulation(deltaTime);
-                solverIt->FinishSimulation();
+                if (solverIt->IsSimulating())
+                {
+                    m_simulatingSolvers.push_back(solverIt.get());
+                }
             }
         }
+
+        if (!cloth_AsyncSimulation)
+        {
+            FinishSolversSimulation();
+        }
+    }
+
+    void SystemComponent::FinishSolversSimulation()
+    {
+        // Finishing a simulation signals the post-simulation events, whose handlers can get back into this function
+        // when adding or removing cloths, so only remove a solver from the list before finishing it.
+        while (!m_simulatingSolvers.empty())
+        {
+            Solver* solver = m_simulatingSolvers.front();
+            m_simulatingSolvers.erase(m_simulatingSolvers.begin());
+            solver->FinishSimulation();
+        }
     }
 
     int SystemComponent::GetTickOrder()
@@ -415,6 +452,24 @@ namespace NvCloth
         return AZ::TICK_PHYSICS;
     }
 
+    SystemComponent::FinishSimulationTickHandler::FinishSimulationTickHandler(SystemComponent* systemComponent)
+        : m_systemComponent(systemComponent)
+    {
+    }
+
+    void SystemComponent::FinishSimulationTickHandler::OnTick(
+        [[maybe_unused]] float deltaTime,
+        [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_systemComponent->FinishSolversSimulation();
+    }
+
+    int SystemComponent::FinishSimulationTickHandler::GetTickOrder()
+    {
+        // Cloth components copy the simulation results into the render meshes on pre-render tick.
+        return AZ::TICK_PRE_RENDER - 1;
+    }
+
     void SystemComponent::InitializeSystem()
     {
         // Create Factory
@@ -427,10 +482,14 @@ namespace NvCloth
 
         AZ::Interface<IClothSystem>::Register(this);
         AZ::TickBus::Handler::BusConnect();
+        m_finishSimulationTickHandler.BusConnect();
     }
 
     void SystemComponent::DestroySystem()
     {
+        FinishSolversSimulation();
+
+        m_finishSimulationTickHandler.BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
         AZ::Interface<IClothSystem>::Unregister(this);
 
@@ -27,6 +27,9 @@ namespace NvCloth
     //! This class has the responsibility to initialize and tear down NvCloth library.
     //! It owns all Solvers, Cloths and Fabrics, and it manages their creation and destruction.
     //! It's also the responsible for updating (on Physics Tick) all the solvers that are not flagged as "user simulated".
+    //! The simulation of all those solvers is started before waiting for any of them, so that they simulate in parallel.
+    //! When cloth_AsyncSimulation is enabled the simulation is finished right before the render data gets updated instead,
+    //! overlapping it with the tick handlers in between.
     class SystemComponent
         : public AZ::Component
         , protected IClothSystem
@@ -78,6 +81,25 @@ namespace NvCloth
         FabricId FindOrCreateFabric(const FabricCookedData& fabricCookedData);
         void DestroyFabric(FabricId fabricId);
 
+        // Waits for the simulation of the solvers started by the system to finish.
+        void FinishSolversSimulation();
+
+        // Tick handler that finishes the simulation started on physics tick when it runs asynchronously.
+        // It ticks right before the cloth components copy the simulation results into the render meshes.
+        class FinishSimulationTickHandler
+            : public AZ::TickBus::Handler
+        {
+        public:
+            explicit FinishSimulationTickHandler(SystemComponent* systemComponent);
+
+            // AZ::TickBus::Handler overrides ...
+            void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+            int GetTickOrder() override;
+
+        private:
+            SystemComponent* m_systemComponent = nullptr;
+        };
+
         // Factory that creates all the solvers, fabric and cloths.
         AZStd::unique_ptr<Factory> m_factory;
 
@@ -89,5 +111,10 @@ namespace NvCloth
 
         // List of all the cloths created.
         AZStd::unordered_map<ClothId, AZStd::unique_ptr<Cloth>> m_cloths;
+
+        // List of the solvers whose simulation was started by the system and is not finished yet.
+        AZStd::vector<Solver*> m_simulatingSolvers;
+
+        FinishSimulationTickHandler m_finishSimulationTickHandler{ this };
     };
 } // namespace NvCloth
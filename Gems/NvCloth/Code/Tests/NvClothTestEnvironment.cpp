@@ -8,6 +8,7 @@
 
 #include <AzTest/GemTestEnvironment.h>
 
+#include <AzCore/Task/TaskGraphSystemComponent.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 
 #include <AzFramework/IO/LocalFileIO.h>
@@ -51,7 +52,9 @@ namespace UnitTest
             NvCloth::ClothComponent::CreateDescriptor()
         });
 
+        // The task graph system allows the solver tests to run the simulation as task graph when cl_activateTaskGraph is enabled.
         AddRequiredComponents({
+            AZ::TaskGraphSystemComponent::TYPEINFO_Uuid(),
             NvCloth::SystemComponent::TYPEINFO_Uuid()
         });
     }
@@ -84,6 +87,25 @@ namespace UnitTest
         m_fabricCooker.reset();
         NvCloth::SystemComponent::TearDownNvClothLibrary(); // SystemAllocator destruction must come after this call.
     }
+
+#ifdef HAVE_BENCHMARK
+    //! The Benchmark environment is used for one time setup and tear down of shared resources
+    class NvClothBenchmarkEnvironment
+        : public AZ::Test::BenchmarkEnvironmentBase
+        , public NvClothTestEnvironment
+    {
+    protected:
+        void SetUpBenchmark() override
+        {
+            SetupEnvironment();
+        }
+
+        void TearDownBenchmark() override
+        {
+            TeardownEnvironment();
+        }
+    };
+#endif
 } // namespace UnitTest
 
-AZ_UNIT_TEST_HOOK(new UnitTest::NvClothTestEnvironment);
+AZ_UNIT_TEST_HOOK(new UnitTest::NvClothTestEnvironment, UnitTest::NvClothBenchmarkEnvironment);
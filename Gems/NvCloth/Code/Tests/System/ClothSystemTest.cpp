@@ -315,6 +315,7 @@ namespace UnitTest
 
         EXPECT_TRUE(clothAdded);
         EXPECT_TRUE(azrtti_cast<NvCloth::Cloth*>(cloth)->GetSolver()->GetName() == solver->GetName());
+        EXPECT_TRUE(cloth->GetSolver() == solver);
         EXPECT_TRUE(azrtti_cast<NvCloth::Solver*>(solver)->GetNumCloths() == 1);
 
         // NOTE: IClothSystem is persistent as it's part of the test environment.
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <UnitTestHelper.h>
+
+#include <System/Cloth.h>
+#include <System/Fabric.h>
+#include <System/Factory.h>
+#include <System/Solver.h>
+
+namespace UnitTest
+{
+    namespace SolverBenchmarkSettings
+    {
+        //! Values passed to the benchmarks to select whether the solver simulates with jobs or as task graph.
+        static const int JobSimulation = 0;
+        static const int TaskGraphSimulation = 1;
+    } // namespace SolverBenchmarkSettings
+
+    //! Sets up a solver with a number of falling cloths, simulated either with jobs or as task graph.
+    class NvClothSolverBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void internalSetUp(const benchmark::State& state)
+        {
+            const bool useTaskGraph = state.range(0) == SolverBenchmarkSettings::TaskGraphSimulation;
+            const size_t numCloths = aznumeric_cast<size_t>(state.range(1));
+
+            // Switch the simulation path for the duration of the benchmark, it is restored on tear down.
+            if (auto* console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->GetCvarValue("cl_activateTaskGraph", m_previousTaskGraphActive);
+                console->PerformCommand(useTaskGraph ? "cl_activateTaskGraph true" : "cl_activateTaskGraph false");
+            }
+
+            m_factory.Init();
+            m_solver = m_factory.CreateSolver("SolverBenchmark");
+            m_fabric = m_factory.CreateFabric(CreateTestFabricCookedData());
+
+            m_cloths.reserve(numCloths);
+            for (size_t i = 0; i < numCloths; ++i)
+            {
+                m_cloths.emplace_back(m_factory.CreateCloth(m_fabric->m_cookedData.m_particles, m_fabric.get()));
+                m_cloths.back()->GetClothConfigurator()->SetGravity(AZ::Vector3(0.0f, 0.0f, -9.81f));
+                m_solver->AddCloth(m_cloths.back().get());
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_cloths.clear();
+            m_fabric.reset();
+            m_solver.reset();
+            m_factory.Destroy();
+
+            if (auto* console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->PerformCommand(m_previousTaskGraphActive ? "cl_activateTaskGraph true" : "cl_activateTaskGraph false");
+            }
+        }
+
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        NvCloth::Factory m_factory;
+        AZStd::unique_ptr<NvCloth::Solver> m_solver;
+        AZStd::unique_ptr<NvCloth::Fabric> m_fabric;
+        AZStd::vector<AZStd::unique_ptr<NvCloth::Cloth>> m_cloths;
+        bool m_previousTaskGraphActive = false;
+    };
+
+    // Runs one simulation pass of the solver per iteration.
+    BENCHMARK_DEFINE_F(NvClothSolverBenchmarkFixture, BM_SolverSimulation)(benchmark::State& state)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_solver->StartSimulation(deltaTimeSim);
+            m_solver->FinishSimulation();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+        state.SetLabel(state.range(0) == SolverBenchmarkSettings::TaskGraphSimulation ? "TaskGraph" : "Jobs");
+    }
+
+    BENCHMARK_REGISTER_F(NvClothSolverBenchmarkFixture, BM_SolverSimulation)
+        ->ArgNames({ "TaskGraph", "Cloths" })
+        ->Args({ SolverBenchmarkSettings::JobSimulation, 20 })
+        ->Args({ SolverBenchmarkSettings::TaskGraphSimulation, 20 })
+        ->Args({ SolverBenchmarkSettings::JobSimulation, 200 })
+        ->Args({ SolverBenchmarkSettings::TaskGraphSimulation, 200 })
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace UnitTest
+
+#endif
@@ -10,6 +10,9 @@
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <UnitTestHelper.h>
 #include <TriangleInputHelper.h>
@@ -37,6 +40,10 @@ namespace UnitTest
         AZStd::unique_ptr<NvCloth::Solver> CreateSolver(const AZStd::string& name);
         AZStd::unique_ptr<NvCloth::Cloth> CreateCloth();
 
+        // Switches the solvers between running their simulation as task graph or as jobs.
+        // The previous value of cl_activateTaskGraph is restored when the test finishes.
+        void SetTaskGraphActive(bool active);
+
         const AZStd::string m_solverName = "SolverTest";
         AZStd::unique_ptr<NvCloth::Solver> m_solver;
         AZStd::unique_ptr<NvCloth::Cloth> m_cloth;
@@ -44,12 +51,19 @@ namespace UnitTest
     private:
         void CreateFabric();
 
+        bool m_previousTaskGraphActive = false;
+
         NvCloth::Factory m_factory;
         AZStd::unique_ptr<NvCloth::Fabric> m_fabric;
     };
 
     void NvClothSystemSolver::SetUp()
     {
+        if (auto* console = AZ::Interface<AZ::IConsole>::Get())
+        {
+            console->GetCvarValue("cl_activateTaskGraph", m_previousTaskGraphActive);
+        }
+
         m_factory.Init();
         m_solver = CreateSolver(m_solverName);
         CreateFabric();
@@ -62,6 +76,8 @@ namespace UnitTest
         m_fabric.reset();
         m_solver.reset();
         m_factory.Destroy();
+
+        SetTaskGraphActive(m_previousTaskGraphActive);
     }
 
     AZStd::unique_ptr<NvCloth::Solver> NvClothSystemSolver::CreateSolver(const AZStd::string& name)
@@ -74,6 +90,14 @@ namespace UnitTest
         return m_factory.CreateCloth(m_fabric->m_cookedData.m_particles, m_fabric.get());
     }
 
+    void NvClothSystemSolver::SetTaskGraphActive(bool active)
+    {
+        if (auto* console = AZ::Interface<AZ::IConsole>::Get())
+        {
+            console->PerformCommand(active ? "cl_activateTaskGraph true" : "cl_activateTaskGraph false");
+        }
+    }
+
     void NvClothSystemSolver::CreateFabric()
     {
         const NvCloth::FabricCookedData fabricCookedData = CreateTestFabricCookedData();
@@ -332,6 +356,162 @@ namespace UnitTest
         m_solver->FinishSimulation();
     }
 
+    TEST_F(NvClothSystemSolver, Solver_StartAndFinishSimulation_IsSimulatingUntilFinished)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+
+        m_solver->AddCloth(m_cloth.get());
+
+        EXPECT_FALSE(m_solver->IsSimulating());
+
+        m_solver->StartSimulation(deltaTimeSim);
+        EXPECT_TRUE(m_solver->IsSimulating());
+
+        m_solver->FinishSimulation();
+        EXPECT_FALSE(m_solver->IsSimulating());
+    }
+
+    TEST_F(NvClothSystemSolver, Solver_StartAndFinishSimulationWithMultipleCloths_SignalsSimulationEventsOfAllCloths)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+        const size_t numCloths = 8;
+
+        AZStd::atomic<size_t> numClothPreSimulationEventsSignaled{ 0 };
+        NvCloth::ICloth::PreSimulationEvent::Handler clothPreSimulationEventHandler(
+            [&numClothPreSimulationEventsSignaled](NvCloth::ClothId, float)
+            {
+                ++numClothPreSimulationEventsSignaled;
+            });
+
+        AZStd::atomic<size_t> numClothPostSimulationEventsSignaled{ 0 };
+        NvCloth::ICloth::PostSimulationEvent::Handler clothPostSimulationEventHandler(
+            [&numClothPostSimulationEventsSignaled](NvCloth::ClothId, float, const AZStd::vector<NvCloth::SimParticleFormat>&)
+            {
+                ++numClothPostSimulationEventsSignaled;
+            });
+
+        AZStd::vector<AZStd::unique_ptr<NvCloth::Cloth>> cloths;
+        AZStd::vector<NvCloth::ICloth::PreSimulationEvent::Handler> clothPreSimulationEventHandlers(numCloths, clothPreSimulationEventHandler);
+        AZStd::vector<NvCloth::ICloth::PostSimulationEvent::Handler> clothPostSimulationEventHandlers(numCloths, clothPostSimulationEventHandler);
+        for (size_t i = 0; i < numCloths; ++i)
+        {
+            cloths.emplace_back(CreateCloth());
+            cloths.back()->ConnectPreSimulationEventHandler(clothPreSimulationEventHandlers[i]);
+            cloths.back()->ConnectPostSimulationEventHandler(clothPostSimulationEventHandlers[i]);
+            m_solver->AddCloth(cloths.back().get());
+        }
+
+        m_solver->StartSimulation(deltaTimeSim);
+        m_solver->FinishSimulation();
+
+        EXPECT_EQ(numClothPreSimulationEventsSignaled, numCloths);
+        EXPECT_EQ(numClothPostSimulationEventsSignaled, numCloths);
+
+        // Simulating again uses a new simulation pass.
+        m_solver->StartSimulation(deltaTimeSim);
+        m_solver->FinishSimulation();
+
+        EXPECT_EQ(numClothPreSimulationEventsSignaled, 2 * numCloths);
+        EXPECT_EQ(numClothPostSimulationEventsSignaled, 2 * numCloths);
+    }
+
+    TEST_F(NvClothSystemSolver, Solver_StartAndFinishSimulationWithTaskGraph_SignalsSimulationEventsOfAllCloths)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+        const size_t numCloths = 8;
+
+        SetTaskGraphActive(true);
+        const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        ASSERT_TRUE(taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive());
+
+        AZStd::atomic<size_t> numClothPreSimulationEventsSignaled{ 0 };
+        NvCloth::ICloth::PreSimulationEvent::Handler clothPreSimulationEventHandler(
+            [&numClothPreSimulationEventsSignaled](NvCloth::ClothId, float)
+            {
+                ++numClothPreSimulationEventsSignaled;
+            });
+
+        AZStd::atomic<size_t> numClothPostSimulationEventsSignaled{ 0 };
+        NvCloth::ICloth::PostSimulationEvent::Handler clothPostSimulationEventHandler(
+            [&numClothPostSimulationEventsSignaled](NvCloth::ClothId, float, const AZStd::vector<NvCloth::SimParticleFormat>&)
+            {
+                ++numClothPostSimulationEventsSignaled;
+            });
+
+        AZStd::vector<AZStd::unique_ptr<NvCloth::Cloth>> cloths;
+        AZStd::vector<NvCloth::ICloth::PreSimulationEvent::Handler> clothPreSimulationEventHandlers(numCloths, clothPreSimulationEventHandler);
+        AZStd::vector<NvCloth::ICloth::PostSimulationEvent::Handler> clothPostSimulationEventHandlers(numCloths, clothPostSimulationEventHandler);
+        for (size_t i = 0; i < numCloths; ++i)
+        {
+            cloths.emplace_back(CreateCloth());
+            cloths.back()->ConnectPreSimulationEventHandler(clothPreSimulationEventHandlers[i]);
+            cloths.back()->ConnectPostSimulationEventHandler(clothPostSimulationEventHandlers[i]);
+            m_solver->AddCloth(cloths.back().get());
+        }
+
+        m_solver->StartSimulation(deltaTimeSim);
+        EXPECT_TRUE(m_solver->IsSimulating());
+        m_solver->FinishSimulation();
+        EXPECT_FALSE(m_solver->IsSimulating());
+
+        EXPECT_EQ(numClothPreSimulationEventsSignaled, numCloths);
+        EXPECT_EQ(numClothPostSimulationEventsSignaled, numCloths);
+
+        // Removing cloths changes the number of chunk tasks of the next simulation pass.
+        for (size_t i = numCloths / 2; i < numCloths; ++i)
+        {
+            m_solver->RemoveCloth(cloths[i].get());
+        }
+
+        m_solver->StartSimulation(deltaTimeSim);
+        m_solver->FinishSimulation();
+
+        EXPECT_EQ(numClothPreSimulationEventsSignaled, numCloths + numCloths / 2);
+        EXPECT_EQ(numClothPostSimulationEventsSignaled, numCloths + numCloths / 2);
+    }
+
+    TEST_F(NvClothSystemSolver, Solver_SimulateWithTaskGraph_MatchesSimulationWithJobs)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+        const size_t numCloths = 4;
+        const size_t numFrames = 10;
+        const AZ::Vector3 gravity(0.0f, 0.0f, -9.81f);
+
+        // Two solvers with the same cloths, one simulated with jobs and the other one as task graph.
+        auto taskGraphSolver = CreateSolver("TaskGraphSolver");
+        AZStd::vector<AZStd::unique_ptr<NvCloth::Cloth>> jobCloths;
+        AZStd::vector<AZStd::unique_ptr<NvCloth::Cloth>> taskGraphCloths;
+        for (size_t i = 0; i < numCloths; ++i)
+        {
+            jobCloths.emplace_back(CreateCloth());
+            jobCloths.back()->GetClothConfigurator()->SetGravity(gravity);
+            m_solver->AddCloth(jobCloths.back().get());
+
+            taskGraphCloths.emplace_back(CreateCloth());
+            taskGraphCloths.back()->GetClothConfigurator()->SetGravity(gravity);
+            taskGraphSolver->AddCloth(taskGraphCloths.back().get());
+        }
+
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            SetTaskGraphActive(false);
+            m_solver->StartSimulation(deltaTimeSim);
+            m_solver->FinishSimulation();
+
+            SetTaskGraphActive(true);
+            taskGraphSolver->StartSimulation(deltaTimeSim);
+            taskGraphSolver->FinishSimulation();
+        }
+
+        for (size_t i = 0; i < numCloths; ++i)
+        {
+            // The cloths have been simulated and both paths produce the same particles.
+            EXPECT_THAT(taskGraphCloths[i]->GetParticles(),
+                ::testing::Not(::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), taskGraphCloths[i]->GetInitialParticles())));
+            EXPECT_THAT(taskGraphCloths[i]->GetParticles(), ::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), jobCloths[i]->GetParticles()));
+        }
+    }
+
     // This test uses Cloth System to check if the system's tick will update a solver in user simulated mode.
     // Since it relies on cloth system, the test has to use a solver and a cloth created from the system.
     // NvClothSystemSolver fixture is not necessary for this test.
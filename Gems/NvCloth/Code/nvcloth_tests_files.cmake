@@ -19,6 +19,7 @@ set(FILES
     Tests/System/ClothTest.cpp
     Tests/System/FabricCookerTest.cpp
     Tests/System/FactoryTest.cpp
+    Tests/System/SolverBenchmarks.cpp
     Tests/System/SolverTest.cpp
     Tests/System/NvTypesTest.cpp
     Tests/System/TangentSpaceHelperTest.cpp
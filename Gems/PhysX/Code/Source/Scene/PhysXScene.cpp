@@ -28,6 +28,7 @@
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Task/TaskGraph.h>
@@ -46,6 +47,12 @@ namespace PhysX
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
 
+    AZ_CVAR(bool, physx_parallelSceneQueryBatch, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Multithreaded execution of batched scene queries. "
+        "Filter callbacks in batched requests may be called from multiple threads when enabled, so they must be thread safe.");
+    AZ_CVAR(size_t, physx_parallelSceneQueryBatchSize, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many scene queries should be processed per task");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -472,6 +479,21 @@ namespace PhysX
 
             return status;
         }
+
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CopySceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            switch (request->m_requestType)
+            {
+            case AzPhysics::SceneQueryRequest::RequestType::Raycast:
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*static_cast<const AzPhysics::RayCastRequest*>(request));
+            case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*static_cast<const AzPhysics::ShapeCastRequest*>(request));
+            case AzPhysics::SceneQueryRequest::RequestType::Overlap:
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*static_cast<const AzPhysics::OverlapRequest*>(request));
+            default:
+                return nullptr;
+            }
+        }
     }
 
     PhysXScene::PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle)
@@ -512,6 +534,10 @@ namespace PhysX
 
     PhysXScene::~PhysXScene()
     {
+        // Async queries read from the scene on other threads, so they must finish before anything gets released.
+        // Their callbacks are never called, since the scene they queried is gone.
+        WaitForAsyncSceneQueries();
+
         m_physicsSystemConfigChanged.Disconnect();
 
         s_overlapBuffer = {};
@@ -574,6 +600,8 @@ namespace PhysX
 
         if (!IsEnabled())
         {
+            // Async scene queries don't depend on the simulation, so their callbacks still get called for disabled scenes.
+            DispatchCompletedAsyncSceneQueries();
             return;
         }
 
@@ -642,6 +670,7 @@ namespace PhysX
 
         FlushQueuedEvents();
         ClearDeferedDeletions();
+        DispatchCompletedAsyncSceneQueries();
 
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationFinishedEvent::Signaled");
@@ -970,6 +999,14 @@ namespace PhysX
     }
 
     bool PhysXScene::QueryScene(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result)
+    {
+        return QuerySceneWithBuffers(request, result, s_rayCastBuffer, s_sweepBuffer, s_overlapBuffer);
+    }
+
+    bool PhysXScene::QuerySceneWithBuffers(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result,
+        AZStd::vector<physx::PxRaycastHit>& rayCastBuffer,
+        AZStd::vector<physx::PxSweepHit>& sweepBuffer,
+        AZStd::vector<physx::PxOverlapHit>& overlapBuffer)
     {
         if (request == nullptr)
         {
@@ -985,17 +1022,17 @@ namespace PhysX
         case AzPhysics::SceneQueryRequest::RequestType::Raycast:
             {
                 return Internal::RayCast(static_cast<const AzPhysics::RayCastRequest*>(request),
-                    s_rayCastBuffer, m_pxScene, queryData, m_raycastBufferSize, result);
+                    rayCastBuffer, m_pxScene, queryData, m_raycastBufferSize, result);
             }
         case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
             {
                 return Internal::ShapeCast(static_cast<const AzPhysics::ShapeCastRequest*>(request),
-                    s_sweepBuffer, m_pxScene, queryData, m_shapecastBufferSize, result);
+                    sweepBuffer, m_pxScene, queryData, m_shapecastBufferSize, result);
             }
         case AzPhysics::SceneQueryRequest::RequestType::Overlap:
             {
                 return Internal::OverlapQuery(static_cast<const AzPhysics::OverlapRequest*>(request),
-                    s_overlapBuffer, m_pxScene, queryData, m_overlapBufferSize, result);
+                    overlapBuffer, m_pxScene, queryData, m_overlapBufferSize, result);
             }
         default:
             {
@@ -1008,27 +1045,202 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        const size_t batchSize = AZStd::max<size_t>(physx_parallelSceneQueryBatchSize, 1);
+        if (!physx_parallelSceneQueryBatch || requests.size() <= batchSize)
+        {
+            QuerySceneRange(requests, 0, requests.size(), results);
+            return results;
+        }
+
+        AZ::TaskGraph taskGraph("Parallel Scene Query Batch");
+        AZ::TaskGraphEvent finishEvent("Parallel scene query batch event");
+
+        const size_t fullSize = requests.size();
+        for (size_t i = 0; i < fullSize; i += batchSize)
         {
-            results.emplace_back(QueryScene(request.get()));
+            AZ::TaskDescriptor taskDescriptor{"SceneQueryTask", "Physics"};
+            taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + batchSize, fullSize), &requests, &results, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Scene Query Task");
+                    QuerySceneRange(requests, start, end, results);
+                });
         }
+
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
+
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            AZ_Warning("Physx", false, "QuerySceneAsync requires a valid request and callback.");
+            return false;
+        }
+
+        // The caller's request doesn't need to outlive this call, so the query runs on a copy of it.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CopySceneQueryRequest(request);
+        if (requestCopy == nullptr)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        auto query = AZStd::make_shared<AsyncSceneQuery>();
+        query->m_requestId = requestId;
+        query->m_requests.emplace_back(AZStd::move(requestCopy));
+        query->m_callback = AZStd::move(callback);
+        StartAsyncSceneQuery(AZStd::move(query));
+        return true;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            AZ_Warning("Physx", false, "QuerySceneAsyncBatch requires a valid callback.");
+            return false;
+        }
+
+        // As with single queries, the caller is free to change or reuse its requests once this returns,
+        // so the batch runs on copies of them.
+        auto query = AZStd::make_shared<AsyncSceneQuery>();
+        query->m_requestId = requestId;
+        query->m_requests.reserve(requests.size());
+        for (const auto& request : requests)
+        {
+            // Null requests are kept as they are and return no hits, the same as in QuerySceneBatch.
+            AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy;
+            if (request != nullptr)
+            {
+                requestCopy = Internal::CopySceneQueryRequest(request.get());
+                if (requestCopy == nullptr)
+                {
+                    AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+                    return false;
+                }
+            }
+            query->m_requests.emplace_back(AZStd::move(requestCopy));
+        }
+        query->m_batchCallback = AZStd::move(callback);
+        StartAsyncSceneQuery(AZStd::move(query));
+        return true;
+    }
+
+    void PhysXScene::QuerySceneRange(
+        const AzPhysics::SceneQueryRequests& requests, size_t start, size_t end, AzPhysics::SceneQueryHitsList& results)
+    {
+        // Keep the scene locked for read for the whole range, the same as the parallel transform sync does,
+        // rather than locking and unlocking it again for every query.
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+        AZStd::vector<physx::PxRaycastHit> rayCastBuffer;
+        AZStd::vector<physx::PxSweepHit> sweepBuffer;
+        AZStd::vector<physx::PxOverlapHit> overlapBuffer;
+        for (size_t index = start; index < end; ++index)
+        {
+            QuerySceneWithBuffers(requests[index].get(), results[index], rayCastBuffer, sweepBuffer, overlapBuffer);
+        }
+    }
+
+    void PhysXScene::StartAsyncSceneQuery(AZStd::shared_ptr<AsyncSceneQuery> query)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::StartAsyncSceneQuery");
+
+        query->m_results.resize(query->m_requests.size());
+
+        const size_t fullSize = query->m_requests.size();
+        const size_t batchSize = physx_parallelSceneQueryBatch ? AZStd::max<size_t>(physx_parallelSceneQueryBatchSize, 1) : fullSize;
+        const size_t taskCount = (fullSize > 0) ? ((fullSize + batchSize - 1) / batchSize) : 0;
+
+        {
+            AZStd::scoped_lock lock(m_asyncSceneQueryMutex);
+            ++m_runningAsyncSceneQueryCount;
+        }
+
+        if (taskCount == 0)
+        {
+            CompleteAsyncSceneQuery(AZStd::move(query));
+            return;
+        }
+
+        query->m_remainingTasks = aznumeric_cast<AZ::u32>(taskCount);
+
+        // The graph is detached so that it cleans itself up once all its tasks are done. The last task to finish hands the
+        // results over to be dispatched, and the destructor waits for any queries that are still running.
+        AZ::TaskGraph taskGraph("Async Scene Query");
+        for (size_t i = 0; i < fullSize; i += batchSize)
+        {
+            AZ::TaskDescriptor taskDescriptor{"AsyncSceneQueryTask", "Physics"};
+            taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + batchSize, fullSize), query, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Async Scene Query Task");
+                    QuerySceneRange(query->m_requests, start, end, query->m_results);
+
+                    if (--query->m_remainingTasks == 0)
+                    {
+                        CompleteAsyncSceneQuery(query);
+                    }
+                });
+        }
+        taskGraph.Detach();
+        taskGraph.Submit();
+    }
+
+    void PhysXScene::CompleteAsyncSceneQuery(AZStd::shared_ptr<AsyncSceneQuery> query)
+    {
+        AZStd::scoped_lock lock(m_asyncSceneQueryMutex);
+        m_completedAsyncSceneQueries.emplace_back(AZStd::move(query));
+        --m_runningAsyncSceneQueryCount;
+        m_asyncSceneQueryCondition.notify_all();
+    }
+
+    void PhysXScene::DispatchCompletedAsyncSceneQueries()
+    {
+        AZStd::vector<AZStd::shared_ptr<AsyncSceneQuery>> completedQueries;
+        {
+            AZStd::scoped_lock lock(m_asyncSceneQueryMutex);
+            completedQueries.swap(m_completedAsyncSceneQueries);
+        }
+
+        if (completedQueries.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::DispatchCompletedAsyncSceneQueries");
+
+        // Callbacks are called outside of the lock, since they may start new async queries.
+        for (auto& query : completedQueries)
+        {
+            if (query->m_batchCallback)
+            {
+                query->m_batchCallback(query->m_requestId, AZStd::move(query->m_results));
+            }
+            else if (query->m_callback)
+            {
+                query->m_callback(query->m_requestId, AZStd::move(query->m_results.front()));
+            }
+        }
+    }
+
+    void PhysXScene::WaitForAsyncSceneQueries()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+        m_asyncSceneQueryCondition.wait(lock, [this]() { return m_runningAsyncSceneQueryCount == 0; });
+        m_completedAsyncSceneQueries.clear();
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -13,6 +13,11 @@
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
 
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
@@ -60,7 +65,12 @@ namespace PhysX
         AzPhysics::SceneQueryHits QueryScene(const AzPhysics::SceneQueryRequest* request) override;
         bool QueryScene(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result) override;
 
+        //! Splits the requests across tasks when physx_parallelSceneQueryBatch is enabled, so filter callbacks
+        //! in the requests may be called from multiple threads at once.
         AzPhysics::SceneQueryHitsList QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests) override;
+        //! Async queries run on task threads on a copy of the requests, and may overlap with the simulation.
+        //! Their callbacks are called on the simulation thread at the end of the next FinishSimulation, and are never
+        //! called if the scene is destroyed before then.
         [[nodiscard]] bool QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback) override;
         [[nodiscard]] bool QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
@@ -103,6 +113,31 @@ namespace PhysX
             AZStd::vector<AzPhysics::SimulatedBodyIndex> m_packedIndices;
         };
 
+        //! State shared by the tasks of an async scene query.
+        struct AsyncSceneQuery
+        {
+            AzPhysics::SceneQuery::AsyncRequestId m_requestId = 0;
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQueryHitsList m_results;
+            AzPhysics::SceneQuery::AsyncCallback m_callback; //!< Set for single queries.
+            AzPhysics::SceneQuery::AsyncBatchCallback m_batchCallback; //!< Set for batch queries.
+            AZStd::atomic<AZ::u32> m_remainingTasks{ 0 };
+        };
+
+        //! Runs a single query using the given hit buffers instead of the thread local ones.
+        bool QuerySceneWithBuffers(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result,
+            AZStd::vector<physx::PxRaycastHit>& rayCastBuffer,
+            AZStd::vector<physx::PxSweepHit>& sweepBuffer,
+            AZStd::vector<physx::PxOverlapHit>& overlapBuffer);
+        //! Runs the requests in [start, end) with the scene locked for read, storing the hits at the same indices in results.
+        //! The hit buffers are local to the call, so task worker threads don't keep hold of the memory once the range is done.
+        void QuerySceneRange(
+            const AzPhysics::SceneQueryRequests& requests, size_t start, size_t end, AzPhysics::SceneQueryHitsList& results);
+        void StartAsyncSceneQuery(AZStd::shared_ptr<AsyncSceneQuery> query);
+        void CompleteAsyncSceneQuery(AZStd::shared_ptr<AsyncSceneQuery> query);
+        void DispatchCompletedAsyncSceneQueries();
+        void WaitForAsyncSceneQueries();
+
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
 
@@ -156,5 +191,11 @@ namespace PhysX
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        // Async scene queries that are still running, and the ones waiting for their callbacks to be called.
+        AZStd::mutex m_asyncSceneQueryMutex;
+        AZStd::condition_variable m_asyncSceneQueryCondition;
+        size_t m_runningAsyncSceneQueryCount = 0;
+        AZStd::vector<AZStd::shared_ptr<AsyncSceneQuery>> m_completedAsyncSceneQueries;
     };
 }
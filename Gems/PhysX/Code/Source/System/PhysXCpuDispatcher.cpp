@@ -9,8 +9,22 @@
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
 namespace PhysX
 {
+    namespace Internal
+    {
+        bool IsTaskGraphActive()
+        {
+            auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            return taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        }
+    } // namespace Internal
+
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
     {
         return aznew PhysXCpuDispatcher();
@@ -18,13 +32,33 @@ namespace PhysX
 
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
-        azJob->Start();
+        if (Internal::IsTaskGraphActive())
+        {
+            // PhysX tracks the dependencies between its own tasks, so each one is submitted on its own
+            // without compiling a task graph for it.
+            static const AZ::TaskDescriptor taskDescriptor{ "PhysXTask", "Physics" };
+            AZ::TaskExecutor::Instance().SubmitTask(
+                taskDescriptor,
+                [&task]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, task.getName());
+                    task.run();
+                    task.release();
+                });
+        }
+        else
+        {
+            auto azJob = aznew PhysXJob(task);
+            azJob->Start();
+        }
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
+        if (Internal::IsTaskGraphActive())
+        {
+            return AZ::TaskExecutor::Instance().GetThreadCount();
+        }
         return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
     }
 } // namespace PhysX
-
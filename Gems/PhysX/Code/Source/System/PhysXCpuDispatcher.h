@@ -13,6 +13,7 @@
 namespace PhysX
 {
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! Tasks run on the task graph executor when the task graph is active (cl_activateTaskGraph), and as jobs otherwise.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
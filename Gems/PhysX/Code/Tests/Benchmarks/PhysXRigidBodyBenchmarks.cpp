@@ -10,6 +10,8 @@
 #include <benchmark/benchmark.h>
 
 #include <AzTest/AzTest.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 
@@ -88,6 +90,24 @@ namespace PhysX::Benchmarks
             //! Number of iterations for each test
             static const int NumIterations = 10;
         } // namespace ActivationBenchmarkSettings
+
+        //! Settings used to setup the dispatcher benchmark
+        namespace DispatcherBenchmarkSettings
+        {
+            //! Number of stacks of boxes to create, each stack is StackHeight boxes tall.
+            static const int NumStacks = 400;
+            static const int StackHeight = 10;
+
+            //! Values passed to the dispatcher benchmark to select which dispatcher runs the PhysX tasks.
+            static const int JobDispatcher = 0;
+            static const int TaskGraphDispatcher = 1;
+
+            //! Number of game frames to simulate for each test, enough for the stacks to settle and fall asleep.
+            static const int GameFramesToSimulate = 300;
+
+            //! Number of iterations for each test
+            static const int NumIterations = 3;
+        } // namespace DispatcherBenchmarkSettings
     } // namespace RigidBodyConstants
 
     namespace Utils
@@ -549,6 +569,89 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, activationTimes);
     }
 
+    //! BM_RigidBody_StackedBoxes_Dispatcher - This test will create stacks of boxes on the terrain and measure the time
+    //! to simulate the scene while the PhysX tasks are dispatched either as jobs or directly on the task graph executor.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_StackedBoxes_Dispatcher)(benchmark::State& state)
+    {
+        const bool useTaskGraph = state.range(0) == RigidBodyConstants::DispatcherBenchmarkSettings::TaskGraphDispatcher;
+
+        // switch the dispatcher for the duration of the test, it is restored at the end
+        auto* console = AZ::Interface<AZ::IConsole>::Get();
+        bool previousTaskGraphActive = false;
+        if (console)
+        {
+            console->GetCvarValue("cl_activateTaskGraph", previousTaskGraphActive);
+            console->PerformCommand(useTaskGraph ? "cl_activateTaskGraph true" : "cl_activateTaskGraph false");
+        }
+
+        const int numStacks = RigidBodyConstants::DispatcherBenchmarkSettings::NumStacks;
+        const int stackHeight = RigidBodyConstants::DispatcherBenchmarkSettings::StackHeight;
+        const int numRigidBodies = numStacks * stackHeight;
+        const int stacksPerRow = static_cast<int>(std::sqrt(static_cast<float>(numStacks)));
+
+        const float boxSize = RigidBodyConstants::RigidBodys::BoxSize;
+        const float stackSpacing = boxSize * 2.0f;
+
+        // function to generate the rigid bodies position, each stack is filled before moving on to the next one
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [=](int idx) -> const AZ::Vector3
+        {
+            const int stackIndex = idx / stackHeight;
+            const int heightIndex = idx % stackHeight;
+            const float x = stackSpacing * (1 + stackIndex % stacksPerRow);
+            const float y = stackSpacing * (1 + stackIndex / stacksPerRow);
+            const float z = boxSize * (0.5f + heightIndex);
+            return AZ::Vector3(x, y, z);
+        };
+
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(boxSize));
+        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+        {
+            return boxShapeConfiguration;
+        };
+
+        Utils::BenchmarkRigidBodies rigidBodies = Utils::CreateRigidBodies(
+            numRigidBodies, GetDefaultSceneHandle(), RigidBodyConstants::CCDEnabled, RigidBodyApiObject, &colliderGenerator, &posGenerator);
+
+        //setup the sub tick tracker
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        //setup the frame timer tracker
+        Types::TimeList tickTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RigidBodyConstants::DispatcherBenchmarkSettings::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+        subTickTracker.Stop();
+
+        //object clean up
+        if (auto handlesList = AZStd::get_if<AzPhysics::SimulatedBodyHandleList>(&rigidBodies))
+        {
+            m_defaultScene->RemoveSimulatedBodies(*handlesList);
+            handlesList->clear();
+        }
+
+        //restore the dispatcher
+        if (console)
+        {
+            console->PerformCommand(previousTaskGraphActive ? "cl_activateTaskGraph true" : "cl_activateTaskGraph false");
+        }
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+
+        state.SetLabel(useTaskGraph ? "TaskGraph" : "Jobs");
+    }
+
     //! Same as the PhysXRigidbodyBenchmarkFixture, adds a world event handler to receive collision events
     class PhysXRigidbodyCollisionsBenchmarkFixture
         : public PhysXRigidbodyBenchmarkFixture
@@ -776,6 +879,13 @@ namespace PhysX::Benchmarks
         ->MeasureProcessCPUTime();
         ;
 
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_StackedBoxes_Dispatcher)
+        ->Args({ RigidBodyConstants::DispatcherBenchmarkSettings::JobDispatcher })
+        ->Args({ RigidBodyConstants::DispatcherBenchmarkSettings::TaskGraphDispatcher })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::DispatcherBenchmarkSettings::NumIterations)
+        ;
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyCollisionsBenchmarkFixture, BM_RigidBody_MovingAndColliding_CollisionHandlers)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({  {RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange},
@@ -9,6 +9,7 @@
 #ifdef HAVE_BENCHMARK
 #include <vector>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Random.h>
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
@@ -21,6 +22,11 @@
 #include <PhysX/PhysXLocks.h>
 #include <Scene/PhysXScene.h>
 
+namespace PhysX
+{
+    AZ_CVAR_EXTERNED(bool, physx_parallelSceneQueryBatch);
+}
+
 namespace PhysX::Benchmarks
 {
     namespace SceneQueryConstants
@@ -29,6 +35,7 @@ namespace PhysX::Benchmarks
         static const float SphereShapeRadius = 2.0f;
         static const AZ::u32 MinRadius = 2u;
         static const int Seed = 100;
+        static const size_t NumBatchRequests = 10000;
 
         static const std::vector<std::vector<std::pair<int64_t, int64_t>>> BenchmarkConfigs =
         {
@@ -224,6 +231,46 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Runs NumBatchRequests raycasts towards the boxes with a single QuerySceneBatch call.
+    //! state.range(2) - 1 to split the batch across tasks, 0 to run it serially.
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(SceneQueryConstants::NumBatchRequests);
+        for (size_t i = 0; i < SceneQueryConstants::NumBatchRequests; ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        const bool parallelSceneQueryBatch = physx_parallelSceneQueryBatch;
+        physx_parallelSceneQueryBatch = state.range(2) != 0;
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+
+        physx_parallelSceneQueryBatch = parallelSceneQueryBatch;
+
+        // get the P50, P90, P99 percentiles of each call and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
     BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_ShapecastRandomBoxes)(benchmark::State& state)
     {
         AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
@@ -306,6 +353,14 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond);
 
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->ArgNames({ "Boxes", "MaxRadius", "Parallel" })
+        ->Args({ 512, 32, 0 })
+        ->Args({ 512, 32, 1 })
+        ->Args({ 4096, 64, 0 })
+        ->Args({ 4096, 64, 1 })
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_ShapecastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
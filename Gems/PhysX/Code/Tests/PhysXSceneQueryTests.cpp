@@ -8,6 +8,7 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
 
@@ -24,6 +25,9 @@
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_parallelSceneQueryBatch);
+    AZ_CVAR_EXTERNED(size_t, physx_parallelSceneQueryBatchSize);
+
     class PhysXSceneQueryBase
     {
     public:
@@ -1007,4 +1011,150 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_ParallelBatches_MatchSerialResults)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        // Place a ring of boxes around the origin, and cast many more rays than the batch size towards them.
+        constexpr size_t NumBoxes = 16;
+        constexpr size_t NumRequests = 200;
+        for (size_t i = 0; i < NumBoxes; i++)
+        {
+            const float angle = AZ::Constants::TwoPi * aznumeric_cast<float>(i) / NumBoxes;
+            TestUtils::AddStaticBoxToScene(m_testSceneHandle, AZ::Vector3(cosf(angle), sinf(angle), 0.0f) * 10.0f);
+        }
+
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < NumRequests; i++)
+        {
+            const float angle = AZ::Constants::TwoPi * aznumeric_cast<float>(i) / NumRequests;
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = AZ::Vector3(cosf(angle), sinf(angle), 0.0f);
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        const bool parallelSceneQueryBatch = physx_parallelSceneQueryBatch;
+        const size_t parallelSceneQueryBatchSize = physx_parallelSceneQueryBatchSize;
+
+        physx_parallelSceneQueryBatch = false;
+        AzPhysics::SceneQueryHitsList serialResults = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        physx_parallelSceneQueryBatch = true;
+        physx_parallelSceneQueryBatchSize = 7;
+        AzPhysics::SceneQueryHitsList parallelResults = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        physx_parallelSceneQueryBatch = parallelSceneQueryBatch;
+        physx_parallelSceneQueryBatchSize = parallelSceneQueryBatchSize;
+
+        // The results should be in the same order as the requests, regardless of which task ran them.
+        ASSERT_EQ(serialResults.size(), NumRequests);
+        ASSERT_EQ(parallelResults.size(), NumRequests);
+        size_t numHits = 0;
+        for (size_t i = 0; i < NumRequests; i++)
+        {
+            ASSERT_EQ(parallelResults[i].m_hits.size(), serialResults[i].m_hits.size());
+            for (size_t j = 0; j < serialResults[i].m_hits.size(); j++)
+            {
+                EXPECT_EQ(parallelResults[i].m_hits[j].m_bodyHandle, serialResults[i].m_hits[j].m_bodyHandle);
+                EXPECT_TRUE(parallelResults[i].m_hits[j].m_position.IsClose(serialResults[i].m_hits[j].m_position));
+            }
+            numHits += serialResults[i].m_hits.size();
+        }
+        EXPECT_GT(numHits, 0);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallsCallbackAfterSimulation)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddStaticBoxToScene(m_testSceneHandle, pos));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = pos.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 42;
+        bool callbackCalled = false;
+        AzPhysics::SceneQuery::AsyncRequestId resultRequestId = 0;
+        AzPhysics::SceneQueryHitsList results;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, RequestId, requests,
+            [&callbackCalled, &resultRequestId, &results](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                callbackCalled = true;
+                resultRequestId = requestId;
+                results = AZStd::move(hits);
+            });
+        ASSERT_TRUE(queued);
+
+        // Callbacks are only called at the end of a simulation step, once the queries have finished.
+        EXPECT_FALSE(callbackCalled);
+        for (int step = 0; step < 100 && !callbackCalled; step++)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+        ASSERT_TRUE(callbackCalled);
+        EXPECT_EQ(resultRequestId, RequestId);
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_EQ(results[i].m_hits[0].m_bodyHandle, simBodies[i]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_RunsOnCopyOfRequest)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle boxHandle = TestUtils::AddStaticBoxToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f));
+
+        bool callbackCalled = false;
+        AzPhysics::SceneQueryHits result;
+        {
+            AzPhysics::RayCastRequest request;
+            request.m_start = AZ::Vector3::CreateZero();
+            request.m_direction = AZ::Vector3::CreateAxisX();
+            request.m_distance = 200.0f;
+
+            const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 1, &request,
+                [&callbackCalled, &result]([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+                {
+                    callbackCalled = true;
+                    result = AZStd::move(hits);
+                });
+            ASSERT_TRUE(queued);
+
+            // Changing the request after it's queued shouldn't change the query.
+            request.m_direction = -AZ::Vector3::CreateAxisX();
+        }
+
+        for (int step = 0; step < 100 && !callbackCalled; step++)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+        ASSERT_TRUE(callbackCalled);
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_EQ(result.m_hits[0].m_bodyHandle, boxHandle);
+
+        // Requests without a callback can't be queued.
+        AzPhysics::RayCastRequest request;
+        EXPECT_FALSE(sceneInterface->QuerySceneAsync(m_testSceneHandle, 2, &request, nullptr));
+    }
 }
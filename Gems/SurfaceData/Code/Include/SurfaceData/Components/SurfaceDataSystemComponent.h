@@ -13,6 +13,7 @@
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/Utility/ObjectPool.h>
 
 namespace SurfaceData
 {
@@ -102,5 +103,8 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        //! Input position lists reserved for reuse by region queries, which can run on multiple threads at once.
+        mutable ObjectPool<AZStd::vector<AZ::Vector3>> m_regionPositionListPool;
     };
 }
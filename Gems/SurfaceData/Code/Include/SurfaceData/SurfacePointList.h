@@ -57,6 +57,7 @@ namespace SurfaceData
         // ---------- List Construction APIs -------------
 
         //! Clear the surface point list.
+        //! The allocated memory is kept, so a list that gets reused for similarly-sized queries stops allocating after the first one.
         void Clear();
 
         //! Constructor for creating a SurfacePointList from a list of SurfacePoint data.
@@ -221,5 +222,9 @@ namespace SurfaceData
         AZStd::vector<AZ::Vector3> m_surfaceNormalList;
         AZStd::vector<SurfaceTagWeights> m_surfaceWeightsList;
         AZStd::vector<AZ::EntityId> m_surfaceCreatorIdList;
+
+        // Scratch storage used by FilterPoints() that contains 1 for every stored surface point that matches the filter tags,
+        // and 0 for every point that doesn't. It's kept as a member so that its memory gets reused when the list is reused.
+        AZStd::vector<AZ::u8> m_surfacePointFilterMatches;
     };
 }
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace SurfaceData
+{
+    //! ObjectPool holds on to objects between uses so that the memory they've allocated internally can be reused.
+    //! This is primarily intended for temporary query structures like SurfacePointList or position lists, which otherwise would
+    //! reallocate all of their storage on every query. Once a pool has warmed up, acquiring and filling an object with a
+    //! similar amount of data doesn't allocate.
+    //! Objects are handed out through ObjectPool::Handle, which returns the object to the pool when it goes out of scope.
+    //! The pool is safe to use from multiple threads at once; each thread that's concurrently using the pool gets its own object.
+    //! Objects are returned in whatever state they were left in, so callers are expected to clear them before use.
+    template<typename T>
+    class ObjectPool
+    {
+    public:
+        class Handle
+        {
+        public:
+            Handle() = default;
+            Handle(ObjectPool* pool, AZStd::unique_ptr<T>&& object)
+                : m_pool(pool)
+                , m_object(AZStd::move(object))
+            {
+            }
+
+            ~Handle()
+            {
+                Release();
+            }
+
+            Handle(Handle&& other)
+                : m_pool(other.m_pool)
+                , m_object(AZStd::move(other.m_object))
+            {
+                other.m_pool = nullptr;
+            }
+
+            Handle& operator=(Handle&& other)
+            {
+                if (this != &other)
+                {
+                    Release();
+                    m_pool = other.m_pool;
+                    m_object = AZStd::move(other.m_object);
+                    other.m_pool = nullptr;
+                }
+                return *this;
+            }
+
+            Handle(const Handle&) = delete;
+            Handle& operator=(const Handle&) = delete;
+
+            T& operator*() const
+            {
+                return *m_object;
+            }
+
+            T* operator->() const
+            {
+                return m_object.get();
+            }
+
+        private:
+            void Release()
+            {
+                if (m_pool && m_object)
+                {
+                    m_pool->Release(AZStd::move(m_object));
+                }
+                m_pool = nullptr;
+            }
+
+            ObjectPool* m_pool = nullptr;
+            AZStd::unique_ptr<T> m_object;
+        };
+
+        ObjectPool() = default;
+        ~ObjectPool() = default;
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        //! Get an object from the pool, or create a new one if the pool is empty.
+        //! All handles need to be destroyed before the pool is destroyed.
+        Handle Acquire()
+        {
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                if (!m_freeObjects.empty())
+                {
+                    AZStd::unique_ptr<T> object = AZStd::move(m_freeObjects.back());
+                    m_freeObjects.pop_back();
+                    return Handle(this, AZStd::move(object));
+                }
+            }
+
+            return Handle(this, AZStd::make_unique<T>());
+        }
+
+        //! Free every object that's currently in the pool. Objects that are in use will still be returned to the pool afterwards.
+        void Clear()
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_freeObjects.clear();
+        }
+
+    private:
+        void Release(AZStd::unique_ptr<T>&& object)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_freeObjects.emplace_back(AZStd::move(object));
+        }
+
+        AZStd::mutex m_mutex;
+        AZStd::vector<AZStd::unique_ptr<T>> m_freeObjects;
+    };
+} // namespace SurfaceData
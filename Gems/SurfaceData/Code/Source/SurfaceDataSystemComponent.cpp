@@ -108,6 +108,7 @@ namespace SurfaceData
     {
         SurfaceDataSystemRequestBus::Handler::BusDisconnect();
         AZ::Interface<SurfaceDataSystem>::Unregister(this);
+        m_regionPositionListPool.Clear();
     }
 
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry)
@@ -289,7 +290,10 @@ namespace SurfaceData
         const size_t totalQueryPositions = aznumeric_cast<size_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) *
             aznumeric_cast<size_t>(ceil(inRegion.GetYExtent() / stepSize.GetY()));
 
-        AZStd::vector<AZ::Vector3> inPositions;
+        // Reuse a pooled position list so that repeated region queries don't need to reallocate it.
+        auto inPositionsHandle = m_regionPositionListPool.Acquire();
+        AZStd::vector<AZ::Vector3>& inPositions = *inPositionsHandle;
+        inPositions.clear();
         inPositions.reserve(totalQueryPositions);
 
         // Initialize our list-per-position list with every input position to query from the region.
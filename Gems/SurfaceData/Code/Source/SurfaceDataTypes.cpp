@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Math/SimdMath.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
 namespace SurfaceData
@@ -119,9 +120,51 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags) const
     {
+        using AZ::Simd::Vec4;
+
+        // With only a few tags in the collection, a sorted search per sample tag is the cheapest option.
+        if (m_weights.size() <= Vec4::ElementCount)
+        {
+            for (const auto& sampleTag : sampleTags)
+            {
+                if (HasMatchingTag(sampleTag))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Otherwise, pack the tags into vectors so that each sample tag gets compared against 4 tags at a time.
+        // Any unused slots in the last vector are filled with a copy of the first tag so that they can't produce a false match.
+        constexpr size_t MaxTagVectors = AzFramework::SurfaceData::Constants::MaxSurfaceWeights / Vec4::ElementCount;
+        const size_t numTagVectors = (m_weights.size() + Vec4::ElementCount - 1) / Vec4::ElementCount;
+
+        alignas(16) int32_t packedTags[MaxTagVectors * Vec4::ElementCount];
+        for (size_t index = 0; index < numTagVectors * Vec4::ElementCount; index++)
+        {
+            const size_t weightIndex = (index < m_weights.size()) ? index : 0;
+            packedTags[index] = static_cast<int32_t>(static_cast<AZ::u32>(m_weights[weightIndex].m_surfaceType));
+        }
+
+        Vec4::Int32Type tagVectors[MaxTagVectors];
+        for (size_t vectorIndex = 0; vectorIndex < numTagVectors; vectorIndex++)
+        {
+            tagVectors[vectorIndex] = Vec4::LoadAligned(&packedTags[vectorIndex * Vec4::ElementCount]);
+        }
+
+        const Vec4::Int32Type noMatches = Vec4::ZeroInt();
         for (const auto& sampleTag : sampleTags)
         {
-            if (HasMatchingTag(sampleTag))
+            const Vec4::Int32Type sampleTagVector = Vec4::Splat(static_cast<int32_t>(static_cast<AZ::u32>(sampleTag)));
+            Vec4::Int32Type matches = noMatches;
+            for (size_t vectorIndex = 0; vectorIndex < numTagVectors; vectorIndex++)
+            {
+                matches = Vec4::Or(matches, Vec4::CmpEq(tagVectors[vectorIndex], sampleTagVector));
+            }
+
+            if (!Vec4::CmpAllEq(matches, noMatches))
             {
                 return true;
             }
@@ -120,6 +120,7 @@ namespace SurfaceData
         m_surfaceNormalList.clear();
         m_surfaceWeightsList.clear();
         m_surfaceCreatorIdList.clear();
+        m_surfacePointFilterMatches.clear();
 
         m_surfacePointBounds = AZ::Aabb::CreateNull();
     }
@@ -204,45 +205,42 @@ namespace SurfaceData
         // Filter out any points that don't match our search tags.
         // This has to be done after the Surface Modifiers have processed the points, not at point insertion time, because
         // Surface Modifiers add tags to existing points.
-        // The algorithm below is basically an "erase_if" that's operating across multiple storage vectors and using one level of
-        // indirection to keep our sorted indices valid.
-        // At some point we might want to consider modifying this to compact the final storage to the minimum needed.
+
+        // First, determine which points match in a single linear pass over the storage vector instead of walking it through
+        // the sorted indices.
+        m_surfacePointFilterMatches.resize(m_surfaceWeightsList.size());
+        for (size_t pointIndex = 0; pointIndex < m_surfaceWeightsList.size(); pointIndex++)
+        {
+            m_surfacePointFilterMatches[pointIndex] = m_surfaceWeightsList[pointIndex].HasAnyMatchingTags(desiredTags) ? 1 : 0;
+        }
+
+        // Then compact the sorted indices for each input position so that they only reference the matching points.
+        // The storage vectors themselves don't need to change, because the removed points simply won't be referenced anymore.
+        // Every index gets written, but the output location only advances for matching points, so the loop doesn't need to branch.
+        size_t totalMatchingPoints = 0;
         for (size_t inputIndex = 0; (inputIndex < m_inputPositionSize); inputIndex++)
         {
-            size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
-            size_t listSize = (surfacePointStartIndex + m_numSurfacePointsPerInput[inputIndex]);
-            size_t index = surfacePointStartIndex;
-            for (; index < listSize; index++)
+            const size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
+            const size_t listSize = (surfacePointStartIndex + m_numSurfacePointsPerInput[inputIndex]);
+            size_t outIndex = surfacePointStartIndex;
+            for (size_t index = surfacePointStartIndex; index < listSize; index++)
             {
-                if (!m_surfaceWeightsList[m_sortedSurfacePointIndices[index]].HasAnyMatchingTags(desiredTags))
-                {
-                    break;
-                }
+                const size_t pointIndex = m_sortedSurfacePointIndices[index];
+                m_sortedSurfacePointIndices[outIndex] = pointIndex;
+                outIndex += m_surfacePointFilterMatches[pointIndex];
             }
 
-            if (index != listSize)
-            {
-                size_t next = index + 1;
-                for (; next < listSize; ++next)
-                {
-                    if (m_surfaceWeightsList[m_sortedSurfacePointIndices[next]].HasAnyMatchingTags(desiredTags))
-                    {
-                        m_sortedSurfacePointIndices[index] = AZStd::move(m_sortedSurfacePointIndices[next]);
-                        m_surfaceCreatorIdList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceCreatorIdList[m_sortedSurfacePointIndices[next]]);
-                        m_surfacePositionList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfacePositionList[m_sortedSurfacePointIndices[next]]);
-                        m_surfaceNormalList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceNormalList[m_sortedSurfacePointIndices[next]]);
-                        m_surfaceWeightsList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceWeightsList[m_sortedSurfacePointIndices[next]]);
-
-                        ++index;
-                    }
-                }
+            m_numSurfacePointsPerInput[inputIndex] = outIndex - surfacePointStartIndex;
+            totalMatchingPoints += m_numSurfacePointsPerInput[inputIndex];
+        }
 
-                m_numSurfacePointsPerInput[inputIndex] = index - surfacePointStartIndex;
-            }
+        // If nothing matched, clear out the storage vectors so that IsEmpty() correctly reports that there aren't any points.
+        if (totalMatchingPoints == 0)
+        {
+            m_surfacePositionList.clear();
+            m_surfaceNormalList.clear();
+            m_surfaceWeightsList.clear();
+            m_surfaceCreatorIdList.clear();
         }
     }
 
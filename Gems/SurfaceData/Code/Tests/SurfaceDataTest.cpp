@@ -28,6 +28,7 @@
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
 #include <SurfaceData/SurfaceDataModifierRequestBus.h>
 #include <SurfaceData/SurfaceTag.h>
+#include <SurfaceData/Utility/ObjectPool.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 #include <Tests/SurfaceDataTestFixtures.h>
 
@@ -1042,5 +1043,84 @@ TEST_F(SurfaceDataTestApp, SurfaceData_FirstPointFilteredOut_SurfacePointListRem
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_AllPointsFilteredOut_SurfacePointListIsEmpty)
+{
+    AZStd::array<AZ::Vector3, 2> inPositions = { AZ::Vector3(0.0f), AZ::Vector3(1.0f) };
+    AZStd::array<SurfaceData::SurfaceTag, 1> filterTags = { SurfaceData::SurfaceTag(AZ::Crc32("keep_this_point")) };
+
+    // Add points that don't have the filter tag, so that every point gets filtered out.
+    SurfaceData::SurfaceTagWeights weights;
+    weights.AddSurfaceTagWeight(AZ::Crc32("remove_this_point"), 1.0f);
+
+    SurfaceData::SurfacePointList testPoints;
+    testPoints.StartListConstruction(inPositions, 1, filterTags);
+    for (auto& inPosition : inPositions)
+    {
+        testPoints.AddSurfacePoint(AZ::EntityId(), inPosition, inPosition, AZ::Vector3::CreateAxisZ(), weights);
+    }
+    testPoints.EndListConstruction();
+
+    // TEST: Verify that the list reports that it's empty, both overall and for each input position.
+    EXPECT_TRUE(testPoints.IsEmpty());
+    EXPECT_EQ(testPoints.GetSize(), 0);
+    for (size_t inPosition = 0; inPosition < inPositions.size(); inPosition++)
+    {
+        EXPECT_TRUE(testPoints.IsEmpty(inPosition));
+    }
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_HasAnyMatchingTags_MatchesForAllCollectionSizes)
+{
+    // Build collections of every size up to the max, so that both the small and the vectorized comparisons get used, including
+    // collections that only partially fill their last vector.
+    for (size_t numTags = 0; numTags <= AzFramework::SurfaceData::Constants::MaxSurfaceWeights; numTags++)
+    {
+        SurfaceData::SurfaceTagWeights weights;
+        SurfaceData::SurfaceTagVector containedTags;
+        for (size_t tagIndex = 0; tagIndex < numTags; tagIndex++)
+        {
+            AZ::Crc32 tag(AZStd::string::format("tag_%zu", tagIndex).c_str());
+            weights.AddSurfaceTagWeight(tag, 1.0f);
+            containedTags.emplace_back(tag);
+        }
+
+        const SurfaceData::SurfaceTagVector missingTags = { SurfaceData::SurfaceTag(AZ::Crc32("missing_tag_0")),
+                                                            SurfaceData::SurfaceTag(AZ::Crc32("missing_tag_1")) };
+
+        // TEST: Verify that a collection never matches tags that it doesn't contain.
+        EXPECT_FALSE(weights.HasAnyMatchingTags(missingTags));
+
+        // TEST: Verify that every contained tag is found, whether it's alone or after a list of missing tags.
+        for (auto& containedTag : containedTags)
+        {
+            SurfaceData::SurfaceTagVector sampleTags = missingTags;
+            sampleTags.emplace_back(containedTag);
+            EXPECT_TRUE(weights.HasAnyMatchingTags(sampleTags));
+            EXPECT_TRUE(weights.HasAnyMatchingTags(AZStd::span<const SurfaceData::SurfaceTag>(&containedTag, 1)));
+        }
+    }
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_ObjectPool_ReusesReleasedObjects)
+{
+    SurfaceData::ObjectPool<AZStd::vector<AZ::Vector3>> pool;
+
+    AZStd::vector<AZ::Vector3>* firstObject = nullptr;
+    {
+        auto handle = pool.Acquire();
+        handle->resize(64);
+        firstObject = &(*handle);
+
+        // TEST: Verify that objects that are in use at the same time are different objects.
+        auto secondHandle = pool.Acquire();
+        EXPECT_NE(firstObject, &(*secondHandle));
+    }
+
+    // TEST: Verify that the most recently released object gets handed out again and keeps its allocated memory.
+    auto handle = pool.Acquire();
+    EXPECT_EQ(&(*handle), firstObject);
+    EXPECT_GE(handle->capacity(), 64);
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
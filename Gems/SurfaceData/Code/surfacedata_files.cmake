@@ -21,6 +21,7 @@ set(FILES
     Include/SurfaceData/SurfaceDataModifierRequestBus.h
     Include/SurfaceData/SurfacePointList.h
     Include/SurfaceData/SurfaceTag.h
+    Include/SurfaceData/Utility/ObjectPool.h
     Include/SurfaceData/Utility/SurfaceDataUtility.h
     Source/SurfaceDataSystemComponent.cpp
     Source/SurfaceDataTypes.cpp
@@ -11,6 +11,7 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -23,6 +24,14 @@
 
 namespace Terrain
 {
+    AZ_CVAR(bool,
+        terrain_cacheHeightGradients,
+        true,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Caches the height gradient values sampled at the terrain query resolution. Takes effect when the height gradient list activates."
+    );
+
     void TerrainHeightGradientListConfig::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -116,6 +125,26 @@ namespace Terrain
             }
         }
 
+        m_compiledGradients.clear();
+        m_compiledGradients.reserve(m_configuration.m_gradientEntities.size());
+        for (auto& entityId : m_configuration.m_gradientEntities)
+        {
+            GradientSignal::GradientSampler gradientSampler;
+            gradientSampler.m_gradientId = entityId;
+            gradientSampler.m_ownerEntityId = GetEntityId();
+            m_compiledGradients.emplace_back(AZStd::make_unique<GradientSignal::CompiledGradient>(gradientSampler));
+        }
+
+        m_gradientCaches.clear();
+        if (terrain_cacheHeightGradients)
+        {
+            m_gradientCaches.reserve(m_compiledGradients.size());
+            for (const auto& compiledGradient : m_compiledGradients)
+            {
+                m_gradientCaches.emplace_back(AZStd::make_unique<GradientSignal::GradientCache>(compiledGradient->GetGradientSampler()));
+            }
+        }
+
         Terrain::TerrainAreaHeightRequestBus::Handler::BusConnect(GetEntityId());
 
         // Cache any height data needed and notify that the area has changed.
@@ -127,6 +156,8 @@ namespace Terrain
         // Disconnect before doing any other teardown. This will guarantee that any active queries have finished before we proceed.
         Terrain::TerrainAreaHeightRequestBus::Handler::BusDisconnect();
 
+        m_gradientCaches.clear();
+        m_compiledGradients.clear();
         m_dependencyMonitor.Reset();
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
@@ -234,12 +265,20 @@ namespace Terrain
             // value of 0 outside their data bounds if they're using bounded data.  We should examine the possibility of extending the
             // gradient API to provide actual bounds so that it's possible to detect if the gradient even 'exists' in an area, at which
             // point we could just make this list a prioritized list from top to bottom for any points that overlap.
-            for (auto& gradientId : m_configuration.m_gradientEntities)
+            for (size_t gradientIndex = 0; gradientIndex < m_configuration.m_gradientEntities.size(); gradientIndex++)
             {
-                if (gradientId.IsValid())
+                if (m_configuration.m_gradientEntities[gradientIndex].IsValid())
                 {
-                    GradientSignal::GradientRequestBus::Event(
-                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList, curGradientSamples);
+                    if (!m_gradientCaches.empty() && (inOutPositionList.size() >= GradientSignal::GradientCache::TileSize))
+                    {
+                        // Terrain queries are generally made on a grid at the query resolution, so those points are served from the cache.
+                        // Smaller queries wouldn't fill any tiles, so they go straight to the compiled gradient instead.
+                        m_gradientCaches[gradientIndex]->GetValues(inOutPositionList, curGradientSamples, m_cachedQueryResolution);
+                    }
+                    else
+                    {
+                        m_compiledGradients[gradientIndex]->GetValues(inOutPositionList, curGradientSamples);
+                    }
 
                     for (size_t index = 0; index < maxValueSamples.size(); index++)
                     {
@@ -284,6 +323,11 @@ namespace Terrain
         AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
             heightBounds, &AzFramework::Terrain::TerrainDataRequestBus::Events::GetTerrainHeightBounds);
 
+        // Get the grid spacing that terrain height queries are made at, which is also the spacing of any cached gradient values.
+        float queryResolution = 1.0f;
+        AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+            queryResolution, &AzFramework::Terrain::TerrainDataRequestBus::Events::GetTerrainHeightQueryResolution);
+
         // Ensure that we only change our cached data and terrain registration status when no queries are actively running.
         {
             AZStd::unique_lock lock(m_queryMutex);
@@ -292,6 +336,11 @@ namespace Terrain
 
             // Save off the min/max heights so that we don't have to re-query them on every single height query.
             m_cachedHeightBounds = heightBounds;
+
+            if (queryResolution > 0.0f)
+            {
+                m_cachedQueryResolution = queryResolution;
+            }
         }
 
         // We specifically refresh this outside of the queryMutex lock to avoid lock inversion deadlocks. These can occur if one thread
@@ -16,13 +16,17 @@
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <GradientSignal/CompiledGradient.h>
+#include <GradientSignal/GradientCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 
@@ -95,6 +99,14 @@ namespace Terrain
 
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
 
+        // Bulk height queries evaluate each gradient entity through a compiled program, in the same order as the config list.
+        AZStd::vector<AZStd::unique_ptr<GradientSignal::CompiledGradient>> m_compiledGradients;
+
+        // When terrain_cacheHeightGradients is enabled (the default), bulk height queries with at least a cache tile row's worth of
+        // positions go through a tile cache per gradient entity instead.
+        AZStd::vector<AZStd::unique_ptr<GradientSignal::GradientCache>> m_gradientCaches;
+        float m_cachedQueryResolution = 1.0f;
+
         // The TerrainAreaHeightRequestBus allows parallel dispatches, so make sure that queries don't happen at the same
         // time as cached data updates.
         AZStd::shared_mutex m_queryMutex;
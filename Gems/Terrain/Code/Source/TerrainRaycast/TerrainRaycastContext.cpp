@@ -9,7 +9,10 @@
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystem.h>
 
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/sort.h>
 
 using namespace Terrain;
@@ -17,26 +20,17 @@ using namespace Terrain;
 namespace
 {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    // Convenience function to get the terrain height values at each corner of an AABB, triangulate them,
-    // and then find the nearest intersection (if any) between the resulting triangles and the given ray.
-    static void TriangulateAndFindNearestIntersection(const TerrainSystem& terrainSystem,
-                                                      const AZ::Aabb& aabb,
-                                                      const AZ::Intersect::SegmentTriangleHitTester& hitTester,
-                                                      AzFramework::RenderGeometry::RayResult& result)
+    // Convenience function to triangulate the four terrain points of a grid square and then find the nearest
+    // intersection (if any) between the resulting triangles and the given ray.
+    // The points are the min corner, the (min x, max y) corner, the max corner, and the (max x, min y) corner.
+    static void FindNearestIntersection(const AZ::Vector3& point0,
+                                        const AZ::Vector3& point1,
+                                        const AZ::Vector3& point2,
+                                        const AZ::Vector3& point3,
+                                        const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+                                        AzFramework::RenderGeometry::RayResult& result)
     {
-        // Obtain the height values at each corner of the AABB.
-        const AZ::Vector3& aabbMin = aabb.GetMin();
-        const AZ::Vector3& aabbMax = aabb.GetMax();
-        AZ::Vector3 point0 = aabbMin;
-        AZ::Vector3 point2 = aabbMax;
-        AZ::Vector3 point1(point0.GetX(), point2.GetY(), 0.0f);
-        AZ::Vector3 point3(point2.GetX(), point0.GetY(), 0.0f);
-        point0.SetZ(terrainSystem.GetHeight(point0, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point1.SetZ(terrainSystem.GetHeight(point1, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point2.SetZ(terrainSystem.GetHeight(point2, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point3.SetZ(terrainSystem.GetHeight(point3, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-
-        // Finally, triangulate the four terrain points and check for a hit,
+        // Triangulate the four terrain points and check for a hit,
         // splitting using the top-left -> bottom-right diagonal so to match
         // the current behavior of the terrain physics and rendering systems.
         AZ::Vector3 bottomLeftHitNormal;
@@ -63,6 +57,195 @@ namespace
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Convenience function to get the terrain height values at each corner of an AABB, triangulate them,
+    // and then find the nearest intersection (if any) between the resulting triangles and the given ray.
+    static void TriangulateAndFindNearestIntersection(const TerrainSystem& terrainSystem,
+                                                      const AZ::Aabb& aabb,
+                                                      const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+                                                      AzFramework::RenderGeometry::RayResult& result)
+    {
+        // Obtain the height values at each corner of the AABB.
+        const AZ::Vector3& aabbMin = aabb.GetMin();
+        const AZ::Vector3& aabbMax = aabb.GetMax();
+        AZ::Vector3 point0 = aabbMin;
+        AZ::Vector3 point2 = aabbMax;
+        AZ::Vector3 point1(point0.GetX(), point2.GetY(), 0.0f);
+        AZ::Vector3 point3(point2.GetX(), point0.GetY(), 0.0f);
+        point0.SetZ(terrainSystem.GetHeight(point0, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
+        point1.SetZ(terrainSystem.GetHeight(point1, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
+        point2.SetZ(terrainSystem.GetHeight(point2, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
+        point3.SetZ(terrainSystem.GetHeight(point3, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
+
+        FindNearestIntersection(point0, point1, point2, point3, hitTester, result);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Convenience function that returns true if the terrain height bounds show that the ray passes entirely above or below the
+    // terrain over the given XY area, so that it can't hit anything there.
+    // The terrain system keeps the bounds until the heights change, so the first ray over an area pays for computing them and
+    // every later ray over the same area gets them for free.
+    static bool RayMissesTerrainHeightBounds(const TerrainSystem& terrainSystem,
+                                             const AzFramework::RenderGeometry::RayRequest& ray,
+                                             const AZ::Vector2& areaMin,
+                                             const AZ::Vector2& areaMax)
+    {
+        const AZ::Aabb area = AZ::Aabb::CreateFromMinMax(AZ::Vector3(areaMin, 0.0f), AZ::Vector3(areaMax, 0.0f));
+        const AzFramework::Terrain::FloatRange heightBounds = terrainSystem.GetTerrainHeightBoundsInRegion(area);
+        if (!heightBounds.IsValid())
+        {
+            // The bounds couldn't be computed for this area, so the heights need to be checked.
+            return false;
+        }
+
+        // Use slightly expanded bounds, the same as for the terrain world bounds, so that precision errors don't cause a
+        // collision right on the boundary to get missed.
+        const AZ::Aabb areaBounds = AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(areaMin, heightBounds.m_min), AZ::Vector3(areaMax, heightBounds.m_max)).GetExpanded(AZ::Vector3(0.01f));
+        AZ::Vector3 clippedRayStart = ray.m_startWorldPosition;
+        AZ::Vector3 clippedRayEnd = ray.m_endWorldPosition;
+        float tClipStart, tClipEnd;
+        return !AZ::Intersect::ClipRayWithAabb(areaBounds, clippedRayStart, clippedRayEnd, tClipStart, tClipEnd);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Steps a ray through the terrain grid squares that it passes over, in order from nearest to farthest.
+    // See the description above TerrainRaycastContext::RayIntersect for the details of the algorithm.
+    class TerrainGridTraversal
+    {
+    public:
+        enum class StepAxis : uint8_t
+        {
+            None,
+            X,
+            Y
+        };
+
+        // Clip the ray to the terrain world bounds and set up the traversal at the first grid square along the ray.
+        // Returns false if the ray doesn't pass over the terrain at all.
+        bool Initialize(const AzFramework::RenderGeometry::RayRequest& ray,
+                        const AZ::Aabb& terrainWorldBounds,
+                        const AZ::Vector2& terrainResolution)
+        {
+            // Start by clipping the ray to the terrain world bounds so that we can reduce our iteration over the ray to just
+            // the subset that can potentially collide with the terrain.
+            // We use a slightly expanded terrain world bounds for clipping the ray so that precision errors don't cause the ray
+            // to get overly truncated and miss a collision that might occur right on the world boundary.
+            AZ::Vector3 clippedRayStart = ray.m_startWorldPosition;
+            AZ::Vector3 clippedRayEnd = ray.m_endWorldPosition;
+            float tClipStart, tClipEnd;
+            bool rayIntersected = AZ::Intersect::ClipRayWithAabb(
+                terrainWorldBounds.GetExpanded(AZ::Vector3(0.01f)), clippedRayStart, clippedRayEnd, tClipStart, tClipEnd);
+
+            if (!rayIntersected)
+            {
+                // The ray does not intersect the terrain world bounds.
+                return false;
+            }
+
+            // Move our clipped line segment into Vector2s for more convenient use below.
+            const AZ::Vector2 clippedStart(clippedRayStart);
+            const AZ::Vector2 clippedEnd(clippedRayEnd);
+            const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
+
+            // Calculate the total number of terrain squares we'll need to visit to trace the ray segment.
+            // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
+            // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
+            const AZ::Vector2 numSquaresToMove =
+                ((clippedEnd / terrainResolution).GetFloor() - (clippedStart / terrainResolution).GetFloor()).GetAbs();
+            m_remainingSquares =
+                1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
+
+            // This tells us how much t distance on the line to move to increment one terrain square in each direction.
+            // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
+            const AZ::Vector2 tDelta(terrainResolution / clippedLineSegment.GetAbs());
+
+            // Get the min world space corner of the terrain grid square containing (x0, y0)
+            const AZ::Vector2 clippedStartGridCorner = (clippedStart / terrainResolution).GetFloor() * terrainResolution;
+
+            // tUntilNextBoundary stores how much further we currently need to move along t to get to the next terrain grid square
+            // boundary in each direction.
+            // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
+            // direction at all (when clippedLineSegment == 0)
+            const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
+
+            m_tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
+                clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
+
+            // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
+            // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
+            m_tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(
+                clippedEnd, clippedStart, tDelta - m_tUntilNextBoundary, m_tUntilNextBoundary);
+
+            // This will hold our current square coordinates in world space values as we loop through the squares, starting with the
+            // grid square for (x0, y0). These values represent the minimum corner of each terrain square.
+            m_curGridCorner = clippedStartGridCorner;
+
+            // This is how much we need to increment our x and y by to get to the next grid square along the line.
+            // They will either be +/- terrainResolution or 0 if we're not moving in that direction.
+            const AZ::Vector2 gridIncrement = terrainResolution *
+                AZ::Vector2::CreateSelectCmpEqual(clippedLineSegment,
+                                                  AZ::Vector2::CreateZero(),
+                                                  AZ::Vector2::CreateZero(),
+                                                  AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
+
+            // Convenience vectors that we can use when stepping to just increment one direction.
+            m_tDeltaX = AZ::Vector2(tDelta.GetX(), 0.0f);
+            m_tDeltaY = AZ::Vector2(0.0f, tDelta.GetY());
+            m_gridIncrementX = AZ::Vector2(gridIncrement.GetX(), 0.0f);
+            m_gridIncrementY = AZ::Vector2(0.0f, gridIncrement.GetY());
+
+            return true;
+        }
+
+        // Returns the number of grid squares left to visit, including the current one.
+        int32_t GetRemainingSquares() const
+        {
+            return m_remainingSquares;
+        }
+
+        // Returns the min corner of the current grid square.
+        const AZ::Vector2& GetCurrentGridCorner() const
+        {
+            return m_curGridCorner;
+        }
+
+        // Move forward along the line (either horizontally or vertically) to the next terrain square.
+        // Returns the axis that we moved along, which tells callers which corners the new square shares with the previous one.
+        StepAxis Step()
+        {
+            m_remainingSquares--;
+
+            if (m_tUntilNextBoundary.GetY() < m_tUntilNextBoundary.GetX())
+            {
+                m_curGridCorner += m_gridIncrementY;
+                m_tUntilNextBoundary += m_tDeltaY;
+                return (m_gridIncrementY.GetY() != 0.0f) ? StepAxis::Y : StepAxis::None;
+            }
+            else
+            {
+                m_curGridCorner += m_gridIncrementX;
+                m_tUntilNextBoundary += m_tDeltaX;
+                return (m_gridIncrementX.GetX() != 0.0f) ? StepAxis::X : StepAxis::None;
+            }
+        }
+
+        // Returns true if the last step moved in the positive direction along the given axis.
+        bool IsPositiveStep(StepAxis axis) const
+        {
+            return (axis == StepAxis::X) ? (m_gridIncrementX.GetX() > 0.0f) : (m_gridIncrementY.GetY() > 0.0f);
+        }
+
+    private:
+        AZ::Vector2 m_curGridCorner = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_tUntilNextBoundary = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_tDeltaX = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_tDeltaY = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_gridIncrementX = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_gridIncrementY = AZ::Vector2::CreateZero();
+        int32_t m_remainingSquares = 0;
+    };
+
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -129,89 +312,30 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
         return rayIntersectionResult;
     }
 
-    // Start by clipping the ray to the terrain world bounds so that we can reduce our iteration over the ray to just
-    // the subset that can potentially collide with the terrain.
-    // We use a slightly expanded terrain world bounds for clipping the ray so that precision errors don't cause the ray
-    // to get overly truncated and miss a collision that might occur right on the world boundary.
-    AZ::Vector3 clippedRayStart = ray.m_startWorldPosition;
-    AZ::Vector3 clippedRayEnd = ray.m_endWorldPosition;
-    float tClipStart, tClipEnd;
-    bool rayIntersected = AZ::Intersect::ClipRayWithAabb(
-        terrainWorldBounds.GetExpanded(AZ::Vector3(0.01f)), clippedRayStart, clippedRayEnd, tClipStart, tClipEnd);
-
-    if (!rayIntersected)
+    TerrainGridTraversal traversal;
+    if (!traversal.Initialize(ray, terrainWorldBounds, terrainResolution))
     {
         // The ray does not intersect the terrain world bounds.
         return rayIntersectionResult;
     }
 
-    // Move our clipped line segment into Vector2s for more convenient use below.
-    const AZ::Vector2 clippedStart(clippedRayStart);
-    const AZ::Vector2 clippedEnd(clippedRayEnd);
-    const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
-
-    // Calculate the total number of terrain squares we'll need to visit to trace the ray segment.
-    // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
-    // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
-    const AZ::Vector2 numSquaresToMove =
-        ((clippedEnd / terrainResolution).GetFloor() - (clippedStart / terrainResolution).GetFloor()).GetAbs();
-    const int32_t numTerrainSquares =
-        1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
-
-    // This tells us how much t distance on the line to move to increment one terrain square in each direction.
-    // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
-    const AZ::Vector2 tDelta(terrainResolution / clippedLineSegment.GetAbs());
-
-    // Get the min world space corner of the terrain grid square containing (x0, y0)
-    const AZ::Vector2 clippedStartGridCorner = (clippedStart / terrainResolution).GetFloor() * terrainResolution;
-
-    // tUntilNextBoundary stores how much further we currently need to move along t to get to the next terrain grid square boundary
-    // in each direction.
-    // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
-    // direction at all (when clippedLineSegment == 0)
-    const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
-
-    AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
-        clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
-
-    // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
-    // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
-    tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(clippedEnd, clippedStart, tDelta - tUntilNextBoundary, tUntilNextBoundary);
-
     // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
     // to make sure we don't run into any precision issues caused from the clipping.
     AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
 
-    // These will hold our current square coordinates in world space values as we loop through the squares, starting with the
-    // grid square for (x0, y0). These values represent the minimum corner of each terrain square.
-    AZ::Vector2 curGridCorner = clippedStartGridCorner;
-
-    // This is how much we need to increment our x and y by to get to the next grid square along the line.
-    // They will either be +/- terrainResolution or 0 if we're not moving in that direction.
-    const AZ::Vector2 gridIncrement = terrainResolution *
-        AZ::Vector2::CreateSelectCmpEqual(clippedLineSegment,
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
-
-    // Convenience vectors that we can use in the loop to just increment one direction.
-    const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
-    const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
-    const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
-    const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
-
     // Walk through each grid square in the terrain that intersects the XY coordinates of the line.
     // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
-    for (int terrainSquare = 0; terrainSquare < numTerrainSquares; terrainSquare++)
+    while (traversal.GetRemainingSquares() > 0)
     {
         // Create a bounding volume for this terrain square.
+        const AZ::Vector2& curGridCorner = traversal.GetCurrentGridCorner();
         AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
             AZ::Vector3(curGridCorner, terrainWorldBounds.GetMin().GetZ()),
             AZ::Vector3(curGridCorner + terrainResolution, terrainWorldBounds.GetMax().GetZ()));
 
         // Check for a hit against the terrain triangles in this square.
-        // Note - this could be optimized to be 2x faster by adding some code to keep track of the terrain heights
-        // from the previous square checked so that we only get the 2 new corners instead of all 4 every time.
+        // Note - the batched RayIntersect below reuses the heights from the previous square checked so that it only gets the
+        // 2 new corners instead of all 4 every time, so prefer that one when tracing more than a handful of rays.
         TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, rayIntersectionResult);
         if (rayIntersectionResult)
         {
@@ -225,20 +349,241 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
             break;
         }
 
-        // No hit yet, so move forward along the line (either horizontally or vertically) to the next terrain square.
-        if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
+        // No hit yet, so move forward along the line to the next terrain square.
+        traversal.Step();
+    }
+
+    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
+    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
+    return rayIntersectionResult;
+}
+
+void TerrainRaycastContext::RayIntersect(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> outResults) const
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    AZ_Assert(rays.size() == outResults.size(), "The sizes of the rays list and the results list should match.");
+
+    // Initialize all the results to invalid at the start.
+    for (auto& result : outResults)
+    {
+        result = AzFramework::RenderGeometry::RayResult();
+    }
+
+    const AZ::Aabb terrainWorldBounds = m_terrainSystem.GetTerrainAabb();
+    const AZ::Vector2 terrainResolution(m_terrainSystem.GetTerrainHeightQueryResolution());
+
+    if (!terrainWorldBounds.IsValid())
+    {
+        // There is no terrain to intersect.
+        return;
+    }
+
+    // The traversal state for every ray that hasn't finished yet.
+    struct ActiveRay
+    {
+        size_t m_rayIndex;
+        TerrainGridTraversal m_traversal;
+        AZ::Intersect::SegmentTriangleHitTester m_hitTester;
+    };
+
+    // A grid square gathered during a pass, with the indices of its 4 corners in the pass's list of corner positions.
+    // The corners are in the same order as the points passed to FindNearestIntersection.
+    struct GridSquare
+    {
+        AZStd::array<uint32_t, 4> m_cornerIndices;
+    };
+
+    AZStd::vector<ActiveRay> activeRays;
+    activeRays.reserve(rays.size());
+    for (size_t rayIndex = 0; rayIndex < rays.size(); rayIndex++)
+    {
+        TerrainGridTraversal traversal;
+        if (traversal.Initialize(rays[rayIndex], terrainWorldBounds, terrainResolution))
+        {
+            // We use the full ray for hit testing instead of the clipped one to make sure we don't run into any precision
+            // issues caused from the clipping.
+            activeRays.push_back(
+                { rayIndex, traversal,
+                  AZ::Intersect::SegmentTriangleHitTester(rays[rayIndex].m_startWorldPosition, rays[rayIndex].m_endWorldPosition) });
+        }
+    }
+
+    // Most rays that hit the terrain do so within their first few squares, so the first pass only gathers a few squares per ray to
+    // avoid fetching heights that won't get used. The rays still active after that tend to be long, so each later pass doubles
+    // the number of squares gathered.
+    constexpr int32_t InitialSquaresPerPass = 8;
+    constexpr int32_t MaxSquaresPerPass = 256;
+    int32_t squaresPerPass = InitialSquaresPerPass;
+
+    AZStd::vector<AZ::Vector3> cornerPositions;
+    AZStd::vector<float> cornerHeights;
+    AZStd::vector<GridSquare> gridSquares;
+    AZStd::vector<size_t> raySquaresEnd;
+
+    while (!activeRays.empty())
+    {
+        cornerPositions.clear();
+        gridSquares.clear();
+        raySquaresEnd.clear();
+
+        // Gather the next run of grid squares for every active ray, along with the positions of the corners that we need heights for.
+        for (auto& activeRay : activeRays)
+        {
+            TerrainGridTraversal& traversal = activeRay.m_traversal;
+            const int32_t numSquares = AZStd::min(squaresPerPass, traversal.GetRemainingSquares());
+            TerrainGridTraversal::StepAxis lastStep = TerrainGridTraversal::StepAxis::None;
+
+            const size_t runCornersBegin = cornerPositions.size();
+            const size_t runSquaresBegin = gridSquares.size();
+            AZ::Vector2 runMin = traversal.GetCurrentGridCorner();
+            AZ::Vector2 runMax = runMin + terrainResolution;
+
+            for (int32_t square = 0; square < numSquares; square++)
+            {
+                const AZ::Vector2& minCorner = traversal.GetCurrentGridCorner();
+                const AZ::Vector2 maxCorner = minCorner + terrainResolution;
+                runMin = runMin.GetMin(minCorner);
+                runMax = runMax.GetMax(maxCorner);
+
+                GridSquare gridSquare;
+                AZStd::array<bool, 4> cornerShared = { false, false, false, false };
+
+                // Consecutive squares share an edge, so reuse the 2 corners on that edge from the previous square.
+                if ((square > 0) && (lastStep != TerrainGridTraversal::StepAxis::None))
+                {
+                    const auto& previous = gridSquares.back().m_cornerIndices;
+                    auto& current = gridSquare.m_cornerIndices;
+                    const bool positive = traversal.IsPositiveStep(lastStep);
+                    if (lastStep == TerrainGridTraversal::StepAxis::X)
+                    {
+                        // The left edge (0, 1) of one square is the right edge (3, 2) of the other.
+                        const int newLow = positive ? 0 : 3, newHigh = positive ? 1 : 2;
+                        const int oldLow = positive ? 3 : 0, oldHigh = positive ? 2 : 1;
+                        current[newLow] = previous[oldLow];
+                        current[newHigh] = previous[oldHigh];
+                        cornerShared[newLow] = cornerShared[newHigh] = true;
+                    }
+                    else
+                    {
+                        // The bottom edge (0, 3) of one square is the top edge (1, 2) of the other.
+                        const int newLeft = positive ? 0 : 1, newRight = positive ? 3 : 2;
+                        const int oldLeft = positive ? 1 : 0, oldRight = positive ? 2 : 3;
+                        current[newLeft] = previous[oldLeft];
+                        current[newRight] = previous[oldRight];
+                        cornerShared[newLeft] = cornerShared[newRight] = true;
+                    }
+                }
+
+                const AZStd::array<AZ::Vector3, 4> corners = { AZ::Vector3(minCorner.GetX(), minCorner.GetY(), 0.0f),
+                                                               AZ::Vector3(minCorner.GetX(), maxCorner.GetY(), 0.0f),
+                                                               AZ::Vector3(maxCorner.GetX(), maxCorner.GetY(), 0.0f),
+                                                               AZ::Vector3(maxCorner.GetX(), minCorner.GetY(), 0.0f) };
+                for (size_t corner = 0; corner < corners.size(); corner++)
+                {
+                    if (!cornerShared[corner])
+                    {
+                        gridSquare.m_cornerIndices[corner] = aznumeric_cast<uint32_t>(cornerPositions.size());
+                        cornerPositions.push_back(corners[corner]);
+                    }
+                }
+                gridSquares.push_back(gridSquare);
+
+                lastStep = traversal.Step();
+            }
+
+            // If the ray passes entirely above or below the terrain under this run of squares, none of them can contain a hit,
+            // so skip fetching their heights.
+            if ((numSquares > 0) && RayMissesTerrainHeightBounds(m_terrainSystem, rays[activeRay.m_rayIndex], runMin, runMax))
+            {
+                cornerPositions.erase(cornerPositions.begin() + runCornersBegin, cornerPositions.end());
+                gridSquares.erase(gridSquares.begin() + runSquaresBegin, gridSquares.end());
+            }
+
+            raySquaresEnd.push_back(gridSquares.size());
+        }
+
+        // Fetch the heights for every corner gathered in this pass with a single bulk query.
+        cornerHeights.resize(cornerPositions.size());
+        if (!cornerPositions.empty())
+        {
+            AzFramework::Terrain::TerrainQueryBuffers heightBuffers;
+            heightBuffers.m_heights = cornerHeights;
+            m_terrainSystem.QueryListIntoBuffers(
+                cornerPositions, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, heightBuffers,
+                AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        }
+
+        // Check the gathered squares for each ray in order, and keep the rays that haven't hit anything yet for the next pass.
+        size_t numStillActive = 0;
+        size_t squaresBegin = 0;
+        for (size_t activeIndex = 0; activeIndex < activeRays.size(); activeIndex++)
         {
-            curGridCorner += gridIncrementY;
-            tUntilNextBoundary += tDeltaY;
+            ActiveRay& activeRay = activeRays[activeIndex];
+            AzFramework::RenderGeometry::RayResult& rayIntersectionResult = outResults[activeRay.m_rayIndex];
+
+            for (size_t squareIndex = squaresBegin; squareIndex < raySquaresEnd[activeIndex]; squareIndex++)
+            {
+                const auto& cornerIndices = gridSquares[squareIndex].m_cornerIndices;
+                AZStd::array<AZ::Vector3, 4> points;
+                for (size_t corner = 0; corner < points.size(); corner++)
+                {
+                    points[corner] = cornerPositions[cornerIndices[corner]];
+                    points[corner].SetZ(cornerHeights[cornerIndices[corner]]);
+                }
+
+                FindNearestIntersection(points[0], points[1], points[2], points[3], activeRay.m_hitTester, rayIntersectionResult);
+                if (rayIntersectionResult)
+                {
+                    break;
+                }
+            }
+            squaresBegin = raySquaresEnd[activeIndex];
+
+            if (!rayIntersectionResult && (activeRay.m_traversal.GetRemainingSquares() > 0))
+            {
+                activeRays[numStillActive++] = activeRay;
+            }
         }
-        else
+        activeRays.erase(activeRays.begin() + numStillActive, activeRays.end());
+
+        squaresPerPass = AZStd::min(squaresPerPass * 2, MaxSquaresPerPass);
+    }
+
+    // Replace the triangle normals from the hits with higher-quality normals calculated by the terrain system,
+    // fetching all of them with a single bulk query.
+    AZStd::vector<size_t> hitIndices;
+    AZStd::vector<AZ::Vector3> hitPositions;
+    for (size_t rayIndex = 0; rayIndex < outResults.size(); rayIndex++)
+    {
+        if (outResults[rayIndex])
         {
-            curGridCorner += gridIncrementX;
-            tUntilNextBoundary += tDeltaX;
+            hitIndices.push_back(rayIndex);
+            hitPositions.push_back(outResults[rayIndex].m_worldPosition);
         }
     }
 
-    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
-    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
-    return rayIntersectionResult;
+    if (hitIndices.empty())
+    {
+        return;
+    }
+
+    AZStd::vector<AZ::Vector3> hitNormals(hitPositions.size());
+    AzFramework::Terrain::TerrainQueryBuffers normalBuffers;
+    normalBuffers.m_normals = hitNormals;
+    m_terrainSystem.QueryListIntoBuffers(
+        hitPositions, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Normals, normalBuffers,
+        AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+
+    for (size_t hit = 0; hit < hitIndices.size(); hit++)
+    {
+        AzFramework::RenderGeometry::RayResult& rayIntersectionResult = outResults[hitIndices[hit]];
+        rayIntersectionResult.m_worldNormal = hitNormals[hit];
+
+        // Return the distance in world space instead of in ray distance space.
+        rayIntersectionResult.m_distance =
+            rayIntersectionResult.m_worldPosition.GetDistance(rays[hitIndices[hit]].m_startWorldPosition);
+    }
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/span.h>
 #include <AzFramework/Render/IntersectorInterface.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +42,19 @@ namespace Terrain
         //! \ref AzFramework::RenderGeometry::RayIntersect
         AzFramework::RenderGeometry::RayResult RayIntersect(const AzFramework::RenderGeometry::RayRequest& ray) override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Intersect a list of rays with the terrain, tracing all of them together.
+        //! Each pass steps every unfinished ray through a run of grid squares, fetches the terrain heights
+        //! for all of those squares with a single bulk query, and then tests the squares for hits.
+        //! Runs of squares where the terrain's cached height bounds show that the ray passes entirely above or below the terrain
+        //! are skipped without fetching their heights.
+        //! This is safe to call from multiple threads at once.
+        //! \param[in] rays The rays to intersect with the terrain
+        //! \param[out] outResults The closest intersection for each ray, the same size as the rays list
+        void RayIntersect(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> outResults) const;
+
     protected:
         ////////////////////////////////////////////////////////////////////////////////////////////
         // RenderGeometry::IntersectorBus inherits from RenderGeometry::IntersectionNotifications,
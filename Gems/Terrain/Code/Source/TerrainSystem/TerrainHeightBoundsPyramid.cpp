@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainHeightBoundsPyramid.h>
+
+#include <AzCore/std/algorithm.h>
+#include <TerrainProfiler.h>
+
+namespace Terrain
+{
+    namespace
+    {
+        // Leaf indices beyond this range are clamped, so that the node and grid index calculations can't overflow.
+        constexpr float MaxLeafIndex = static_cast<float>(1 << 24);
+
+        int32_t ClampLeafIndex(float leafIndex)
+        {
+            return aznumeric_cast<int32_t>(AZStd::clamp(leafIndex, -MaxLeafIndex, MaxLeafIndex));
+        }
+
+        void MergeBounds(AzFramework::Terrain::FloatRange& inOutBounds, const AzFramework::Terrain::FloatRange& bounds)
+        {
+            if (!inOutBounds.IsValid())
+            {
+                inOutBounds = bounds;
+            }
+            else if (bounds.IsValid())
+            {
+                inOutBounds.m_min = AZStd::min(inOutBounds.m_min, bounds.m_min);
+                inOutBounds.m_max = AZStd::max(inOutBounds.m_max, bounds.m_max);
+            }
+        }
+    } // namespace
+
+    void TerrainHeightBoundsPyramid::SetQueryResolution(float queryResolution)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (queryResolution != m_queryResolution)
+        {
+            m_queryResolution = queryResolution;
+            ClearInternal();
+        }
+    }
+
+    void TerrainHeightBoundsPyramid::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        ClearInternal();
+    }
+
+    void TerrainHeightBoundsPyramid::ClearInternal()
+    {
+        m_generation++;
+        for (auto& nodes : m_levels)
+        {
+            nodes.clear();
+        }
+    }
+
+    void TerrainHeightBoundsPyramid::InvalidateRegion(const AZ::Aabb& dirtyRegion)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        if (!dirtyRegion.IsValid() || (m_queryResolution <= 0.0f))
+        {
+            ClearInternal();
+            return;
+        }
+
+        // Any leaves currently being computed might have queried heights in the dirty region, so they can't be stored either.
+        m_generation++;
+
+        // A leaf includes the grid points on all of its edges, so a region that starts exactly on the min edge of a leaf also
+        // changes the leaf before it.
+        const float leafWorldSize = m_queryResolution * BlockSize;
+        const int32_t minLeafX = ClampLeafIndex(ceilf(dirtyRegion.GetMin().GetX() / leafWorldSize) - 1.0f);
+        const int32_t minLeafY = ClampLeafIndex(ceilf(dirtyRegion.GetMin().GetY() / leafWorldSize) - 1.0f);
+        const int32_t maxLeafX = ClampLeafIndex(floorf(dirtyRegion.GetMax().GetX() / leafWorldSize));
+        const int32_t maxLeafY = ClampLeafIndex(floorf(dirtyRegion.GetMax().GetY() / leafWorldSize));
+
+        // Remove the overlapping leaves along with every node above them, since their bounds include the stale leaves.
+        for (int32_t level = 0; level <= MaxLevel; level++)
+        {
+            const int32_t nodeSize = 1 << level;
+            NodeMap& nodes = m_levels[level];
+            for (auto nodeIter = nodes.begin(); nodeIter != nodes.end();)
+            {
+                const int32_t nodeMinX = nodeIter->first.m_x * nodeSize;
+                const int32_t nodeMinY = nodeIter->first.m_y * nodeSize;
+                const bool overlaps = (nodeMinX <= maxLeafX) && ((nodeMinX + nodeSize - 1) >= minLeafX) && (nodeMinY <= maxLeafY) &&
+                    ((nodeMinY + nodeSize - 1) >= minLeafY);
+
+                if (overlaps)
+                {
+                    nodeIter = nodes.erase(nodeIter);
+                }
+                else
+                {
+                    ++nodeIter;
+                }
+            }
+        }
+    }
+
+    size_t TerrainHeightBoundsPyramid::GetNodeCount(int32_t level) const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return ((level >= 0) && (level <= MaxLevel)) ? m_levels[level].size() : 0;
+    }
+
+    AzFramework::Terrain::FloatRange TerrainHeightBoundsPyramid::GetHeightBounds(
+        const AZ::Aabb& region, const HeightQueryFunction& queryHeights) const
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        NodeMap computedLeaves;
+        AZ::u64 generation = 0;
+        float queryResolution = 0.0f;
+
+        // Each pass gathers the leaves that are missing, computes them without holding the lock, and stores them if nothing was
+        // invalidated in the meantime. Leaves that couldn't be stored are still used to answer this query.
+        while (true)
+        {
+            AZStd::vector<NodeKey> missingLeaves;
+            {
+                AZStd::scoped_lock lock(m_mutex);
+
+                if (queryResolution != m_queryResolution)
+                {
+                    computedLeaves.clear();
+                }
+                else if (generation == m_generation)
+                {
+                    for (const auto& [key, bounds] : computedLeaves)
+                    {
+                        m_levels[0].emplace(key, bounds);
+                    }
+                }
+
+                LeafRange range;
+                if (!GetLeafRange(region, range))
+                {
+                    return AzFramework::Terrain::FloatRange::CreateNull();
+                }
+
+                AzFramework::Terrain::FloatRange bounds;
+                if (GetRangeBounds(range, computedLeaves, bounds, &missingLeaves))
+                {
+                    return bounds;
+                }
+
+                generation = m_generation;
+                queryResolution = m_queryResolution;
+            }
+
+            ComputeLeaves(missingLeaves, queryResolution, queryHeights, computedLeaves);
+        }
+    }
+
+    bool TerrainHeightBoundsPyramid::GetCachedHeightBounds(const AZ::Aabb& region, AzFramework::Terrain::FloatRange& outBounds) const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        LeafRange range;
+        if (!GetLeafRange(region, range))
+        {
+            return false;
+        }
+
+        return GetRangeBounds(range, {}, outBounds, nullptr);
+    }
+
+    bool TerrainHeightBoundsPyramid::GetLeafRange(const AZ::Aabb& region, LeafRange& outRange) const
+    {
+        if (!region.IsValid() || (m_queryResolution <= 0.0f))
+        {
+            return false;
+        }
+
+        // A region edge that lies exactly on a leaf edge only needs one of the two leaves, since both include the grid points there.
+        const float leafWorldSize = m_queryResolution * BlockSize;
+        outRange.m_minX = ClampLeafIndex(floorf(region.GetMin().GetX() / leafWorldSize));
+        outRange.m_minY = ClampLeafIndex(floorf(region.GetMin().GetY() / leafWorldSize));
+        outRange.m_maxX = AZStd::max(outRange.m_minX, ClampLeafIndex(ceilf(region.GetMax().GetX() / leafWorldSize) - 1.0f));
+        outRange.m_maxY = AZStd::max(outRange.m_minY, ClampLeafIndex(ceilf(region.GetMax().GetY() / leafWorldSize) - 1.0f));
+        return true;
+    }
+
+    bool TerrainHeightBoundsPyramid::GetRangeBounds(
+        const LeafRange& range, const NodeMap& computedLeaves,
+        AzFramework::Terrain::FloatRange& outBounds, AZStd::vector<NodeKey>* outMissingLeaves) const
+    {
+        // Start at the lowest level where a couple of nodes along each side cover the entire range.
+        const int32_t extent = AZStd::max(range.m_maxX - range.m_minX, range.m_maxY - range.m_minY) + 1;
+        int32_t level = 0;
+        while ((level < MaxLevel) && ((1 << level) < extent))
+        {
+            level++;
+        }
+
+        const int32_t nodeSize = 1 << level;
+        outBounds = AzFramework::Terrain::FloatRange::CreateNull();
+        bool found = true;
+        for (int32_t y = FloorDivide(range.m_minY, nodeSize); y <= FloorDivide(range.m_maxY, nodeSize); y++)
+        {
+            for (int32_t x = FloorDivide(range.m_minX, nodeSize); x <= FloorDivide(range.m_maxX, nodeSize); x++)
+            {
+                // Keep going after a missing leaf so that every missing leaf gets gathered in a single pass.
+                found = MergeRangeBounds(level, { x, y }, range, computedLeaves, outBounds, outMissingLeaves) && found;
+            }
+        }
+        return found;
+    }
+
+    bool TerrainHeightBoundsPyramid::MergeRangeBounds(
+        int32_t level, const NodeKey& key, const LeafRange& range, const NodeMap& computedLeaves,
+        AzFramework::Terrain::FloatRange& inOutBounds, AZStd::vector<NodeKey>* outMissingLeaves) const
+    {
+        const int32_t nodeSize = 1 << level;
+        const int32_t nodeMinX = key.m_x * nodeSize;
+        const int32_t nodeMinY = key.m_y * nodeSize;
+        const int32_t nodeMaxX = nodeMinX + nodeSize - 1;
+        const int32_t nodeMaxY = nodeMinY + nodeSize - 1;
+
+        if ((nodeMaxX < range.m_minX) || (nodeMinX > range.m_maxX) || (nodeMaxY < range.m_minY) || (nodeMinY > range.m_maxY))
+        {
+            return true;
+        }
+
+        const bool contained =
+            (nodeMinX >= range.m_minX) && (nodeMaxX <= range.m_maxX) && (nodeMinY >= range.m_minY) && (nodeMaxY <= range.m_maxY);
+        if (contained)
+        {
+            AzFramework::Terrain::FloatRange nodeBounds;
+            bool storable = true;
+            if (!GetNodeBounds(level, key, computedLeaves, nodeBounds, storable, outMissingLeaves))
+            {
+                return false;
+            }
+            MergeBounds(inOutBounds, nodeBounds);
+            return true;
+        }
+
+        // The node is only partially inside the range, so only its children that overlap the range contribute to the bounds.
+        bool found = true;
+        for (int32_t childY = 0; childY < 2; childY++)
+        {
+            for (int32_t childX = 0; childX < 2; childX++)
+            {
+                const NodeKey childKey = { (key.m_x * 2) + childX, (key.m_y * 2) + childY };
+                found = MergeRangeBounds(level - 1, childKey, range, computedLeaves, inOutBounds, outMissingLeaves) && found;
+            }
+        }
+        return found;
+    }
+
+    bool TerrainHeightBoundsPyramid::GetNodeBounds(
+        int32_t level, const NodeKey& key, const NodeMap& computedLeaves,
+        AzFramework::Terrain::FloatRange& outBounds, bool& outStorable, AZStd::vector<NodeKey>* outMissingLeaves) const
+    {
+        if (auto nodeIter = m_levels[level].find(key); nodeIter != m_levels[level].end())
+        {
+            outBounds = nodeIter->second;
+            outStorable = true;
+            return true;
+        }
+
+        if (level == 0)
+        {
+            if (auto leafIter = computedLeaves.find(key); leafIter != computedLeaves.end())
+            {
+                outBounds = leafIter->second;
+                outStorable = false;
+                return true;
+            }
+
+            if (outMissingLeaves)
+            {
+                outMissingLeaves->push_back(key);
+            }
+            return false;
+        }
+
+        outBounds = AzFramework::Terrain::FloatRange::CreateNull();
+        outStorable = true;
+        bool found = true;
+        for (int32_t childY = 0; childY < 2; childY++)
+        {
+            for (int32_t childX = 0; childX < 2; childX++)
+            {
+                const NodeKey childKey = { (key.m_x * 2) + childX, (key.m_y * 2) + childY };
+                AzFramework::Terrain::FloatRange childBounds;
+                bool childStorable = true;
+                if (GetNodeBounds(level - 1, childKey, computedLeaves, childBounds, childStorable, outMissingLeaves))
+                {
+                    MergeBounds(outBounds, childBounds);
+                    outStorable = outStorable && childStorable;
+                }
+                else
+                {
+                    found = false;
+                }
+            }
+        }
+
+        if (found && outStorable)
+        {
+            m_levels[level].emplace(key, outBounds);
+        }
+        return found;
+    }
+
+    void TerrainHeightBoundsPyramid::ComputeLeaves(
+        AZStd::span<const NodeKey> leaves, float queryResolution, const HeightQueryFunction& queryHeights,
+        NodeMap& outComputedLeaves) const
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        // A leaf includes the grid points on all 4 of its edges, so that its bounds cover every grid square inside it.
+        constexpr int32_t PointsPerSide = BlockSize + 1;
+        constexpr size_t PointsPerLeaf = PointsPerSide * PointsPerSide;
+
+        // Query the heights for a limited number of leaves at a time so that large regions don't need all of their heights in
+        // memory at once.
+        constexpr size_t LeavesPerBatch = 64;
+
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<float> heights;
+        positions.reserve(AZStd::min(leaves.size(), LeavesPerBatch) * PointsPerLeaf);
+
+        for (size_t batchStart = 0; batchStart < leaves.size(); batchStart += LeavesPerBatch)
+        {
+            const size_t batchEnd = AZStd::min(batchStart + LeavesPerBatch, leaves.size());
+
+            positions.clear();
+            for (size_t leafIndex = batchStart; leafIndex < batchEnd; leafIndex++)
+            {
+                const NodeKey& leaf = leaves[leafIndex];
+                for (int32_t y = 0; y < PointsPerSide; y++)
+                {
+                    const float gridY = aznumeric_cast<float>((leaf.m_y * BlockSize) + y);
+                    for (int32_t x = 0; x < PointsPerSide; x++)
+                    {
+                        const float gridX = aznumeric_cast<float>((leaf.m_x * BlockSize) + x);
+                        positions.emplace_back(gridX * queryResolution, gridY * queryResolution, 0.0f);
+                    }
+                }
+            }
+
+            heights.resize(positions.size());
+            queryHeights(positions, heights);
+
+            for (size_t leafIndex = batchStart; leafIndex < batchEnd; leafIndex++)
+            {
+                const float* leafHeights = heights.data() + ((leafIndex - batchStart) * PointsPerLeaf);
+                AzFramework::Terrain::FloatRange bounds = { leafHeights[0], leafHeights[0] };
+                for (size_t point = 1; point < PointsPerLeaf; point++)
+                {
+                    bounds.m_min = AZStd::min(bounds.m_min, leafHeights[point]);
+                    bounds.m_max = AZStd::max(bounds.m_max, leafHeights[point]);
+                }
+                outComputedLeaves[leaves[leafIndex]] = bounds;
+            }
+        }
+    }
+} // namespace Terrain
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
+
+namespace Terrain
+{
+    //! Keeps a pyramid of min/max terrain heights over square blocks of the height query grid, so that callers can get tight
+    //! height bounds for a region without querying every height in it.
+    //! Each leaf node covers BlockSize x BlockSize grid squares and holds the range of the heights at every grid point on or inside
+    //! its edges. Points with no terrain are included with whatever height the terrain system returns for them, since raycasts
+    //! use those heights too. Each level above the leaves merges 2 x 2 nodes of the level below, up to MaxLevel.
+    //! Nodes are computed on demand, and a change to the heights in a region only removes the nodes that overlap it, so only the
+    //! dirty part of the pyramid ever needs to be recomputed.
+    //! All methods are safe to call from multiple threads at once.
+    class TerrainHeightBoundsPyramid
+    {
+    public:
+        //! The number of grid squares along each side of a leaf node.
+        static constexpr int32_t BlockSize = 32;
+
+        //! The highest level in the pyramid. A node at this level covers 2^MaxLevel leaf nodes along each side.
+        static constexpr int32_t MaxLevel = 8;
+
+        //! Queries the terrain heights for a list of grid positions.
+        using HeightQueryFunction = AZStd::function<void(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outHeights)>;
+
+        //! Sets the distance between grid points. Changing the resolution clears the pyramid.
+        void SetQueryResolution(float queryResolution);
+
+        //! Removes every node from the pyramid.
+        void Clear();
+
+        //! Removes every node that contains a grid point inside the given region in XY. An invalid region clears the entire pyramid.
+        void InvalidateRegion(const AZ::Aabb& dirtyRegion);
+
+        //! Returns the number of computed nodes at the given level of the pyramid.
+        size_t GetNodeCount(int32_t level) const;
+
+        //! Gets the range of the terrain heights in the XY area of a region, computing any missing nodes with the given height query.
+        //! The range covers every leaf node that the region touches, so it can be wider than the exact range inside the region.
+        //! Returns a null range if the region or the query resolution isn't valid.
+        AzFramework::Terrain::FloatRange GetHeightBounds(const AZ::Aabb& region, const HeightQueryFunction& queryHeights) const;
+
+        //! Gets the range of the terrain heights in the XY area of a region using only the nodes that have already been computed.
+        //! Returns false if part of the region hasn't been computed yet.
+        bool GetCachedHeightBounds(const AZ::Aabb& region, AzFramework::Terrain::FloatRange& outBounds) const;
+
+    private:
+        struct NodeKey
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+
+            bool operator==(const NodeKey& rhs) const
+            {
+                return (m_x == rhs.m_x) && (m_y == rhs.m_y);
+            }
+        };
+
+        struct NodeKeyHash
+        {
+            size_t operator()(const NodeKey& key) const
+            {
+                size_t seed = 0;
+                AZStd::hash_combine(seed, key.m_x, key.m_y);
+                return seed;
+            }
+        };
+
+        using NodeMap = AZStd::unordered_map<NodeKey, AzFramework::Terrain::FloatRange, NodeKeyHash>;
+
+        //! An inclusive range of leaf node indices.
+        struct LeafRange
+        {
+            int32_t m_minX = 0;
+            int32_t m_minY = 0;
+            int32_t m_maxX = 0;
+            int32_t m_maxY = 0;
+        };
+
+        //! Gets the leaf nodes whose world space bounds overlap the region in XY. Returns false if the region isn't valid.
+        bool GetLeafRange(const AZ::Aabb& region, LeafRange& outRange) const;
+
+        //! Merges the bounds of every node under the given node that is inside the leaf range into the output bounds.
+        //! Leaves that haven't been computed are looked up in the computed leaves, and otherwise added to the missing leaves.
+        //! Returns false if any leaf was missing. The mutex must be held when calling this.
+        bool MergeRangeBounds(
+            int32_t level, const NodeKey& key, const LeafRange& range, const NodeMap& computedLeaves,
+            AzFramework::Terrain::FloatRange& inOutBounds, AZStd::vector<NodeKey>* outMissingLeaves) const;
+
+        //! Gets the bounds of an entire node, computing and storing it from its children if needed.
+        //! outStorable is set to false if any of the leaves only came from the computed leaves, which means that the bounds might be
+        //! stale and can't be stored. Returns false if any leaf was missing. The mutex must be held when calling this.
+        bool GetNodeBounds(
+            int32_t level, const NodeKey& key, const NodeMap& computedLeaves,
+            AzFramework::Terrain::FloatRange& outBounds, bool& outStorable, AZStd::vector<NodeKey>* outMissingLeaves) const;
+
+        //! Merges the bounds of every top level node that overlaps the leaf range. The mutex must be held when calling this.
+        bool GetRangeBounds(
+            const LeafRange& range, const NodeMap& computedLeaves,
+            AzFramework::Terrain::FloatRange& outBounds, AZStd::vector<NodeKey>* outMissingLeaves) const;
+
+        //! Removes every node from the pyramid. The mutex must be held when calling this.
+        void ClearInternal();
+
+        //! Queries the heights for the given leaves and computes their bounds.
+        void ComputeLeaves(
+            AZStd::span<const NodeKey> leaves, float queryResolution, const HeightQueryFunction& queryHeights,
+            NodeMap& outComputedLeaves) const;
+
+        static int32_t FloorDivide(int32_t value, int32_t divisor)
+        {
+            return (value >= 0) ? (value / divisor) : ((value - divisor + 1) / divisor);
+        }
+
+        mutable AZStd::mutex m_mutex;
+        mutable AZStd::array<NodeMap, MaxLevel + 1> m_levels;
+        float m_queryResolution = 1.0f;
+
+        //! Bumped by Clear() and InvalidateRegion(). GetHeightBounds() computes leaves without holding the mutex, and only stores them
+        //! if this still matches the value from before the heights were queried.
+        AZ::u64 m_generation = 0;
+    };
+} // namespace Terrain
@@ -7,6 +7,9 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +28,23 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+AZ_CVAR(
+    uint32_t,
+    terrain_heightTileCacheMaxTiles,
+    0,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of baked 32x32 tiles of height data that the terrain system keeps in memory. 0 disables the height cache.");
+
+AZ_CVAR(
+    uint32_t,
+    terrain_surfaceTileCacheMaxTiles,
+    0,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of baked 32x32 tiles of surface weight data that the terrain system keeps in memory. "
+    "0 disables the surface weight cache.");
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -69,6 +89,9 @@ TerrainSystem::TerrainSystem()
     // Use the global JobManager for terrain jobs (we could create our own dedicated terrain JobManager if needed).
     AZ::JobManagerBus::BroadcastResult(m_terrainJobManager, &AZ::JobManagerEvents::GetManager);
     AZ_Assert(m_terrainJobManager, "No global JobManager found.");
+
+    m_heightTileCache.SetMaxTiles(terrain_heightTileCacheMaxTiles);
+    m_surfaceTileCache.SetMaxTiles(terrain_surfaceTileCacheMaxTiles);
 }
 
 TerrainSystem::~TerrainSystem()
@@ -94,6 +117,10 @@ void TerrainSystem::Activate()
         m_registeredAreas.clear();
     }
 
+    m_heightTileCache.Clear();
+    m_surfaceTileCache.Clear();
+    m_heightBoundsPyramid.Clear();
+
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusConnect();
 
     // Register any terrain spawners that were already active before the terrain system activated.
@@ -135,6 +162,16 @@ void TerrainSystem::Deactivate()
         m_registeredAreas.clear();
     }
 
+    m_heightTileCache.Clear();
+    m_surfaceTileCache.Clear();
+    m_heightBoundsPyramid.Clear();
+
+    {
+        AZStd::scoped_lock lock(m_pendingTileBakesMutex);
+        m_pendingHeightTileBakes.m_tiles.clear();
+        m_pendingSurfaceTileBakes.m_tiles.clear();
+    }
+
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
@@ -183,6 +220,17 @@ AzFramework::Terrain::FloatRange TerrainSystem::GetTerrainHeightBounds() const
     return m_currentSettings.m_heightRange;
 }
 
+AzFramework::Terrain::FloatRange TerrainSystem::GetTerrainHeightBoundsInRegion(const AZ::Aabb& region) const
+{
+    return m_heightBoundsPyramid.GetHeightBounds(
+        region,
+        [this](AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outHeights)
+        {
+            AZStd::vector<bool> terrainExists(positions.size());
+            GetHeightsSynchronous(positions, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, outHeights, terrainExists);
+        });
+}
+
 float TerrainSystem::GetTerrainHeightQueryResolution() const
 {
     return m_currentSettings.m_heightQueryResolution;
@@ -447,7 +495,171 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
 
-    auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
+    // Any query positions on the height query grid can come from the baked height tiles.
+    GetHeightsFromTileCache(outPositions, outTerrainExists);
+
+    // Compute/store the final result
+    for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
+    {
+        switch(sampler)
+        {
+        case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
+            {
+                // We now need to compute the final height after all the bulk queries are done.
+                AZ::Vector2 normalizedDelta;
+                AZ::Vector2 clampedPosition;
+                ClampPosition(inPositions[i].GetX(), inPositions[i].GetY(), queryResolution, clampedPosition, normalizedDelta);
+                AZStd::array<float,4> queriedHeights = { outPositions[iteratorIndex].GetZ(),
+                                     outPositions[iteratorIndex + 1].GetZ(),
+                                     outPositions[iteratorIndex + 2].GetZ(),
+                                     outPositions[iteratorIndex + 3].GetZ() };
+                AZStd::array<bool, 4> queriedExistsFlags = { outTerrainExists[iteratorIndex],
+                    outTerrainExists[iteratorIndex + 1],
+                    outTerrainExists[iteratorIndex + 2],
+                    outTerrainExists[iteratorIndex + 3]};
+
+                InterpolateHeights(queriedHeights, queriedExistsFlags,
+                    normalizedDelta.GetX(), normalizedDelta.GetY(), heights[i], terrainExists[i]);
+            }
+            break;
+        case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
+            [[fallthrough]];
+        case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
+            [[fallthrough]];
+        default:
+            // For clamp and exact, we just need to store the results of the bulk query.
+            heights[i] = outPositions[iteratorIndex].GetZ();
+            terrainExists[i] = outTerrainExists[iteratorIndex];
+            break;
+        }
+    }
+}
+
+template<typename TileCacheType>
+typename TileCacheType::LookupSettings TerrainSystem::GetTileLookupSettings(float queryResolution)
+{
+    // Queries only line up with the baked tiles when they use the query grid exactly, and only queries that cover most of a tile
+    // cause it to get baked, so scattered point queries don't fill the cache with tiles that nothing reads again.
+    typename TileCacheType::LookupSettings settings;
+    settings.m_sampleSpacing = queryResolution;
+    settings.m_minPositionsPerMissingTile = TileCacheType::TileSize;
+    settings.m_reserveMissingTiles = true;
+    return settings;
+}
+
+template<typename TileKeyType>
+void TerrainSystem::QueueTileBakes(
+    PendingTileBakes<TileKeyType>& pendingBakes, const AZStd::vector<TileKeyType>& tilesToBake, AZ::u64 generation) const
+{
+    if (tilesToBake.empty())
+    {
+        return;
+    }
+
+    AZStd::scoped_lock lock(m_pendingTileBakesMutex);
+
+    // Every cache invalidation increments the generation and forgets about the tiles requested before it, so only the tiles from
+    // the most recent generation are worth baking.
+    if (generation > pendingBakes.m_generation)
+    {
+        pendingBakes.m_tiles.clear();
+        pendingBakes.m_generation = generation;
+    }
+
+    if (generation == pendingBakes.m_generation)
+    {
+        pendingBakes.m_tiles.insert(pendingBakes.m_tiles.end(), tilesToBake.begin(), tilesToBake.end());
+    }
+}
+
+void TerrainSystem::StartPendingTileBakes()
+{
+    PendingTileBakes<HeightTileCache::TileKey> heightTileBakes;
+    PendingTileBakes<SurfaceTileCache::TileKey> surfaceTileBakes;
+    {
+        AZStd::scoped_lock lock(m_pendingTileBakesMutex);
+        heightTileBakes.m_generation = m_pendingHeightTileBakes.m_generation;
+        heightTileBakes.m_tiles.swap(m_pendingHeightTileBakes.m_tiles);
+        surfaceTileBakes.m_generation = m_pendingSurfaceTileBakes.m_generation;
+        surfaceTileBakes.m_tiles.swap(m_pendingSurfaceTileBakes.m_tiles);
+    }
+
+    BakeHeightTiles(heightTileBakes.m_tiles, heightTileBakes.m_generation);
+    BakeSurfaceTiles(surfaceTileBakes.m_tiles, surfaceTileBakes.m_generation);
+}
+
+template<typename TileCacheType, typename BakeFunction>
+void TerrainSystem::BakeTilesAsync(
+    TileCacheType& tileCache,
+    const AZStd::vector<typename TileCacheType::TileKey>& tilesToBake,
+    AZ::u64 generation,
+    BakeFunction bakeFunction) const
+{
+    if (tilesToBake.empty())
+    {
+        return;
+    }
+
+    if (!m_terrainJobManager)
+    {
+        for (const auto& tileKey : tilesToBake)
+        {
+            tileCache.CancelTile(tileKey, generation);
+        }
+        return;
+    }
+
+    // Create a terrain job context and track it, so that deactivating the terrain system cancels and waits for the bakes.
+    AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext =
+        AZStd::make_shared<AzFramework::Terrain::TerrainJobContext>(*m_terrainJobManager, aznumeric_cast<int>(tilesToBake.size()));
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+        m_activeTerrainJobContexts.push_back(jobContext);
+    }
+
+    for (const auto& tileKey : tilesToBake)
+    {
+        auto jobFunction = [this, &tileCache, tileKey, generation, bakeFunction, jobContext]()
+        {
+            // Bake the tile, unless the associated job context has been cancelled.
+            if (jobContext->IsCancelled())
+            {
+                tileCache.CancelTile(tileKey, generation);
+            }
+            else
+            {
+                tileCache.StoreTile(tileKey, bakeFunction(tileKey), generation);
+            }
+
+            // Remove this TerrainJobContext from the list of active ones once the final tile is done.
+            if (jobContext->OnJobCompleted())
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+                m_activeTerrainJobContexts.erase(
+                    AZStd::find(m_activeTerrainJobContexts.begin(), m_activeTerrainJobContexts.end(), jobContext));
+                m_activeTerrainJobContextMutexConditionVariable.notify_one();
+            }
+        };
+
+        // Create the job and start it immediately.
+        AZ::Job* bakeJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get());
+        bakeJob->Start();
+    }
+}
+
+void TerrainSystem::QueryHeightsFromAreas(
+    AZStd::span<AZ::Vector3> inOutPositions,
+    AZStd::span<bool> outTerrainExists,
+    const AzFramework::Terrain::FloatRange& heightRange) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (inOutPositions.empty())
+    {
+        return;
+    }
+
+    auto callback = [this, &heightRange]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
                         AZStd::span<AZ::Vector3> outPositions,
                         AZStd::span<bool> outTerrainExists,
                         [[maybe_unused]] AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
@@ -465,8 +677,8 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
                             {
                                 const float areaMin = AZStd::clamp(
                                     area->second.m_areaBounds.GetMin().GetZ(),
-                                    m_currentSettings.m_heightRange.m_min,
-                                    m_currentSettings.m_heightRange.m_max);
+                                    heightRange.m_min,
+                                    heightRange.m_max);
 
                                 for (size_t index = 0; index < outPositions.size(); index++)
                                 {
@@ -481,43 +693,88 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     // This will be unused for heights. It's fine if it's empty.
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    MakeBulkQueries(inOutPositions, inOutPositions, outTerrainExists, outSurfaceWeights, callback);
+}
 
-    // Compute/store the final result
-    for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
+void TerrainSystem::GetHeightsFromTileCache(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> outTerrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (!m_heightTileCache.IsEnabled())
     {
-        switch(sampler)
+        QueryHeightsFromAreas(inOutPositions, outTerrainExists, m_currentSettings.m_heightRange);
+        return;
+    }
+
+    AZStd::vector<CachedHeight> cachedHeights(inOutPositions.size());
+    AZStd::vector<bool> cachedHeightFound(inOutPositions.size());
+    AZStd::vector<HeightTileCache::TileKey> tilesToBake;
+    const AZ::u64 generation = m_heightTileCache.Lookup(
+        GetTileLookupSettings<HeightTileCache>(m_currentSettings.m_heightQueryResolution), inOutPositions, cachedHeights,
+        cachedHeightFound, tilesToBake);
+
+    // Copy out the cached heights and gather up the positions that still need to be queried from the terrain areas.
+    AZStd::vector<size_t> uncachedIndices;
+    for (size_t index = 0; index < inOutPositions.size(); index++)
+    {
+        if (cachedHeightFound[index])
         {
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
-            {
-                // We now need to compute the final height after all the bulk queries are done.
-                AZ::Vector2 normalizedDelta;
-                AZ::Vector2 clampedPosition;
-                ClampPosition(inPositions[i].GetX(), inPositions[i].GetY(), queryResolution, clampedPosition, normalizedDelta);
-                AZStd::array<float,4> queriedHeights = { outPositions[iteratorIndex].GetZ(),
-                                     outPositions[iteratorIndex + 1].GetZ(),
-                                     outPositions[iteratorIndex + 2].GetZ(),
-                                     outPositions[iteratorIndex + 3].GetZ() };
-                AZStd::array<bool, 4> queriedExistsFlags = { outTerrainExists[iteratorIndex],
-                    outTerrainExists[iteratorIndex + 1],
-                    outTerrainExists[iteratorIndex + 2],
-                    outTerrainExists[iteratorIndex + 3]};
+            inOutPositions[index].SetZ(cachedHeights[index].m_height);
+            outTerrainExists[index] = cachedHeights[index].m_exists;
+        }
+        else
+        {
+            uncachedIndices.push_back(index);
+        }
+    }
 
-                InterpolateHeights(queriedHeights, queriedExistsFlags,
-                    normalizedDelta.GetX(), normalizedDelta.GetY(), heights[i], terrainExists[i]);
-            }
-            break;
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
-            [[fallthrough]];
-        case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
-            [[fallthrough]];
-        default:
-            // For clamp and exact, we just need to store the results of the bulk query.
-            heights[i] = outPositions[iteratorIndex].GetZ();
-            terrainExists[i] = outTerrainExists[iteratorIndex];
-            break;
+    if (uncachedIndices.size() == inOutPositions.size())
+    {
+        QueryHeightsFromAreas(inOutPositions, outTerrainExists, m_currentSettings.m_heightRange);
+    }
+    else if (!uncachedIndices.empty())
+    {
+        AZStd::vector<AZ::Vector3> uncachedPositions(uncachedIndices.size());
+        AZStd::vector<bool> uncachedTerrainExists(uncachedIndices.size());
+        for (size_t index = 0; index < uncachedIndices.size(); index++)
+        {
+            uncachedPositions[index] = inOutPositions[uncachedIndices[index]];
+            uncachedTerrainExists[index] = outTerrainExists[uncachedIndices[index]];
+        }
+
+        QueryHeightsFromAreas(uncachedPositions, uncachedTerrainExists, m_currentSettings.m_heightRange);
+
+        for (size_t index = 0; index < uncachedIndices.size(); index++)
+        {
+            inOutPositions[uncachedIndices[index]] = uncachedPositions[index];
+            outTerrainExists[uncachedIndices[index]] = uncachedTerrainExists[index];
         }
     }
+
+    QueueTileBakes(m_pendingHeightTileBakes, tilesToBake, generation);
+}
+
+void TerrainSystem::BakeHeightTiles(const AZStd::vector<HeightTileCache::TileKey>& tilesToBake, AZ::u64 generation) const
+{
+    // The settings can change on the main thread while the bake jobs run, so the jobs get their own copy of the height range.
+    // If the settings do change, the tile cache gets cleared and the baked tiles are discarded.
+    BakeTilesAsync(
+        m_heightTileCache, tilesToBake, generation,
+        [this, heightRange = m_currentSettings.m_heightRange](const HeightTileCache::TileKey& tileKey)
+        {
+            // Bake the tile with exactly the same query positions that GetHeightsSynchronous() would use for the tile's grid points.
+            AZStd::vector<AZ::Vector3> positions;
+            HeightTileCache::GetTilePositions(tileKey, heightRange.m_min, positions);
+            AZStd::vector<bool> terrainExists(positions.size(), false);
+            QueryHeightsFromAreas(positions, terrainExists, heightRange);
+
+            AZStd::vector<CachedHeight> samples(positions.size());
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                samples[index] = { positions[index].GetZ(), terrainExists[index] };
+            }
+            return samples;
+        });
 }
 
 float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const
@@ -1102,6 +1359,19 @@ AzFramework::RenderGeometry::RayResult TerrainSystem::GetClosestIntersection(
     return m_terrainRaycastContext.RayIntersect(ray);
 }
 
+void TerrainSystem::GetClosestIntersections(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> outResults) const
+{
+    if (rays.size() != outResults.size())
+    {
+        AZ_Error("TerrainSystem", false, "The results list needs one entry per ray: %zu vs %zu.", outResults.size(), rays.size());
+        return;
+    }
+
+    m_terrainRaycastContext.RayIntersect(rays, outResults);
+}
+
 AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::QueryListAsync(
     const AZStd::span<const AZ::Vector3>& inPositions,
     TerrainDataMask requestedData,
@@ -1232,7 +1502,7 @@ AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::QueryR
             };
 
             // Create the job and start it immediately.
-            AZ::Job* processJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get());
+            AZ::Job* processJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get(), GetJobPriority(params));
             processJob->Start();
             jobsStarted++;
         }
@@ -1244,6 +1514,225 @@ AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::QueryR
     return jobContext;
 }
 
+AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::QueryListIntoBuffersAsync(
+    const AZStd::span<const AZ::Vector3>& inPositions,
+    TerrainDataMask requestedData,
+    const AzFramework::Terrain::TerrainQueryBuffers& outBuffers,
+    Sampler sampler,
+    AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params) const
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    const int32_t numPositionsToProcess = static_cast<int32_t>(inPositions.size());
+
+    if (numPositionsToProcess == 0)
+    {
+        AZ_Warning("TerrainSystem", false, "No positions to process.");
+        return nullptr;
+    }
+
+    if (!ValidateQueryBuffers(inPositions.size(), requestedData, outBuffers))
+    {
+        return nullptr;
+    }
+
+    // Requests with a completion event run on the task graph so that the event gets signaled when the tasks finish.
+    AZ::TaskGraphEvent* completionEvent = params ? params->m_completionEvent : nullptr;
+    if (completionEvent)
+    {
+        auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActive || !taskGraphActive->IsTaskGraphActive())
+        {
+            AZ_Error("TerrainSystem", false, "A completion event was requested, but the task graph system isn't active.");
+            return nullptr;
+        }
+    }
+
+    // Determine the maximum number of jobs, and the minimum number of positions that should be processed per job.
+    const int32_t numJobsMax = CalculateMaxJobs(params);
+    const int32_t minPositionsPerJob = params && (params->m_minPositionsPerJob > 0)
+        ? params->m_minPositionsPerJob
+        : AzFramework::Terrain::QueryAsyncParams::MinPositionsPerJobDefault;
+    const int32_t numJobs = AZStd::clamp(numPositionsToProcess / minPositionsPerJob, 1, numJobsMax);
+
+    // Create a terrain job context and track it. Task graph requests also use it, so that they can be cancelled
+    // and waited on in the same way as the job requests.
+    AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext =
+        AZStd::make_shared<AzFramework::Terrain::TerrainJobContext>(*m_terrainJobManager, numJobs);
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+        m_activeTerrainJobContexts.push_back(jobContext);
+    }
+
+    auto processRangeFunction = [this, inPositions, requestedData, outBuffers, sampler, jobContext, params](size_t offset, size_t count)
+    {
+        // Process the range of positions, unless the associated job context has been cancelled.
+        if (!jobContext->IsCancelled())
+        {
+            auto bufferRange = [offset, count](auto buffer)
+            {
+                return buffer.empty() ? buffer : buffer.subspan(offset, count);
+            };
+
+            AzFramework::Terrain::TerrainQueryBuffers rangeBuffers;
+            rangeBuffers.m_heights = bufferRange(outBuffers.m_heights);
+            rangeBuffers.m_normals = bufferRange(outBuffers.m_normals);
+            rangeBuffers.m_surfaceWeights = bufferRange(outBuffers.m_surfaceWeights);
+            rangeBuffers.m_terrainExists = bufferRange(outBuffers.m_terrainExists);
+
+            QueryListIntoBuffers(inPositions.subspan(offset, count), requestedData, rangeBuffers, sampler);
+
+            if (params && params->m_rangeFilledCallback)
+            {
+                params->m_rangeFilledCallback(offset, count);
+            }
+        }
+
+        // Decrement the number of completions remaining, invoke the completion callback if this happens
+        // to be the final job completed, and remove this TerrainJobContext from the list of active ones.
+        const bool wasLastJobCompleted = jobContext->OnJobCompleted();
+        if (wasLastJobCompleted)
+        {
+            if (params && params->m_completionCallback)
+            {
+                params->m_completionCallback(jobContext);
+            }
+
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+                m_activeTerrainJobContexts.erase(
+                    AZStd::find(m_activeTerrainJobContexts.begin(), m_activeTerrainJobContexts.end(), jobContext));
+                m_activeTerrainJobContextMutexConditionVariable.notify_one();
+            }
+        }
+    };
+
+    // Task lambdas can only capture a small amount of data, so all the jobs or tasks share a single copy of the range processing function.
+    auto processRange = AZStd::make_shared<decltype(processRangeFunction)>(AZStd::move(processRangeFunction));
+
+    const AZ::s8 priority = GetJobPriority(params);
+    const AZ::TaskDescriptor taskDescriptor{ "Terrain::QueryListIntoBuffersAsync", "Terrain",
+                                             (priority > 0) ? AZ::TaskPriority::HIGH
+                                                            : ((priority < 0) ? AZ::TaskPriority::LOW : AZ::TaskPriority::MEDIUM) };
+    AZ::TaskGraph taskGraph{ "Terrain::QueryListIntoBuffersAsync" };
+
+    const size_t numPositionsPerJob = numPositionsToProcess / numJobs;
+    for (int32_t i = 0; i < numJobs; ++i)
+    {
+        // If the number of positions can't be divided evenly by the number of jobs,
+        // ensure we still process the remaining positions along with the final job.
+        const size_t offset = i * numPositionsPerJob;
+        const size_t count = (i < numJobs - 1) ? numPositionsPerJob : (numPositionsToProcess - offset);
+
+        if (completionEvent)
+        {
+            taskGraph.AddTask(
+                taskDescriptor,
+                [processRange, offset, count]()
+                {
+                    (*processRange)(offset, count);
+                });
+        }
+        else
+        {
+            // Create the job and start it immediately.
+            auto jobFunction = [processRange, offset, count]()
+            {
+                (*processRange)(offset, count);
+            };
+            AZ::Job* processJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get(), priority);
+            processJob->Start();
+        }
+    }
+
+    if (completionEvent)
+    {
+        taskGraph.Detach();
+        taskGraph.Submit(completionEvent);
+    }
+
+    return jobContext;
+}
+
+AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::GetClosestIntersectionsAsync(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> outResults,
+    AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params) const
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    const int32_t numRaysToProcess = static_cast<int32_t>(rays.size());
+
+    if (numRaysToProcess == 0)
+    {
+        AZ_Warning("TerrainSystem", false, "No rays to process.");
+        return nullptr;
+    }
+
+    if (rays.size() != outResults.size())
+    {
+        AZ_Error("TerrainSystem", false, "The results list needs one entry per ray: %zu vs %zu.", outResults.size(), rays.size());
+        return nullptr;
+    }
+
+    // Determine the maximum number of jobs, and the minimum number of rays that should be processed per job.
+    const int32_t numJobsMax = CalculateMaxJobs(params);
+    const int32_t minRaysPerJob = params && (params->m_minPositionsPerJob > 0)
+        ? params->m_minPositionsPerJob
+        : AzFramework::Terrain::QueryAsyncParams::MinPositionsPerJobDefault;
+    const int32_t numJobs = AZStd::clamp(numRaysToProcess / minRaysPerJob, 1, numJobsMax);
+
+    // Create a terrain job context and split the work across multiple jobs.
+    AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext =
+        AZStd::make_shared<AzFramework::Terrain::TerrainJobContext>(*m_terrainJobManager, numJobs);
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+        m_activeTerrainJobContexts.push_back(jobContext);
+    }
+
+    const size_t numRaysPerJob = numRaysToProcess / numJobs;
+    for (int32_t i = 0; i < numJobs; ++i)
+    {
+        // If the number of rays can't be divided evenly by the number of jobs,
+        // ensure we still process the remaining rays along with the final job.
+        const size_t offset = i * numRaysPerJob;
+        const size_t count = (i < numJobs - 1) ? numRaysPerJob : (numRaysToProcess - offset);
+
+        auto jobFunction = [this, jobRays = rays.subspan(offset, count), jobResults = outResults.subspan(offset, count), jobContext, params]()
+        {
+            // Trace this job's rays together, unless the associated job context has been cancelled.
+            if (!jobContext->IsCancelled())
+            {
+                m_terrainRaycastContext.RayIntersect(jobRays, jobResults);
+            }
+
+            // Decrement the number of completions remaining, invoke the completion callback if this happens
+            // to be the final job completed, and remove this TerrainJobContext from the list of active ones.
+            const bool wasLastJobCompleted = jobContext->OnJobCompleted();
+            if (wasLastJobCompleted)
+            {
+                if (params && params->m_completionCallback)
+                {
+                    params->m_completionCallback(jobContext);
+                }
+
+                {
+                    AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+                    m_activeTerrainJobContexts.erase(
+                        AZStd::find(m_activeTerrainJobContexts.begin(), m_activeTerrainJobContexts.end(), jobContext));
+                    m_activeTerrainJobContextMutexConditionVariable.notify_one();
+                }
+            }
+        };
+
+        // Create the job and start it immediately.
+        AZ::Job* processJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get(), GetJobPriority(params));
+        processJob->Start();
+    }
+
+    return jobContext;
+}
+
 AZ::EntityId TerrainSystem::FindBestAreaEntityAtPosition(const AZ::Vector3& position, AZ::Aabb& bounds) const
 {
     // Find the highest priority layer that encompasses this position
@@ -1283,6 +1772,21 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     Sampler querySampler = (sampler == Sampler::EXACT) ? Sampler::EXACT : Sampler::CLAMP;
     GenerateQueryPositions(inPositions, queryPositions, queryResolution, querySampler);
 
+    // Any query positions on the surface data query grid can come from the baked surface weight tiles.
+    GetSurfaceWeightsFromTileCache(queryPositions, outSurfaceWeightsList);
+}
+
+void TerrainSystem::QuerySurfaceWeightsFromAreas(
+    AZStd::span<const AZ::Vector3> inPositions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (inPositions.empty())
+    {
+        return;
+    }
+
     auto callback = [](const AZStd::span<const AZ::Vector3> inPositions,
                         [[maybe_unused]] AZStd::span<AZ::Vector3> outPositions,
                         [[maybe_unused]] AZStd::span<bool> outTerrainExists,
@@ -1302,10 +1806,95 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
                                     AzFramework::SurfaceData::SurfaceTagWeightComparator());
                             }
                         };
-    
-    // This will be unused for surface weights. It's fine if it's empty.
+
+    // These will be unused for surface weights. It's fine if they're empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+    AZStd::vector<bool> outTerrainExists;
+    MakeBulkQueries(inPositions, outPositions, outTerrainExists, outSurfaceWeightsList, callback);
+}
+
+void TerrainSystem::GetSurfaceWeightsFromTileCache(
+    AZStd::span<const AZ::Vector3> inPositions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (!m_surfaceTileCache.IsEnabled())
+    {
+        QuerySurfaceWeightsFromAreas(inPositions, outSurfaceWeightsList);
+        return;
+    }
+
+    // The cached surface weights are written straight into the output list.
+    AZStd::vector<bool> cachedWeightsFound(inPositions.size());
+    AZStd::vector<SurfaceTileCache::TileKey> tilesToBake;
+    const AZ::u64 generation = m_surfaceTileCache.Lookup(
+        GetTileLookupSettings<SurfaceTileCache>(m_currentSettings.m_surfaceDataQueryResolution), inPositions, outSurfaceWeightsList,
+        cachedWeightsFound, tilesToBake);
+
+    AZStd::vector<size_t> uncachedIndices;
+    for (size_t index = 0; index < inPositions.size(); index++)
+    {
+        if (!cachedWeightsFound[index])
+        {
+            uncachedIndices.push_back(index);
+        }
+    }
+
+    if (uncachedIndices.size() == inPositions.size())
+    {
+        QuerySurfaceWeightsFromAreas(inPositions, outSurfaceWeightsList);
+    }
+    else if (!uncachedIndices.empty())
+    {
+        AZStd::vector<AZ::Vector3> uncachedPositions(uncachedIndices.size());
+        for (size_t index = 0; index < uncachedIndices.size(); index++)
+        {
+            uncachedPositions[index] = inPositions[uncachedIndices[index]];
+        }
+
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> uncachedSurfaceWeights(uncachedIndices.size());
+        QuerySurfaceWeightsFromAreas(uncachedPositions, uncachedSurfaceWeights);
+
+        for (size_t index = 0; index < uncachedIndices.size(); index++)
+        {
+            outSurfaceWeightsList[uncachedIndices[index]] = uncachedSurfaceWeights[index];
+        }
+    }
+
+    QueueTileBakes(m_pendingSurfaceTileBakes, tilesToBake, generation);
+}
+
+void TerrainSystem::BakeSurfaceTiles(const AZStd::vector<SurfaceTileCache::TileKey>& tilesToBake, AZ::u64 generation) const
+{
+    BakeTilesAsync(
+        m_surfaceTileCache, tilesToBake, generation,
+        [this, heightMin = m_currentSettings.m_heightRange.m_min](const SurfaceTileCache::TileKey& tileKey)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            SurfaceTileCache::GetTilePositions(tileKey, heightMin, positions);
+
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> samples(positions.size());
+            QuerySurfaceWeightsFromAreas(positions, samples);
+            return samples;
+        });
+}
+
+void TerrainSystem::InvalidateTileCaches(
+    const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
+{
+    if ((changeMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData) ==
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData)
+    {
+        m_heightTileCache.InvalidateRegion(dirtyRegion);
+        m_heightBoundsPyramid.InvalidateRegion(dirtyRegion);
+    }
+
+    if ((changeMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData) ==
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData)
+    {
+        m_surfaceTileCache.InvalidateRegion(dirtyRegion);
+    }
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1488,6 +2077,53 @@ void TerrainSystem::QueryListOfVector2(
     QueryList(inPositionsVec3, requestedData, perPositionCallback, sampler);
 }
 
+void TerrainSystem::QueryListIntoBuffers(
+    const AZStd::span<const AZ::Vector3>& inPositions,
+    TerrainDataMask requestedData,
+    const AzFramework::Terrain::TerrainQueryBuffers& outBuffers,
+    Sampler sampler) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (inPositions.empty() || !ValidateQueryBuffers(inPositions.size(), requestedData, outBuffers))
+    {
+        return;
+    }
+
+    // The height and normal queries always produce terrain exists flags, so give them somewhere to go if the caller didn't.
+    AZStd::vector<bool> terrainExistsStorage;
+    AZStd::span<bool> terrainExists = outBuffers.m_terrainExists;
+    if (terrainExists.empty() && (requestedData & (TerrainDataMask::Heights | TerrainDataMask::Normals)))
+    {
+        terrainExistsStorage.resize(inPositions.size());
+        terrainExists = terrainExistsStorage;
+    }
+
+    // Query normals before heights because the height query produces better results for the terrainExists flag for a given point,
+    // so we want to prefer keeping the results from the height query if we end up querying both.
+    if (requestedData & TerrainDataMask::Normals)
+    {
+        GetNormalsSynchronous(inPositions, sampler, outBuffers.m_normals, terrainExists);
+    }
+    if (requestedData & TerrainDataMask::Heights)
+    {
+        GetHeightsSynchronous(inPositions, sampler, outBuffers.m_heights, terrainExists);
+    }
+    if (requestedData & TerrainDataMask::SurfaceData)
+    {
+        // The terrain areas append to the surface weight lists, so clear out any results that the caller's buffers still contain.
+        for (auto& surfaceWeights : outBuffers.m_surfaceWeights)
+        {
+            surfaceWeights.clear();
+        }
+
+        // We can skip the extra height query for the terrain exists flags if the height query already provided them,
+        // or if the caller doesn't want them.
+        GetOrderedSurfaceWeightsFromList(inPositions, sampler, outBuffers.m_surfaceWeights,
+            (requestedData & TerrainDataMask::Heights) ? AZStd::span<bool>() : outBuffers.m_terrainExists);
+    }
+}
+
 //! Given a set of async parameters, calculate the max number of jobs that we can use for the async call.
 int32_t TerrainSystem::CalculateMaxJobs(AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params) const
 {
@@ -1499,6 +2135,26 @@ int32_t TerrainSystem::CalculateMaxJobs(AZStd::shared_ptr<AzFramework::Terrain::
     return numJobsMax;
 }
 
+AZ::s8 TerrainSystem::GetJobPriority(const AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams>& params)
+{
+    return params ? params->m_priority : 0;
+}
+
+bool TerrainSystem::ValidateQueryBuffers(
+    size_t numPositions, TerrainDataMask requestedData, const AzFramework::Terrain::TerrainQueryBuffers& buffers)
+{
+    const bool heightsValid = !(requestedData & TerrainDataMask::Heights) || (buffers.m_heights.size() == numPositions);
+    const bool normalsValid = !(requestedData & TerrainDataMask::Normals) || (buffers.m_normals.size() == numPositions);
+    const bool surfaceWeightsValid =
+        !(requestedData & TerrainDataMask::SurfaceData) || (buffers.m_surfaceWeights.size() == numPositions);
+    const bool terrainExistsValid = buffers.m_terrainExists.empty() || (buffers.m_terrainExists.size() == numPositions);
+
+    AZ_Error(
+        "TerrainSystem", heightsValid && normalsValid && surfaceWeightsValid && terrainExistsValid,
+        "The query buffers for the requested data need to be the same size as the list of positions.");
+    return heightsValid && normalsValid && surfaceWeightsValid && terrainExistsValid;
+}
+
 void TerrainSystem::SubdivideRegionForJobs(
     int32_t numSamplesX, int32_t numSamplesY, int32_t maxNumJobs, int32_t minPointsPerJob, int32_t& subdivisionsX, int32_t& subdivisionsY)
 {
@@ -1688,6 +2344,10 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
     m_dirtyRegion.AddAabb(aabb);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
+    InvalidateTileCaches(
+        aabb,
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
     m_cachedAreaBounds.AddAabb(aabb);
 }
 
@@ -1708,6 +2368,10 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
+                InvalidateTileCaches(
+                    areaData.m_areaBounds,
+                    AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
+                        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
 
                 if (ContainedAabbTouchesEdge(m_cachedAreaBounds, areaData.m_areaBounds))
                 {
@@ -1763,6 +2427,9 @@ void TerrainSystem::RefreshRegion(
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
+
+    // Any baked tiles in the region are stale, so remove them immediately instead of waiting for the next tick.
+    InvalidateTileCaches(dirtyRegion, changeMask);
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -1771,6 +2438,10 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
 
     bool terrainSettingsChanged = false;
 
+    // Pick up any changes to the tile cache budgets.
+    m_heightTileCache.SetMaxTiles(terrain_heightTileCacheMaxTiles);
+    m_surfaceTileCache.SetMaxTiles(terrain_surfaceTileCacheMaxTiles);
+
     if ((m_terrainDirtyMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::Settings) ==
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::Settings)
     {
@@ -1804,6 +2475,13 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // The baked tiles are all inside the height range of the previous settings. Tiles at the previous query resolutions
+        // would never get looked up again, so they're cleared as well.
+        m_heightTileCache.Clear();
+        m_surfaceTileCache.Clear();
+        m_heightBoundsPyramid.SetQueryResolution(m_currentSettings.m_heightQueryResolution);
+        m_heightBoundsPyramid.Clear();
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
@@ -1826,4 +2504,7 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
             changeMask);
     }
 
+    // Bake the tiles that queries found missing since the last tick. This happens here rather than in the queries themselves so
+    // that the jobs never get started while a query holds m_areaMutex, and so that they copy the settings on the thread that changes them.
+    StartPendingTileBakes();
 }
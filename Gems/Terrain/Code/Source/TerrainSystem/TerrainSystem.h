@@ -26,6 +26,8 @@
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystemBus.h>
+#include <TerrainSystem/TerrainHeightBoundsPyramid.h>
+#include <GradientSignal/GridTileCache.h>
 
 AZ_DECLARE_BUDGET(Terrain);
 
@@ -71,6 +73,8 @@ namespace Terrain
 
         bool TerrainAreaExistsInBounds(const AZ::Aabb& bounds) const override;
 
+        AzFramework::Terrain::FloatRange GetTerrainHeightBoundsInRegion(const AZ::Aabb& region) const override;
+
         //! Returns terrains height in meters at location x,y.
         //! @terrainExistsPtr: Can be nullptr. If != nullptr then, if there's no terrain at location x,y or location x,y is inside a terrain
         //! HOLE then *terrainExistsPtr will become false,
@@ -160,6 +164,13 @@ namespace Terrain
             AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
             Sampler sampler = Sampler::DEFAULT) const override;
 
+        //! Given a list of XY coordinates, write the requested terrain data for each coordinate into the provided buffers.
+        void QueryListIntoBuffers(
+            const AZStd::span<const AZ::Vector3>& inPositions,
+            TerrainDataMask requestedData,
+            const AzFramework::Terrain::TerrainQueryBuffers& outBuffers,
+            Sampler sampler = Sampler::DEFAULT) const override;
+
         //! Given a region(aabb) and a step size, call the provided callback function with surface data corresponding to the
         //! coordinates in the region.
         void QueryRegion(
@@ -171,6 +182,9 @@ namespace Terrain
         AzFramework::EntityContextId GetTerrainRaycastEntityContextId() const override;
         AzFramework::RenderGeometry::RayResult GetClosestIntersection(
             const AzFramework::RenderGeometry::RayRequest& ray) const override;
+        void GetClosestIntersections(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> outResults) const override;
 
         AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> QueryListAsync(
             const AZStd::span<const AZ::Vector3>& inPositions,
@@ -190,11 +204,38 @@ namespace Terrain
             AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
             Sampler sampler = Sampler::DEFAULT,
             AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params = nullptr) const override;
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> QueryListIntoBuffersAsync(
+            const AZStd::span<const AZ::Vector3>& inPositions,
+            TerrainDataMask requestedData,
+            const AzFramework::Terrain::TerrainQueryBuffers& outBuffers,
+            Sampler sampler = Sampler::DEFAULT,
+            AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params = nullptr) const override;
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> GetClosestIntersectionsAsync(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> outResults,
+            AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params = nullptr) const override;
 
     private:
+        // Baked height data for a single point on the height query grid.
+        struct CachedHeight
+        {
+            float m_height = 0.0f;
+            bool m_exists = false;
+        };
+
+        using HeightTileCache = GradientSignal::GridTileCache<CachedHeight>;
+        using SurfaceTileCache = GradientSignal::GridTileCache<AzFramework::SurfaceData::SurfaceTagWeightList>;
+
         //! Given a set of async parameters, calculate the max number of jobs that we can use for the async call.
         int32_t CalculateMaxJobs(AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params) const;
 
+        //! Given a set of async parameters, get the priority to run the async jobs at.
+        static AZ::s8 GetJobPriority(const AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams>& params);
+
+        //! Returns true if every buffer needed for the requested data has one entry per position.
+        static bool ValidateQueryBuffers(
+            size_t numPositions, TerrainDataMask requestedData, const AzFramework::Terrain::TerrainQueryBuffers& buffers);
+
         //! Given the number of samples in a region and the desired number of jobs, choose the best subdivision of the region into jobs.
         static void SubdivideRegionForJobs(
             int32_t numSamplesX, int32_t numSamplesY, int32_t maxNumJobs, int32_t minPointsPerJob,
@@ -266,6 +307,63 @@ namespace Terrain
             const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
             AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList,
             AZStd::span<bool> terrainExists) const;
+
+        //! Query the heights for a list of positions directly from the terrain areas, clamping ground plane heights to the given range.
+        void QueryHeightsFromAreas(
+            AZStd::span<AZ::Vector3> inOutPositions,
+            AZStd::span<bool> outTerrainExists,
+            const AzFramework::Terrain::FloatRange& heightRange) const;
+        //! Query the ordered surface weights for a list of positions directly from the terrain areas.
+        void QuerySurfaceWeightsFromAreas(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const;
+
+        //! Get the heights for a list of positions, using the baked tiles for any positions on the height query grid
+        //! and querying the terrain areas for the rest.
+        void GetHeightsFromTileCache(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> outTerrainExists) const;
+        //! Get the ordered surface weights for a list of positions, using the baked tiles for any positions on the surface data
+        //! query grid and querying the terrain areas for the rest.
+        void GetSurfaceWeightsFromTileCache(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const;
+
+        //! Get the settings for looking up positions on the given query grid in a tile cache.
+        template<typename TileCacheType>
+        static typename TileCacheType::LookupSettings GetTileLookupSettings(float queryResolution);
+
+        //! Tiles that queries found missing from a tile cache, along with the cache generation they were looked up in.
+        template<typename TileKeyType>
+        struct PendingTileBakes
+        {
+            AZStd::vector<TileKeyType> m_tiles;
+            AZ::u64 m_generation = 0;
+        };
+
+        //! Queue tiles found missing by a query. Queries can hold m_areaMutex, so the bake jobs are started from OnTick instead.
+        template<typename TileKeyType>
+        void QueueTileBakes(
+            PendingTileBakes<TileKeyType>& pendingBakes, const AZStd::vector<TileKeyType>& tilesToBake, AZ::u64 generation) const;
+
+        //! Start the bake jobs for every queued tile.
+        void StartPendingTileBakes();
+
+        //! Bake the given tiles on the terrain job manager, one job per tile. The bake function queries the data for a tile's
+        //! grid positions.
+        //! The bakes use the terrain job manager rather than the task executor so that they are tracked in the same list of
+        //! TerrainJobContexts as the async queries, which Deactivate() cancels and waits on before the terrain areas go away.
+        template<typename TileCacheType, typename BakeFunction>
+        void BakeTilesAsync(
+            TileCacheType& tileCache,
+            const AZStd::vector<typename TileCacheType::TileKey>& tilesToBake,
+            AZ::u64 generation,
+            BakeFunction bakeFunction) const;
+
+        void BakeHeightTiles(const AZStd::vector<HeightTileCache::TileKey>& tilesToBake, AZ::u64 generation) const;
+        void BakeSurfaceTiles(const AZStd::vector<SurfaceTileCache::TileKey>& tilesToBake, AZ::u64 generation) const;
+
+        //! Invalidate the baked tiles and height bounds that overlap the given region for each type of data in the change mask.
+        void InvalidateTileCaches(
+            const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask);
         void MakeBulkQueries(
             const AZStd::span<const AZ::Vector3> inPositions,
             AZStd::span<AZ::Vector3> outPositions,
@@ -312,6 +410,18 @@ namespace Terrain
         mutable AZStd::shared_mutex m_areaMutex;
         AZStd::map<AZ::EntityId, TerrainAreaData, TerrainLayerPriorityComparator> m_registeredAreas;
 
+        // Baked tiles of terrain data at the current query resolutions, so that repeated queries of unchanged regions don't need
+        // to query the terrain areas again.
+        mutable HeightTileCache m_heightTileCache;
+        mutable SurfaceTileCache m_surfaceTileCache;
+
+        mutable AZStd::mutex m_pendingTileBakesMutex;
+        mutable PendingTileBakes<HeightTileCache::TileKey> m_pendingHeightTileBakes;
+        mutable PendingTileBakes<SurfaceTileCache::TileKey> m_pendingSurfaceTileBakes;
+
+        // Min/max heights over blocks of the height query grid, so that bounds queries don't need every height in a region.
+        mutable TerrainHeightBoundsPyramid m_heightBoundsPyramid;
+
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
         AZ::JobManager* m_terrainJobManager = nullptr;
@@ -402,7 +512,7 @@ namespace Terrain
             };
 
             // Create the job and start it immediately.
-            AZ::Job* processJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get());
+            AZ::Job* processJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get(), GetJobPriority(params));
             processJob->Start();
         }
 
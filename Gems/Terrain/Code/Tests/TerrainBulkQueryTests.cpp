@@ -6,9 +6,11 @@
  *
  */
 
+#include <AzCore/Math/Random.h>
 #include <AzCore/std/parallel/semaphore.h>
 
 #include <AzTest/AzTest.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
 
 #include <TerrainSystem/TerrainSystem.h>
 #include <TerrainTestFixtures.h>
@@ -1001,4 +1003,252 @@ namespace UnitTest::TerrainTest
         DestroyTestTerrainSystem();
     }
 
+    TEST_F(TerrainBulkQueryTest, ProcessSurfacePointsFromRegionAndQueryListIntoBuffersProduceSameResults)
+    {
+        CreateTestTerrainSystem(TerrainWorldBounds, TerrainQueryResolution, TerrainNumSurfaces);
+
+        for (auto sampler :
+             { AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+               AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT })
+        {
+            // Gather all our initial results from calling Process*FromRegion
+            AZStd::vector<AZ::Vector3> queryPositions;
+            AZStd::vector<AzFramework::SurfaceData::SurfacePoint> baselineResultPoints;
+            AZStd::vector<bool> baselineExistsFlags;
+            GenerateBaselineSurfacePointData(
+                QueryBounds, QueryStepSize, sampler, queryPositions, baselineResultPoints, baselineExistsFlags);
+            ASSERT_EQ(queryPositions.size(), ExpectedResultCount);
+
+            // Gather results from QueryListIntoBuffers. Fill the surface weight buffers with stale data first
+            // to verify that it doesn't leak into the results.
+            AZStd::vector<float> heights(queryPositions.size());
+            AZStd::vector<AZ::Vector3> normals(queryPositions.size());
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights(
+                queryPositions.size(), { AzFramework::SurfaceData::SurfaceTagWeight(AZ::Crc32("stale"), 1.0f) });
+            AZStd::vector<bool> comparisonExistsFlags(queryPositions.size());
+
+            AzFramework::Terrain::TerrainQueryBuffers buffers;
+            buffers.m_heights = heights;
+            buffers.m_normals = normals;
+            buffers.m_surfaceWeights = surfaceWeights;
+            buffers.m_terrainExists = comparisonExistsFlags;
+            AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                &AzFramework::Terrain::TerrainDataRequests::QueryListIntoBuffers, queryPositions,
+                AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::All, buffers, sampler);
+
+            AZStd::vector<AzFramework::SurfaceData::SurfacePoint> comparisonResultPoints(queryPositions.size());
+            for (size_t index = 0; index < queryPositions.size(); index++)
+            {
+                comparisonResultPoints[index].m_position = queryPositions[index];
+                comparisonResultPoints[index].m_position.SetZ(heights[index]);
+                comparisonResultPoints[index].m_normal = normals[index];
+                comparisonResultPoints[index].m_surfaceTags = surfaceWeights[index];
+            }
+
+            // Compare the results
+            CompareSurfacePointData(baselineResultPoints, baselineExistsFlags, comparisonResultPoints, comparisonExistsFlags);
+        }
+
+        DestroyTestTerrainSystem();
+    }
+
+    TEST_F(TerrainBulkQueryTest, ProcessSurfacePointsFromRegionAndQueryListIntoBuffersAsyncProduceSameResults)
+    {
+        CreateTestTerrainSystem(TerrainWorldBounds, TerrainQueryResolution, TerrainNumSurfaces);
+
+        for (auto sampler :
+             { AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+               AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT })
+        {
+            // Gather all our initial results from calling Process*FromRegion
+            AZStd::vector<AZ::Vector3> queryPositions;
+            AZStd::vector<AzFramework::SurfaceData::SurfacePoint> baselineResultPoints;
+            AZStd::vector<bool> baselineExistsFlags;
+            GenerateBaselineSurfacePointData(
+                QueryBounds, QueryStepSize, sampler, queryPositions, baselineResultPoints, baselineExistsFlags);
+            ASSERT_EQ(queryPositions.size(), ExpectedResultCount);
+
+            // Gather results from QueryListIntoBuffersAsync
+            AZStd::vector<float> heights(queryPositions.size());
+            AZStd::vector<AZ::Vector3> normals(queryPositions.size());
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights(queryPositions.size());
+            AZStd::vector<bool> comparisonExistsFlags(queryPositions.size());
+
+            AzFramework::Terrain::TerrainQueryBuffers buffers;
+            buffers.m_heights = heights;
+            buffers.m_normals = normals;
+            buffers.m_surfaceWeights = surfaceWeights;
+            buffers.m_terrainExists = comparisonExistsFlags;
+
+            // Keep track of the ranges that get filled in so that we can verify every position was reported exactly once.
+            AZStd::atomic<size_t> numPositionsFilled = 0;
+            auto params = CreateTestAsyncParams();
+            params->m_rangeFilledCallback = [&numPositionsFilled]([[maybe_unused]] size_t firstIndex, size_t count)
+            {
+                numPositionsFilled += count;
+            };
+
+            AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext;
+            AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+                jobContext, &AzFramework::Terrain::TerrainDataRequests::QueryListIntoBuffersAsync, queryPositions,
+                AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::All, buffers, sampler, params);
+            ASSERT_NE(jobContext, nullptr);
+
+            // Wait for the async query to complete
+            m_queryCompletionEvent.acquire();
+            EXPECT_EQ(numPositionsFilled, queryPositions.size());
+
+            AZStd::vector<AzFramework::SurfaceData::SurfacePoint> comparisonResultPoints(queryPositions.size());
+            for (size_t index = 0; index < queryPositions.size(); index++)
+            {
+                comparisonResultPoints[index].m_position = queryPositions[index];
+                comparisonResultPoints[index].m_position.SetZ(heights[index]);
+                comparisonResultPoints[index].m_normal = normals[index];
+                comparisonResultPoints[index].m_surfaceTags = surfaceWeights[index];
+            }
+
+            // Compare the results
+            CompareSurfacePointData(baselineResultPoints, baselineExistsFlags, comparisonResultPoints, comparisonExistsFlags);
+        }
+
+        DestroyTestTerrainSystem();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Compare Raycast APIs
+
+    class TerrainBulkRaycastTest : public TerrainBulkQueryTest
+    {
+    protected:
+        // Generate a mix of rays that start above the terrain and end below it, rays that skim across the terrain, and rays that
+        // miss the terrain world bounds entirely.
+        static AZStd::vector<AzFramework::RenderGeometry::RayRequest> GenerateTestRays(size_t numRays)
+        {
+            AZ::SimpleLcgRandom random;
+            auto randomPosition = [&random](float minZ, float maxZ)
+            {
+                const float margin = TerrainSize / 4.0f;
+                return AZ::Vector3(
+                    TerrainWorldBounds.GetMin().GetX() - margin + (random.GetRandomFloat() * (TerrainSize + 2.0f * margin)),
+                    TerrainWorldBounds.GetMin().GetY() - margin + (random.GetRandomFloat() * (TerrainSize + 2.0f * margin)),
+                    minZ + (random.GetRandomFloat() * (maxZ - minZ)));
+            };
+
+            AZStd::vector<AzFramework::RenderGeometry::RayRequest> rays(numRays);
+            for (size_t index = 0; index < numRays; index++)
+            {
+                const float minZ = TerrainWorldBounds.GetMin().GetZ();
+                const float maxZ = TerrainWorldBounds.GetMax().GetZ();
+                switch (index % 3)
+                {
+                case 0:
+                    rays[index].m_startWorldPosition = randomPosition(maxZ, maxZ + TerrainSize);
+                    rays[index].m_endWorldPosition = randomPosition(minZ - TerrainSize, minZ);
+                    break;
+                case 1:
+                    rays[index].m_startWorldPosition = randomPosition(minZ, maxZ);
+                    rays[index].m_endWorldPosition = randomPosition(minZ, maxZ);
+                    break;
+                default:
+                    rays[index].m_startWorldPosition = randomPosition(maxZ + 1.0f, maxZ + TerrainSize);
+                    rays[index].m_endWorldPosition = randomPosition(maxZ + 1.0f, maxZ + TerrainSize);
+                    break;
+                }
+            }
+            return rays;
+        }
+
+        // Compare the batched results against the results of casting each ray individually.
+        static void CompareRayResults(
+            const AZStd::vector<AzFramework::RenderGeometry::RayRequest>& rays,
+            const AZStd::vector<AzFramework::RenderGeometry::RayResult>& comparisonResults)
+        {
+            ASSERT_EQ(rays.size(), comparisonResults.size());
+
+            size_t numHits = 0;
+            for (size_t index = 0; index < rays.size(); index++)
+            {
+                AzFramework::RenderGeometry::RayResult baselineResult;
+                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+                    baselineResult, &AzFramework::Terrain::TerrainDataRequests::GetClosestIntersection, rays[index]);
+
+                const auto& comparisonResult = comparisonResults[index];
+                EXPECT_EQ(static_cast<bool>(baselineResult), static_cast<bool>(comparisonResult));
+                if (baselineResult && comparisonResult)
+                {
+                    EXPECT_THAT(comparisonResult.m_worldPosition, IsCloseTolerance(baselineResult.m_worldPosition, 0.001f));
+                    EXPECT_THAT(comparisonResult.m_worldNormal, IsCloseTolerance(baselineResult.m_worldNormal, 0.001f));
+                    EXPECT_NEAR(comparisonResult.m_distance, baselineResult.m_distance, 0.001f);
+                    numHits++;
+                }
+            }
+
+            // Make sure the test rays actually exercise both the hit and the miss paths.
+            EXPECT_GT(numHits, 0);
+            EXPECT_LT(numHits, rays.size());
+        }
+
+        const static inline size_t NumTestRays = 300;
+    };
+
+    TEST_F(TerrainBulkRaycastTest, GetClosestIntersectionAndGetClosestIntersectionsProduceSameResults)
+    {
+        CreateTestTerrainSystem(TerrainWorldBounds, TerrainQueryResolution, TerrainNumSurfaces);
+
+        auto rays = GenerateTestRays(NumTestRays);
+        AZStd::vector<AzFramework::RenderGeometry::RayResult> results(rays.size());
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequests::GetClosestIntersections,
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest>(rays), AZStd::span<AzFramework::RenderGeometry::RayResult>(results));
+
+        CompareRayResults(rays, results);
+
+        DestroyTestTerrainSystem();
+    }
+
+    TEST_F(TerrainBulkRaycastTest, GetClosestIntersectionsWithCachedHeightBoundsProduceSameResults)
+    {
+        CreateTestTerrainSystem(TerrainWorldBounds, TerrainQueryResolution, TerrainNumSurfaces);
+
+        // Compute the height bounds for the entire terrain so that the batched rays can skip the runs of squares that they pass
+        // entirely above or below.
+        AzFramework::Terrain::FloatRange heightBounds = AzFramework::Terrain::FloatRange::CreateNull();
+        AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+            heightBounds, &AzFramework::Terrain::TerrainDataRequests::GetTerrainHeightBoundsInRegion, TerrainWorldBounds);
+        EXPECT_TRUE(heightBounds.IsValid());
+
+        auto rays = GenerateTestRays(NumTestRays);
+        AZStd::vector<AzFramework::RenderGeometry::RayResult> results(rays.size());
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequests::GetClosestIntersections,
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest>(rays), AZStd::span<AzFramework::RenderGeometry::RayResult>(results));
+
+        CompareRayResults(rays, results);
+
+        DestroyTestTerrainSystem();
+    }
+
+    TEST_F(TerrainBulkRaycastTest, GetClosestIntersectionAndGetClosestIntersectionsAsyncProduceSameResults)
+    {
+        CreateTestTerrainSystem(TerrainWorldBounds, TerrainQueryResolution, TerrainNumSurfaces);
+
+        auto rays = GenerateTestRays(NumTestRays);
+        AZStd::vector<AzFramework::RenderGeometry::RayResult> results(rays.size());
+
+        auto params = CreateTestAsyncParams();
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext;
+        AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+            jobContext, &AzFramework::Terrain::TerrainDataRequests::GetClosestIntersectionsAsync,
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest>(rays), AZStd::span<AzFramework::RenderGeometry::RayResult>(results),
+            params);
+        ASSERT_NE(jobContext, nullptr);
+
+        // Wait for the async query to complete
+        m_queryCompletionEvent.acquire();
+
+        CompareRayResults(rays, results);
+
+        DestroyTestTerrainSystem();
+    }
+
 } // namespace UnitTest
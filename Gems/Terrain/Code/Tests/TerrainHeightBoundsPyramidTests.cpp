@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <gmock/gmock.h>
+
+#include <TerrainSystem/TerrainHeightBoundsPyramid.h>
+
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    class TerrainHeightBoundsPyramidTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        using Pyramid = Terrain::TerrainHeightBoundsPyramid;
+
+        static constexpr float QueryResolution = 0.5f;
+        static constexpr float LeafWorldSize = QueryResolution * Pyramid::BlockSize;
+
+        float m_heightOffset = 0.0f;
+        size_t m_numQueriedHeights = 0;
+
+        float GetExpectedHeight(float x, float y) const
+        {
+            return (sinf(x * 0.37f) * 10.0f) + (cosf(y * 0.21f) * 5.0f) + m_heightOffset;
+        }
+
+        Pyramid::HeightQueryFunction GetHeightQuery()
+        {
+            return [this](AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outHeights)
+            {
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    outHeights[index] = GetExpectedHeight(positions[index].GetX(), positions[index].GetY());
+                }
+                m_numQueriedHeights += positions.size();
+            };
+        }
+
+        // Gets the range of the heights at every grid point inside the given grid index range.
+        AzFramework::Terrain::FloatRange GetExpectedBounds(int32_t minGridX, int32_t minGridY, int32_t maxGridX, int32_t maxGridY) const
+        {
+            AzFramework::Terrain::FloatRange bounds = { AZStd::numeric_limits<float>::max(), AZStd::numeric_limits<float>::lowest() };
+            for (int32_t y = minGridY; y <= maxGridY; y++)
+            {
+                for (int32_t x = minGridX; x <= maxGridX; x++)
+                {
+                    const float height = GetExpectedHeight(x * QueryResolution, y * QueryResolution);
+                    bounds.m_min = AZStd::min(bounds.m_min, height);
+                    bounds.m_max = AZStd::max(bounds.m_max, height);
+                }
+            }
+            return bounds;
+        }
+    };
+
+    TEST_F(TerrainHeightBoundsPyramidTests, LeafAlignedRegions_MatchGridHeights)
+    {
+        Pyramid pyramid;
+        pyramid.SetQueryResolution(QueryResolution);
+
+        // Include negative positions and regions that span several levels of the pyramid.
+        for (int32_t minLeaf : { -3, 0, 2 })
+        {
+            for (int32_t numLeaves : { 1, 2, 5 })
+            {
+                const float minWorld = minLeaf * LeafWorldSize;
+                const float maxWorld = (minLeaf + numLeaves) * LeafWorldSize;
+                const AZ::Aabb region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(minWorld, minWorld, 0.0f), AZ::Vector3(maxWorld, maxWorld, 0.0f));
+
+                const int32_t minGrid = minLeaf * Pyramid::BlockSize;
+                const int32_t maxGrid = (minLeaf + numLeaves) * Pyramid::BlockSize;
+                const auto expectedBounds = GetExpectedBounds(minGrid, minGrid, maxGrid, maxGrid);
+
+                const auto bounds = pyramid.GetHeightBounds(region, GetHeightQuery());
+                EXPECT_EQ(bounds.m_min, expectedBounds.m_min);
+                EXPECT_EQ(bounds.m_max, expectedBounds.m_max);
+            }
+        }
+    }
+
+    TEST_F(TerrainHeightBoundsPyramidTests, UnalignedRegions_CoverTouchedLeaves)
+    {
+        Pyramid pyramid;
+        pyramid.SetQueryResolution(QueryResolution);
+
+        // A small region inside a single leaf gets the bounds of that entire leaf.
+        AZ::Aabb region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(1.0f, 1.0f, 0.0f), AZ::Vector3(2.0f, 2.0f, 0.0f));
+        auto bounds = pyramid.GetHeightBounds(region, GetHeightQuery());
+        auto expectedBounds = GetExpectedBounds(0, 0, Pyramid::BlockSize, Pyramid::BlockSize);
+        EXPECT_EQ(bounds.m_min, expectedBounds.m_min);
+        EXPECT_EQ(bounds.m_max, expectedBounds.m_max);
+        EXPECT_EQ(pyramid.GetNodeCount(0), 1u);
+
+        // A region that ends exactly on the edge of a leaf doesn't need the next leaf, since the edge grid points are in both.
+        region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(1.0f, 1.0f, 0.0f), AZ::Vector3(LeafWorldSize, LeafWorldSize, 0.0f));
+        pyramid.GetHeightBounds(region, GetHeightQuery());
+        EXPECT_EQ(pyramid.GetNodeCount(0), 1u);
+
+        // A region spanning the corner of 4 leaves gets the bounds of all of them.
+        region = AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(LeafWorldSize - 1.0f, LeafWorldSize - 1.0f, 0.0f), AZ::Vector3(LeafWorldSize + 1.0f, LeafWorldSize + 1.0f, 0.0f));
+        bounds = pyramid.GetHeightBounds(region, GetHeightQuery());
+        expectedBounds = GetExpectedBounds(0, 0, Pyramid::BlockSize * 2, Pyramid::BlockSize * 2);
+        EXPECT_EQ(bounds.m_min, expectedBounds.m_min);
+        EXPECT_EQ(bounds.m_max, expectedBounds.m_max);
+        EXPECT_EQ(pyramid.GetNodeCount(0), 4u);
+
+        // Invalid regions don't have any bounds.
+        EXPECT_FALSE(pyramid.GetHeightBounds(AZ::Aabb::CreateNull(), GetHeightQuery()).IsValid());
+    }
+
+    TEST_F(TerrainHeightBoundsPyramidTests, ComputedNodes_AreReused)
+    {
+        Pyramid pyramid;
+        pyramid.SetQueryResolution(QueryResolution);
+
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(LeafWorldSize * 4.0f, LeafWorldSize * 4.0f, 0.0f));
+
+        // Nothing has been computed yet, so the cached bounds aren't available.
+        AzFramework::Terrain::FloatRange cachedBounds;
+        EXPECT_FALSE(pyramid.GetCachedHeightBounds(region, cachedBounds));
+
+        const auto bounds = pyramid.GetHeightBounds(region, GetHeightQuery());
+        EXPECT_EQ(pyramid.GetNodeCount(0), 16u);
+        EXPECT_EQ(pyramid.GetNodeCount(1), 4u);
+        EXPECT_EQ(pyramid.GetNodeCount(2), 1u);
+
+        // Querying the same region again, or any part of it, doesn't query any heights.
+        m_numQueriedHeights = 0;
+        EXPECT_EQ(pyramid.GetHeightBounds(region, GetHeightQuery()), bounds);
+        pyramid.GetHeightBounds(
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(3.0f, 5.0f, 0.0f), AZ::Vector3(LeafWorldSize * 2.5f, LeafWorldSize, 0.0f)),
+            GetHeightQuery());
+        EXPECT_EQ(m_numQueriedHeights, 0u);
+
+        EXPECT_TRUE(pyramid.GetCachedHeightBounds(region, cachedBounds));
+        EXPECT_EQ(cachedBounds, bounds);
+    }
+
+    TEST_F(TerrainHeightBoundsPyramidTests, DirtyRegion_InvalidatesOverlappingNodes)
+    {
+        Pyramid pyramid;
+        pyramid.SetQueryResolution(QueryResolution);
+
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(LeafWorldSize * 4.0f, LeafWorldSize * 4.0f, 0.0f));
+        pyramid.GetHeightBounds(region, GetHeightQuery());
+        EXPECT_EQ(pyramid.GetNodeCount(0), 16u);
+
+        // A region inside one leaf removes that leaf and every node above it, regardless of its height.
+        pyramid.InvalidateRegion(AZ::Aabb::CreateFromMinMax(AZ::Vector3(1.0f, 1.0f, 1000.0f), AZ::Vector3(2.0f, 2.0f, 1001.0f)));
+        EXPECT_EQ(pyramid.GetNodeCount(0), 15u);
+        EXPECT_EQ(pyramid.GetNodeCount(1), 3u);
+        EXPECT_EQ(pyramid.GetNodeCount(2), 0u);
+
+        // A region that starts exactly on the edge of a leaf also removes the leaf before it, since both include the edge grid points.
+        pyramid.InvalidateRegion(
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(LeafWorldSize * 2.0f, 1.0f, 0.0f), AZ::Vector3(LeafWorldSize * 2.0f + 1.0f, 2.0f, 0.0f)));
+        EXPECT_EQ(pyramid.GetNodeCount(0), 13u);
+
+        // The heights changed, so recomputing the bounds should pick up the new heights for the invalidated leaves only.
+        m_heightOffset = 100.0f;
+        m_numQueriedHeights = 0;
+        auto bounds = pyramid.GetHeightBounds(region, GetHeightQuery());
+        EXPECT_EQ(m_numQueriedHeights, 3u * (Pyramid::BlockSize + 1) * (Pyramid::BlockSize + 1));
+        EXPECT_GE(bounds.m_max, 100.0f);
+        EXPECT_EQ(pyramid.GetNodeCount(0), 16u);
+        EXPECT_EQ(pyramid.GetNodeCount(2), 1u);
+
+        // An invalid region means that everything changed.
+        pyramid.InvalidateRegion(AZ::Aabb::CreateNull());
+        for (int32_t level = 0; level <= Pyramid::MaxLevel; level++)
+        {
+            EXPECT_EQ(pyramid.GetNodeCount(level), 0u);
+        }
+        bounds = pyramid.GetHeightBounds(region, GetHeightQuery());
+        const auto expectedBounds = GetExpectedBounds(0, 0, Pyramid::BlockSize * 4, Pyramid::BlockSize * 4);
+        EXPECT_EQ(bounds.m_min, expectedBounds.m_min);
+        EXPECT_EQ(bounds.m_max, expectedBounds.m_max);
+    }
+
+    TEST_F(TerrainHeightBoundsPyramidTests, QueryResolutionChange_ClearsPyramid)
+    {
+        Pyramid pyramid;
+        pyramid.SetQueryResolution(QueryResolution);
+
+        pyramid.GetHeightBounds(AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(1.0f)), GetHeightQuery());
+        EXPECT_EQ(pyramid.GetNodeCount(0), 1u);
+
+        pyramid.SetQueryResolution(QueryResolution);
+        EXPECT_EQ(pyramid.GetNodeCount(0), 1u);
+
+        pyramid.SetQueryResolution(QueryResolution * 2.0f);
+        EXPECT_EQ(pyramid.GetNodeCount(0), 0u);
+    }
+} // namespace UnitTest
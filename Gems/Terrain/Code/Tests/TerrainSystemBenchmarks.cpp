@@ -33,6 +33,13 @@
 #include <TerrainTestFixtures.h>
 #include <benchmark/benchmark.h>
 
+AZ_CVAR_EXTERNED(uint32_t, terrain_heightTileCacheMaxTiles);
+
+namespace Terrain
+{
+    AZ_CVAR_EXTERNED(bool, terrain_cacheHeightGradients);
+}
+
 namespace UnitTest
 {
     using ::testing::NiceMock;
@@ -271,6 +278,43 @@ namespace UnitTest
         ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
 
+    // Get timings for repeated height queries of the same list with the height gradient cache turned off or on.
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsList_CachedHeightGradients)(benchmark::State& state)
+    {
+        // The height gradient list only reads the setting when it activates, which happens when the test terrain is created.
+        const bool previousCacheHeightGradients = Terrain::terrain_cacheHeightGradients;
+        Terrain::terrain_cacheHeightGradients = (state.range(3) != 0);
+
+        // Run the benchmark
+        RunTerrainApiBenchmark(
+            state,
+            [this](float queryResolution, const AZ::Aabb& worldBounds, AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                AZStd::vector<AZ::Vector3> inPositions;
+                GenerateInputPositionsList(queryResolution, worldBounds, inPositions);
+
+                auto perPositionCallback = [](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    benchmark::DoNotOptimize(surfacePoint.m_position.GetZ());
+                };
+
+                AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                    &AzFramework::Terrain::TerrainDataRequests::QueryList, inPositions,
+                    AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, perPositionCallback, sampler);
+            }
+        );
+
+        Terrain::terrain_cacheHeightGradients = previousCacheHeightGradients;
+    }
+
+    // The 1024 x 1024 query covers exactly as many tiles as the gradient cache holds by default.
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsList_CachedHeightGradients)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 0 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 1 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 0 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsListAsync)(benchmark::State& state)
     {
         // Run the benchmark
@@ -995,6 +1039,136 @@ namespace UnitTest
         ->Args({ 2048, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
 
+    // Generate the same random rays as BM_GetClosestIntersectionRandom so that the batched benchmarks can be compared against it.
+    static AZStd::vector<AzFramework::RenderGeometry::RayRequest> GenerateRandomRays(uint32_t numRays, const AZ::Aabb& worldBounds)
+    {
+        // Cast rays starting at random positions above the terrain,
+        // and ending at a random positions below the terrain.
+        AZ::SimpleLcgRandom random;
+        AZStd::vector<AzFramework::RenderGeometry::RayRequest> rays(numRays);
+        for (auto& ray : rays)
+        {
+            ray.m_startWorldPosition.SetX(worldBounds.GetMin().GetX() + (random.GetRandomFloat() * worldBounds.GetXExtent()));
+            ray.m_startWorldPosition.SetY(worldBounds.GetMin().GetY() + (random.GetRandomFloat() * worldBounds.GetYExtent()));
+            ray.m_startWorldPosition.SetZ(worldBounds.GetMax().GetZ());
+            ray.m_endWorldPosition.SetX(worldBounds.GetMin().GetX() + (random.GetRandomFloat() * worldBounds.GetXExtent()));
+            ray.m_endWorldPosition.SetY(worldBounds.GetMin().GetY() + (random.GetRandomFloat() * worldBounds.GetYExtent()));
+            ray.m_endWorldPosition.SetZ(worldBounds.GetMin().GetZ());
+        }
+        return rays;
+    }
+
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_GetClosestIntersectionsRandom)(benchmark::State& state)
+    {
+        // Run the benchmark
+        const uint32_t numRays = aznumeric_cast<uint32_t>(state.range(1));
+        RunTerrainApiBenchmark(
+            state,
+            [numRays]([[maybe_unused]] float queryResolution, const AZ::Aabb& worldBounds,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                // Trace all of the rays together with a single batched request.
+                auto rays = GenerateRandomRays(numRays, worldBounds);
+                AZStd::vector<AzFramework::RenderGeometry::RayResult> results(rays.size());
+                AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                    &AzFramework::Terrain::TerrainDataRequests::GetClosestIntersections,
+                    AZStd::span<const AzFramework::RenderGeometry::RayRequest>(rays),
+                    AZStd::span<AzFramework::RenderGeometry::RayResult>(results));
+                benchmark::DoNotOptimize(results.data());
+            });
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_GetClosestIntersectionsRandom)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 10, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 10, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 100, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 100, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_GetClosestIntersectionsRandomAsync)(benchmark::State& state)
+    {
+        // Run the benchmark
+        const uint32_t numRays = aznumeric_cast<uint32_t>(state.range(1));
+        RunTerrainApiBenchmark(
+            state,
+            [numRays]([[maybe_unused]] float queryResolution, const AZ::Aabb& worldBounds,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                // Trace the rays in batches spread across all of the available job threads.
+                auto rays = GenerateRandomRays(numRays, worldBounds);
+                AZStd::vector<AzFramework::RenderGeometry::RayResult> results(rays.size());
+
+                AZStd::semaphore completionEvent;
+                auto completionCallback = [&completionEvent](AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>)
+                {
+                    completionEvent.release();
+                };
+
+                AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> asyncParams
+                    = AZStd::make_shared<AzFramework::Terrain::QueryAsyncParams>();
+                asyncParams->m_desiredNumberOfJobs = AzFramework::Terrain::QueryAsyncParams::UseMaxJobs;
+                asyncParams->m_completionCallback = completionCallback;
+                AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                    &AzFramework::Terrain::TerrainDataRequests::GetClosestIntersectionsAsync,
+                    AZStd::span<const AzFramework::RenderGeometry::RayRequest>(rays),
+                    AZStd::span<AzFramework::RenderGeometry::RayResult>(results), asyncParams);
+
+                completionEvent.acquire();
+                benchmark::DoNotOptimize(results.data());
+            });
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_GetClosestIntersectionsRandomAsync)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 10, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 10, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 100, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 100, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_GetClosestIntersectionsWorstCase)(benchmark::State& state)
+    {
+        // Run the benchmark
+        const uint32_t numRays = aznumeric_cast<uint32_t>(state.range(1));
+        RunTerrainApiBenchmark(
+            state,
+            [numRays]([[maybe_unused]] float queryResolution, const AZ::Aabb& worldBounds,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                // Cast the same rays as BM_GetClosestIntersectionWorstCase, which traverse the entire grid
+                // without finding an intersection, but trace all of them with a single batched request.
+                AzFramework::RenderGeometry::RayRequest ray;
+                ray.m_startWorldPosition = worldBounds.GetMax();
+                ray.m_endWorldPosition = worldBounds.GetMin();
+                ray.m_endWorldPosition.SetZ(ray.m_startWorldPosition.GetZ());
+                AZStd::vector<AzFramework::RenderGeometry::RayRequest> rays(numRays, ray);
+                AZStd::vector<AzFramework::RenderGeometry::RayResult> results(rays.size());
+                AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                    &AzFramework::Terrain::TerrainDataRequests::GetClosestIntersections,
+                    AZStd::span<const AzFramework::RenderGeometry::RayRequest>(rays),
+                    AZStd::span<AzFramework::RenderGeometry::RayResult>(results));
+                benchmark::DoNotOptimize(results.data());
+            });
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_GetClosestIntersectionsWorstCase)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 10, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 10, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 100, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 100, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 1024, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Args({ 2048, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
+        ->Unit(::benchmark::kMillisecond);
+
     // Benchmark a single usage of our more complicated terrain setup.
     BENCHMARK_DEFINE_F(TerrainSurfaceGradientBenchmarkFixture, BM_ProcessSurfacePointsList_SurfaceGradients)(benchmark::State& state)
     {
@@ -1187,6 +1361,79 @@ namespace UnitTest
         ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 4 })
         ->Unit(::benchmark::kMillisecond);
 
+    // Get timings for how long it takes to run N of the same height query at the same time, with the height tile cache either
+    // turned off or large enough to hold every tile in the query, to show how much the cache lookups contend with each other.
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ParallelProcessHeightsList_TileCache)(benchmark::State& state)
+    {
+        const uint32_t numParallelQueries = aznumeric_cast<uint32_t>(state.range(3));
+        const uint32_t previousMaxTiles = terrain_heightTileCacheMaxTiles;
+        terrain_heightTileCacheMaxTiles = aznumeric_cast<uint32_t>(state.range(4));
+
+        // Run the benchmark
+        RunTerrainApiBenchmark(
+            state,
+            [this, numParallelQueries](
+                float queryResolution, const AZ::Aabb& worldBounds, AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                // The terrain system picks up the cache size and starts baking the tiles that earlier queries missed on tick,
+                // so the first few iterations warm up the cache.
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+
+                AZStd::vector<AZ::Vector3> inPositions;
+                GenerateInputPositionsList(queryResolution, worldBounds, inPositions);
+
+                constexpr uint32_t MaxParallelQueries = 16;
+                AZStd::thread threads[MaxParallelQueries];
+                AZStd::semaphore syncThreads;
+
+                const uint32_t numThreads = AZStd::min(numParallelQueries, MaxParallelQueries);
+
+                // Create N threads, each one running a synchronous height query over the same positions.
+                for (uint32_t thread = 0; thread < numThreads; thread++)
+                {
+                    threads[thread] = AZStd::thread(
+                        [&inPositions, &syncThreads, sampler]()
+                        {
+                            auto perPositionCallback =
+                                [](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                            {
+                                benchmark::DoNotOptimize(surfacePoint.m_position.GetZ());
+                            };
+
+                            syncThreads.acquire();
+
+                            AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                                &AzFramework::Terrain::TerrainDataRequests::QueryList, inPositions,
+                                AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, perPositionCallback,
+                                sampler);
+                        });
+                }
+
+                // Now that all threads are created, signal everything to start running in parallel.
+                syncThreads.release(numThreads);
+
+                // Wait for the threads to finish.
+                for (uint32_t thread = 0; thread < numThreads; thread++)
+                {
+                    threads[thread].join();
+                }
+            });
+
+        terrain_heightTileCacheMaxTiles = previousMaxTiles;
+    }
+
+    // The 512 x 512 query covers 256 tiles of 32 x 32 heights.
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ParallelProcessHeightsList_TileCache)
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 1, 0 })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 2, 0 })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 4, 0 })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 8, 0 })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 1, 256 })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 2, 256 })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 4, 256 })
+        ->Args({ 512, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 8, 256 })
+        ->Unit(::benchmark::kMillisecond);
+
 #endif
 
 }
@@ -1480,6 +1480,92 @@ namespace UnitTest
         EXPECT_EQ(numFailures, 0);
     }
 
+    TEST_F(TerrainSystemTest, TerrainHeightBoundsInRegionFollowHeightChanges)
+    {
+        // Create a mock terrain layer spawner that generates heights that increase by 0.1m per meter along the X axis,
+        // plus an offset that the test can change.
+        float heightOffset = 0.0f;
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -20.0f, 64.0f, 64.0f, 20.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ((position.GetX() * 0.1f) + heightOffset);
+                terrainExists = true;
+            });
+
+        constexpr float queryResolution = 1.0f;
+        auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution);
+
+        // The bounds cover every grid point in the blocks of the height query grid that the region touches, so a small region near
+        // the origin gets the bounds from the grid points in (0, 0) - (32, 32).
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, 0.0f, 10.0f, 10.0f, 0.0f);
+        auto bounds = terrainSystem->GetTerrainHeightBoundsInRegion(region);
+        EXPECT_NEAR(bounds.m_min, 0.0f, 0.001f);
+        EXPECT_NEAR(bounds.m_max, 3.2f, 0.001f);
+
+        // The bounds are kept until the terrain system is told that the heights changed.
+        heightOffset = 5.0f;
+        bounds = terrainSystem->GetTerrainHeightBoundsInRegion(region);
+        EXPECT_NEAR(bounds.m_min, 0.0f, 0.001f);
+
+        terrainSystem->RefreshRegion(spawnerBox, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        bounds = terrainSystem->GetTerrainHeightBoundsInRegion(region);
+        EXPECT_NEAR(bounds.m_min, 5.0f, 0.001f);
+        EXPECT_NEAR(bounds.m_max, 8.2f, 0.001f);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainGetClosestIntersectionsSkipsHeightsUnderRaysAboveTheTerrain)
+    {
+        // Create a flat terrain at a height of 0 that counts how many heights get queried.
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -5.0f, 64.0f, 64.0f, 15.0f);
+        AZStd::atomic<size_t> numHeightQueries{ 0 };
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&numHeightQueries](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(0.0f);
+                terrainExists = true;
+                numHeightQueries++;
+            });
+
+        constexpr float queryResolution = 1.0f;
+        auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution);
+
+        // A ray that stays above the terrain the whole way across it.
+        AZStd::array<AzFramework::RenderGeometry::RayRequest, 1> rays;
+        rays[0].m_startWorldPosition = AZ::Vector3(-60.0f, 1.5f, 10.0f);
+        rays[0].m_endWorldPosition = AZ::Vector3(60.0f, 1.5f, 5.0f);
+        AZStd::array<AzFramework::RenderGeometry::RayResult, 1> results;
+
+        // The first ray computes the height bounds under it.
+        terrainSystem->GetClosestIntersections(rays, results);
+        EXPECT_FALSE(results[0]);
+        EXPECT_GT(numHeightQueries.load(), 0u);
+
+        // A second ray over the same area can tell from the height bounds alone that it passes above the terrain.
+        numHeightQueries = 0;
+        rays[0].m_startWorldPosition.SetY(2.5f);
+        rays[0].m_endWorldPosition.SetY(2.5f);
+        terrainSystem->GetClosestIntersections(rays, results);
+        EXPECT_FALSE(results[0]);
+        EXPECT_EQ(numHeightQueries.load(), 0u);
+
+        // A ray that goes through the terrain still needs the heights, and still hits it.
+        rays[0].m_endWorldPosition.SetZ(-5.0f);
+        terrainSystem->GetClosestIntersections(rays, results);
+        EXPECT_TRUE(results[0]);
+        EXPECT_GT(numHeightQueries.load(), 0u);
+
+        // Changing the heights invalidates the bounds, so the next ray needs to compute them again.
+        terrainSystem->RefreshRegion(spawnerBox, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        numHeightQueries = 0;
+        rays[0].m_endWorldPosition.SetZ(5.0f);
+        terrainSystem->GetClosestIntersections(rays, results);
+        EXPECT_FALSE(results[0]);
+        EXPECT_GT(numHeightQueries.load(), 0u);
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessAsyncCancellation)
     {
         // Tests cancellation of the asynchronous terrain API.
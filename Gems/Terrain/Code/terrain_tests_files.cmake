@@ -11,6 +11,7 @@ set(FILES
     Tests/LayerSpawnerTests.cpp
     Tests/MockAxisAlignedBoxShapeComponent.h
     Tests/TerrainBulkQueryTests.cpp
+    Tests/TerrainHeightBoundsPyramidTests.cpp
     Tests/TerrainHeightGradientListTests.cpp
     Tests/TerrainMacroMaterialTests.cpp
     Tests/SurfaceMaterialsListTest.cpp
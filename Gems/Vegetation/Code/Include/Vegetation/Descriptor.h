@@ -90,6 +90,24 @@ namespace Vegetation
                 m_instanceSpawner->DestroyInstance(id, instance);
             }
         }
+        AZ_INLINE void CreateInstances(AZStd::span<const InstanceData> instances, AZStd::span<InstancePtr> outInstances)
+        {
+            if (m_instanceSpawner)
+            {
+                m_instanceSpawner->CreateInstances(instances, outInstances);
+            }
+            else
+            {
+                AZStd::fill(outInstances.begin(), outInstances.end(), nullptr);
+            }
+        }
+        AZ_INLINE void DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances)
+        {
+            if (m_instanceSpawner)
+            {
+                m_instanceSpawner->DestroyInstances(ids, instances);
+            }
+        }
 
         // We use the InstanceSpawner pointer as the notification bus ID since the InstanceSpawner is
         // the one that will actually broadcast out the notifications.  Multiple Descriptors can point to
@@ -33,6 +33,8 @@ namespace Vegetation
 
         virtual void FillSectorStart([[maybe_unused]] int sectorX, [[maybe_unused]] int sectorY, [[maybe_unused]] TimePoint timePoint) {};
         virtual void FillSectorEnd([[maybe_unused]] int sectorX, [[maybe_unused]] int sectorY, [[maybe_unused]] TimePoint timePoint, [[maybe_unused]] AZ::u32 unusedClaimPointCount) {};
+        //! Reports the time between a sector update getting requested and the sector finishing its fill.
+        virtual void FillSectorLatency([[maybe_unused]] int sectorX, [[maybe_unused]] int sectorY, [[maybe_unused]] TimeSpan latencyUs) {};
 
         virtual void FillAreaStart([[maybe_unused]] AZ::EntityId areaId, [[maybe_unused]] TimePoint timePoint) {};
         virtual void MarkAreaRejectedByMask([[maybe_unused]] AZ::EntityId areaId) {};
@@ -54,6 +54,8 @@ namespace Vegetation
         {
             SectorId m_id;
             AZ::u32 m_numClaimPointsRemaining = 0; // number of sector points that were unused after a fill
+            TimeSpan m_lastLatencyUs = 0; // time between the most recent update request and the end of its fill
+            TimeSpan m_peakLatencyUs = 0;
             AZ::Vector3 m_worldPosition;
             AZStd::unordered_map<AreaId, AreaSectorTiming> m_perAreaData;
         };
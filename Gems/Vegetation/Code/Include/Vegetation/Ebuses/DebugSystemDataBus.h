@@ -19,6 +19,8 @@ namespace Vegetation
     {
         AZStd::atomic_int m_areaTaskQueueCount{ 0 };
         AZStd::atomic_int m_areaTaskActiveCount{ 0 };
+        AZStd::atomic_int m_sectorUpdateQueueCount{ 0 };
+        AZStd::atomic_int m_sectorFillLatencyUs{ 0 };
     };
 
     class DebugSystemData
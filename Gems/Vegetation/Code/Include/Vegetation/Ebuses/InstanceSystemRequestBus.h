@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/span.h>
 #include <Vegetation/Descriptor.h>
 
 namespace Vegetation
@@ -41,6 +42,12 @@ namespace Vegetation
         virtual void DestroyInstance(InstanceId instanceId) = 0;
         virtual void DestroyAllInstances() = 0;
 
+        // create a batch of vegetation instances, filling in the instance id of each entry the same way as CreateInstance
+        virtual void CreateInstances(AZStd::span<InstanceData> instanceData) = 0;
+
+        // destroy a batch of vegetation instances by id
+        virtual void DestroyInstances(AZStd::span<const InstanceId> instanceIds) = 0;
+
         virtual void Cleanup() = 0;
     };
 
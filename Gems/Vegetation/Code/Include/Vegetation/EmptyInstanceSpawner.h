@@ -64,6 +64,18 @@ namespace Vegetation
         //! Destroy a single instance.
         void DestroyInstance([[maybe_unused]] InstanceId id, [[maybe_unused]] InstancePtr instance) override {}
 
+        //! Create a batch of instances.
+        void CreateInstances([[maybe_unused]] AZStd::span<const InstanceData> instances, AZStd::span<InstancePtr> outInstances) override
+        {
+            AZStd::fill(outInstances.begin(), outInstances.end(), static_cast<InstancePtr>(this));
+        }
+
+        //! Destroy a batch of instances.
+        void DestroyInstances(
+            [[maybe_unused]] AZStd::span<const InstanceId> ids, [[maybe_unused]] AZStd::span<const InstancePtr> instances) override
+        {
+        }
+
     private:
         bool DataIsEquivalent(const InstanceSpawner& rhs) const override;
     };
@@ -9,6 +9,7 @@
 
 #include <AzCore/RTTI/TypeInfoSimple.h>
 #include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Component/EntityId.h>
@@ -79,6 +80,19 @@ namespace Vegetation
         //! Destroy a single instance.
         virtual void DestroyInstance(InstanceId id, InstancePtr instance) = 0;
 
+        //! Create a batch of instances that all use this spawner.
+        //! The default implementation creates the instances one at a time.  Spawners that can share resources between
+        //! instances, such as a single instance buffer per spawner, should override this to create the batch at once.
+        //! @param instances The data for each instance to create.
+        //! @param outInstances Receives the created instance for each entry in instances, or nullptr if that creation failed.
+        virtual void CreateInstances(AZStd::span<const InstanceData> instances, AZStd::span<InstancePtr> outInstances);
+
+        //! Destroy a batch of instances that were created by this spawner.
+        //! The default implementation destroys the instances one at a time.
+        //! @param ids The ids of the instances to destroy.
+        //! @param instances The instance for each entry in ids.
+        virtual void DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances);
+
         //! Check for data equivalency.  Subclasses are expected to implement this.
         bool operator==(const InstanceSpawner& rhs) const { return DataIsEquivalent(rhs); };
 
@@ -59,6 +59,12 @@ namespace Vegetation
         //! Destroy a single instance.
         void DestroyInstance(InstanceId id, InstancePtr instance) override;
 
+        //! Create a batch of instances, sizing the ticket tracking once for the whole batch.
+        void CreateInstances(AZStd::span<const InstanceData> instances, AZStd::span<InstancePtr> outInstances) override;
+
+        //! Destroy a batch of instances.
+        void DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances) override;
+
         AZStd::string GetSpawnableAssetPath() const;
         void SetSpawnableAssetPath(const AZStd::string& assetPath);
 
@@ -81,8 +87,14 @@ namespace Vegetation
         //! Verify that the spawnable asset only contains data compatible with the dynamic vegetation system.
         bool ValidateAssetContents(const AZ::Data::Asset<AZ::Data::AssetData> asset) const;
 
+        //! Spawn an instance of the spawnable asset and start tracking its ticket.
+        InstancePtr SpawnAssetInstance(AzFramework::SpawnableEntitiesDefinition& spawnableEntities, const InstanceData& instanceData);
+
         //! Despawn an instance of a spawnable asset
-        void DespawnAssetInstance(AzFramework::EntitySpawnTicket* ticket);
+        void DespawnAssetInstance(AzFramework::SpawnableEntitiesDefinition& spawnableEntities, AzFramework::EntitySpawnTicket* ticket);
+
+        //! Despawn an instance, stop tracking its ticket and delete the ticket.
+        void ReleaseAssetInstance(AzFramework::SpawnableEntitiesDefinition& spawnableEntities, InstancePtr instance);
 
         //! Cached values so that asset isn't accessed on other threads
         bool m_assetLoadedAndSpawnable = false;
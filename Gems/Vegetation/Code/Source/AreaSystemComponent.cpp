@@ -22,7 +22,11 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobEmpty.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
@@ -37,6 +41,14 @@
 #include <ISystem.h>
 #include <cinttypes>
 
+AZ_CVAR(
+    uint32_t,
+    veg_maxParallelSectorUpdates,
+    0,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of vegetation sectors that gather their surface points in parallel. 0 uses the number of job worker threads.");
+
 namespace Vegetation
 {
     namespace AreaSystemUtil
@@ -80,7 +92,7 @@ namespace Vegetation
         return o;
     }
 
-    bool AreaSystemComponent::ViewRect::operator==(const ViewRect& b)
+    bool AreaSystemComponent::ViewRect::operator==(const ViewRect& b) const
     {
         return m_x == b.m_x && m_y == b.m_y && m_width == b.m_width && m_height == b.m_height;
     }
@@ -90,16 +102,47 @@ namespace Vegetation
         return static_cast<size_t>(m_height * m_width);
     }
 
-    bool AreaSystemComponent::ViewRect::operator!=(const ViewRect& b)
+    bool AreaSystemComponent::ViewRect::operator!=(const ViewRect& b) const
     {
         return m_x != b.m_x || m_y != b.m_y || m_width != b.m_width || m_height != b.m_height;
     }
 
+    size_t AreaSystemComponent::ViewRect::GetSectorIndex(const SectorId& sector) const
+    {
+        AZ_Assert(IsInside(sector), "Sector (%d, %d) is outside the view rectangle", sector.first, sector.second);
+        return static_cast<size_t>(((sector.second - m_y) * m_width) + (sector.first - m_x));
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // DirtySectors
-    void AreaSystemComponent::DirtySectors::MarkDirty(const SectorId& sector)
+    void AreaSystemComponent::DirtySectors::MarkDirty(const SectorId& sector, const ViewRect& viewRect)
     {
-        m_dirtySet.insert(AZStd::move(sector));
+        if (m_allSectorsDirty)
+        {
+            return;
+        }
+
+        if (m_viewRect != viewRect)
+        {
+            if (m_dirtyCount > 0)
+            {
+                // The sectors that are already dirty were marked in a different view rectangle, so we can't map them into
+                // the new one.  This is rare enough that it's simplest to treat everything as dirty.
+                MarkAllDirty();
+                return;
+            }
+
+            m_viewRect = viewRect;
+            m_dirtyFlags.clear();
+            m_dirtyFlags.resize(viewRect.GetNumSectors(), 0);
+        }
+
+        if (m_viewRect.IsInside(sector))
+        {
+            AZ::u8& dirtyFlag = m_dirtyFlags[m_viewRect.GetSectorIndex(sector)];
+            m_dirtyCount += (dirtyFlag == 0) ? 1 : 0;
+            dirtyFlag = 1;
+        }
     }
 
     void AreaSystemComponent::DirtySectors::MarkAllDirty()
@@ -109,14 +152,137 @@ namespace Vegetation
 
     void AreaSystemComponent::DirtySectors::Clear()
     {
-        m_dirtySet.clear();
+        // Keep the flag storage around so that it doesn't need to get reallocated the next time sectors get marked.
+        if (m_dirtyCount > 0)
+        {
+            AZStd::fill(m_dirtyFlags.begin(), m_dirtyFlags.end(), AZ::u8(0));
+            m_dirtyCount = 0;
+        }
         m_allSectorsDirty = false;
     }
 
     bool AreaSystemComponent::DirtySectors::IsDirty(const SectorId& sector) const
     {
         return m_allSectorsDirty ||
-            (!m_dirtySet.empty() && (m_dirtySet.find(sector) != m_dirtySet.end()));
+            ((m_dirtyCount > 0) && m_viewRect.IsInside(sector) && (m_dirtyFlags[m_viewRect.GetSectorIndex(sector)] != 0));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // SectorRollingWindow
+    void AreaSystemComponent::SectorRollingWindow::SetViewRect(const ViewRect& viewRect)
+    {
+        if (viewRect == m_viewRect)
+        {
+            return;
+        }
+
+        // Gather all sectors and lay them out again for the new view rectangle.  Only the pointers get moved, so this
+        // is cheap compared to the sector updates that follow a view rectangle change.
+        AZStd::vector<AZStd::unique_ptr<SectorInfo>> sectors = AZStd::move(m_sectorsOutsideViewRect);
+        m_sectorsOutsideViewRect.clear();
+        for (auto& slot : m_grid)
+        {
+            if (slot)
+            {
+                sectors.emplace_back(AZStd::move(slot));
+            }
+        }
+
+        m_viewRect = viewRect;
+        m_grid.clear();
+        m_grid.resize(m_viewRect.GetNumSectors());
+        for (auto& sector : sectors)
+        {
+            if (m_viewRect.IsInside(sector->m_id))
+            {
+                m_grid[m_viewRect.GetSectorIndex(sector->m_id)] = AZStd::move(sector);
+            }
+            else
+            {
+                m_sectorsOutsideViewRect.emplace_back(AZStd::move(sector));
+            }
+        }
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::SectorRollingWindow::GetSector(const SectorId& id) const
+    {
+        if (m_viewRect.IsInside(id))
+        {
+            return m_grid[m_viewRect.GetSectorIndex(id)].get();
+        }
+
+        for (const auto& sector : m_sectorsOutsideViewRect)
+        {
+            if (sector->m_id == id)
+            {
+                return sector.get();
+            }
+        }
+        return nullptr;
+    }
+
+    AZStd::unique_ptr<AreaSystemComponent::SectorInfo>* AreaSystemComponent::SectorRollingWindow::FindSlot(const SectorId& id)
+    {
+        if (m_viewRect.IsInside(id))
+        {
+            return &m_grid[m_viewRect.GetSectorIndex(id)];
+        }
+
+        auto sector = AZStd::find_if(m_sectorsOutsideViewRect.begin(), m_sectorsOutsideViewRect.end(),
+            [&id](const AZStd::unique_ptr<SectorInfo>& sectorInfo) { return sectorInfo->m_id == id; });
+        return (sector != m_sectorsOutsideViewRect.end()) ? &(*sector) : nullptr;
+    }
+
+    AreaSystemComponent::SectorInfo& AreaSystemComponent::SectorRollingWindow::AddSector(SectorInfo&& sectorInfo)
+    {
+        AZStd::unique_ptr<SectorInfo>* slot = FindSlot(sectorInfo.m_id);
+        if (!slot)
+        {
+            slot = &m_sectorsOutsideViewRect.emplace_back();
+        }
+
+        if (*slot)
+        {
+            **slot = AZStd::move(sectorInfo);
+        }
+        else
+        {
+            *slot = AZStd::make_unique<SectorInfo>(AZStd::move(sectorInfo));
+            ++m_numSectors;
+        }
+        return **slot;
+    }
+
+    void AreaSystemComponent::SectorRollingWindow::RemoveSector(const SectorId& id)
+    {
+        AZStd::unique_ptr<SectorInfo>* slot = FindSlot(id);
+        if (!slot || !*slot)
+        {
+            return;
+        }
+
+        --m_numSectors;
+        if (m_viewRect.IsInside(id))
+        {
+            slot->reset();
+        }
+        else
+        {
+            // The order of the sectors outside the view rectangle doesn't matter, so swap the removed one with the last one.
+            AZStd::swap(*slot, m_sectorsOutsideViewRect.back());
+            m_sectorsOutsideViewRect.pop_back();
+        }
+    }
+
+    void AreaSystemComponent::SectorRollingWindow::Clear()
+    {
+        // Keep the grid around so that it doesn't need to get reallocated when the sectors get created again.
+        for (auto& slot : m_grid)
+        {
+            slot.reset();
+        }
+        m_sectorsOutsideViewRect.clear();
+        m_numSectors = 0;
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -1060,8 +1226,7 @@ namespace Vegetation
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
-        auto itSector = m_sectorRollingWindow.find(sectorId);
-        return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
+        return m_sectorRollingWindow.GetSector(sectorId);
     }
 
     AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::GetSector(const SectorId& sectorId)
@@ -1069,8 +1234,7 @@ namespace Vegetation
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
-        auto itSector = m_sectorRollingWindow.find(sectorId);
-        return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
+        return m_sectorRollingWindow.GetSector(sectorId);
     }
 
     AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
@@ -1081,9 +1245,15 @@ namespace Vegetation
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        return AddSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
-        SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
+        SectorInfo& sectorInfoRef = m_sectorRollingWindow.AddSector(AZStd::move(sectorInfo));
         UpdateSectorCallbacks(sectorInfoRef);
         return &sectorInfoRef;
     }
@@ -1102,7 +1272,9 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointList availablePointsPerPosition;
+        // The point list is pooled so that its storage gets reused across sector updates instead of getting reallocated each time.
+        auto availablePointsHandle = m_surfacePointListPool.Acquire();
+        SurfaceData::SurfacePointList& availablePointsPerPosition = *availablePointsHandle;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1188,12 +1360,10 @@ namespace Vegetation
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
-        auto itSector = m_sectorRollingWindow.find(sectorId);
-        if (itSector != m_sectorRollingWindow.end())
+        if (SectorInfo* sectorInfo = m_sectorRollingWindow.GetSector(sectorId))
         {
-            SectorInfo& sectorInfo(itSector->second);
-            EmptySector(sectorInfo);
-            m_sectorRollingWindow.erase(itSector);
+            EmptySector(*sectorInfo);
+            m_sectorRollingWindow.RemoveSector(sectorId);
         }
         else
         {
@@ -1272,7 +1442,7 @@ namespace Vegetation
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
+        AZStd::unordered_map<AZ::EntityId, AZStd::vector<ClaimHandle>> claimsToRelease;
 
         // Group up all the previously-claimed-but-no-longer-claimed points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPointsBeforeFill)
@@ -1282,7 +1452,7 @@ namespace Vegetation
             const auto& areaId = instanceData.m_id;
             if (sectorInfo.m_claimedWorldPoints.find(handle) == sectorInfo.m_claimedWorldPoints.end())
             {
-                claimsToRelease[areaId].insert(handle);
+                claimsToRelease[areaId].push_back(handle);
             }
         }
         sectorInfo.m_claimedWorldPointsBeforeFill.clear();
@@ -1293,17 +1463,13 @@ namespace Vegetation
             const auto& areaId = claimPair.first;
             const auto& handles = claimPair.second;
             AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaConnect);
-
-            for (const auto& handle : handles)
-            {
-                AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPosition, handle);
-            }
-
+            AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPositions, AZStd::span<const ClaimHandle>(handles));
             AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaDisconnect);
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas)
+    void AreaSystemComponent::VegetationThreadTasks::FillSector(
+        SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, AZStd::chrono::steady_clock::time_point requestTime)
     {
         AZ_PROFILE_FUNCTION(Entity);
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorStart, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::steady_clock::now()));
@@ -1343,13 +1509,21 @@ namespace Vegetation
         ReleaseUnusedClaims(sectorInfo);
 
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorEnd, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::steady_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
+
+        // Track how long the sector waited between its update getting requested and the fill completing.
+        const auto latencyUs = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - requestTime);
+        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorLatency, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), latencyUs.count()));
+        if (m_debugData)
+        {
+            m_debugData->m_sectorFillLatencyUs.store(static_cast<int>(latencyUs.count()), AZStd::memory_order_relaxed);
+        }
     }
 
     void AreaSystemComponent::VegetationThreadTasks::EmptySector(SectorInfo& sectorInfo)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
+        AZStd::unordered_map<AZ::EntityId, AZStd::vector<ClaimHandle>> claimsToRelease;
 
         // group up all the points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPoints)
@@ -1357,7 +1531,7 @@ namespace Vegetation
             const auto& handle = claimPair.first;
             const auto& instanceData = claimPair.second;
             const auto& areaId = instanceData.m_id;
-            claimsToRelease[areaId].insert(handle);
+            claimsToRelease[areaId].push_back(handle);
         }
         sectorInfo.m_claimedWorldPoints.clear();
 
@@ -1367,12 +1541,7 @@ namespace Vegetation
             const auto& areaId = claimPair.first;
             const auto& handles = claimPair.second;
             AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaConnect);
-
-            for (const auto& handle : handles)
-            {
-                AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPosition, handle);
-            }
-
+            AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPositions, AZStd::span<const ClaimHandle>(handles));
             AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaDisconnect);
         }
     }
@@ -1382,11 +1551,8 @@ namespace Vegetation
         AZ_PROFILE_FUNCTION(Entity);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
-        for (auto& sectorPair : m_sectorRollingWindow)
-        {
-            EmptySector(sectorPair.second);
-        }
-        m_sectorRollingWindow.clear();
+        m_sectorRollingWindow.EnumerateSectors([](SectorInfo& sectorInfo) { EmptySector(sectorInfo); });
+        m_sectorRollingWindow.Clear();
 
         // Clear any pending unregistrations; since all of the sectors have been cleared anyways, these don't affect anything
         m_unregisteredVegetationAreaSet.clear();
@@ -1419,7 +1585,7 @@ namespace Vegetation
                 // already marked *all* sectors as dirty.
                 EnumerateSectorsInAabb(bounds, worldToSector, viewRect, [&](SectorId&& sectorId)
                 {
-                    dirtySet.MarkDirty(sectorId);
+                    dirtySet.MarkDirty(sectorId, viewRect);
                     return true;
                 });
             }
@@ -1437,6 +1603,14 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugSystemDataBus::BroadcastResult(m_debugData, &DebugSystemDataBus::Events::GetDebugData));
     }
 
+    void AreaSystemComponent::VegetationThreadTasks::SetPendingSectorUpdateCount(size_t count)
+    {
+        if (m_debugData)
+        {
+            m_debugData->m_sectorUpdateQueueCount.store(static_cast<int>(count), AZStd::memory_order_relaxed);
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // PersistentThreadData
 
@@ -1472,6 +1646,13 @@ namespace Vegetation
                 // - Vegetation tasks have been queued for this thread to process
 
                 // Our main thread has potentially updated its state, so cache a new copy of the pieces of state we need.
+                // If the sector layout changed, any surface points that were gathered ahead of time are no longer valid.
+                if ((m_cachedMainThreadData.m_sectorDensity != cachedMainThreadData->m_sectorDensity) ||
+                    (m_cachedMainThreadData.m_sectorSizeInMeters != cachedMainThreadData->m_sectorSizeInMeters) ||
+                    (m_cachedMainThreadData.m_sectorPointSnapMode != cachedMainThreadData->m_sectorPointSnapMode))
+                {
+                    m_preparedSectors.clear();
+                }
                 m_cachedMainThreadData = *cachedMainThreadData;
 
                 // Run through all the queued tasks to update vegetation area active states and lists of dirty sectors
@@ -1569,7 +1750,7 @@ namespace Vegetation
             threadData->m_dirtySectorSurfacePoints.IsNoneDirty())
         {
             AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
-            if (vegTasks->m_sectorRollingWindow.empty())
+            if (vegTasks->m_sectorRollingWindow.IsEmpty())
             {
                 return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
             }
@@ -1590,7 +1771,7 @@ namespace Vegetation
             AZStd::remove_if(
                 m_updateWorkList.begin(),
                 m_updateWorkList.end(),
-                [currViewRect](const auto& entry) {return !currViewRect.IsInside(entry.first); }),
+                [currViewRect](const auto& entry) {return !currViewRect.IsInside(entry.m_sectorId); }),
             m_updateWorkList.end());
         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Refreshed RequestedUpdate list should not be larger than the view rectangle.");
 
@@ -1604,94 +1785,79 @@ namespace Vegetation
         if (deleteAllSectors)
         {
             m_updateWorkList.clear();
+            m_preparedSectors.clear();
+        }
+
+        // Throw away any surface points gathered ahead of time for sectors that are no longer in view, or whose surface
+        // data has changed since the points were gathered.
+        m_preparedSectors.erase(
+            AZStd::remove_if(
+                m_preparedSectors.begin(),
+                m_preparedSectors.end(),
+                [currViewRect, threadData](const SectorInfo& sectorInfo)
+                {
+                    return !currViewRect.IsInside(sectorInfo.m_id) || threadData->m_dirtySectorSurfacePoints.IsDirty(sectorInfo.m_id);
+                }),
+            m_preparedSectors.end());
+
+        // Map each sector in the view rectangle to its pending update request, so that new requests can find and
+        // merge with existing ones without searching the work list.
+        m_updateWorkListIndices.assign(m_viewRectSectorCount, -1);
+        for (size_t index = 0; index < m_updateWorkList.size(); ++index)
+        {
+            m_updateWorkListIndices[currViewRect.GetSectorIndex(m_updateWorkList[index].m_sectorId)] = aznumeric_cast<AZ::s32>(index);
         }
 
+        const auto requestTime = AZStd::chrono::steady_clock::now();
+
         // Run through our list of active sectors and determine which ones need adding / updating / deleting
         {
             AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-            // To create our add / update / delete lists, we need two loops.  The first loops through the *new* view rectangle
-            // looking for missing sectors to add.  The second loops through the *current* set of active sectors looking for any
-            // to update or remove.
+            // Lay out the rolling window for the new view rectangle, so the sectors in it can be looked up directly.
+            vegTasks->m_sectorRollingWindow.SetViewRect(currViewRect);
 
-            // First loop:  Determine non-existent sectors which need to be created
-            if (!deleteAllSectors)
-            {
-                for (int y = currViewRect.m_y; y < currViewRect.m_y + currViewRect.m_height; ++y)
-                {
-                    for (int x = currViewRect.m_x; x < currViewRect.m_x + currViewRect.m_width; ++x)
-                    {
-                        SectorId sectorId(x, y);
-                        if (vegTasks->m_sectorRollingWindow.find(sectorId) == vegTasks->m_sectorRollingWindow.end())
-                        {
-                            // If the sector doesn't currently exist and it belongs in the view rect, request a creation.
-                            // (This will either create a new entry or overwrite an existing pending Create request)
-                            auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry) { return (entry.first == sectorId); });
-                            if (found != m_updateWorkList.end())
-                            {
-                                // If the update entry already exists, overwrite the state.  We don't need to check or
-                                // preserve the existing state because Create is the most comprehensive update we can do.
-                                found->second = UpdateMode::Create;
-                            }
-                            else
-                            {
-                                m_updateWorkList.emplace_back(sectorId, UpdateMode::Create);
-                            }
+            // To create our add / update / delete lists, we need two loops.  The first loops through the *current* set of
+            // active sectors looking for any to update or remove.  The second loops through the *new* view rectangle looking
+            // for missing sectors to add.
 
-                            // Since we've already removed entries that aren't in the view rect, and these loops are only
-                            // adding entries in the view rect, at this point our update work list size should never get
-                            // larger than the set of sectors in the view rect.
-                            AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
-                        }
-                    }
-                }
-            }
-
-            // Second loop:  Determine any existing sectors which need to be updated or deleted
-            for (auto& sector : vegTasks->m_sectorRollingWindow)
+            // First loop:  Determine any existing sectors which need to be updated or deleted
+            vegTasks->m_sectorRollingWindow.EnumerateSectors([&](const SectorInfo& sectorInfo)
             {
-                auto& sectorId = sector.first;
+                const auto& sectorId = sectorInfo.m_id;
 
                 if (deleteAllSectors || !currViewRect.IsInside(sectorId))
                 {
                     // Active sector is no longer within view or there are no active areas, so delete it
-                    m_deleteWorkList.emplace_back(AZStd::move(sectorId));
+                    m_deleteWorkList.emplace_back(sectorId);
+                    return;
                 }
-                else if (threadData->m_dirtySectorSurfacePoints.IsDirty(sectorId))
+
+                if (threadData->m_dirtySectorSurfacePoints.IsDirty(sectorId))
                 {
                     // Active sector has new surface point information, so rebuild surface cache and fill
-                    // (This will either create a new entry, or overwrite an existing fill or rebuild request)
-                    auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry) { return (entry.first == sectorId); });
-                    if (found != m_updateWorkList.end())
-                    {
-                        // If the update entry already exists, overwrite the state.  We don't need to check or
-                        // preserve the state since it should only contain either Rebuild or Fill, and Rebuild
-                        // is more comprehensive than Fill.
-                        AZ_Assert(found->second != UpdateMode::Create, "Create requests shouldn't exist for active sectors!");
-                        found->second = UpdateMode::RebuildSurfaceCacheAndFill;
-                    }
-                    else
-                    {
-                        m_updateWorkList.emplace_back(sectorId, UpdateMode::RebuildSurfaceCacheAndFill);
-                    }
-
-                    // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
-                    AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
+                    RequestSectorUpdate(sectorId, UpdateMode::RebuildSurfaceCacheAndFill, requestTime);
                 }
                 else if (threadData->m_dirtySectorContents.IsDirty(sectorId))
                 {
                     // Active sector has new veg area information, so refill it.
-                    auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry)
-                    { return (entry.first == sectorId); });
-                    if (found == m_updateWorkList.end())
-                    {
-                        // Only add Fill entries if no update request exists for this sector.  We don't
-                        // overwrite existing entries because an existing entry might have previously
-                        // requested "RebuildSurfaceCacheAndFill", which is more comprehensive than this request.
-                        m_updateWorkList.emplace_back(sectorId, UpdateMode::Fill);
+                    RequestSectorUpdate(sectorId, UpdateMode::Fill, requestTime);
+                }
+            });
 
-                        // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
-                        AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
+            // Second loop:  Determine non-existent sectors which need to be created
+            if (!deleteAllSectors)
+            {
+                for (int y = currViewRect.m_y; y < currViewRect.m_y + currViewRect.m_height; ++y)
+                {
+                    for (int x = currViewRect.m_x; x < currViewRect.m_x + currViewRect.m_width; ++x)
+                    {
+                        const SectorId sectorId(x, y);
+                        if (!vegTasks->m_sectorRollingWindow.GetSector(sectorId))
+                        {
+                            // If the sector doesn't currently exist and it belongs in the view rect, request a creation.
+                            RequestSectorUpdate(sectorId, UpdateMode::Create, requestTime);
+                        }
                     }
                 }
             }
@@ -1740,7 +1906,7 @@ namespace Vegetation
             {
                 // We always pull from the end of the list, so we sort the *closest* sectors to the end.
                 // That way we create / update the closest sectors first.
-                return sectorCompare(lhs.first, rhs.first, false);
+                return sectorCompare(lhs.m_sectorId, rhs.m_sectorId, false);
             });
 
             AZStd::sort(m_deleteWorkList.begin(), m_deleteWorkList.end(), [sectorCompare](const auto& lhs, const auto& rhs)
@@ -1768,7 +1934,7 @@ namespace Vegetation
         {
             AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-            if ((vegTasks->m_sectorRollingWindow.size() > m_viewRectSectorCount) || m_updateWorkList.empty())
+            if ((vegTasks->m_sectorRollingWindow.GetNumSectors() > m_viewRectSectorCount) || m_updateWorkList.empty())
             {
                 vegTasks->DeleteSector(m_deleteWorkList.back());
                 m_deleteWorkList.pop_back();
@@ -1779,10 +1945,15 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
+            // Gather the surface points for the closest few sectors in parallel before processing them one at a time.
+            if (m_updateWorkList.back().m_mode != UpdateMode::Fill)
+            {
+                PrepareSectorPoints(vegTasks);
+            }
+
+            const SectorUpdateRequest request = m_updateWorkList.back();
             m_updateWorkList.pop_back();
+            vegTasks->SetPendingSectorUpdateCount(m_updateWorkList.size());
 
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
@@ -1791,30 +1962,45 @@ namespace Vegetation
                 auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
                 auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
 
-                switch (mode)
+                // Claims are still processed one sector at a time, since the area buses serialize their handlers and areas
+                // connect and disconnect their bus handlers around each claim pass.
+                switch (request.m_mode)
                 {
                     case UpdateMode::RebuildSurfaceCacheAndFill:
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
+                        auto sectorInfo = vegTasks->GetSector(request.m_sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        SectorInfo preparedSector;
+                        if (TakePreparedSector(request.m_sectorId, preparedSector))
+                        {
+                            // Only the surface points are replaced, the existing claims are needed to reuse unchanged instances.
+                            sectorInfo->m_baseContext.m_masks = AZStd::move(preparedSector.m_baseContext.m_masks);
+                            sectorInfo->m_baseContext.m_availablePoints = AZStd::move(preparedSector.m_baseContext.m_availablePoints);
+                        }
+                        else
+                        {
+                            vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        }
+                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, request.m_requestTime);
                     }
                     break;
 
                     case UpdateMode::Fill:
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
+                        auto sectorInfo = vegTasks->GetSector(request.m_sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, request.m_requestTime);
                     }
                     break;
 
                     case UpdateMode::Create:
                     {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        AZ_Assert(!vegTasks->GetSector(request.m_sectorId), "Sector update mode is 'Create' but sector already exists");
+                        SectorInfo preparedSector;
+                        auto sectorInfo = TakePreparedSector(request.m_sectorId, preparedSector)
+                            ? vegTasks->AddSector(AZStd::move(preparedSector))
+                            : vegTasks->CreateSector(request.m_sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, request.m_requestTime);
                     }
                     break;
                 }
@@ -1827,4 +2013,109 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::RequestSectorUpdate(
+        const SectorId& sectorId, UpdateMode mode, AZStd::chrono::steady_clock::time_point requestTime)
+    {
+        AZ::s32& workListIndex = m_updateWorkListIndices[m_cachedMainThreadData.m_currViewRect.GetSectorIndex(sectorId)];
+        if (workListIndex < 0)
+        {
+            workListIndex = aznumeric_cast<AZ::s32>(m_updateWorkList.size());
+            m_updateWorkList.push_back({ sectorId, mode, requestTime });
+
+            // Since we've already removed entries that aren't in the view rect, and we only add entries in the view rect,
+            // our update work list size should never get larger than the set of sectors in the view rect.
+            AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
+            return;
+        }
+
+        // An update is already pending, so keep whichever mode is more comprehensive.  Create is the most comprehensive,
+        // and RebuildSurfaceCacheAndFill is more comprehensive than Fill.  The original request time is kept so that the
+        // measured latency includes the entire time the sector has been waiting.
+        auto& request = m_updateWorkList[workListIndex];
+        AZ_Assert((mode == UpdateMode::Create) || (request.m_mode != UpdateMode::Create), "Create requests shouldn't exist for active sectors!");
+        if ((mode == UpdateMode::Create) || ((mode == UpdateMode::RebuildSurfaceCacheAndFill) && (request.m_mode == UpdateMode::Fill)))
+        {
+            request.m_mode = mode;
+        }
+    }
+
+    void AreaSystemComponent::UpdateContext::PrepareSectorPoints(VegetationThreadTasks* vegTasks)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        auto isPrepared = [this](const SectorId& sectorId)
+        {
+            return AZStd::any_of(m_preparedSectors.begin(), m_preparedSectors.end(),
+                [&sectorId](const SectorInfo& sectorInfo) { return sectorInfo.m_id == sectorId; });
+        };
+
+        // If the next sector to process already has its points, the previous batch is still being worked through.
+        if (isPrepared(m_updateWorkList.back().m_sectorId))
+        {
+            return;
+        }
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t maxSectors = (veg_maxParallelSectorUpdates > 0)
+            ? static_cast<size_t>(static_cast<uint32_t>(veg_maxParallelSectorUpdates))
+            : (jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0);
+        if (maxSectors <= 1)
+        {
+            // There's nothing to gain from a single job, so let the sector gather its own points when it gets processed.
+            return;
+        }
+
+        const auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        // The work list is sorted with the closest sectors at the back, so walk it backwards to pick the closest sectors that
+        // need new surface points.  All of the sectors are added before any jobs start so that the list doesn't reallocate
+        // while the jobs are writing into it.
+        const size_t firstNewSector = m_preparedSectors.size();
+        for (auto request = m_updateWorkList.rbegin();
+             (request != m_updateWorkList.rend()) && ((m_preparedSectors.size() - firstNewSector) < maxSectors);
+             ++request)
+        {
+            if ((request->m_mode != UpdateMode::Fill) && !isPrepared(request->m_sectorId))
+            {
+                SectorInfo& sectorInfo = m_preparedSectors.emplace_back();
+                sectorInfo.m_id = request->m_sectorId;
+                sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(request->m_sectorId, sectorSizeInMeters);
+            }
+        }
+
+        const size_t numNewSectors = m_preparedSectors.size() - firstNewSector;
+        AZ::JobEmpty batch(false, jobContext);
+        for (size_t index = 0; index < numNewSectors; ++index)
+        {
+            SectorInfo* sectorInfo = &m_preparedSectors[firstNewSector + index];
+
+            // Closer sectors get a higher priority so that they're picked up first when the job system is busy.
+            const AZ::s8 priority = aznumeric_cast<AZ::s8>(AZStd::GetMin<size_t>(numNewSectors - index, AZStd::numeric_limits<AZ::s8>::max()));
+            auto job = AZ::CreateJobFunction(
+                [vegTasks, sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                {
+                    vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                },
+                true, jobContext, priority);
+            job->SetDependent(&batch);
+            job->Start();
+        }
+        batch.StartAndWaitForCompletion();
+    }
+
+    bool AreaSystemComponent::UpdateContext::TakePreparedSector(const SectorId& sectorId, SectorInfo& sectorInfo)
+    {
+        auto preparedSector = AZStd::find_if(m_preparedSectors.begin(), m_preparedSectors.end(),
+            [&sectorId](const SectorInfo& preparedSectorInfo) { return preparedSectorInfo.m_id == sectorId; });
+        if (preparedSector == m_preparedSectors.end())
+        {
+            return false;
+        }
+
+        sectorInfo = AZStd::move(*preparedSector);
+        m_preparedSectors.erase(preparedSector);
+        return true;
+    }
 }
@@ -15,12 +15,21 @@
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <GradientSignal/Ebuses/SectorDataRequestBus.h>
 #include <SurfaceData/SurfaceDataSystemNotificationBus.h>
+#include <SurfaceData/SurfacePointList.h>
+#include <SurfaceData/Utility/ObjectPool.h>
 #include <CrySystemBus.h>
 #include <ISystem.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 
+namespace UnitTest
+{
+    class VegetationSectorUpdateTests;
+}
+
 namespace Vegetation
 {
     struct DebugData;
@@ -87,6 +96,7 @@ namespace Vegetation
     {
     public:
         friend class EditorAreaSystemComponent;
+        friend class ::UnitTest::VegetationSectorUpdateTests;
         AZ_COMPONENT(AreaSystemComponent, "{7CE8E791-6BC6-4C88-8727-A476DE00F9A1}");
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
@@ -197,31 +207,6 @@ namespace Vegetation
         using VegetationAreaVector = AZStd::vector<VegetationAreaInfo>;
         using UnregisteredVegetationAreaMap = AZStd::unordered_map<SectorId, AZStd::unordered_set<AZ::EntityId>>;
 
-        //! Helper class to track whether or not a visible sector is dirty.  Different instances of this
-        //! class are used to track different reasons for being dirty.
-        //! This is a class instead of just an unordered_set<> so that we can also encapsulate the optimization
-        //! of tracking when *all* sectors are dirty.
-        class DirtySectors
-        {
-            public:
-                DirtySectors() = default;
-                ~DirtySectors() = default;
-
-                void MarkDirty(const SectorId& id);
-                void MarkAllDirty();
-                bool IsAllDirty() const { return m_allSectorsDirty; }
-                bool IsNoneDirty() const { return (!m_allSectorsDirty) && m_dirtySet.empty(); }
-                bool IsDirty(const SectorId& id) const;
-                void Clear();
-
-            private:
-                using DirtySectorSet = AZStd::unordered_set<SectorId>;
-                DirtySectorSet m_dirtySet;
-                //! Flag when *all* existing sectors are dirty
-                bool m_allSectorsDirty = false;
-        };
-
-
         // ViewRect is a helper struct to manage the "scrolling view rectangle".  This view rectangle controls the
         // set of active spawned vegetation.
         struct ViewRect
@@ -245,9 +230,11 @@ namespace Vegetation
 
             bool IsInside(const SectorId& sector) const;
             ViewRect Overlap(const ViewRect& b) const;
-            bool operator !=(const ViewRect& b);
-            bool operator ==(const ViewRect& b);
+            bool operator !=(const ViewRect& b) const;
+            bool operator ==(const ViewRect& b) const;
             size_t GetNumSectors() const;
+            //! Gets the row-major index of a sector within the view rectangle.  The sector must be inside the view rectangle.
+            size_t GetSectorIndex(const SectorId& sector) const;
             int GetMinXSector() const { return m_x; }
             int GetMinYSector() const { return m_y; }
             int GetMaxXSector() const { return m_x + m_width - 1; }
@@ -257,6 +244,88 @@ namespace Vegetation
             AZ::Aabb GetViewRectBounds() const { return m_viewRectBounds; }
         };
 
+        //! Helper class to track whether or not a visible sector is dirty.  Different instances of this
+        //! class are used to track different reasons for being dirty.
+        //! The dirty state is stored as a flat grid covering the view rectangle that the sectors were marked with, since
+        //! only sectors inside the view rectangle ever get updated.  The class also encapsulates the optimization
+        //! of tracking when *all* sectors are dirty.
+        class DirtySectors
+        {
+            public:
+                DirtySectors() = default;
+                ~DirtySectors() = default;
+
+                //! Marks a sector in the given view rectangle as dirty.  Sectors outside the view rectangle are ignored.
+                //! If the view rectangle changes while sectors are still marked as dirty, all sectors get marked as dirty.
+                void MarkDirty(const SectorId& id, const ViewRect& viewRect);
+                void MarkAllDirty();
+                bool IsAllDirty() const { return m_allSectorsDirty; }
+                bool IsNoneDirty() const { return (!m_allSectorsDirty) && (m_dirtyCount == 0); }
+                bool IsDirty(const SectorId& id) const;
+                void Clear();
+
+            private:
+                //! The view rectangle that the dirty flags are laid out in.
+                ViewRect m_viewRect;
+                //! One flag per sector in the view rectangle, stored in row-major order.
+                AZStd::vector<AZ::u8> m_dirtyFlags;
+                size_t m_dirtyCount = 0;
+                //! Flag when *all* existing sectors are dirty
+                bool m_allSectorsDirty = false;
+        };
+
+        //! The sectors that are currently active, which are the sectors that store vegetation instances.
+        //! Sectors inside the view rectangle are stored in a flat grid covering the view rectangle, so that they can be
+        //! looked up without hashing.  Sectors that scrolled out of the view rectangle stay active until they get deleted,
+        //! so these are kept in a short overflow list until then.  Each sector is allocated separately, so that pointers
+        //! and references to a sector stay valid until the sector gets removed.
+        class SectorRollingWindow
+        {
+            public:
+                SectorRollingWindow() = default;
+                ~SectorRollingWindow() = default;
+
+                //! Moves the sectors between the grid and the overflow list to match the given view rectangle.
+                void SetViewRect(const ViewRect& viewRect);
+
+                SectorInfo* GetSector(const SectorId& id) const;
+                //! Adds the sector, replacing any existing sector with the same id.
+                SectorInfo& AddSector(SectorInfo&& sectorInfo);
+                void RemoveSector(const SectorId& id);
+                void Clear();
+
+                size_t GetNumSectors() const { return m_numSectors; }
+                bool IsEmpty() const { return m_numSectors == 0; }
+
+                //! Calls the given function on each active sector.  Sectors must not be added or removed while enumerating.
+                template<class Fn>
+                void EnumerateSectors(Fn&& fn) const
+                {
+                    for (const auto& slot : m_grid)
+                    {
+                        if (slot)
+                        {
+                            fn(*slot);
+                        }
+                    }
+                    for (const auto& sector : m_sectorsOutsideViewRect)
+                    {
+                        fn(*sector);
+                    }
+                }
+
+            private:
+                AZStd::unique_ptr<SectorInfo>* FindSlot(const SectorId& id);
+
+                //! The view rectangle that the grid is laid out in.
+                ViewRect m_viewRect;
+                //! One entry per sector in the view rectangle, stored in row-major order.  Empty entries are null.
+                AZStd::vector<AZStd::unique_ptr<SectorInfo>> m_grid;
+                //! Active sectors that are outside of the view rectangle.
+                AZStd::vector<AZStd::unique_ptr<SectorInfo>> m_sectorsOutsideViewRect;
+                size_t m_numSectors = 0;
+        };
+
         // Forward declarations, these get defined further down.
         class UpdateContext;
         class PersistentThreadData;
@@ -292,8 +361,12 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Adds a sector whose surface points have already been gathered to the rolling window.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
+            //! Gathers the available surface points for a sector.  This only touches the given sector, so it's safe to call on
+            //! several sectors at once from different threads as long as they aren't in the rolling window yet.
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
+            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, AZStd::chrono::steady_clock::time_point requestTime);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
 
@@ -301,12 +374,12 @@ namespace Vegetation
             static AZ::Aabb GetSectorBounds(const SectorId& sectorId, int sectorSizeInMeters);
 
             void FetchDebugData();
+            void SetPendingSectorUpdateCount(size_t count);
 
             void MarkDirtySectors(const AZ::Aabb& bounds, DirtySectors& dirtySet, float worldToSector, const ViewRect& viewRect);
             void AddUnregisteredVegetationArea(const VegetationAreaInfo& area, float worldToSector, const ViewRect& viewRect);
 
             //! 2D Array rolling window of sectors that store vegetation objects.
-            using SectorRollingWindow = AZStd::unordered_map<SectorId, SectorInfo>;
             mutable AZStd::recursive_mutex m_sectorRollingWindowMutex;
             SectorRollingWindow m_sectorRollingWindow;
 
@@ -341,6 +414,9 @@ namespace Vegetation
             //! Cached pointer to the debug data.
             //! Note: This doesn't have an associated mutex because DebugData itself consists purely of atomics
             DebugData* m_debugData = nullptr;
+
+            //! Surface point lists reserved for reuse when gathering the available points for a sector.
+            SurfaceData::ObjectPool<SurfaceData::SurfacePointList> m_surfacePointListPool;
         };
 
         //! Helper struct to hold the state data used by the vegetation thread.  This contains all the data
@@ -421,6 +497,8 @@ namespace Vegetation
         class UpdateContext
         {
         public:
+            friend class ::UnitTest::VegetationSectorUpdateTests;
+
             UpdateContext() = default;
 
             void Run(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks, CachedMainThreadData* cachedMainThreadData);
@@ -438,13 +516,41 @@ namespace Vegetation
                 Fill
             };
 
+            struct SectorUpdateRequest
+            {
+                SectorId m_sectorId;
+                UpdateMode m_mode = UpdateMode::Fill;
+                //! The time the update was first requested, used for measuring the sector fill latency.
+                AZStd::chrono::steady_clock::time_point m_requestTime;
+            };
+
+            //! Adds a request to the update work list, or updates the mode of an existing request for the same sector.
+            //! m_updateWorkListIndices must be up to date with m_updateWorkList when calling this.
+            void RequestSectorUpdate(const SectorId& sectorId, UpdateMode mode, AZStd::chrono::steady_clock::time_point requestTime);
+
+            //! Gathers the surface points for the closest sectors in the update work list that need them, in parallel on the
+            //! job system. The results are kept in m_preparedSectors until the sectors get processed.
+            void PrepareSectorPoints(VegetationThreadTasks* vegTasks);
+
+            //! Removes a prepared sector from m_preparedSectors, returning true if it was found.
+            bool TakePreparedSector(const SectorId& sectorId, SectorInfo& sectorInfo);
+
             // The sorted work list of sectors to delete.  The list is recreated every time UpdateSectorWorkLists() is run.
             AZStd::vector<SectorId> m_deleteWorkList;
 
             // The sorted work list of sectors to create / update.  This is incrementally modified when UpdateSectorWorkLists()
             // is run, because any previously-requested updates that are still in view need to be preserved.  They can't simply
             // be recalculated.
-            AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
+            AZStd::vector<SectorUpdateRequest> m_updateWorkList;
+
+            // The index of each sector's entry in m_updateWorkList, or -1 if the sector has no pending update.  This is a flat
+            // grid covering the view rectangle that is rebuilt in UpdateSectorWorkLists(), and is kept persistent to avoid
+            // reallocating it on every update.
+            AZStd::vector<AZ::s32> m_updateWorkListIndices;
+
+            // Sectors that have had their surface points gathered ahead of time, and are waiting for their turn to get filled.
+            // This only ever holds a handful of sectors, so a linear search is cheaper than a map lookup.
+            AZStd::vector<SectorInfo> m_preparedSectors;
 
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
@@ -314,6 +314,26 @@ namespace Vegetation
         }
     }
 
+    void AreaBlenderComponent::UnclaimPositions(AZStd::span<const ClaimHandle> handles)
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
+
+        AZ_ErrorOnce(
+            "Vegetation", !AreaRequestBus::HasReentrantEBusUseThisThread(),
+            "Detected cyclic dependencies with vegetation entity references on entity '%s' (%s)", GetEntity()->GetName().c_str(),
+            GetEntityId().ToString().c_str());
+
+        if (!AreaRequestBus::HasReentrantEBusUseThisThread())
+        {
+            for (const auto& entityId : m_configuration.m_vegetationAreaIds)
+            {
+                AreaNotificationBus::Event(entityId, &AreaNotificationBus::Events::OnAreaConnect);
+                AreaRequestBus::Event(entityId, &AreaRequestBus::Events::UnclaimPositions, handles);
+                AreaNotificationBus::Event(entityId, &AreaNotificationBus::Events::OnAreaDisconnect);
+            }
+        }
+    }
+
     AZ::Aabb AreaBlenderComponent::GetEncompassingAabb() const
     {
         AZ_PROFILE_FUNCTION(Vegetation);
@@ -284,8 +284,9 @@ void DebugComponent::DrawSectorTimingData(const AzFramework::ViewportInfo& viewp
 
         if (distanceToCamera <= maxTextDisplayDistance)
         {
-            AZStd::string displayString = AZStd::string::format("Sector %d, %d\nTime: %dus\nUpdate Count: %d", sectorTiming.m_id.first,
-                sectorTiming.m_id.second, static_cast<int>(sectorTiming.m_averageTimeUs), sectorTiming.m_updateCount);
+            AZStd::string displayString = AZStd::string::format("Sector %d, %d\nTime: %dus\nLatency: %dus\nUpdate Count: %d",
+                sectorTiming.m_id.first, sectorTiming.m_id.second, static_cast<int>(sectorTiming.m_averageTimeUs),
+                static_cast<int>(sectorTiming.m_lastLatencyUs), sectorTiming.m_updateCount);
 
             constexpr bool centerText = true;
             constexpr float fontSize = 0.7f;
@@ -332,6 +333,15 @@ void DebugComponent::FillSectorEnd([[maybe_unused]] int sectorX, [[maybe_unused]
     m_currentSectorTiming.m_perAreaTracking.clear();
 }
 
+void DebugComponent::FillSectorLatency(int sectorX, int sectorY, TimeSpan latencyUs)
+{
+    // The latency is reported right after the sector's fill ends, so it belongs to the most recently recorded sector.
+    if (!m_sectorData.empty() && (m_sectorData.back().m_id == AZStd::make_pair(sectorX, sectorY)))
+    {
+        m_sectorData.back().m_latencyUs = latencyUs;
+    }
+}
+
 namespace DebugComponentUtilities
 {
     template <typename ValueType>
@@ -642,7 +652,7 @@ namespace DebugUtility
         {
         case Vegetation::DebugRequests::SortType::BySector:
         {
-            written = azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "sector x, sector y, update count, avg update time ms, peak update time ms, lowest update time ms, total update time ms, number of instances created, number of unused claim points, worldPos X, WorldPos Y,\n");
+            written = azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "sector x, sector y, update count, avg update time ms, peak update time ms, lowest update time ms, total update time ms, number of instances created, number of unused claim points, last latency ms, peak latency ms, worldPos X, WorldPos Y,\n");
         }
         break;
         case Vegetation::DebugRequests::SortType::BySectorDetailed:
@@ -719,7 +729,7 @@ namespace DebugUtility
             {
                 DebugRequests::SectorTiming* sectorTiming = (DebugRequests::SectorTiming*)s;
                 DebugRequests::SectorId sectorId = sectorTiming->m_id;
-                written = azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "%d, %d, %d, %4.2f, %4.2f, %4.2f, %4.2f, %d, %d, %8.1f, %8.1f,\n",
+                written = azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "%d, %d, %d, %4.2f, %4.2f, %4.2f, %4.2f, %d, %d, %4.2f, %4.2f, %8.1f, %8.1f,\n",
                     sectorId.first, sectorId.second,
                     s->m_updateCount,
                     s->m_averageTimeUs / 1000.0f,
@@ -728,6 +738,8 @@ namespace DebugUtility
                     s->m_totalUpdateTimeUs / 1000.0f,
                     s->m_numInstancesCreated,
                     sectorTiming->m_numClaimPointsRemaining,
+                    sectorTiming->m_lastLatencyUs / 1000.0f,
+                    sectorTiming->m_peakLatencyUs / 1000.0f,
                     (float)sectorTiming->m_worldPosition.GetX(),
                     (float)sectorTiming->m_worldPosition.GetY());
 
@@ -863,6 +875,9 @@ void DebugComponent::PrepareNextReport()
     },
     [](const SectorTracker& sectorTracker, SectorTiming& sectorTiming)
     {
+        sectorTiming.m_lastLatencyUs = sectorTracker.m_latencyUs;
+        sectorTiming.m_peakLatencyUs = AZ::GetMax(sectorTiming.m_peakLatencyUs, sectorTracker.m_latencyUs);
+
         for (const auto& sectorTracking : sectorTracker.m_perAreaTracking)
         {
             const AreaId& areaId = sectorTracking.first;
@@ -939,6 +954,8 @@ void DebugComponent::PrepareNextReport()
     m_thePerformanceReport.m_lastUpdateTime = AZStd::chrono::steady_clock::now();
     DebugUtility::MergeResults(sectorTimingMap, m_thePerformanceReport.m_sectorTimingData, m_thePerformanceReport.m_lastUpdateTime, [](const SectorTiming& newTiming, SectorTiming& timing)
     {
+        timing.m_lastLatencyUs = newTiming.m_lastLatencyUs;
+        timing.m_peakLatencyUs = AZ::GetMax(timing.m_peakLatencyUs, newTiming.m_peakLatencyUs);
         for (const auto& newData : newTiming.m_perAreaData)
         {
             timing.m_perAreaData[newData.first] = newData.second;
@@ -974,9 +991,11 @@ void DebugComponent::DrawDebugStats(AzFramework::DebugDisplayRequests& debugDisp
         40.0f, 22.0f, 0.7f,
         AZStd::string::format(
             "VegetationSystemStats:\nActive Instances Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d\nThread "
-            "Queue Count: %d\nThread Processing Count: %d",
+            "Queue Count: %d\nThread Processing Count: %d\nSector Update Queue: %d\nSector Fill Latency: %dus",
             instanceCount, createTaskCount, destroyTaskCount, m_debugData->m_areaTaskQueueCount.load(AZStd::memory_order_relaxed),
-            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed))
+            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed),
+            m_debugData->m_sectorUpdateQueueCount.load(AZStd::memory_order_relaxed),
+            m_debugData->m_sectorFillLatencyUs.load(AZStd::memory_order_relaxed))
             .c_str(),
         false);
 }
@@ -92,6 +92,7 @@ namespace Vegetation
         // DebugNotifications
         void FillSectorStart(int sectorX, int sectorY, TimePoint timePoint) override;
         void FillSectorEnd(int sectorX, int sectorY, TimePoint timePoint, AZ::u32 unusedClaimPointCount) override;
+        void FillSectorLatency(int sectorX, int sectorY, TimeSpan latencyUs) override;
         void FillAreaStart(AZ::EntityId areaId, TimePoint timePoint) override;
         void MarkAreaRejectedByMask(AZ::EntityId areaId) override;
         void FillAreaEnd(AZ::EntityId areaId, TimePoint timePoint, AZ::u32 unusedClaimPointCount) override;
@@ -162,6 +163,7 @@ namespace Vegetation
             TimePoint m_end;
             size_t m_numInstancesCreated = 0;// number of instances in the sector over all areas.
             size_t m_numClaimPointsRemaining = 0;
+            TimeSpan m_latencyUs = 0;
             AZStd::unordered_map<AreaId, SectorAreaData> m_perAreaTracking;
         };
         using SectorData = AZStd::vector<SectorTracker>;
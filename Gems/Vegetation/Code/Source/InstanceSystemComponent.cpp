@@ -13,6 +13,8 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <Vegetation/Ebuses/AreaInfoBus.h>
@@ -261,6 +263,22 @@ namespace Vegetation
         }
     }
 
+    bool InstanceSystemComponent::PrepareInstanceCreation(InstanceData& instanceData)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        //generate new instance id, from pool if entries exist
+        instanceData.m_instanceId = CreateInstanceId();
+        if (instanceData.m_instanceId == InvalidInstanceId)
+        {
+            return false;
+        }
+
+        // Doing this here risks a slighly inaccurate count if the Create*Node functions fail, but I need this to happen on the vegetation thread so the events are recorded in order.
+        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
+        return true;
+    }
+
     void InstanceSystemComponent::CreateInstance(InstanceData& instanceData)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
@@ -274,23 +292,47 @@ namespace Vegetation
             return;
         }
 
-        //generate new instance id, from pool if entries exist
-        instanceData.m_instanceId = CreateInstanceId();
-        if (instanceData.m_instanceId == InvalidInstanceId)
+        if (PrepareInstanceCreation(instanceData))
         {
-            return;
+            //queue render node related tasks to process on the main thread
+            AddCreateTasks(AZStd::span<const InstanceData>(&instanceData, 1));
         }
+    }
 
-        // Doing this here risks a slighly inaccurate count if the Create*Node functions fail, but I need this to happen on the vegetation thread so the events are recorded in order.
-        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
+    void InstanceSystemComponent::CreateInstances(AZStd::span<InstanceData> instanceData)
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
 
-        //queue render node related tasks to process on the main thread
-        AddTask([this, instanceData]() {
-            CreateInstanceNode(instanceData);
-            m_createTaskCount--;
-        });
+        // Hold the id lock for the whole batch instead of reacquiring it for every instance.
+        AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
+
+        // Batches usually contain long runs of the same descriptor, so only validate a descriptor when it changes.
+        DescriptorPtr lastDescriptorPtr;
+        bool lastDescriptorValid = false;
 
-        m_createTaskCount++;
+        // Queue the instances in contiguous runs, splitting the runs around any instances that can't be created.
+        size_t runStart = 0;
+        for (size_t index = 0; index < instanceData.size(); ++index)
+        {
+            InstanceData& instance = instanceData[index];
+            if (!lastDescriptorPtr || (instance.m_descriptorPtr != lastDescriptorPtr))
+            {
+                lastDescriptorPtr = instance.m_descriptorPtr;
+                lastDescriptorValid = IsDescriptorValid(lastDescriptorPtr);
+            }
+
+            if (!lastDescriptorValid)
+            {
+                instance.m_instanceId = InvalidInstanceId;
+            }
+
+            if (!lastDescriptorValid || !PrepareInstanceCreation(instance))
+            {
+                AddCreateTasks(instanceData.subspan(runStart, index - runStart));
+                runStart = index + 1;
+            }
+        }
+        AddCreateTasks(instanceData.subspan(runStart));
     }
 
     void InstanceSystemComponent::DestroyInstance(InstanceId instanceId)
@@ -306,17 +348,27 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            ReleaseInstanceNode(instanceId);
+        AddDestroyTasks(AZStd::span<const InstanceId>(&instanceId, 1));
+    }
 
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-            m_destroyTaskCount--;
-        });
+    void InstanceSystemComponent::DestroyInstances(AZStd::span<const InstanceId> instanceIds)
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
 
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        m_instanceDeletionSet.insert(instanceId);
-        m_destroyTaskCount++;
+        size_t runStart = 0;
+        for (size_t index = 0; index < instanceIds.size(); ++index)
+        {
+            if (instanceIds[index] == InvalidInstanceId)
+            {
+                AddDestroyTasks(instanceIds.subspan(runStart, index - runStart));
+                runStart = index + 1;
+                continue;
+            }
+
+            // do this here so we retain a correct ordering of events based on the vegetation thread.
+            VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceIds[index]));
+        }
+        AddDestroyTasks(instanceIds.subspan(runStart));
     }
 
     void InstanceSystemComponent::DestroyAllInstances()
@@ -433,80 +485,147 @@ namespace Vegetation
         m_instanceIdPool.insert(instanceId);
     }
 
-    bool InstanceSystemComponent::IsInstanceSkippable(const InstanceData& instanceData) const
+    void InstanceSystemComponent::CreateInstanceNodes(AZStd::vector<InstanceData>& instances)
     {
-        VEGETATION_PROFILE_FUNCTION_VERBOSE
-
-        //if the instance was queued for deletion before its creation task executed then skip it
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        return instanceData.m_instanceId == InvalidInstanceId || m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end();
-    }
-
-    void InstanceSystemComponent::CreateInstanceNode(const InstanceData& instanceData)
-    {
-        VEGETATION_PROFILE_FUNCTION_VERBOSE
+        AZ_PROFILE_FUNCTION(Vegetation);
 
-        if (IsInstanceSkippable(instanceData))
+        //if an instance was queued for deletion before its creation task executed then skip it
         {
-            return;
+            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+            instances.erase(
+                AZStd::remove_if(instances.begin(), instances.end(), [this](const InstanceData& instanceData)
+                {
+                    return instanceData.m_instanceId == InvalidInstanceId ||
+                        m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end();
+                }),
+                instances.end());
         }
 
-        // Only support valid, registered descriptors with loaded assets
-        if (!instanceData.m_descriptorPtr || !instanceData.m_descriptorPtr->IsLoaded())
+        // Group the instances by descriptor so that each spawner receives all of its instances in one contiguous run.
+        AZStd::sort(instances.begin(), instances.end(), [](const InstanceData& lhs, const InstanceData& rhs)
         {
-            //descriptor and mesh must be valid but it's not an error
-            //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
-            //this should result in a composition change and refresh
-            return;
-        }
+            return lhs.m_descriptorPtr.get() < rhs.m_descriptorPtr.get();
+        });
 
+        AZStd::vector<InstancePtr> createdInstances(instances.size(), nullptr);
+        for (size_t runStart = 0; runStart < instances.size(); )
         {
-            AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
+            const DescriptorPtr& descriptorPtr = instances[runStart].m_descriptorPtr;
+            size_t runEnd = runStart + 1;
+            while ((runEnd < instances.size()) && (instances[runEnd].m_descriptorPtr == descriptorPtr))
+            {
+                ++runEnd;
+            }
 
-            auto descItr = m_uniqueDescriptors.find(instanceData.m_descriptorPtr);
-            if (descItr == m_uniqueDescriptors.end())
+            // Only support valid, registered descriptors with loaded assets.
+            // The descriptor and mesh must be valid but it's not an error if they aren't.  An edit, asset change, or other
+            // event could have released descriptors or render groups on this or another thread, which should result in a
+            // composition change and refresh.
+            bool canCreate = descriptorPtr && descriptorPtr->IsLoaded();
+            if (canCreate)
             {
                 //descriptor must be registered with the system to create an instance.
                 //it could have been removed or re-added while editing or deleting entities that control the registration
-                return;
+                AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
+                canCreate = m_uniqueDescriptors.find(descriptorPtr) != m_uniqueDescriptors.end();
             }
-        }
 
-        InstancePtr opaqueInstanceData = instanceData.m_descriptorPtr->CreateInstance(instanceData);
+            if (canCreate)
+            {
+                const size_t runSize = runEnd - runStart;
+                descriptorPtr->CreateInstances(
+                    AZStd::span<const InstanceData>(instances.data() + runStart, runSize),
+                    AZStd::span<InstancePtr>(createdInstances.data() + runStart, runSize));
+            }
 
-        if (opaqueInstanceData)
+            runStart = runEnd;
+        }
+
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        for (size_t index = 0; index < instances.size(); ++index)
         {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-            m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstanceData);
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
+            if (createdInstances[index])
+            {
+                const InstanceData& instanceData = instances[index];
+                AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
+                m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, createdInstances[index]);
+            }
         }
+        m_instanceCount = static_cast<int>(m_instanceMap.size());
     }
 
-    void InstanceSystemComponent::ReleaseInstanceNode(InstanceId instanceId)
+    void InstanceSystemComponent::ReleaseInstanceNodes(const AZStd::vector<InstanceId>& instanceIds)
     {
         AZ_PROFILE_FUNCTION(Vegetation);
 
-        DescriptorPtr descriptor = nullptr;
-        InstancePtr opaqueInstanceData = nullptr;
+        struct ReleasedInstance
+        {
+            DescriptorPtr m_descriptorPtr;
+            InstanceId m_instanceId = InvalidInstanceId;
+            InstancePtr m_instance = nullptr;
+        };
 
+        AZStd::vector<ReleasedInstance> releasedInstances;
+        releasedInstances.reserve(instanceIds.size());
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            auto instanceItr = m_instanceMap.find(instanceId);
-            if (instanceItr != m_instanceMap.end())
+            for (InstanceId instanceId : instanceIds)
             {
-                descriptor = instanceItr->second.first;
-                opaqueInstanceData = instanceItr->second.second;
-                m_instanceMap.erase(instanceItr);
+                auto instanceItr = m_instanceMap.find(instanceId);
+                if (instanceItr != m_instanceMap.end())
+                {
+                    releasedInstances.push_back({ instanceItr->second.first, instanceId, instanceItr->second.second });
+                    m_instanceMap.erase(instanceItr);
+                }
             }
             m_instanceCount = static_cast<int>(m_instanceMap.size());
         }
 
-        if (opaqueInstanceData)
+        // Group the instances by descriptor so that each spawner destroys all of its instances with one call.
+        AZStd::sort(releasedInstances.begin(), releasedInstances.end(), [](const ReleasedInstance& lhs, const ReleasedInstance& rhs)
+        {
+            return lhs.m_descriptorPtr.get() < rhs.m_descriptorPtr.get();
+        });
+
+        AZStd::vector<InstanceId> releasedIds(releasedInstances.size());
+        AZStd::vector<InstancePtr> releasedPtrs(releasedInstances.size());
+        for (size_t index = 0; index < releasedInstances.size(); ++index)
+        {
+            releasedIds[index] = releasedInstances[index].m_instanceId;
+            releasedPtrs[index] = releasedInstances[index].m_instance;
+        }
+
+        for (size_t runStart = 0; runStart < releasedInstances.size(); )
+        {
+            const DescriptorPtr& descriptorPtr = releasedInstances[runStart].m_descriptorPtr;
+            size_t runEnd = runStart + 1;
+            while ((runEnd < releasedInstances.size()) && (releasedInstances[runEnd].m_descriptorPtr == descriptorPtr))
+            {
+                ++runEnd;
+            }
+
+            const size_t runSize = runEnd - runStart;
+            descriptorPtr->DestroyInstances(
+                AZStd::span<const InstanceId>(releasedIds.data() + runStart, runSize),
+                AZStd::span<const InstancePtr>(releasedPtrs.data() + runStart, runSize));
+
+            runStart = runEnd;
+        }
+
         {
-            descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+            AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
+            for (InstanceId instanceId : instanceIds)
+            {
+                ReleaseInstanceId(instanceId);
+            }
+        }
+
+        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+        for (InstanceId instanceId : instanceIds)
+        {
+            m_instanceDeletionSet.erase(instanceId);
         }
-        ReleaseInstanceId(instanceId);
+        m_destroyTaskCount -= static_cast<int>(instanceIds.size());
     }
 
     bool InstanceSystemComponent::HasTasks() const
@@ -515,16 +634,75 @@ namespace Vegetation
         return !m_mainThreadTaskQueue.empty();
     }
 
-    void InstanceSystemComponent::AddTask(const Task& task)
+    void InstanceSystemComponent::AddCreateTasks(AZStd::span<const InstanceData> instances)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
+        if (instances.empty())
+        {
+            return;
+        }
+
+        const size_t maxBatchSize = static_cast<size_t>(AZStd::GetMax(m_configuration.m_maxInstanceTaskBatchSize, 1));
+
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
-        if (m_mainThreadTaskQueue.empty() || m_mainThreadTaskQueue.back().size() >= m_configuration.m_maxInstanceTaskBatchSize)
+
+        // Creations can't be added to an earlier batch once a destruction has been queued, or they could run out of order.
+        m_openDestroyBatch.reset();
+        for (const InstanceData& instanceData : instances)
         {
-            m_mainThreadTaskQueue.emplace_back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
+            if (!m_openCreateBatch || (m_openCreateBatch->size() >= maxBatchSize))
+            {
+                m_openCreateBatch = AZStd::make_shared<InstanceCreateBatch>();
+                m_openCreateBatch->reserve(maxBatchSize);
+                m_mainThreadTaskQueue.emplace_back().emplace_back([this, batch = m_openCreateBatch]()
+                {
+                    const int batchSize = static_cast<int>(batch->size());
+                    CreateInstanceNodes(*batch);
+                    m_createTaskCount -= batchSize;
+                });
+            }
+            m_openCreateBatch->push_back(instanceData);
+        }
+
+        m_createTaskCount += static_cast<int>(instances.size());
+    }
+
+    void InstanceSystemComponent::AddDestroyTasks(AZStd::span<const InstanceId> instanceIds)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        if (instanceIds.empty())
+        {
+            return;
+        }
+
+        // Mark the instances for deletion before queueing the tasks, so that any pending creations for them get skipped.
+        {
+            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+            m_instanceDeletionSet.insert(instanceIds.begin(), instanceIds.end());
+            m_destroyTaskCount += static_cast<int>(instanceIds.size());
+        }
+
+        const size_t maxBatchSize = static_cast<size_t>(AZStd::GetMax(m_configuration.m_maxInstanceTaskBatchSize, 1));
+
+        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+
+        // Destructions can't be added to an earlier batch once a creation has been queued, or they could run out of order.
+        m_openCreateBatch.reset();
+        for (InstanceId instanceId : instanceIds)
+        {
+            if (!m_openDestroyBatch || (m_openDestroyBatch->size() >= maxBatchSize))
+            {
+                m_openDestroyBatch = AZStd::make_shared<InstanceDestroyBatch>();
+                m_openDestroyBatch->reserve(maxBatchSize);
+                m_mainThreadTaskQueue.emplace_back().emplace_back([this, batch = m_openDestroyBatch]()
+                {
+                    ReleaseInstanceNodes(*batch);
+                });
+            }
+            m_openDestroyBatch->push_back(instanceId);
         }
-        m_mainThreadTaskQueue.back().emplace_back(task);
     }
 
     void InstanceSystemComponent::ClearTasks()
@@ -534,6 +712,8 @@ namespace Vegetation
         AZStd::lock_guard<decltype(m_mainThreadTaskInProgressMutex)> mainThreadTaskInProgressLock(m_mainThreadTaskInProgressMutex);
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
         m_mainThreadTaskQueue.clear();
+        m_openCreateBatch.reset();
+        m_openDestroyBatch.reset();
 
         m_createTaskCount = 0;
         m_destroyTaskCount = 0;
@@ -547,6 +727,12 @@ namespace Vegetation
         if (!m_mainThreadTaskQueue.empty())
         {
             removedTasks.splice(removedTasks.end(), m_mainThreadTaskQueue, m_mainThreadTaskQueue.begin());
+            if (m_mainThreadTaskQueue.empty())
+            {
+                // The open batches are always in the last task batch, which is about to run, so close them.
+                m_openCreateBatch.reset();
+                m_openDestroyBatch.reset();
+            }
             return true;
         }
         return false;
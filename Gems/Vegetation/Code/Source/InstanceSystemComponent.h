@@ -17,6 +17,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_fwd.h>
 
@@ -96,6 +97,8 @@ namespace Vegetation
 
         void CreateInstance(InstanceData& instanceData) override;
         void DestroyInstance(InstanceId instanceId) override;
+        void CreateInstances(AZStd::span<InstanceData> instanceData) override;
+        void DestroyInstances(AZStd::span<const InstanceId> instanceIds) override;
         void DestroyAllInstances() override;
         void Cleanup() override;
 
@@ -124,10 +127,14 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // vegetation instance management
-        bool IsInstanceSkippable(const InstanceData& instanceData) const;
-        void CreateInstanceNode(const InstanceData& instanceData);
+        bool PrepareInstanceCreation(InstanceData& instanceData);
 
-        void ReleaseInstanceNode(InstanceId instanceId);
+        //! Creates the instances for a batch on the main thread.  The batch is grouped by descriptor so that each
+        //! descriptor's spawner creates all of its instances with a single call.
+        void CreateInstanceNodes(AZStd::vector<InstanceData>& instances);
+
+        //! Destroys the instances for a batch on the main thread, grouped by descriptor the same way as CreateInstanceNodes.
+        void ReleaseInstanceNodes(const AZStd::vector<InstanceId>& instanceIds);
 
         mutable AZStd::recursive_mutex m_instanceMapMutex;
         AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
@@ -144,8 +151,17 @@ namespace Vegetation
         mutable AZStd::recursive_mutex m_mainThreadTaskMutex;
         mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
 
+        //! Consecutive instance creations and destructions get gathered into a single queued task each, holding up to
+        //! m_maxInstanceTaskBatchSize instances.  These point at the batch that's still open for more instances, if any.
+        //! The open batch is always in the last task batch of the queue, and is guarded by m_mainThreadTaskMutex.
+        using InstanceCreateBatch = AZStd::vector<InstanceData>;
+        using InstanceDestroyBatch = AZStd::vector<InstanceId>;
+        AZStd::shared_ptr<InstanceCreateBatch> m_openCreateBatch;
+        AZStd::shared_ptr<InstanceDestroyBatch> m_openDestroyBatch;
+
         bool HasTasks() const;
-        void AddTask(const Task& task);
+        void AddCreateTasks(AZStd::span<const InstanceData> instances);
+        void AddDestroyTasks(AZStd::span<const InstanceId> instanceIds);
         void ClearTasks();
         bool GetTasks(TaskList& removedTasks);
         void ExecuteTasks();
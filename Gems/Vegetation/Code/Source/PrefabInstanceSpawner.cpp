@@ -112,9 +112,10 @@ namespace Vegetation
         // the instance destroy.
         if (!m_instanceTickets.empty())
         {
+            AzFramework::SpawnableEntitiesDefinition& spawnableEntities = *AzFramework::SpawnableEntitiesInterface::Get();
             for (auto& ticket : m_instanceTickets)
             {
-                DespawnAssetInstance(ticket);
+                DespawnAssetInstance(spawnableEntities, ticket);
             }
         }
         ResetSpawnableAsset();
@@ -316,6 +317,26 @@ namespace Vegetation
     }
 
     InstancePtr PrefabInstanceSpawner::CreateInstance(const InstanceData& instanceData)
+    {
+        return SpawnAssetInstance(*AzFramework::SpawnableEntitiesInterface::Get(), instanceData);
+    }
+
+    void PrefabInstanceSpawner::CreateInstances(AZStd::span<const InstanceData> instances, AZStd::span<InstancePtr> outInstances)
+    {
+        AZ_Assert(instances.size() == outInstances.size(), "The instance data and output instance lists need to be the same size.");
+
+        // Grow the ticket set once for the whole batch instead of rehashing it repeatedly as tickets get added.
+        m_instanceTickets.reserve(m_instanceTickets.size() + instances.size());
+
+        AzFramework::SpawnableEntitiesDefinition& spawnableEntities = *AzFramework::SpawnableEntitiesInterface::Get();
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            outInstances[index] = SpawnAssetInstance(spawnableEntities, instances[index]);
+        }
+    }
+
+    InstancePtr PrefabInstanceSpawner::SpawnAssetInstance(
+        AzFramework::SpawnableEntitiesDefinition& spawnableEntities, const InstanceData& instanceData)
     {
         InstancePtr opaqueInstanceData = nullptr;
 
@@ -350,7 +371,7 @@ namespace Vegetation
 
             AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
             optionalArgs.m_preInsertionCallback = AZStd::move(preSpawnCB);
-            AzFramework::SpawnableEntitiesInterface::Get()->SpawnAllEntities(*ticket, AZStd::move(optionalArgs));
+            spawnableEntities.SpawnAllEntities(*ticket, AZStd::move(optionalArgs));
 
             opaqueInstanceData = ticket;
         }
@@ -364,15 +385,33 @@ namespace Vegetation
         return opaqueInstanceData;
     }
 
-    void PrefabInstanceSpawner::DespawnAssetInstance(AzFramework::EntitySpawnTicket* ticket)
+    void PrefabInstanceSpawner::DespawnAssetInstance(
+        AzFramework::SpawnableEntitiesDefinition& spawnableEntities, AzFramework::EntitySpawnTicket* ticket)
     {
         if (ticket->IsValid())
         {
-            AzFramework::SpawnableEntitiesInterface::Get()->DespawnAllEntities(*ticket);
+            spawnableEntities.DespawnAllEntities(*ticket);
         }
     }
 
     void PrefabInstanceSpawner::DestroyInstance([[maybe_unused]] InstanceId id, InstancePtr instance)
+    {
+        ReleaseAssetInstance(*AzFramework::SpawnableEntitiesInterface::Get(), instance);
+    }
+
+    void PrefabInstanceSpawner::DestroyInstances(
+        [[maybe_unused]] AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances)
+    {
+        AZ_Assert(ids.size() == instances.size(), "The instance id and instance lists need to be the same size.");
+
+        AzFramework::SpawnableEntitiesDefinition& spawnableEntities = *AzFramework::SpawnableEntitiesInterface::Get();
+        for (InstancePtr instance : instances)
+        {
+            ReleaseAssetInstance(spawnableEntities, instance);
+        }
+    }
+
+    void PrefabInstanceSpawner::ReleaseAssetInstance(AzFramework::SpawnableEntitiesDefinition& spawnableEntities, InstancePtr instance)
     {
         if (instance)
         {
@@ -386,7 +425,7 @@ namespace Vegetation
                 // The call to DespawnAssetInstance above is technically redundant right now, because when we delete the ticket pointer
                 // below it will automatically despawn everything anyways. However, it's nice to have a single explicit call to despawn,
                 // in case we ever need a place to add logging, or have a callback when despawning is complete, etc.
-                DespawnAssetInstance(ticket);
+                DespawnAssetInstance(spawnableEntities, ticket);
                 m_instanceTickets.erase(foundInstance);
             }
 
@@ -16,6 +16,7 @@
 
 #include <Vegetation/Ebuses/FilterRequestBus.h>
 #include <Vegetation/Ebuses/InstanceSystemRequestBus.h>
+#include <Vegetation/InstanceData.h>
 #include <Vegetation/InstanceSpawner.h>
 #include <Vegetation/EmptyInstanceSpawner.h>
 #include <Vegetation/PrefabInstanceSpawner.h>
@@ -35,6 +36,24 @@ namespace Vegetation
         }
     }
 
+    void InstanceSpawner::CreateInstances(AZStd::span<const InstanceData> instances, AZStd::span<InstancePtr> outInstances)
+    {
+        AZ_Assert(instances.size() == outInstances.size(), "The instance list and the output list need to be the same size.");
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            outInstances[index] = CreateInstance(instances[index]);
+        }
+    }
+
+    void InstanceSpawner::DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances)
+    {
+        AZ_Assert(ids.size() == instances.size(), "The id list and the instance list need to be the same size.");
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            DestroyInstance(ids[index], instances[index]);
+        }
+    }
+
     namespace Details
     {
         AzFramework::GenericAssetHandler<DescriptorListAsset>* s_vegetationDescriptorListAssetHandler = nullptr;
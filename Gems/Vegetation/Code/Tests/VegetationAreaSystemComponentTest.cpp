@@ -15,12 +15,16 @@
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Console/IConsole.h>
 
 //////////////////////////////////////////////////////////////////////////
 
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
+#include <VegetationMocks.h>
+
+AZ_CVAR_EXTERNED(uint32_t, veg_maxParallelSectorUpdates);
 
 namespace UnitTest
 {
@@ -152,5 +156,324 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
+
+    // Surface data mock that returns one flat surface point for every position in a queried region.
+    struct MockFlatSurfaceHandler
+        : public MockSurfaceHandler
+    {
+        void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointList& surfacePointListPerPosition) const override
+        {
+            // Sector points can get gathered from several jobs at once, so this only touches the output list and an atomic counter.
+            ++m_regionQueryCount;
+
+            const size_t numX = aznumeric_cast<size_t>(ceil(inRegion.GetXExtent() / stepSize.GetX()));
+            const size_t numY = aznumeric_cast<size_t>(ceil(inRegion.GetYExtent() / stepSize.GetY()));
+            AZStd::vector<AZ::Vector3> positions;
+            positions.reserve(numX * numY);
+            for (size_t y = 0; y < numY; ++y)
+            {
+                for (size_t x = 0; x < numX; ++x)
+                {
+                    positions.emplace_back(
+                        inRegion.GetMin().GetX() + (x * stepSize.GetX()), inRegion.GetMin().GetY() + (y * stepSize.GetY()), 0.0f);
+                }
+            }
+
+            surfacePointListPerPosition.Clear();
+            surfacePointListPerPosition.StartListConstruction(AZStd::span<const AZ::Vector3>(positions), 1, {});
+            for (const auto& position : positions)
+            {
+                surfacePointListPerPosition.AddSurfacePoint(
+                    AZ::EntityId(), position, position, AZ::Vector3::CreateAxisZ(), SurfaceData::SurfaceTagWeights());
+            }
+            surfacePointListPerPosition.EndListConstruction();
+        }
+
+        mutable AZStd::atomic_int m_regionQueryCount{ 0 };
+    };
+
+    // Test harness that runs the sector update logic of the vegetation thread directly, so that the results of each step can be
+    // checked.  This is a friend of the area system, so the private types and methods are wrapped here for the tests to use.
+    class VegetationSectorUpdateTests
+        : public VegetationTestApp
+    {
+    protected:
+        using SectorId = Vegetation::AreaSystemComponent::SectorId;
+        using SectorInfo = Vegetation::AreaSystemComponent::SectorInfo;
+        using ViewRect = Vegetation::AreaSystemComponent::ViewRect;
+        using SectorRollingWindow = Vegetation::AreaSystemComponent::SectorRollingWindow;
+        using PersistentThreadData = Vegetation::AreaSystemComponent::PersistentThreadData;
+        using VegetationThreadTasks = Vegetation::AreaSystemComponent::VegetationThreadTasks;
+        using UpdateContext = Vegetation::AreaSystemComponent::UpdateContext;
+        using UpdateMode = UpdateContext::UpdateMode;
+        using SectorUpdateRequest = UpdateContext::SectorUpdateRequest;
+
+        static constexpr int SectorSizeInMeters = 16;
+        static constexpr int SectorDensity = 4;
+
+    public:
+        void SetUp() override
+        {
+            VegetationTestApp::SetUp();
+
+            m_previousMaxParallelSectorUpdates = veg_maxParallelSectorUpdates;
+            m_surfaceHandler = AZStd::make_unique<MockFlatSurfaceHandler>();
+            m_threadData = AZStd::make_unique<PersistentThreadData>();
+            m_vegTasks = AZStd::make_unique<VegetationThreadTasks>();
+            m_updateContext = AZStd::make_unique<UpdateContext>();
+        }
+
+        void TearDown() override
+        {
+            m_vegTasks->ClearSectors();
+            m_updateContext.reset();
+            m_vegTasks.reset();
+            m_threadData.reset();
+            m_surfaceHandler.reset();
+            veg_maxParallelSectorUpdates = m_previousMaxParallelSectorUpdates;
+
+            VegetationTestApp::TearDown();
+        }
+
+    protected:
+        static ViewRect CreateViewRect(int x, int y, int width, int height)
+        {
+            const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(
+                AZ::Vector3(aznumeric_cast<float>(x * SectorSizeInMeters), aznumeric_cast<float>(y * SectorSizeInMeters), 0.0f),
+                AZ::Vector3(
+                    aznumeric_cast<float>((x + width) * SectorSizeInMeters), aznumeric_cast<float>((y + height) * SectorSizeInMeters), 0.0f));
+            return ViewRect(x, y, width, height, bounds);
+        }
+
+        // Sets the sector layout and view rectangle the same way the main thread passes them to the vegetation thread.
+        void SetViewRect(int x, int y, int width, int height)
+        {
+            auto& cachedMainThreadData = m_updateContext->m_cachedMainThreadData;
+            cachedMainThreadData.m_worldToSector = 1.0f / SectorSizeInMeters;
+            cachedMainThreadData.m_sectorSizeInMeters = SectorSizeInMeters;
+            cachedMainThreadData.m_sectorDensity = SectorDensity;
+            cachedMainThreadData.m_currViewRect = CreateViewRect(x, y, width, height);
+        }
+
+        // Clears the update work list and sizes its lookup grid for the current view rectangle, like UpdateSectorWorkLists() does.
+        void ClearUpdateWorkList()
+        {
+            const size_t numSectors = m_updateContext->m_cachedMainThreadData.m_currViewRect.GetNumSectors();
+            m_updateContext->m_viewRectSectorCount = numSectors;
+            m_updateContext->m_updateWorkList.clear();
+            m_updateContext->m_updateWorkListIndices.assign(numSectors, -1);
+        }
+
+        void MarkAllSurfacePointsDirty()
+        {
+            m_threadData->m_dirtySectorSurfacePoints.MarkAllDirty();
+        }
+
+        bool UpdateSectorWorkLists()
+        {
+            return m_updateContext->UpdateSectorWorkLists(m_threadData.get(), m_vegTasks.get());
+        }
+
+        // Processes sector deletes and updates until there's no work left.
+        void UpdateAllSectors()
+        {
+            while (m_updateContext->UpdateOneSector(m_threadData.get(), m_vegTasks.get()))
+            {
+            }
+        }
+
+        void RequestSectorUpdate(const SectorId& sectorId, UpdateMode mode, AZStd::chrono::steady_clock::time_point requestTime)
+        {
+            m_updateContext->RequestSectorUpdate(sectorId, mode, requestTime);
+        }
+
+        const AZStd::vector<SectorUpdateRequest>& GetUpdateWorkList() const
+        {
+            return m_updateContext->m_updateWorkList;
+        }
+
+        void PrepareSectorPoints()
+        {
+            m_updateContext->PrepareSectorPoints(m_vegTasks.get());
+        }
+
+        bool TakePreparedSector(const SectorId& sectorId, SectorInfo& sectorInfo)
+        {
+            return m_updateContext->TakePreparedSector(sectorId, sectorInfo);
+        }
+
+        size_t GetNumPreparedSectors() const
+        {
+            return m_updateContext->m_preparedSectors.size();
+        }
+
+        SectorInfo* GetSector(const SectorId& sectorId)
+        {
+            return m_vegTasks->GetSector(sectorId);
+        }
+
+        size_t GetNumSectors() const
+        {
+            return m_vegTasks->m_sectorRollingWindow.GetNumSectors();
+        }
+
+        // Creates a sector for the rolling window tests, which don't need any surface points.
+        static SectorInfo CreateSectorInfo(const SectorId& sectorId)
+        {
+            SectorInfo sectorInfo;
+            sectorInfo.m_id = sectorId;
+            return sectorInfo;
+        }
+
+        AZStd::unique_ptr<MockFlatSurfaceHandler> m_surfaceHandler;
+        AZStd::unique_ptr<PersistentThreadData> m_threadData;
+        AZStd::unique_ptr<VegetationThreadTasks> m_vegTasks;
+        AZStd::unique_ptr<UpdateContext> m_updateContext;
+        uint32_t m_previousMaxParallelSectorUpdates = 0;
+    };
+
+    TEST_F(VegetationSectorUpdateTests, SectorRollingWindow_KeepsSectorsWhenViewRectChanges)
+    {
+        SectorRollingWindow rollingWindow;
+        rollingWindow.SetViewRect(CreateViewRect(0, 0, 2, 2));
+        SectorInfo& insideSector = rollingWindow.AddSector(CreateSectorInfo(SectorId(1, 1)));
+        SectorInfo& outsideSector = rollingWindow.AddSector(CreateSectorInfo(SectorId(5, 5)));
+        EXPECT_EQ(rollingWindow.GetNumSectors(), 2u);
+
+        // Replacing a sector keeps it in the same place.
+        EXPECT_EQ(&rollingWindow.AddSector(CreateSectorInfo(SectorId(1, 1))), &insideSector);
+        EXPECT_EQ(rollingWindow.GetNumSectors(), 2u);
+
+        // Moving the view rectangle moves sectors between the grid and the overflow list without moving the sectors themselves.
+        rollingWindow.SetViewRect(CreateViewRect(4, 4, 2, 2));
+        EXPECT_EQ(rollingWindow.GetSector(SectorId(1, 1)), &insideSector);
+        EXPECT_EQ(rollingWindow.GetSector(SectorId(5, 5)), &outsideSector);
+        EXPECT_EQ(rollingWindow.GetSector(SectorId(4, 4)), nullptr);
+
+        size_t numEnumeratedSectors = 0;
+        rollingWindow.EnumerateSectors([&numEnumeratedSectors]([[maybe_unused]] const SectorInfo& sectorInfo) { ++numEnumeratedSectors; });
+        EXPECT_EQ(numEnumeratedSectors, 2u);
+
+        rollingWindow.RemoveSector(SectorId(1, 1));
+        EXPECT_EQ(rollingWindow.GetSector(SectorId(1, 1)), nullptr);
+        EXPECT_EQ(rollingWindow.GetNumSectors(), 1u);
+
+        rollingWindow.Clear();
+        EXPECT_EQ(rollingWindow.GetSector(SectorId(5, 5)), nullptr);
+        EXPECT_TRUE(rollingWindow.IsEmpty());
+    }
+
+    TEST_F(VegetationSectorUpdateTests, RequestSectorUpdate_MergesRequestsForTheSameSector)
+    {
+        SetViewRect(0, 0, 3, 3);
+        ClearUpdateWorkList();
+
+        const auto firstRequestTime = AZStd::chrono::steady_clock::now();
+        const auto laterRequestTime = firstRequestTime + AZStd::chrono::seconds(1);
+        RequestSectorUpdate(SectorId(1, 1), UpdateMode::Fill, firstRequestTime);
+        RequestSectorUpdate(SectorId(1, 1), UpdateMode::RebuildSurfaceCacheAndFill, laterRequestTime);
+        RequestSectorUpdate(SectorId(1, 1), UpdateMode::Fill, laterRequestTime);
+        RequestSectorUpdate(SectorId(2, 2), UpdateMode::Create, laterRequestTime);
+
+        // The more comprehensive update mode wins, and the original request time is kept.
+        const auto& updateWorkList = GetUpdateWorkList();
+        ASSERT_EQ(updateWorkList.size(), 2u);
+        EXPECT_EQ(updateWorkList[0].m_sectorId, SectorId(1, 1));
+        EXPECT_EQ(updateWorkList[0].m_mode, UpdateMode::RebuildSurfaceCacheAndFill);
+        EXPECT_TRUE(updateWorkList[0].m_requestTime == firstRequestTime);
+        EXPECT_EQ(updateWorkList[1].m_sectorId, SectorId(2, 2));
+        EXPECT_EQ(updateWorkList[1].m_mode, UpdateMode::Create);
+    }
+
+    TEST_F(VegetationSectorUpdateTests, PrepareSectorPoints_GathersClosestSectorsThatNeedPoints)
+    {
+        SetViewRect(0, 0, 3, 3);
+        ClearUpdateWorkList();
+
+        // The work list is sorted with the closest sector at the back.
+        const auto requestTime = AZStd::chrono::steady_clock::now();
+        RequestSectorUpdate(SectorId(0, 0), UpdateMode::Create, requestTime);
+        RequestSectorUpdate(SectorId(1, 0), UpdateMode::Create, requestTime);
+        RequestSectorUpdate(SectorId(2, 0), UpdateMode::Fill, requestTime);
+        RequestSectorUpdate(SectorId(1, 1), UpdateMode::Create, requestTime);
+
+        // A single sector at a time doesn't gain anything from jobs, so the points are left for the sector update to gather.
+        veg_maxParallelSectorUpdates = 1;
+        PrepareSectorPoints();
+        EXPECT_EQ(GetNumPreparedSectors(), 0u);
+
+        // The two closest sectors that aren't only getting refilled get their points gathered.
+        veg_maxParallelSectorUpdates = 2;
+        PrepareSectorPoints();
+        EXPECT_EQ(GetNumPreparedSectors(), 2u);
+        EXPECT_EQ(m_surfaceHandler->m_regionQueryCount.load(), 2);
+
+        // Nothing more is gathered while the closest sector still has prepared points waiting.
+        PrepareSectorPoints();
+        EXPECT_EQ(GetNumPreparedSectors(), 2u);
+        EXPECT_EQ(m_surfaceHandler->m_regionQueryCount.load(), 2);
+
+        SectorInfo sectorInfo;
+        EXPECT_FALSE(TakePreparedSector(SectorId(0, 0), sectorInfo));
+        EXPECT_FALSE(TakePreparedSector(SectorId(2, 0), sectorInfo));
+
+        ASSERT_TRUE(TakePreparedSector(SectorId(1, 1), sectorInfo));
+        EXPECT_EQ(sectorInfo.m_id, SectorId(1, 1));
+        EXPECT_EQ(sectorInfo.m_baseContext.m_availablePoints.size(), static_cast<size_t>(SectorDensity * SectorDensity));
+        EXPECT_FALSE(TakePreparedSector(SectorId(1, 1), sectorInfo));
+
+        EXPECT_TRUE(TakePreparedSector(SectorId(1, 0), sectorInfo));
+        EXPECT_EQ(GetNumPreparedSectors(), 0u);
+    }
+
+    TEST_F(VegetationSectorUpdateTests, SectorUpdates_FollowTheViewRect)
+    {
+        veg_maxParallelSectorUpdates = 3;
+
+        // Dirty surface points make every sector in view get created.
+        SetViewRect(0, 0, 3, 3);
+        MarkAllSurfacePointsDirty();
+        EXPECT_TRUE(UpdateSectorWorkLists());
+        UpdateAllSectors();
+
+        EXPECT_EQ(GetNumSectors(), 9u);
+        for (int y = 0; y < 3; ++y)
+        {
+            for (int x = 0; x < 3; ++x)
+            {
+                SectorInfo* sectorInfo = GetSector(SectorId(x, y));
+                ASSERT_NE(sectorInfo, nullptr);
+                EXPECT_EQ(sectorInfo->m_baseContext.m_availablePoints.size(), static_cast<size_t>(SectorDensity * SectorDensity));
+            }
+        }
+        // Points that were gathered ahead of time aren't gathered a second time.
+        EXPECT_EQ(m_surfaceHandler->m_regionQueryCount.load(), 9);
+        EXPECT_EQ(GetNumPreparedSectors(), 0u);
+
+        // Moving the view rectangle deletes the sectors that left it, creates the ones that entered it, and rebuilds the rest.
+        SectorInfo* movedSector = GetSector(SectorId(1, 1));
+        SetViewRect(1, 0, 3, 3);
+        MarkAllSurfacePointsDirty();
+        EXPECT_TRUE(UpdateSectorWorkLists());
+        UpdateAllSectors();
+
+        EXPECT_EQ(GetNumSectors(), 9u);
+        for (int y = 0; y < 3; ++y)
+        {
+            EXPECT_EQ(GetSector(SectorId(0, y)), nullptr);
+            for (int x = 1; x < 4; ++x)
+            {
+                EXPECT_NE(GetSector(SectorId(x, y)), nullptr);
+            }
+        }
+        EXPECT_EQ(GetSector(SectorId(1, 1)), movedSector);
+        EXPECT_EQ(m_surfaceHandler->m_regionQueryCount.load(), 18);
+
+        // Without any active areas or dirty sectors, all of the sectors get deleted.
+        EXPECT_TRUE(UpdateSectorWorkLists());
+        UpdateAllSectors();
+        EXPECT_EQ(GetNumSectors(), 0u);
+    }
 }
 
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Source/DebugSystemComponent.h>
+#include <Source/InstanceSystemComponent.h>
+#include <Vegetation/EmptyInstanceSpawner.h>
+#include <Vegetation/Ebuses/InstanceSystemRequestBus.h>
+
+namespace UnitTest
+{
+    class VegetationInstanceSystemBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        void internalSetUp()
+        {
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            m_app->Create({}, startupParameters);
+            m_app->RegisterComponentDescriptor(Vegetation::InstanceSystemComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(Vegetation::DebugSystemComponent::CreateDescriptor());
+
+            // The instance system offloads some of its main thread cleanup to a job.
+            AZ::JobManagerDesc jobDesc;
+            jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            // Give the instance system enough time per tick to process every queued task.
+            Vegetation::InstanceSystemConfig instanceSystemConfig;
+            instanceSystemConfig.m_maxInstanceProcessTimeMicroseconds = std::numeric_limits<int>::max();
+            m_instanceSystemEntity = AZStd::make_unique<AZ::Entity>();
+            m_instanceSystemEntity->CreateComponent<Vegetation::InstanceSystemComponent>(instanceSystemConfig);
+            m_instanceSystemEntity->CreateComponent<Vegetation::DebugSystemComponent>();
+            m_instanceSystemEntity->Init();
+            m_instanceSystemEntity->Activate();
+
+            Vegetation::Descriptor descriptor;
+            descriptor.SetInstanceSpawner(AZStd::make_shared<Vegetation::EmptyInstanceSpawner>());
+            Vegetation::InstanceSystemRequestBus::BroadcastResult(
+                m_descriptorPtr, &Vegetation::InstanceSystemRequestBus::Events::RegisterUniqueDescriptor, descriptor);
+        }
+
+        void internalTearDown()
+        {
+            Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyAllInstances);
+            Vegetation::InstanceSystemRequestBus::Broadcast(
+                &Vegetation::InstanceSystemRequestBus::Events::ReleaseUniqueDescriptor, m_descriptorPtr);
+            m_descriptorPtr.reset();
+
+            m_instanceSystemEntity.reset();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        // Creates instances of the benchmark descriptor, either one bus call at a time or in one batched call.
+        void CreateInstances(AZStd::vector<Vegetation::InstanceData>& instances, bool batched)
+        {
+            if (batched)
+            {
+                Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstances, instances);
+            }
+            else
+            {
+                for (auto& instance : instances)
+                {
+                    Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstance, instance);
+                }
+            }
+        }
+
+        // Destroys instances, either one bus call at a time or in one batched call.
+        void DestroyInstances(const AZStd::vector<Vegetation::InstanceId>& instanceIds, bool batched)
+        {
+            if (batched)
+            {
+                Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstances, instanceIds);
+            }
+            else
+            {
+                for (auto instanceId : instanceIds)
+                {
+                    Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstance, instanceId);
+                }
+            }
+        }
+
+        // Creates and destroys a full set of instances per iteration, including the main thread task processing for both.
+        void RunCreateAndDestroyBenchmark(benchmark::State& state, bool batched)
+        {
+            const size_t instanceCount = aznumeric_cast<size_t>(state.range(0));
+            AZStd::vector<Vegetation::InstanceData> instances(instanceCount);
+            AZStd::vector<Vegetation::InstanceId> instanceIds(instanceCount);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t index = 0; index < instanceCount; ++index)
+                {
+                    instances[index].m_descriptorPtr = m_descriptorPtr;
+                    instances[index].m_position = AZ::Vector3(aznumeric_cast<float>(index), 0.0f, 0.0f);
+                }
+
+                CreateInstances(instances, batched);
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+
+                for (size_t index = 0; index < instanceCount; ++index)
+                {
+                    instanceIds[index] = instances[index].m_instanceId;
+                }
+
+                DestroyInstances(instanceIds, batched);
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+    protected:
+        void SetUp([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+        void SetUp([[maybe_unused]] benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<AZ::Entity> m_instanceSystemEntity;
+        Vegetation::DescriptorPtr m_descriptorPtr;
+    };
+
+    BENCHMARK_DEFINE_F(VegetationInstanceSystemBenchmark, BM_CreateAndDestroyInstancesIndividually)(benchmark::State& state)
+    {
+        RunCreateAndDestroyBenchmark(state, false);
+    }
+
+    BENCHMARK_DEFINE_F(VegetationInstanceSystemBenchmark, BM_CreateAndDestroyInstancesBatched)(benchmark::State& state)
+    {
+        RunCreateAndDestroyBenchmark(state, true);
+    }
+
+    BENCHMARK_REGISTER_F(VegetationInstanceSystemBenchmark, BM_CreateAndDestroyInstancesIndividually)
+        ->Arg(1024)
+        ->Arg(16384)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(VegetationInstanceSystemBenchmark, BM_CreateAndDestroyInstancesBatched)
+        ->Arg(1024)
+        ->Arg(16384)
+        ->Unit(::benchmark::kMillisecond);
+}
+
+#endif
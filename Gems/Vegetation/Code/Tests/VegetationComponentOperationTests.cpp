@@ -21,6 +21,8 @@
 #include <Vegetation/EmptyInstanceSpawner.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 
 namespace UnitTest
 {
@@ -65,6 +67,44 @@ namespace UnitTest
         }
     };
 
+    // Records the size of every batch that the instance system hands to the spawner.
+    class BatchRecordingInstanceSpawner
+        : public Vegetation::EmptyInstanceSpawner
+    {
+    public:
+        AZ_RTTI(BatchRecordingInstanceSpawner, "{6F0A8E5C-3B1D-4C7E-9A52-8D4F1E2B7C90}", Vegetation::EmptyInstanceSpawner);
+        AZ_CLASS_ALLOCATOR(BatchRecordingInstanceSpawner, AZ::SystemAllocator);
+
+        explicit BatchRecordingInstanceSpawner(int id)
+            : m_id(id)
+        {
+        }
+
+        void CreateInstances(AZStd::span<const Vegetation::InstanceData> instances, AZStd::span<Vegetation::InstancePtr> outInstances) override
+        {
+            m_createBatchSizes.push_back(instances.size());
+            EmptyInstanceSpawner::CreateInstances(instances, outInstances);
+        }
+
+        void DestroyInstances(AZStd::span<const Vegetation::InstanceId> ids, AZStd::span<const Vegetation::InstancePtr> instances) override
+        {
+            m_destroyBatchSizes.push_back(ids.size());
+            EmptyInstanceSpawner::DestroyInstances(ids, instances);
+        }
+
+        AZStd::vector<size_t> m_createBatchSizes;
+        AZStd::vector<size_t> m_destroyBatchSizes;
+
+    private:
+        bool DataIsEquivalent(const Vegetation::InstanceSpawner& rhs) const override
+        {
+            const auto* otherSpawner = azrtti_cast<const BatchRecordingInstanceSpawner*>(&rhs);
+            return otherSpawner && (otherSpawner->m_id == m_id);
+        }
+
+        int m_id = 0;
+    };
+
     struct VegetationComponentOperationTests
         : public VegetationComponentTests
     {
@@ -395,6 +435,115 @@ namespace UnitTest
         mockDescriptorProviderBus.BusDisconnect();
     }
 
+    TEST_F(VegetationComponentOperationTests, InstanceSystemComponent_BatchedInstances)
+    {
+        //the instance system offloads some of its main thread cleanup to a job, so it needs a job context to process tasks
+        AZ::JobManagerDesc jobDesc;
+        jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+        AZ::JobManager jobManager(jobDesc);
+        AZ::JobContext jobContext(jobManager);
+        AZ::JobContext::SetGlobalContext(&jobContext);
+
+        //need dummy system component to track instance and task stats, with enough time per tick to process every task
+        Vegetation::InstanceSystemConfig instanceSystemConfig;
+        instanceSystemConfig.m_maxInstanceProcessTimeMicroseconds = 1000000;
+        Vegetation::InstanceSystemComponent* instanceSystemComponent = nullptr;
+        auto instanceSystemEntity = CreateEntity(instanceSystemConfig, &instanceSystemComponent, [](AZ::Entity* e)
+        {
+            e->CreateComponent<Vegetation::DebugSystemComponent>();
+        });
+
+        //use two different spawners so that the batch contains more than one descriptor run
+        AZStd::vector<AZStd::shared_ptr<BatchRecordingInstanceSpawner>> spawners;
+        AZStd::vector<Vegetation::DescriptorPtr> descriptors;
+        for (int spawnerId = 0; spawnerId < 2; ++spawnerId)
+        {
+            spawners.emplace_back(AZStd::make_shared<BatchRecordingInstanceSpawner>(spawnerId));
+
+            Vegetation::Descriptor descriptor;
+            descriptor.SetInstanceSpawner(spawners.back());
+            Vegetation::DescriptorPtr descriptorPtr;
+            Vegetation::InstanceSystemRequestBus::BroadcastResult(descriptorPtr, &Vegetation::InstanceSystemRequestBus::Events::RegisterUniqueDescriptor, descriptor);
+            descriptors.push_back(descriptorPtr);
+        }
+        ASSERT_NE(descriptors[0], descriptors[1]);
+
+        //create a batch of 64 instances in alternating runs of 16 per descriptor, with an unregistered descriptor in the middle
+        AZStd::vector<Vegetation::InstanceData> instances(64);
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            instances[index].m_descriptorPtr = descriptors[(index / 16) % 2];
+        }
+        instances[40].m_descriptorPtr.reset();
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstances, instances);
+
+        AZStd::vector<Vegetation::InstanceId> instanceIds;
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            if (index == 40)
+            {
+                EXPECT_EQ(instances[index].m_instanceId, Vegetation::InvalidInstanceId);
+            }
+            else
+            {
+                EXPECT_NE(instances[index].m_instanceId, Vegetation::InvalidInstanceId);
+            }
+            instanceIds.push_back(instances[index].m_instanceId);
+        }
+
+        AZ::u32 createTaskCount = 0;
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(createTaskCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetCreateTaskCount);
+        EXPECT_EQ(createTaskCount, 63);
+
+        //run the main thread tasks, which should hand each spawner all of its instances in a single grouped call
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+
+        AZ::u32 totalTaskCount = 0;
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(totalTaskCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetTotalTaskCount);
+        EXPECT_EQ(totalTaskCount, 0);
+
+        AZ::u32 instanceCount = 0;
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(instanceCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetInstanceCount);
+        EXPECT_EQ(instanceCount, 63);
+
+        EXPECT_EQ(spawners[0]->m_createBatchSizes, AZStd::vector<size_t>({ 31 }));
+        EXPECT_EQ(spawners[1]->m_createBatchSizes, AZStd::vector<size_t>({ 32 }));
+
+        //destroy the first half of the instances, which covers the first run of each descriptor
+        Vegetation::InstanceSystemRequestBus::Broadcast(
+            &Vegetation::InstanceSystemRequestBus::Events::DestroyInstances, AZStd::span<const Vegetation::InstanceId>(instanceIds.data(), 32));
+
+        AZ::u32 destroyTaskCount = 0;
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(destroyTaskCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetDestroyTaskCount);
+        EXPECT_EQ(destroyTaskCount, 32);
+
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(destroyTaskCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetDestroyTaskCount);
+        EXPECT_EQ(destroyTaskCount, 0);
+
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(instanceCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetInstanceCount);
+        EXPECT_EQ(instanceCount, 31);
+
+        EXPECT_EQ(spawners[0]->m_destroyBatchSizes, AZStd::vector<size_t>({ 16 }));
+        EXPECT_EQ(spawners[1]->m_destroyBatchSizes, AZStd::vector<size_t>({ 16 }));
+
+        //destroy all instances and queued tasks
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyAllInstances);
+
+        Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(instanceCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetInstanceCount);
+        EXPECT_EQ(instanceCount, 0);
+
+        for (auto& descriptorPtr : descriptors)
+        {
+            Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::ReleaseUniqueDescriptor, descriptorPtr);
+        }
+        descriptors.clear();
+
+        instanceSystemEntity.reset();
+        AZ::JobContext::SetGlobalContext(nullptr);
+    }
+
     TEST_F(VegetationComponentOperationTests, AreaBlenderComponent)
     {
         auto entityBlocker = CreateEntity<Vegetation::BlockerComponent>(Vegetation::BlockerConfig(), nullptr, [](AZ::Entity* e)
@@ -152,6 +152,16 @@ namespace UnitTest
 
         void DestroyAllInstances() override {}
 
+        void CreateInstances(AZStd::span<Vegetation::InstanceData> instanceData) override
+        {
+            for (auto& instance : instanceData)
+            {
+                CreateInstance(instance);
+            }
+        }
+
+        void DestroyInstances([[maybe_unused]] AZStd::span<const Vegetation::InstanceId> instanceIds) override {}
+
         void Cleanup() override {}
     };
 